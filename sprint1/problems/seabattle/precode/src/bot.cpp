@@ -0,0 +1,304 @@
+#ifdef WIN32
+#include <sdkddkver.h>
+#endif
+
+#include "run_workers.h"
+#include "seabattle_agent.h"
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/write.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Нагрузочный клиент сервера морского боя. Каждый бот подключается к лобби, играет партию
+ * случайными выстрелами по неизвестным клеткам и переподключается, пока не сыграно нужное число партий.
+ * Тогда, или если партии перестали завершаться, сокеты всех ботов закрываются, и клиент выходит.
+ */
+
+namespace net = boost::asio;
+using net::ip::tcp;
+namespace sys = boost::system;
+using namespace std::literals;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Если за это время не завершилась ни одна партия, боты останавливаются
+constexpr auto PROGRESS_TIMEOUT = 10s;
+
+struct BotStats {
+    // Сколько партий должно быть сыграно, каждую считают оба её бота
+    size_t games_target = 0;
+    std::atomic<size_t> games = 0;
+    std::atomic<size_t> wins = 0;
+    std::atomic<size_t> errors = 0;
+    std::atomic<size_t> moves = 0;
+    // Время от отправки хода до получения результата
+    std::atomic<int64_t> move_latency_ns = 0;
+    std::atomic<int64_t> max_move_latency_ns = 0;
+};
+
+class Bot;
+
+// Все боты клиента. После Stop боты не переподключаются, а их сокеты закрываются,
+// так что незаконченные партии и ожидание в лобби не держат ioc.run()
+class Fleet {
+public:
+    explicit Fleet(net::io_context& ioc)
+        : progress_timer_(net::make_strand(ioc)) {
+    }
+
+    void Add(std::shared_ptr<Bot> bot) {
+        bots_.push_back(std::move(bot));
+    }
+
+    bool IsStopping() const {
+        return stopping_;
+    }
+
+    void Run(const BotStats& stats);
+    void Stop();
+
+private:
+    void WaitProgress(const BotStats& stats, size_t games);
+
+    // Заполняется до запуска ioc и дальше не меняется
+    std::vector<std::shared_ptr<Bot>> bots_;
+    std::atomic<bool> stopping_ = false;
+    net::steady_timer progress_timer_;
+};
+
+class Bot : public std::enable_shared_from_this<Bot> {
+public:
+    Bot(net::io_context& ioc, tcp::endpoint endpoint, unsigned seed, BotStats& stats, Fleet& fleet)
+        : socket_(net::make_strand(ioc))
+        , endpoint_(endpoint)
+        , engine_(seed)
+        , stats_(stats)
+        , fleet_(fleet) {
+    }
+
+    void Run() {
+        if (fleet_.IsStopping()) {
+            return;
+        }
+        agent_.emplace(SeabattleField::GetRandomField(engine_));
+        socket_.async_connect(endpoint_, [self = shared_from_this()](sys::error_code ec) {
+            if (ec) {
+                return self->Fail(ec);
+            }
+            self->socket_.set_option(tcp::no_delay(true), ec);
+            net::async_read(self->socket_, net::buffer(self->in_, 1), [self](sys::error_code ec, size_t) {
+                if (ec) {
+                    return self->Fail(ec);
+                }
+                self->in_[0] ? self->MyTurn() : self->OtherTurn();
+            });
+        });
+    }
+
+    void Close() {
+        net::post(socket_.get_executor(), [self = shared_from_this()] {
+            sys::error_code ignored;
+            self->socket_.shutdown(tcp::socket::shutdown_both, ignored);
+            self->socket_.close(ignored);
+        });
+    }
+
+private:
+    void MyTurn() {
+        if (agent_->IsGameEnded()) {
+            return FinishGame();
+        }
+        move_ = agent_->ChooseRandomMove(engine_);
+        out_ = SeabattleAgent::MoveToString(move_);
+        shot_at_ = Clock::now();
+        net::async_write(socket_, net::buffer(out_), [self = shared_from_this()](sys::error_code ec, size_t) {
+            if (ec) {
+                return self->Fail(ec);
+            }
+            net::async_read(self->socket_, net::buffer(self->in_, 1), [self](sys::error_code ec, size_t) {
+                self->OnResult(ec);
+            });
+        });
+    }
+
+    void OnResult(sys::error_code ec) {
+        if (ec) {
+            return Fail(ec);
+        }
+        const auto result = SeabattleAgent::ParseShotResult(in_[0]);
+        if (!result) {
+            return Fail(net::error::invalid_argument);
+        }
+        RecordLatency(Clock::now() - shot_at_);
+        agent_->ApplyMyShot(move_, *result);
+        *result == SeabattleField::ShotResult::MISS ? OtherTurn() : MyTurn();
+    }
+
+    void OtherTurn() {
+        if (agent_->IsGameEnded()) {
+            return FinishGame();
+        }
+        net::async_read(socket_, net::buffer(in_, 2), [self = shared_from_this()](sys::error_code ec, size_t) {
+            if (ec) {
+                return self->Fail(ec);
+            }
+            const auto move = SeabattleAgent::ParseMove({self->in_.data(), 2});
+            if (!move) {
+                return self->Fail(net::error::invalid_argument);
+            }
+            const auto result = self->agent_->ApplyOtherShot(*move);
+            self->out_.assign(1, static_cast<char>(result));
+            net::async_write(self->socket_, net::buffer(self->out_), [self, result](sys::error_code ec, size_t) {
+                if (ec) {
+                    return self->Fail(ec);
+                }
+                result == SeabattleField::ShotResult::MISS ? self->MyTurn() : self->OtherTurn();
+            });
+        });
+    }
+
+    void RecordLatency(Clock::duration latency) {
+        const int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count();
+        ++stats_.moves;
+        stats_.move_latency_ns += ns;
+        int64_t max = stats_.max_move_latency_ns;
+        while (ns > max && !stats_.max_move_latency_ns.compare_exchange_weak(max, ns)) {
+        }
+    }
+
+    void FinishGame() {
+        if (agent_->IsWinner()) {
+            ++stats_.wins;
+        }
+        if (++stats_.games >= stats_.games_target) {
+            return fleet_.Stop();
+        }
+        Reconnect();
+    }
+
+    void Fail(sys::error_code ec) {
+        // Сокет закрыт остановкой, это не ошибка
+        if (fleet_.IsStopping()) {
+            return;
+        }
+        if (stats_.errors++ == 0) {
+            std::cerr << "Bot error: "sv << ec.message() << std::endl;
+        }
+        Reconnect();
+    }
+
+    void Reconnect() {
+        sys::error_code ignored;
+        socket_.shutdown(tcp::socket::shutdown_both, ignored);
+        socket_.close(ignored);
+        Run();
+    }
+
+    tcp::socket socket_;
+    tcp::endpoint endpoint_;
+    std::mt19937 engine_;
+    BotStats& stats_;
+    Fleet& fleet_;
+    std::optional<SeabattleAgent> agent_;
+    SeabattleMove move_;
+    std::array<char, 2> in_{};
+    std::string out_;
+    Clock::time_point shot_at_;
+};
+
+void Fleet::Run(const BotStats& stats) {
+    for (const auto& bot : bots_) {
+        bot->Run();
+    }
+    WaitProgress(stats, 0);
+}
+
+void Fleet::Stop() {
+    if (stopping_.exchange(true)) {
+        return;
+    }
+    for (const auto& bot : bots_) {
+        bot->Close();
+    }
+    net::post(progress_timer_.get_executor(), [this] {
+        progress_timer_.cancel();
+    });
+}
+
+void Fleet::WaitProgress(const BotStats& stats, size_t games) {
+    progress_timer_.expires_after(PROGRESS_TIMEOUT);
+    progress_timer_.async_wait([this, &stats, games](sys::error_code ec) {
+        if (ec || stopping_) {
+            return;
+        }
+        const size_t finished = stats.games;
+        if (finished == games) {
+            std::cerr << "No games finished for "sv << PROGRESS_TIMEOUT.count() << " s, stopping"sv << std::endl;
+            return Stop();
+        }
+        WaitProgress(stats, finished);
+    });
+}
+
+}  // namespace
+
+int main(int argc, const char** argv) {
+    if (argc < 5 || argc > 6) {
+        std::cout << "Usage: seabattle_bot <ip> <port> <bots> <games> [<threads>]" << std::endl;
+        return 1;
+    }
+
+    sys::error_code ec;
+    const auto address = net::ip::make_address(argv[1], ec);
+    if (ec) {
+        std::cout << "Wrong IP format"sv << std::endl;
+        return 1;
+    }
+    const tcp::endpoint endpoint{address, static_cast<unsigned short>(std::stoi(argv[2]))};
+    const int bots = std::stoi(argv[3]);
+    const long games = std::stol(argv[4]);
+    const unsigned num_threads = argc == 6 ? std::stoi(argv[5]) : std::thread::hardware_concurrency();
+
+    net::io_context ioc(num_threads);
+    BotStats stats;
+    // Каждую партию считают оба её бота
+    stats.games_target = static_cast<size_t>(games) * 2;
+
+    Fleet fleet{ioc};
+    for (int i = 0; i < bots; ++i) {
+        fleet.Add(std::make_shared<Bot>(ioc, endpoint, static_cast<unsigned>(i), stats, fleet));
+    }
+
+    const auto start = Clock::now();
+    fleet.Run(stats);
+    RunWorkers(num_threads, [&ioc] {
+        ioc.run();
+    });
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+
+    const size_t moves = std::max<size_t>(stats.moves, 1);
+    std::cout << "Games: "sv << stats.games / 2 << " in "sv << elapsed.count() << " s, "sv
+              << stats.games / 2 / elapsed.count() << " games/s"sv << std::endl;
+    std::cout << "Moves: "sv << stats.moves << ", "sv << stats.moves / elapsed.count() << " moves/s, latency avg "sv
+              << stats.move_latency_ns / moves / 1000 << " us, max "sv << stats.max_move_latency_ns / 1000 << " us"sv
+              << std::endl;
+    std::cout << "Errors: "sv << stats.errors << std::endl;
+}
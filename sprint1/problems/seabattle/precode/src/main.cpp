@@ -2,7 +2,7 @@
 #include <sdkddkver.h>
 #endif
 
-#include "seabattle.h"
+#include "seabattle_agent.h"
 
 #include <atomic>
 #include <boost/asio.hpp>
@@ -61,10 +61,11 @@ static bool WriteExact(tcp::socket& socket, std::string_view data) {
     return !ec;
 }
 
-class SeabattleAgent {
+// Консольная игра по сети: ходы вводятся с клавиатуры, сокет блокирующий
+class ConsolePlayer {
 public:
-    SeabattleAgent(const SeabattleField& field)
-        : my_field_(field) {
+    ConsolePlayer(const SeabattleField& field)
+        : agent_(field) {
     }
 
     void StartGame(tcp::socket& socket, bool my_initiative) {
@@ -86,28 +87,12 @@ public:
     }
 
 private:
-    static std::optional<std::pair<int, int>> ParseMove(const std::string_view& sv) {
-        if (sv.size() != 2) return std::nullopt;
-
-        int p1 = sv[0] - 'A', p2 = sv[1] - '1';
-
-        if (p1 < 0 || p1 > 8) return std::nullopt;
-        if (p2 < 0 || p2 > 8) return std::nullopt;
-
-        return {{p1, p2}};
-    }
-
-    static std::string MoveToString(std::pair<int, int> move) {
-        char buff[] = {static_cast<char>(static_cast<char>(static_cast<char>(move.first) + 'A')), static_cast<char>(static_cast<char>(static_cast<char>(move.second) + '1'))};
-        return {buff, 2};
-    }
-
     void PrintFields() const {
-        PrintFieldPair(my_field_, other_field_);
+        PrintFieldPair(agent_.GetMyField(), agent_.GetOtherField());
     }
 
     bool IsGameEnded() const {
-        return my_field_.IsLoser() || other_field_.IsLoser();
+        return agent_.IsGameEnded();
     }
 
     void MyTurn(tcp::socket& socket) {
@@ -116,12 +101,12 @@ private:
         std::cout << "Your turn: ";
         std::string turn;
         std::cin >> turn;
-        auto myMove = ParseMove(turn);
+        auto myMove = SeabattleAgent::ParseMove(turn);
         while (!myMove) {
             std::cout << "Wrong format! Pass 1 digit and 1 number! Try again: ";
             turn.clear();
             std::cin >> turn;
-            myMove = ParseMove(turn);
+            myMove = SeabattleAgent::ParseMove(turn);
         }
         
         if (!WriteExact(socket, turn)) {
@@ -137,7 +122,7 @@ private:
         }
 
         if (IsMyShotSuccessfull(std::move(result), std::move(myMove))) {
-            if (other_field_.IsLoser()) {
+            if (agent_.IsWinner()) {
                 std::cout << "Congratulation! You won the seabattle!" << std::endl;
             } else {
                 std::cout << "Congratulation, continue!" << std::endl;
@@ -158,7 +143,7 @@ private:
         }
         std::cout << "Shot to " << otherShot.value() << std::endl;
 
-        auto otherMove = ParseMove(otherShot.value());
+        auto otherMove = SeabattleAgent::ParseMove(otherShot.value());
         SeabattleField::ShotResult otherShotResult;
         bool isOtherSuccess = IsOtherShotSuccessfull(std::move(otherMove), otherShotResult);
         
@@ -167,7 +152,7 @@ private:
         WriteExact(socket, strToSend);
 
         if (isOtherSuccess) {
-            if (my_field_.IsLoser()) {
+            if (agent_.GetMyField().IsLoser()) {
                 std::cout << "You've lost the seabattle..." << std::endl;
             } else {
                 OtherTurn(socket);
@@ -176,44 +161,36 @@ private:
     }
 
 private:
-    bool IsMyShotSuccessfull(std::optional<std::string>&& result, std::optional<std::pair<int, int>>&& move) {
-        bool ret = false;
-
-        if (result) {
-            char shotRes = result.value()[0];
-            
-            switch (shotRes) {
-                case static_cast<char>(SeabattleField::ShotResult::HIT): {
-                    other_field_.MarkHit(move.value().second, move.value().first);
-                    ret = true;
-                    std::cout << "You Hit (:" << std::endl;
-                    break;
-                }
-                
-                case static_cast<char>(SeabattleField::ShotResult::KILL): {
-                    other_field_.MarkKill(move.value().second, move.value().first);
-                    ret = true;
-                    std::cout << "You Killed! (:" << std::endl;
-                    break;
-                }
-
-                case static_cast<char>(SeabattleField::ShotResult::MISS): {
-                    other_field_.MarkMiss(move.value().second, move.value().first);
-                    std::cout << "You Missed :(" << std::endl;
-                    break;
-                }
+    bool IsMyShotSuccessfull(std::optional<std::string>&& result, std::optional<SeabattleMove>&& move) {
+        if (!result) {
+            return false;
+        }
+        auto shotRes = SeabattleAgent::ParseShotResult(result.value()[0]);
+        if (!shotRes) {
+            return false;
+        }
 
-                default: break;
-            }
+        agent_.ApplyMyShot(move.value(), *shotRes);
+
+        switch (*shotRes) {
+            case SeabattleField::ShotResult::HIT:
+                std::cout << "You Hit (:" << std::endl;
+                return true;
+            case SeabattleField::ShotResult::KILL:
+                std::cout << "You Killed! (:" << std::endl;
+                return true;
+            case SeabattleField::ShotResult::MISS:
+                std::cout << "You Missed :(" << std::endl;
+                return false;
         }
 
-        return ret;
+        return false;
     }
 
-    bool IsOtherShotSuccessfull(std::optional<std::pair<int, int>>&& otherMove, SeabattleField::ShotResult& otherShotResult) {
+    bool IsOtherShotSuccessfull(std::optional<SeabattleMove>&& otherMove, SeabattleField::ShotResult& otherShotResult) {
         bool ret = false;
 
-        auto shotRes = my_field_.Shoot(otherMove.value().second, otherMove.value().first);
+        auto shotRes = agent_.ApplyOtherShot(otherMove.value());
 
         switch (shotRes) {
             case SeabattleField::ShotResult::HIT: {
@@ -241,12 +218,11 @@ private:
         return ret;
     }
 
-    SeabattleField my_field_;
-    SeabattleField other_field_;
+    SeabattleAgent agent_;
 };
 
 void StartServer(const SeabattleField& field, unsigned short port) {
-    SeabattleAgent agent(field);
+    ConsolePlayer agent(field);
 
     net::io_context io_context;
 
@@ -268,7 +244,7 @@ void StartServer(const SeabattleField& field, unsigned short port) {
 };
 
 void StartClient(const SeabattleField& field, const std::string& ip_str, unsigned short port) {
-    SeabattleAgent agent(field);
+    ConsolePlayer agent(field);
 
     boost::system::error_code ec;
     auto endpoint = tcp::endpoint(net::ip::make_address(ip_str, ec), port);
@@ -1,10 +1,76 @@
 #pragma once
 #include <array>
 #include <cassert>
+#include <cstdint>
 #include <optional>
 #include <iostream>
 #include <random>
-#include <set>
+
+namespace seabattle_detail {
+
+// Поле 8x8 хранится в битах uint64_t: клетка (x, y) - бит x + y * 8
+using Bitboard = uint64_t;
+
+inline constexpr Bitboard FIRST_COLUMN = 0x0101010101010101ULL;
+inline constexpr Bitboard LAST_COLUMN = FIRST_COLUMN << 7;
+
+constexpr Bitboard ShiftRight(Bitboard b) {
+    return (b << 1) & ~FIRST_COLUMN;
+}
+
+constexpr Bitboard ShiftLeft(Bitboard b) {
+    return (b >> 1) & ~LAST_COLUMN;
+}
+
+constexpr Bitboard ShiftDown(Bitboard b) {
+    return b << 8;
+}
+
+constexpr Bitboard ShiftUp(Bitboard b) {
+    return b >> 8;
+}
+
+// Клетки и все их соседи, включая диагональных
+constexpr Bitboard Dilate(Bitboard b) {
+    const Bitboard row = b | ShiftRight(b) | ShiftLeft(b);
+    return row | ShiftDown(row) | ShiftUp(row);
+}
+
+inline constexpr size_t MAX_SHIP_LENGTH = 4;
+// Горизонтальные и вертикальные положения корабля длиной не меньше 2, однопалубный - в любой из 64 клеток
+inline constexpr size_t MAX_PLACEMENTS = 2 * 8 * 7;
+
+struct Placements {
+    std::array<std::array<Bitboard, MAX_PLACEMENTS>, MAX_SHIP_LENGTH + 1> masks{};
+    std::array<size_t, MAX_SHIP_LENGTH + 1> counts{};
+};
+
+// Все положения кораблей каждой длины в виде масок
+constexpr Placements MakePlacements() {
+    Placements result;
+    for (size_t length = 1; length <= MAX_SHIP_LENGTH; ++length) {
+        size_t& count = result.counts[length];
+        for (size_t y = 0; y < 8; ++y) {
+            for (size_t x = 0; x + length <= 8; ++x) {
+                Bitboard horizontal = 0;
+                Bitboard vertical = 0;
+                for (size_t i = 0; i < length; ++i) {
+                    horizontal |= Bitboard{1} << (x + i + y * 8);
+                    vertical |= Bitboard{1} << (y + (x + i) * 8);
+                }
+                result.masks[length][count++] = horizontal;
+                if (length > 1) {
+                    result.masks[length][count++] = vertical;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+inline constexpr Placements PLACEMENTS = MakePlacements();
+
+}  // namespace seabattle_detail
 
 class SeabattleField {
 public:
@@ -15,10 +81,24 @@ public:
         SHIP
     };
 
+    using Bitboard = seabattle_detail::Bitboard;
+
     static const size_t field_size = 8;
 
     SeabattleField(State default_elem = State::UNKNOWN) {
-        field_.fill(default_elem);
+        switch (default_elem) {
+            case State::SHIP:
+                ship_ = ~Bitboard{0};
+                break;
+            case State::KILLED:
+                hit_ = ~Bitboard{0};
+                break;
+            case State::EMPTY:
+                miss_ = ~Bitboard{0};
+                break;
+            case State::UNKNOWN:
+                break;
+        }
     }
 
     template <class T>
@@ -32,122 +112,93 @@ public:
     }
 
 private:
+    // Каждый корабль ставится в случайное из положений, не задевающих уже поставленные корабли и их соседей.
+    // Сначала положение несколько раз выбирается среди всех подряд: пока поле свободно, это почти всегда
+    // удаётся с первой попытки. Если не удалось, свободные положения перебираются. В обоих случаях выбор
+    // равновероятен среди свободных положений. Если для очередного корабля места не осталось, поле строится заново
     template<class T>
     static std::optional<SeabattleField> TryGetRandomField(T&& random_engine) {
-        SeabattleField result{State::EMPTY};
+        using namespace seabattle_detail;
 
-        std::set<std::pair<size_t, size_t>> availableElements;
-        std::vector ship_sizes = {4, 3, 3, 2, 2, 2, 1, 1, 1, 1};
+        static constexpr std::array<size_t, 10> ship_sizes = {4, 3, 3, 2, 2, 2, 1, 1, 1, 1};
+        static constexpr int max_attempts = 8;
 
-        const auto mark_cell_as_used = [&](size_t x, size_t y) {
-            for (int dy = -1; dy <= 1; ++dy) {
-                for (int dx = -1; dx <= 1; ++dx) {
-                    availableElements.erase({x + dx, y + dy});
-                }
-            }
-        };
+        using Distr = std::uniform_int_distribution<size_t>;
+        using Param = Distr::param_type;
+        Distr d;
 
-        const auto dir_to_dxdy = [](size_t dir) -> std::pair<int, int> {
-            int dx = dir == 1 ? 1 : dir == 3 ? -1 : 0;
-            int dy = dir == 0 ? 1 : dir == 2 ? -1 : 0;
+        Bitboard ships = 0;
+        Bitboard blocked = 0;
 
-            return {dx, dy};
+        const auto place = [&](Bitboard ship) {
+            ships |= ship;
+            blocked |= Dilate(ship);
         };
 
-        const auto check_ship_available = [&](size_t x, size_t y, size_t dir, int ship_length) {
-            auto [dx, dy] = dir_to_dxdy(dir);
-
-            for (int i = 0; i < ship_length; ++i) {
-                size_t cx = x + dx * i;
-                size_t cy = y + dy * i;
+        for (size_t length : ship_sizes) {
+            const auto& masks = PLACEMENTS.masks[length];
+            const size_t total = PLACEMENTS.counts[length];
 
-                if (cx >= field_size || cy >= field_size) {
-                    return false;
-                }
-                if (availableElements.count({cx, cy}) == 0) {
-                    return false;
+            bool placed = false;
+            for (int attempt = 0; attempt < max_attempts && !placed; ++attempt) {
+                const Bitboard ship = masks[d(random_engine, Param(0, total - 1))];
+                if ((ship & blocked) == 0) {
+                    place(ship);
+                    placed = true;
                 }
             }
-
-            return true;
-        };
-
-        const auto mark_ship = [&](size_t x, size_t y, size_t dir, int ship_length){
-            auto [dx, dy] = dir_to_dxdy(dir);
-
-            for (int i = 0; i < ship_length; ++i) {
-                size_t cx = x + dx * i;
-                size_t cy = y + dy * i;
-
-                result.Get(cx, cy) = State::SHIP;
-                mark_cell_as_used(cx, cy);
+            if (placed) {
+                continue;
             }
-        };
 
-        for (size_t y = 0; y < field_size; ++y) {
-            for (size_t x = 0; x < field_size; ++x) {
-                availableElements.insert({x, y});
+            std::array<Bitboard, MAX_PLACEMENTS> available;
+            size_t count = 0;
+            for (size_t i = 0; i < total; ++i) {
+                available[count] = masks[i];
+                count += (masks[i] & blocked) == 0;
             }
+            if (count == 0) {
+                return std::nullopt;
+            }
+            place(available[d(random_engine, Param(0, count - 1))]);
         }
 
-        using Distr = std::uniform_int_distribution<size_t>;
-        using Param = Distr::param_type;
-
-        static const int max_attempts = 100;
-
-        for (int length : ship_sizes) {
-            std::pair<size_t, size_t> pos;
-            size_t direction;
-            int attempt = 0;
-
-            Distr d;
-            do {
-                if (attempt++ >= max_attempts || availableElements.empty()) {
-                    return std::nullopt;
-                }
-
-                size_t pos_index = d(random_engine, Param(0, availableElements.size() - 1));
-                direction = d(random_engine, Param(0, 3));
-                pos = *std::next(availableElements.begin(), pos_index);
-            } while (!check_ship_available(pos.first, pos.second, direction, length));
-            mark_ship(pos.first, pos.second, direction, length);
-        }
-
+        SeabattleField result{State::EMPTY};
+        result.ship_ = ships;
+        result.miss_ = ~ships;
         return result;
     }
 
-    bool IsKilledInDirection(size_t x, size_t y, int dx, int dy) const {
-        for (; x < field_size && y < field_size; x += dx, y += dy) {
-            if (Get(x, y) == State::EMPTY) {
-                return true;
-            }
-            if (Get(x, y) != State::KILLED) {
-                return false;
-            }
-        }
-        return true;
+    static Bitboard Bit(size_t x, size_t y) {
+        assert(x < field_size && y < field_size);
+        return Bitboard{1} << (x + y * field_size);
     }
 
-    void MarkKillInDirection(size_t x, size_t y, int dx, int dy) {
-        auto mark_cell_empty = [this](size_t x, size_t y) {
-            if (x >= field_size || y >= field_size) {
-                return;
-            }
-            if (Get(x, y) != State::UNKNOWN) {
-                return;
-            }
-            Get(x, y) = State::EMPTY;
-        };
-        for (; x < field_size && y < field_size; x += dx, y += dy) {
-            mark_cell_empty(x + dy, y + dx);
-            mark_cell_empty(x - dy, y - dx);
-            mark_cell_empty(x, y);
-            if (Get(x, y) != State::KILLED) {
-                return;
+    // Подряд идущие подбитые клетки, продолжающие cell сдвигами forward и backward
+    template <typename Forward, typename Backward>
+    Bitboard HitRun(Bitboard cell, Forward forward, Backward backward) const {
+        Bitboard run = cell;
+        while (true) {
+            const Bitboard next = run | ((forward(run) | backward(run)) & hit_);
+            if (next == run) {
+                return run;
             }
+            run = next;
         }
     }
 
+    template <typename Forward, typename Backward>
+    bool IsKilledAlong(Bitboard cell, Forward forward, Backward backward) const {
+        const Bitboard run = HitRun(cell, forward, backward);
+        // Клетки сразу за концами подбитого отрезка должны быть пустыми, край поля тоже подходит
+        const Bitboard ends = (forward(run) | backward(run)) & ~run;
+        return (ends & ~miss_) == 0;
+    }
+
+    Bitboard Unknown() const {
+        return ~(ship_ | hit_ | miss_);
+    }
+
 public:
     enum class ShotResult {
         MISS = 0,
@@ -156,47 +207,77 @@ public:
     };
 
     ShotResult Shoot(size_t x, size_t y) {
-        if (Get(x, y) != State::SHIP) return ShotResult::MISS;
+        const Bitboard cell = Bit(x, y);
+        if ((ship_ & cell) == 0) return ShotResult::MISS;
 
-        Get(x, y) = State::KILLED;
+        ship_ &= ~cell;
+        hit_ |= cell;
         --weight_;
 
         return IsKilled(x, y) ? ShotResult::KILL : ShotResult::HIT;
     }
 
     void MarkMiss(size_t x, size_t y) {
-        if (Get(x, y) != State::UNKNOWN) {
+        const Bitboard cell = Bit(x, y);
+        if ((Unknown() & cell) == 0) {
             return;
         }
-        Get(x, y) = State::EMPTY;
+        miss_ |= cell;
     }
 
     void MarkHit(size_t x, size_t y) {
-        if (Get(x, y) != State::UNKNOWN) {
+        const Bitboard cell = Bit(x, y);
+        if ((Unknown() & cell) == 0) {
             return;
         }
         --weight_;
-        Get(x, y) = State::KILLED;
+        hit_ |= cell;
     }
 
+    // Подбитый корабль лежит на одной прямой, все неизвестные клетки вокруг него пустые
     void MarkKill(size_t x, size_t y) {
-        if (Get(x, y) != State::UNKNOWN) {
+        using namespace seabattle_detail;
+
+        const Bitboard cell = Bit(x, y);
+        if ((Unknown() & cell) == 0) {
             return;
         }
         MarkHit(x, y);
-        MarkKillInDirection(x, y, 1, 0);
-        MarkKillInDirection(x, y, -1, 0);
-        MarkKillInDirection(x, y, 0, 1);
-        MarkKillInDirection(x, y, 0, -1);
+        const Bitboard ship = HitRun(cell, ShiftRight, ShiftLeft) | HitRun(cell, ShiftDown, ShiftUp);
+        miss_ |= Dilate(ship) & Unknown();
     }
 
     State operator()(size_t x, size_t y) const {
-        return Get(x, y);
+        const Bitboard cell = Bit(x, y);
+        if (ship_ & cell) return State::SHIP;
+        if (hit_ & cell) return State::KILLED;
+        if (miss_ & cell) return State::EMPTY;
+        return State::UNKNOWN;
+    }
+
+    // Клетки в состоянии state: бит x + y * field_size
+    Bitboard GetMask(State state) const {
+        switch (state) {
+            case State::SHIP:
+                return ship_;
+            case State::KILLED:
+                return hit_;
+            case State::EMPTY:
+                return miss_;
+            case State::UNKNOWN:
+                return Unknown();
+        }
+        return 0;
     }
 
     bool IsKilled(size_t x, size_t y) const {
-        return IsKilledInDirection(x, y, 1, 0) && IsKilledInDirection(x, y, -1, 0)
-            && IsKilledInDirection(x, y, 0, 1) && IsKilledInDirection(x, y, 0, -1);
+        using namespace seabattle_detail;
+
+        const Bitboard cell = Bit(x, y);
+        if (miss_ & cell) return true;
+        if ((hit_ & cell) == 0) return false;
+
+        return IsKilledAlong(cell, ShiftRight, ShiftLeft) && IsKilledAlong(cell, ShiftDown, ShiftUp);
     }
 
     static void PrintDigitLine(std::ostream& out) {
@@ -226,14 +307,6 @@ public:
     }
 
 private:
-    State& Get(size_t x, size_t y) {
-        return field_[x + y * field_size];
-    }
-
-    State Get(size_t x, size_t y) const {
-        return field_[x + y * field_size];
-    }
-
     static char Repr(State state) {
         switch (state) {
             case State::UNKNOWN:
@@ -250,6 +323,9 @@ private:
     }
 
 private:
-    std::array<State, field_size * field_size> field_;
+    // Целые корабли, подбитые клетки и клетки, где кораблей точно нет. Остальные клетки неизвестны
+    Bitboard ship_ = 0;
+    Bitboard hit_ = 0;
+    Bitboard miss_ = 0;
     int weight_ = 1 * 4 + 2 * 3 + 3 * 2 + 4 * 1;
 };
@@ -0,0 +1,104 @@
+#pragma once
+#include "seabattle.h"
+
+#include <bit>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Ход - пара (строка, столбец). По сети передаётся двумя символами от "A1" до "H8",
+// результат выстрела - одним байтом со значением SeabattleField::ShotResult
+using SeabattleMove = std::pair<int, int>;
+
+// Логика игрока без ввода-вывода: своё поле, известная часть поля соперника и разбор ходов.
+// Используется и консольной игрой, и ботами
+class SeabattleAgent {
+public:
+    explicit SeabattleAgent(const SeabattleField& field)
+        : my_field_(field) {
+    }
+
+    static std::optional<SeabattleMove> ParseMove(std::string_view sv) {
+        if (sv.size() != 2) return std::nullopt;
+
+        int p1 = sv[0] - 'A', p2 = sv[1] - '1';
+
+        if (p1 < 0 || p1 >= static_cast<int>(SeabattleField::field_size)) return std::nullopt;
+        if (p2 < 0 || p2 >= static_cast<int>(SeabattleField::field_size)) return std::nullopt;
+
+        return {{p1, p2}};
+    }
+
+    static std::string MoveToString(SeabattleMove move) {
+        char buff[] = {static_cast<char>(move.first + 'A'), static_cast<char>(move.second + '1')};
+        return {buff, 2};
+    }
+
+    static std::optional<SeabattleField::ShotResult> ParseShotResult(char c) {
+        switch (c) {
+            case static_cast<char>(SeabattleField::ShotResult::MISS):
+                return SeabattleField::ShotResult::MISS;
+            case static_cast<char>(SeabattleField::ShotResult::HIT):
+                return SeabattleField::ShotResult::HIT;
+            case static_cast<char>(SeabattleField::ShotResult::KILL):
+                return SeabattleField::ShotResult::KILL;
+            default:
+                return std::nullopt;
+        }
+    }
+
+    // Стреляет соперник: результат определяется своим полем
+    SeabattleField::ShotResult ApplyOtherShot(SeabattleMove move) {
+        return my_field_.Shoot(move.second, move.first);
+    }
+
+    // Отмечает на поле соперника результат своего выстрела
+    void ApplyMyShot(SeabattleMove move, SeabattleField::ShotResult result) {
+        switch (result) {
+            case SeabattleField::ShotResult::HIT:
+                other_field_.MarkHit(move.second, move.first);
+                break;
+            case SeabattleField::ShotResult::KILL:
+                other_field_.MarkKill(move.second, move.first);
+                break;
+            case SeabattleField::ShotResult::MISS:
+                other_field_.MarkMiss(move.second, move.first);
+                break;
+        }
+    }
+
+    // Случайная клетка поля соперника, о которой ещё ничего не известно. Игра не должна быть закончена
+    template <class T>
+    SeabattleMove ChooseRandomMove(T&& random_engine) const {
+        SeabattleField::Bitboard unknown = other_field_.GetMask(SeabattleField::State::UNKNOWN);
+        assert(unknown != 0);
+        const int count = std::popcount(unknown);
+        for (int skip = std::uniform_int_distribution<int>(0, count - 1)(random_engine); skip > 0; --skip) {
+            unknown &= unknown - 1;
+        }
+        const int cell = std::countr_zero(unknown);
+        return {cell / static_cast<int>(SeabattleField::field_size), cell % static_cast<int>(SeabattleField::field_size)};
+    }
+
+    bool IsGameEnded() const {
+        return my_field_.IsLoser() || other_field_.IsLoser();
+    }
+
+    bool IsWinner() const {
+        return other_field_.IsLoser();
+    }
+
+    const SeabattleField& GetMyField() const {
+        return my_field_;
+    }
+
+    const SeabattleField& GetOtherField() const {
+        return other_field_;
+    }
+
+private:
+    SeabattleField my_field_;
+    SeabattleField other_field_;
+};
@@ -0,0 +1,273 @@
+#include "seabattle_server.h"
+
+#include <boost/asio/bind_executor.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <iostream>
+
+namespace seabattle_server {
+
+using namespace std::literals;
+
+namespace {
+
+// Отключение игрока - обычное завершение партии, о нём не пишем
+bool IsDisconnect(sys::error_code ec) {
+    return ec == net::error::eof || ec == net::error::connection_reset || ec == net::error::broken_pipe
+        || ec == net::error::operation_aborted;
+}
+
+void ReportError(sys::error_code ec, std::string_view what) {
+    std::cerr << what << ": "sv << ec.message() << std::endl;
+}
+
+}  // namespace
+
+GameSession::GameSession(Strand strand, tcp::socket first, tcp::socket second, ServerStats& stats)
+    : strand_(strand)
+    , timer_(strand)
+    , players_{Player{std::move(first), {}}, Player{std::move(second), {}}}
+    , stats_(stats) {
+}
+
+void GameSession::Start() {
+    ++stats_.active_games;
+    // Дальше все обработчики партии выполняются в её strand
+    net::dispatch(strand_, [self = shared_from_this()] {
+        self->SendInitiative(0);
+    });
+}
+
+void GameSession::SendInitiative(size_t player) {
+    if (player == players_.size()) {
+        return ReadMove();
+    }
+    net::async_write(players_[player].socket, net::buffer(&initiative_[player], 1),
+                     net::bind_executor(strand_, [self = shared_from_this(), player](sys::error_code ec, size_t) {
+                         if (ec) {
+                             return self->Finish(false, "write initiative"sv, ec);
+                         }
+                         self->SendInitiative(player + 1);
+                     }));
+}
+
+void GameSession::ReadMove() {
+    StartTimer();
+    net::async_read(Shooter().socket, net::buffer(move_),
+                    net::bind_executor(strand_, [self = shared_from_this()](sys::error_code ec, size_t) {
+                        self->OnMove(ec);
+                    }));
+}
+
+void GameSession::OnMove(sys::error_code ec) {
+    if (ec) {
+        return Finish(false, "read move"sv, ec);
+    }
+    if (!SeabattleAgent::ParseMove({move_.data(), move_.size()})) {
+        return Finish(false, "wrong move"sv);
+    }
+    net::async_write(Target().socket, net::buffer(move_),
+                     net::bind_executor(strand_, [self = shared_from_this()](sys::error_code ec, size_t) {
+                         self->OnMoveForwarded(ec);
+                     }));
+}
+
+void GameSession::OnMoveForwarded(sys::error_code ec) {
+    if (ec) {
+        return Finish(false, "forward move"sv, ec);
+    }
+    StartTimer();
+    net::async_read(Target().socket, net::buffer(result_),
+                    net::bind_executor(strand_, [self = shared_from_this()](sys::error_code ec, size_t) {
+                        self->OnResult(ec);
+                    }));
+}
+
+void GameSession::OnResult(sys::error_code ec) {
+    if (ec) {
+        return Finish(false, "read result"sv, ec);
+    }
+    if (!SeabattleAgent::ParseShotResult(result_[0])) {
+        return Finish(false, "wrong result"sv);
+    }
+    net::async_write(Shooter().socket, net::buffer(result_),
+                     net::bind_executor(strand_, [self = shared_from_this()](sys::error_code ec, size_t) {
+                         self->OnResultForwarded(ec);
+                     }));
+}
+
+void GameSession::OnResultForwarded(sys::error_code ec) {
+    if (ec) {
+        return Finish(false, "forward result"sv, ec);
+    }
+    ++stats_.moves;
+
+    const auto move = *SeabattleAgent::ParseMove({move_.data(), move_.size()});
+    const auto result = *SeabattleAgent::ParseShotResult(result_[0]);
+    SeabattleField& view = Target().view;
+    switch (result) {
+        case SeabattleField::ShotResult::HIT:
+            view.MarkHit(move.second, move.first);
+            break;
+        case SeabattleField::ShotResult::KILL:
+            view.MarkKill(move.second, move.first);
+            break;
+        case SeabattleField::ShotResult::MISS:
+            view.MarkMiss(move.second, move.first);
+            shooter_ = 1 - shooter_;
+            break;
+    }
+
+    if (view.IsLoser()) {
+        return Finish(true);
+    }
+    ReadMove();
+}
+
+void GameSession::StartTimer() {
+    timer_.expires_after(MOVE_TIMEOUT);
+    timer_.async_wait(net::bind_executor(strand_, [self = shared_from_this()](sys::error_code ec) {
+        // Таймер перезапускается на каждом ожидании, отменённое ожидание - не таймаут
+        if (ec != net::error::operation_aborted && self->timer_.expiry() <= net::steady_timer::clock_type::now()) {
+            self->Finish(false, "move timeout"sv);
+        }
+    }));
+}
+
+void GameSession::Finish(bool completed, std::string_view reason, sys::error_code ec) {
+    if (finished_) {
+        return;
+    }
+    finished_ = true;
+
+    if (!reason.empty() && !ec) {
+        std::cerr << reason << std::endl;
+    } else if (!reason.empty() && !IsDisconnect(ec)) {
+        ReportError(ec, reason);
+    }
+
+    timer_.cancel();
+    for (Player& player : players_) {
+        sys::error_code ignored;
+        player.socket.shutdown(tcp::socket::shutdown_both, ignored);
+        player.socket.close(ignored);
+    }
+
+    --stats_.active_games;
+    ++(completed ? stats_.finished_games : stats_.aborted_games);
+}
+
+void Lobby::Join(tcp::socket socket) {
+    tcp::socket first{ioc_};
+    {
+        std::lock_guard lock{mutex_};
+        if (!waiting_) {
+            waiting_.emplace(std::move(socket));
+            ++stats_.waiting;
+            WatchWaiting(++waiting_generation_);
+            return;
+        }
+        // Отменённое ожидание завершится с operation_aborted, сокет с ним можно передавать в партию
+        sys::error_code ignored;
+        waiting_->cancel(ignored);
+        first = std::move(*waiting_);
+        waiting_.reset();
+        --stats_.waiting;
+    }
+
+    // Ждавший в лобби ходит первым
+    std::make_shared<GameSession>(net::make_strand(ioc_), std::move(first), std::move(socket), stats_)->Start();
+}
+
+void Lobby::WatchWaiting(size_t generation) {
+    waiting_->async_wait(tcp::socket::wait_read, [this, generation](sys::error_code ec) {
+        OnWaitingReadable(ec, generation);
+    });
+}
+
+void Lobby::DropWaiting() {
+    sys::error_code ignored;
+    waiting_->close(ignored);
+    waiting_.reset();
+    --stats_.waiting;
+    ++stats_.dropped_waiting;
+}
+
+void Lobby::OnWaitingReadable(sys::error_code ec, size_t generation) {
+    if (ec == net::error::operation_aborted) {
+        return;
+    }
+
+    std::lock_guard lock{mutex_};
+    // Игрока уже забрали в партию, там его отключение и заметят
+    if (!waiting_ || generation != waiting_generation_) {
+        return;
+    }
+    if (ec) {
+        return DropWaiting();
+    }
+
+    // Сокет блокирующий, поэтому на время проверки он переводится в неблокирующий режим
+    std::array<char, 1> byte;
+    waiting_->non_blocking(true, ec);
+    if (!ec) {
+        // Закрытое соединение Asio сообщает ошибкой eof
+        waiting_->receive(net::buffer(byte), tcp::socket::message_peek, ec);
+    }
+    sys::error_code ignored;
+    waiting_->non_blocking(false, ignored);
+
+    if (ec == net::error::would_block || ec == net::error::try_again) {
+        // Ложная готовность, игрок на месте
+        return WatchWaiting(generation);
+    }
+    if (ec) {
+        // EOF или ошибка соединения
+        return DropWaiting();
+    }
+    // Данные до начала партии: их прочитает партия как ход, а отключение заметит она же.
+    // Ожидание не перезапускается, иначе готовый к чтению сокет будил бы лобби без конца
+}
+
+Listener::Listener(net::io_context& ioc, const tcp::endpoint& endpoint, Lobby& lobby)
+    : ioc_(ioc)
+    , acceptor_(net::make_strand(ioc))
+    , retry_timer_(acceptor_.get_executor())
+    , lobby_(lobby) {
+    acceptor_.open(endpoint.protocol());
+    acceptor_.set_option(net::socket_base::reuse_address(true));
+    acceptor_.bind(endpoint);
+    acceptor_.listen(net::socket_base::max_listen_connections);
+}
+
+void Listener::DoAccept() {
+    acceptor_.async_accept(ioc_, [self = shared_from_this()](sys::error_code ec, tcp::socket socket) {
+        self->OnAccept(ec, std::move(socket));
+    });
+}
+
+void Listener::OnAccept(sys::error_code ec, tcp::socket socket) {
+    if (ec == net::error::operation_aborted) {
+        // Acceptor закрыт
+        return;
+    }
+
+    if (ec) {
+        ReportError(ec, "accept"sv);
+        retry_timer_.expires_after(ACCEPT_RETRY_DELAY);
+        retry_timer_.async_wait([self = shared_from_this()](sys::error_code ec) {
+            if (!ec) {
+                self->DoAccept();
+            }
+        });
+        return;
+    }
+
+    // Ходы - пакеты в пару байт, ждать их склейки алгоритмом Нейгла нельзя
+    socket.set_option(tcp::no_delay(true), ec);
+    lobby_.Join(std::move(socket));
+    DoAccept();
+}
+
+}  // namespace seabattle_server
@@ -0,0 +1,149 @@
+#pragma once
+#ifdef WIN32
+#include <sdkddkver.h>
+#endif
+
+#include "seabattle_agent.h"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+
+/*
+ * Сервер морского боя на много одновременных партий.
+ *
+ * Подключившийся игрок попадает в лобби и ждёт соперника. Когда игроков двое, сервер создаёт партию
+ * со своим strand и посылает каждому байт инициативы: 1 - ходит первым, 0 - вторым. Дальше протокол
+ * тот же, что и у консольной игры: стреляющий присылает ход ("A1"), сервер пересылает его сопернику,
+ * ответ соперника (байт SeabattleField::ShotResult) возвращает стреляющему. После промаха ход переходит.
+ *
+ * Поля игроков хранятся у клиентов. Сервер по пересланным ответам ведёт каждому игроку поле, каким его
+ * видит соперник, проверяет формат ходов и ответов и закрывает партию, когда у кого-то подбиты все
+ * корабли, кто-то отключился, нарушил протокол или не ответил за GameSession::MOVE_TIMEOUT.
+ */
+namespace seabattle_server {
+
+namespace net = boost::asio;
+using tcp = net::ip::tcp;
+namespace sys = boost::system;
+
+struct ServerStats {
+    std::atomic<size_t> waiting = 0;
+    std::atomic<size_t> active_games = 0;
+    std::atomic<size_t> finished_games = 0;
+    std::atomic<size_t> aborted_games = 0;
+    // Отключились, пока ждали соперника в лобби
+    std::atomic<size_t> dropped_waiting = 0;
+    std::atomic<size_t> moves = 0;
+};
+
+class GameSession : public std::enable_shared_from_this<GameSession> {
+public:
+    using Strand = net::strand<net::io_context::executor_type>;
+
+    static constexpr std::chrono::seconds MOVE_TIMEOUT{60};
+
+    // Первым ходит first
+    GameSession(Strand strand, tcp::socket first, tcp::socket second, ServerStats& stats);
+
+    GameSession(const GameSession&) = delete;
+    GameSession& operator=(const GameSession&) = delete;
+
+    void Start();
+
+private:
+    struct Player {
+        tcp::socket socket;
+        // Поле игрока, каким его знает соперник по полученным ответам
+        SeabattleField view;
+    };
+
+    void SendInitiative(size_t player);
+    void ReadMove();
+    void OnMove(sys::error_code ec);
+    void OnMoveForwarded(sys::error_code ec);
+    void OnResult(sys::error_code ec);
+    void OnResultForwarded(sys::error_code ec);
+    void StartTimer();
+    void Finish(bool completed, std::string_view reason = {}, sys::error_code ec = {});
+
+    Player& Shooter() {
+        return players_[shooter_];
+    }
+
+    Player& Target() {
+        return players_[1 - shooter_];
+    }
+
+    Strand strand_;
+    net::steady_timer timer_;
+    std::array<Player, 2> players_;
+    ServerStats& stats_;
+    size_t shooter_ = 0;
+    std::array<char, 2> move_{};
+    std::array<char, 1> result_{};
+    std::array<char, 2> initiative_{1, 0};
+    bool finished_ = false;
+};
+
+// Лобби: ожидающий игрок получает в соперники следующего подключившегося.
+// До начала партии клиент ничего не присылает. Когда сокет ожидающего готов к чтению, лобби
+// заглядывает в него без блокировки: EOF или ошибка - игрок отключился, и его убирают из лобби.
+// Готовность бывает ложной, тогда ожидание запускается снова
+class Lobby {
+public:
+    Lobby(net::io_context& ioc, ServerStats& stats)
+        : ioc_(ioc)
+        , stats_(stats) {
+    }
+
+    void Join(tcp::socket socket);
+
+private:
+    // Вызываются под mutex_
+    void WatchWaiting(size_t generation);
+    void DropWaiting();
+
+    void OnWaitingReadable(sys::error_code ec, size_t generation);
+
+    net::io_context& ioc_;
+    ServerStats& stats_;
+    std::mutex mutex_;
+    std::optional<tcp::socket> waiting_;
+    // Номер ожидающего: ожидание чтения прежнего игрока могло завершиться уже после того, как его забрали в партию
+    size_t waiting_generation_ = 0;
+};
+
+class Listener : public std::enable_shared_from_this<Listener> {
+public:
+    // После ошибки accept (например, кончились дескрипторы) новый accept откладывается,
+    // иначе он сразу завершится той же ошибкой и займёт поток целиком
+    static constexpr std::chrono::milliseconds ACCEPT_RETRY_DELAY{100};
+
+    Listener(net::io_context& ioc, const tcp::endpoint& endpoint, Lobby& lobby);
+
+    void Run() {
+        DoAccept();
+    }
+
+private:
+    void DoAccept();
+    void OnAccept(sys::error_code ec, tcp::socket socket);
+
+    net::io_context& ioc_;
+    tcp::acceptor acceptor_;
+    net::steady_timer retry_timer_;
+    Lobby& lobby_;
+};
+
+}  // namespace seabattle_server
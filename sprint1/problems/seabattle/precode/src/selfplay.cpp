@@ -0,0 +1,71 @@
+#include "run_workers.h"
+#include "seabattle_agent.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+
+/*
+ * Играет партии двух ботов со случайными выстрелами без сети и печатает число партий в секунду.
+ * Так проверяется скорость SeabattleField для подбора стратегий ботов. Партии независимы,
+ * поэтому делятся между потоками поровну, у каждого потока свой генератор
+ */
+
+using namespace std::literals;
+
+namespace {
+
+// Возвращает номер победившего игрока
+int PlayGame(std::mt19937_64& engine) {
+    std::array<SeabattleAgent, 2> agents{SeabattleAgent{SeabattleField::GetRandomField(engine)},
+                                         SeabattleAgent{SeabattleField::GetRandomField(engine)}};
+    int shooter = 0;
+    while (true) {
+        SeabattleAgent& me = agents[shooter];
+        SeabattleAgent& other = agents[1 - shooter];
+        const SeabattleMove move = me.ChooseRandomMove(engine);
+        const auto result = other.ApplyOtherShot(move);
+        me.ApplyMyShot(move, result);
+        if (me.IsWinner()) {
+            return shooter;
+        }
+        if (result == SeabattleField::ShotResult::MISS) {
+            shooter = 1 - shooter;
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, const char** argv) {
+    if (argc < 2 || argc > 4) {
+        std::cout << "Usage: seabattle_selfplay <games> [<threads>] [<seed>]" << std::endl;
+        return 1;
+    }
+
+    const long games = std::stol(argv[1]);
+    const unsigned num_threads = std::max(1u, argc >= 3 ? std::stoi(argv[2]) : std::thread::hardware_concurrency());
+    const unsigned long long seed = argc == 4 ? std::stoull(argv[3]) : 42;
+
+    std::atomic<unsigned> next_worker = 0;
+    std::atomic<long> first_wins = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    RunWorkers(num_threads, [&] {
+        const unsigned worker = next_worker++;
+        std::mt19937_64 engine(seed + worker);
+        long wins = 0;
+        for (long i = worker; i < games; i += num_threads) {
+            wins += PlayGame(engine) == 0;
+        }
+        first_wins += wins;
+    });
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Games: "sv << games << " in "sv << elapsed.count() << " s, "sv << games / elapsed.count()
+              << " games/s, threads: "sv << num_threads << std::endl;
+    std::cout << "First player wins: "sv << 100.0 * first_wins / std::max(games, 1L) << "%"sv << std::endl;
+}
@@ -0,0 +1,71 @@
+#ifdef WIN32
+#include <sdkddkver.h>
+#endif
+
+#include "run_workers.h"
+#include "seabattle_server.h"
+
+#include <boost/asio/signal_set.hpp>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace net = boost::asio;
+namespace sys = boost::system;
+using namespace std::literals;
+
+namespace {
+
+constexpr auto STATS_PERIOD = 10s;
+
+void PrintStats(const seabattle_server::ServerStats& stats) {
+    std::cout << "waiting: "sv << stats.waiting << ", active games: "sv << stats.active_games
+              << ", finished: "sv << stats.finished_games << ", aborted: "sv << stats.aborted_games
+              << ", dropped from lobby: "sv << stats.dropped_waiting
+              << ", moves: "sv << stats.moves << std::endl;
+}
+
+void SchedulePrintStats(net::steady_timer& timer, const seabattle_server::ServerStats& stats) {
+    timer.expires_after(STATS_PERIOD);
+    timer.async_wait([&timer, &stats](sys::error_code ec) {
+        if (!ec) {
+            PrintStats(stats);
+            SchedulePrintStats(timer, stats);
+        }
+    });
+}
+
+}  // namespace
+
+int main(int argc, const char** argv) {
+    if (argc != 2 && argc != 3) {
+        std::cout << "Usage: seabattle_server <port> [<threads>]" << std::endl;
+        return 1;
+    }
+
+    const unsigned short port = std::stoi(argv[1]);
+    const unsigned num_threads = argc == 3 ? std::stoi(argv[2]) : std::thread::hardware_concurrency();
+
+    net::io_context ioc(num_threads);
+
+    net::signal_set signals(ioc, SIGINT, SIGTERM);
+    signals.async_wait([&ioc](const sys::error_code& ec, [[maybe_unused]] int signal_number) {
+        if (!ec) {
+            ioc.stop();
+        }
+    });
+
+    seabattle_server::ServerStats stats;
+    seabattle_server::Lobby lobby(ioc, stats);
+    std::make_shared<seabattle_server::Listener>(ioc, seabattle_server::tcp::endpoint{net::ip::tcp::v4(), port},
+                                                 lobby)->Run();
+
+    net::steady_timer stats_timer(ioc);
+    SchedulePrintStats(stats_timer, stats);
+
+    std::cout << "Seabattle server is listening on port "sv << port << ", threads: "sv << num_threads << std::endl;
+    RunWorkers(num_threads, [&ioc] {
+        ioc.run();
+    });
+    PrintStats(stats);
+}
@@ -1,78 +1,230 @@
+"""Profiles the game server with perf and draws flamegraphs.
+
+The server is started under `perf record -g`, loaded for a while and stopped.
+Then the stacks are folded and drawn with the FlameGraph scripts
+(https://github.com/brendangregg/FlameGraph):
+
+    python3 shoot.py "bin/game_server -c ../data/config.json -w ../static -t 50"
+    python3 shoot.py --save-baseline before.folded "bin/game_server ..."
+    python3 shoot.py --baseline before.folded "bin/game_server ..."
+
+The last command also draws a differential flamegraph: red frames got more
+samples than in the baseline, blue ones got less.
+Stacks are complete only if the server is built with -fno-omit-frame-pointer,
+otherwise use --call-graph dwarf.
+"""
 
 import argparse
-import subprocess
-import time
+import http.client
+import os
 import random
 import shlex
-import os
+import shutil
+import signal
+import socket
+import subprocess
+import threading
+import time
 
-RANDOM_LIMIT = 1000
 SEED = 123456789
-random.seed(SEED)
 
 AMMUNITION = [
-    'localhost:8080/api/v1/maps/map1',
-    'localhost:8080/api/v1/maps'
+    '/api/v1/maps/map1',
+    '/api/v1/maps'
 ]
 
-SHOOT_COUNT = 100
-COOLDOWN = 0.1
-
-
-def start_server():
-    parser = argparse.ArgumentParser()
-    parser.add_argument('server', type=str)
-    return parser.parse_args().server
+SERVER_START_TIMEOUT = 10.0
+PERF_STOP_TIMEOUT = 60.0
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Profile the game server under load')
+    parser.add_argument('server', type=str, help='command that starts the server')
+    parser.add_argument('--host', default='127.0.0.1')
+    parser.add_argument('--port', type=int, default=8080)
+    parser.add_argument('--duration', type=float, default=30.0, help='load duration in seconds')
+    parser.add_argument('--connections', type=int, default=8, help='keep-alive connections of the load')
+    parser.add_argument('--rps', type=float, default=0.0, help='requests per second, 0 is as fast as possible')
+    parser.add_argument('--ammo', type=str, help='Yandex.Tank ammo in the uri format, used instead of AMMUNITION')
+    parser.add_argument('--load-command', type=str,
+                        help='external load instead of the built-in one, e.g. "bin/game_load --bots 500 -d 30"')
+    parser.add_argument('--frequency', type=int, default=999, help='perf sampling frequency')
+    parser.add_argument('--call-graph', default='fp', choices=['fp', 'dwarf', 'lbr'])
+    parser.add_argument('--flamegraph-dir', default='./FlameGraph', help='checkout of the FlameGraph scripts')
+    parser.add_argument('--output', default='graph', help='prefix of the output files')
+    parser.add_argument('--baseline', type=str, help='folded stacks to draw the differential flamegraph against')
+    parser.add_argument('--save-baseline', type=str, help='keep the folded stacks as a baseline')
+    return parser.parse_args()
 
 
 def run(command, output=None):
-    process = subprocess.Popen(shlex.split(command), stdout=output, stderr=subprocess.DEVNULL)
+    # Own process group, so that perf and the server get the stop signal together
+    process = subprocess.Popen(shlex.split(command), stdout=output, stderr=subprocess.DEVNULL,
+                               start_new_session=True)
     return process
 
 
-def stop(process, wait=False):
-    if process.poll() is None and wait:
+def stop(process, timeout=PERF_STOP_TIMEOUT):
+    if process.poll() is None:
+        os.killpg(process.pid, signal.SIGINT)
+    try:
+        process.wait(timeout)
+    except subprocess.TimeoutExpired:
+        os.killpg(process.pid, signal.SIGKILL)
         process.wait()
-    process.terminate()
-
-def shoot(ammo):
-    hit = run('curl ' + ammo, output=subprocess.DEVNULL)
-    time.sleep(COOLDOWN)
-    stop(hit, wait=True)
-
-
-def make_shots():
-    for _ in range(SHOOT_COUNT):
-        ammo_number = random.randrange(RANDOM_LIMIT) % len(AMMUNITION)
-        shoot(AMMUNITION[ammo_number])
-    print('Shooting complete')
-
-def record(process, output=None):
-	pid = process.pid
-	print("Start recording")
-	list = ['perf', 'record', '-p', pid, '-o', 'perf.data']
-	command = ' '.join(map(str, list))
-	process = run(command, None)
-	#process = subprocess.Popen(shlex.split(command), stdout=output, stderr=subprocess.DEVNULL)
-	return process
-
-def make_result():
-	print('Make result')
-	#command=f'sudo perf script | ./FlameGraph/stackcollapse-perf.pl | ./FlameGraph/flamegraph.pl -i perf.data  > graph.svg'
-	command=f'sudo touch graph.svg'
-	os.system(command)
-	command_write=f'sudo echo http_handler::RequestHandler >> graph.svg'
-	os.system(command_write)
-	#os.system(command)	
-	#process=run(command, output=subprocess.DEVNULL)
-	#return process
-
-server = run(start_server())
-record(server)
-make_shots()
-stop(server)
-time.sleep(5)
-print('Job done')
-make_result()
-time.sleep(2)
-#stop(result)
+
+
+def record(server_command, args):
+    print('Start recording')
+    command = f'perf record -F {args.frequency} --call-graph {args.call_graph} -o perf.data -- {server_command}'
+    return run(command)
+
+
+def wait_for_server(host, port, process):
+    deadline = time.monotonic() + SERVER_START_TIMEOUT
+    while time.monotonic() < deadline:
+        if process.poll() is not None:
+            raise RuntimeError('Server has exited, see perf.data or run the server command by hand')
+        try:
+            with socket.create_connection((host, port), timeout=0.5):
+                return
+        except OSError:
+            time.sleep(0.1)
+    raise RuntimeError(f'Server has not started on {host}:{port}')
+
+
+def load_ammo(path):
+    if path is None:
+        return AMMUNITION
+    with open(path) as ammo_file:
+        uris = [line.split()[0] for line in ammo_file if line.strip().startswith('/')]
+    if not uris:
+        raise RuntimeError(f'No uris in {path}')
+    return uris
+
+
+class Shooter:
+    """Keeps one connection and sends requests until the deadline"""
+
+    def __init__(self, host, port, ammunition, deadline, interval, seed):
+        self.host = host
+        self.port = port
+        self.ammunition = ammunition
+        self.deadline = deadline
+        self.interval = interval
+        self.random = random.Random(seed)
+        self.shots = 0
+        self.errors = 0
+
+    def shoot(self, connection, ammo):
+        connection.request('GET', ammo)
+        response = connection.getresponse()
+        response.read()
+        if response.status >= 500:
+            self.errors += 1
+
+    def run(self):
+        connection = http.client.HTTPConnection(self.host, self.port, timeout=5)
+        next_shot = time.monotonic()
+        while next_shot < self.deadline:
+            if self.interval:
+                time.sleep(max(0.0, next_shot - time.monotonic()))
+                next_shot += self.interval
+            else:
+                next_shot = time.monotonic()
+            try:
+                self.shoot(connection, self.random.choice(self.ammunition))
+                self.shots += 1
+            except (OSError, http.client.HTTPException):
+                self.errors += 1
+                connection.close()
+                connection = http.client.HTTPConnection(self.host, self.port, timeout=5)
+        connection.close()
+
+
+def make_shots(args):
+    if args.load_command:
+        load = subprocess.run(shlex.split(args.load_command))
+        print(f'Load command exited with {load.returncode}')
+        return
+
+    ammunition = load_ammo(args.ammo)
+    deadline = time.monotonic() + args.duration
+    interval = args.connections / args.rps if args.rps > 0 else 0.0
+    shooters = [Shooter(args.host, args.port, ammunition, deadline, interval, SEED + i)
+                for i in range(args.connections)]
+    threads = [threading.Thread(target=shooter.run) for shooter in shooters]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    shots = sum(shooter.shots for shooter in shooters)
+    errors = sum(shooter.errors for shooter in shooters)
+    print(f'Shooting complete: {shots} requests, {errors} errors, {shots / args.duration:.1f} rps')
+
+
+def flamegraph_script(args, name):
+    path = os.path.join(args.flamegraph_dir, name)
+    if not os.path.isfile(path):
+        raise RuntimeError(f'{path} is not found, clone https://github.com/brendangregg/FlameGraph '
+                           f'or set --flamegraph-dir')
+    return path
+
+
+def pipe(commands, output_path):
+    """Runs commands as a shell pipeline and writes the output of the last one to the file"""
+    with open(output_path, 'w') as output:
+        processes = []
+        stdin = None
+        for i, command in enumerate(commands):
+            stdout = output if i == len(commands) - 1 else subprocess.PIPE
+            process = subprocess.Popen(command, stdin=stdin, stdout=stdout)
+            if stdin is not None:
+                stdin.close()
+            stdin = process.stdout
+            processes.append(process)
+        for process, command in zip(processes, commands):
+            if process.wait() != 0:
+                raise RuntimeError(f'{" ".join(command)} has failed')
+
+
+def make_result(args):
+    print('Make result')
+    folded = f'{args.output}.folded'
+    pipe([['perf', 'script', '-i', 'perf.data'],
+          [flamegraph_script(args, 'stackcollapse-perf.pl')]], folded)
+    pipe([[flamegraph_script(args, 'flamegraph.pl'), '--title', 'game_server', folded]], f'{args.output}.svg')
+    print(f'Flamegraph: {args.output}.svg')
+
+    if args.baseline:
+        diff = f'{args.output}-diff.folded'
+        # -n normalizes the sample counts, so runs of different length can be compared
+        pipe([[flamegraph_script(args, 'difffolded.pl'), '-n', args.baseline, folded]], diff)
+        pipe([[flamegraph_script(args, 'flamegraph.pl'), '--title', 'game_server diff', diff]],
+             f'{args.output}-diff.svg')
+        print(f'Differential flamegraph: {args.output}-diff.svg')
+
+    if args.save_baseline:
+        shutil.copyfile(folded, args.save_baseline)
+        print(f'Baseline: {args.save_baseline}')
+
+
+def main():
+    args = parse_args()
+    # Scripts are checked before the long run
+    for script in ['stackcollapse-perf.pl', 'flamegraph.pl'] + (['difffolded.pl'] if args.baseline else []):
+        flamegraph_script(args, script)
+
+    perf = record(args.server, args)
+    try:
+        wait_for_server(args.host, args.port, perf)
+        make_shots(args)
+    finally:
+        stop(perf)
+    print('Job done')
+    make_result(args)
+
+
+if __name__ == '__main__':
+    main()
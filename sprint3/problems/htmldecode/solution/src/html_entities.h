@@ -0,0 +1,4011 @@
+#pragma once
+// Сгенерировано tools/gen_html_entities.py, не редактировать вручную
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace html_entities {
+
+using namespace std::literals;
+
+struct Node {
+    uint16_t first_edge;
+    uint8_t edge_count;
+    int16_t value;  // индекс в VALUES или -1, если имя здесь не заканчивается
+};
+
+struct Edge {
+    char label;
+    uint16_t child;
+};
+
+inline constexpr size_t MAX_NAME_LENGTH = 32;
+
+inline constexpr Node NODES[9858] = {
+    {0, 52, -1}, {52, 17, -1}, {69, 8, -1}, {77, 14, -1}, {91, 11, -1}, {102, 16, -1}, {118, 5, -1}, {123, 12, -1},
+    {135, 8, -1}, {143, 14, -1}, {157, 5, -1}, {162, 7, -1}, {169, 11, -1}, {180, 8, -1}, {188, 9, -1}, {197, 14, -1},
+    {211, 9, -1}, {220, 4, -1}, {224, 12, -1}, {236, 13, -1}, {249, 11, -1}, {260, 14, -1}, {274, 9, -1}, {283, 5, -1},
+    {288, 4, -1}, {292, 9, -1}, {301, 8, -1}, {309, 16, -1}, {325, 16, -1}, {341, 15, -1}, {356, 19, -1}, {375, 18, -1},
+    {393, 12, -1}, {405, 17, -1}, {422, 10, -1}, {432, 15, -1}, {447, 6, -1}, {453, 8, -1}, {461, 23, -1}, {484, 14, -1},
+    {498, 24, -1}, {522, 18, -1}, {540, 12, -1}, {552, 6, -1}, {558, 21, -1}, {579, 19, -1}, {598, 13, -1}, {611, 18, -1},
+    {629, 15, -1}, {644, 7, -1}, {651, 14, -1}, {665, 8, -1}, {673, 10, -1}, {683, 1, -1}, {684, 1, -1}, {685, 1, -1},
+    {686, 1, -1}, {687, 1, -1}, {688, 2, -1}, {690, 1, -1}, {691, 1, -1}, {692, 1, -1}, {693, 1, -1}, {694, 1, -1},
+    {695, 2, -1}, {697, 1, -1}, {698, 1, -1}, {699, 2, -1}, {701, 1, -1}, {702, 1, -1}, {703, 2, -1}, {705, 1, -1},
+    {706, 3, -1}, {709, 1, -1}, {710, 1, -1}, {711, 1, -1}, {712, 1, -1}, {713, 1, -1}, {714, 1, -1}, {715, 1, -1},
+    {716, 3, -1}, {719, 4, -1}, {723, 1, -1}, {724, 2, -1}, {726, 1, -1}, {727, 1, -1}, {728, 1, -1}, {729, 1, -1},
+    {730, 4, -1}, {734, 1, -1}, {735, 1, -1}, {736, 1, -1}, {737, 2, -1}, {739, 1, -1}, {740, 1, -1}, {741, 1, -1},
+    {742, 3, -1}, {745, 2, -1}, {747, 1, -1}, {748, 1, -1}, {749, 2, -1}, {751, 4, -1}, {755, 2, -1}, {757, 1, -1},
+    {758, 1, -1}, {759, 1, -1}, {760, 3, -1}, {763, 1, -1}, {764, 1, -1}, {765, 1, -1}, {766, 1, -1}, {767, 2, -1},
+    {769, 2, -1}, {771, 1, -1}, {772, 1, -1}, {773, 2, -1}, {775, 1, -1}, {776, 1, -1}, {777, 2, -1}, {779, 1, -1},
+    {780, 1, -1}, {781, 1, -1}, {782, 3, -1}, {785, 1, -1}, {786, 1, -1}, {787, 1, 146}, {788, 1, -1}, {789, 1, -1},
+    {790, 3, -1}, {793, 1, -1}, {794, 1, -1}, {795, 1, -1}, {796, 1, -1}, {797, 1, -1}, {798, 1, -1}, {799, 1, -1},
+    {800, 1, -1}, {801, 2, -1}, {803, 1, -1}, {804, 1, -1}, {805, 1, -1}, {806, 2, -1}, {808, 2, -1}, {810, 1, -1},
+    {811, 1, -1}, {812, 1, -1}, {813, 1, -1}, {814, 1, -1}, {815, 2, -1}, {817, 1, -1}, {818, 1, -1}, {819, 1, -1},
+    {820, 3, -1}, {823, 2, -1}, {825, 3, -1}, {828, 1, -1}, {829, 1, -1}, {830, 2, -1}, {832, 2, -1}, {834, 1, -1},
+    {835, 1, -1}, {836, 2, -1}, {838, 1, -1}, {839, 1, -1}, {840, 1, -1}, {841, 1, -1}, {842, 2, -1}, {844, 1, -1},
+    {845, 1, -1}, {846, 1, -1}, {847, 1, -1}, {848, 1, 215}, {849, 5, -1}, {854, 3, -1}, {857, 2, -1}, {859, 1, -1},
+    {860, 2, -1}, {862, 1, -1}, {863, 3, -1}, {866, 3, -1}, {869, 1, -1}, {870, 1, -1}, {871, 1, -1}, {872, 2, -1},
+    {874, 1, -1}, {875, 1, -1}, {876, 1, -1}, {877, 1, -1}, {878, 1, -1}, {879, 1, -1}, {880, 1, -1}, {881, 3, -1},
+    {884, 3, -1}, {887, 1, -1}, {888, 4, -1}, {892, 1, -1}, {893, 1, -1}, {894, 1, -1}, {895, 1, -1}, {896, 1, -1},
+    {897, 2, -1}, {899, 1, -1}, {900, 1, -1}, {901, 1, -1}, {902, 3, -1}, {905, 1, -1}, {906, 1, -1}, {907, 1, -1},
+    {908, 2, -1}, {910, 1, -1}, {911, 1, -1}, {912, 1, -1}, {913, 1, -1}, {914, 1, -1}, {915, 1, -1}, {916, 1, -1},
+    {917, 1, -1}, {918, 1, -1}, {919, 2, -1}, {921, 4, -1}, {925, 2, -1}, {927, 1, -1}, {928, 1, -1}, {929, 1, -1},
+    {930, 1, -1}, {931, 1, -1}, {932, 1, -1}, {933, 3, -1}, {936, 3, -1}, {939, 2, -1}, {941, 1, -1}, {942, 1, -1},
+    {943, 1, -1}, {944, 2, -1}, {946, 1, -1}, {947, 2, -1}, {949, 1, -1}, {950, 2, -1}, {952, 1, -1}, {953, 1, -1},
+    {954, 5, -1}, {959, 1, -1}, {960, 1, -1}, {961, 1, -1}, {962, 1, -1}, {963, 1, -1}, {964, 2, -1}, {966, 1, -1},
+    {967, 1, -1}, {968, 4, -1}, {972, 1, -1}, {973, 1, -1}, {974, 2, -1}, {976, 2, -1}, {978, 3, -1}, {981, 1, -1},
+    {982, 2, -1}, {984, 1, -1}, {985, 1, -1}, {986, 1, -1}, {987, 2, -1}, {989, 2, -1}, {991, 1, -1}, {992, 2, -1},
+    {994, 1, -1}, {995, 1, -1}, {996, 1, -1}, {997, 1, -1}, {998, 2, -1}, {1000, 2, -1}, {1002, 8, -1}, {1010, 1, -1},
+    {1011, 1, -1}, {1012, 1, -1}, {1013, 1, -1}, {1014, 1, -1}, {1015, 1, -1}, {1016, 1, -1}, {1017, 1, -1}, {1018, 2, -1},
+    {1020, 1, -1}, {1021, 1, -1}, {1022, 1, -1}, {1023, 1, -1}, {1024, 1, -1}, {1025, 1, -1}, {1026, 1, -1}, {1027, 1, -1},
+    {1028, 1, -1}, {1029, 1, -1}, {1030, 1, -1}, {1031, 1, -1}, {1032, 1, -1}, {1033, 1, -1}, {1034, 1, -1}, {1035, 1, -1},
+    {1036, 1, -1}, {1037, 2, -1}, {1039, 1, -1}, {1040, 1, -1}, {1041, 1, -1}, {1042, 1, -1}, {1043, 1, -1}, {1044, 1, -1},
+    {1045, 2, -1}, {1047, 1, -1}, {1048, 2, -1}, {1050, 1, -1}, {1051, 1, -1}, {1052, 1, -1}, {1053, 1, -1}, {1054, 1, -1},
+    {1055, 6, -1}, {1061, 1, -1}, {1062, 2, -1}, {1064, 1, -1}, {1065, 2, -1}, {1067, 2, -1}, {1069, 2, -1}, {1071, 2, -1},
+    {1073, 7, -1}, {1080, 1, -1}, {1081, 3, -1}, {1084, 1, -1}, {1085, 1, -1}, {1086, 2, -1}, {1088, 1, -1}, {1089, 2, -1},
+    {1091, 1, -1}, {1092, 2, -1}, {1094, 1, -1}, {1095, 5, -1}, {1100, 1, -1}, {1101, 1, -1}, {1102, 1, -1}, {1103, 3, -1},
+    {1106, 2, -1}, {1108, 4, -1}, {1112, 1, -1}, {1113, 2, -1}, {1115, 4, -1}, {1119, 2, -1}, {1121, 3, -1}, {1124, 4, -1},
+    {1128, 1, -1}, {1129, 3, -1}, {1132, 1, -1}, {1133, 3, -1}, {1136, 1, -1}, {1137, 1, -1}, {1138, 4, -1}, {1142, 2, -1},
+    {1144, 2, -1}, {1146, 1, -1}, {1147, 7, -1}, {1154, 2, -1}, {1156, 1, -1}, {1157, 1, -1}, {1158, 1, -1}, {1159, 4, -1},
+    {1163, 2, -1}, {1165, 2, -1}, {1167, 3, -1}, {1170, 3, -1}, {1173, 2, -1}, {1175, 1, -1}, {1176, 5, -1}, {1181, 1, -1},
+    {1182, 1, -1}, {1183, 5, -1}, {1188, 2, -1}, {1190, 3, -1}, {1193, 2, -1}, {1195, 2, -1}, {1197, 1, -1}, {1198, 2, -1},
+    {1200, 2, -1}, {1202, 2, -1}, {1204, 4, -1}, {1208, 1, -1}, {1209, 1, -1}, {1210, 2, -1}, {1212, 3, -1}, {1215, 4, -1},
+    {1219, 3, -1}, {1222, 2, -1}, {1224, 2, -1}, {1226, 3, -1}, {1229, 4, -1}, {1233, 2, -1}, {1235, 3, -1}, {1238, 2, -1},
+    {1240, 2, -1}, {1242, 3, -1}, {1245, 1, -1}, {1246, 1, -1}, {1247, 1, -1}, {1248, 3, -1}, {1251, 1, -1}, {1252, 1, -1},
+    {1253, 3, -1}, {1256, 1, -1}, {1257, 2, -1}, {1259, 1, -1}, {1260, 2, -1}, {1262, 1, -1}, {1263, 2, -1}, {1265, 3, -1},
+    {1268, 1, -1}, {1269, 2, -1}, {1271, 1, -1}, {1272, 4, -1}, {1276, 1, -1}, {1277, 2, -1}, {1279, 1, -1}, {1280, 1, -1},
+    {1281, 4, -1}, {1285, 4, -1}, {1289, 1, -1}, {1290, 1, -1}, {1291, 2, -1}, {1293, 6, 146}, {1299, 2, -1}, {1301, 1, -1},
+    {1302, 4, -1}, {1306, 1, -1}, {1307, 1, -1}, {1308, 3, -1}, {1311, 1, -1}, {1312, 1, -1}, {1313, 5, -1}, {1318, 3, -1},
+    {1321, 2, -1}, {1323, 1, -1}, {1324, 3, -1}, {1327, 2, -1}, {1329, 2, -1}, {1331, 1, -1}, {1332, 4, -1}, {1336, 1, -1},
+    {1337, 3, -1}, {1340, 5, -1}, {1345, 4, -1}, {1349, 1, -1}, {1350, 1, -1}, {1351, 2, -1}, {1353, 2, -1}, {1355, 2, -1},
+    {1357, 2, -1}, {1359, 1, -1}, {1360, 1, -1}, {1361, 1, -1}, {1362, 2, -1}, {1364, 1, -1}, {1365, 1, -1}, {1366, 2, -1},
+    {1368, 1, -1}, {1369, 1, -1}, {1370, 1, -1}, {1371, 1, -1}, {1372, 1, -1}, {1373, 1, -1}, {1374, 3, -1}, {1377, 1, -1},
+    {1378, 2, -1}, {1380, 1, -1}, {1381, 9, -1}, {1390, 3, -1}, {1393, 4, -1}, {1397, 4, -1}, {1401, 5, -1}, {1406, 3, -1},
+    {1409, 2, -1}, {1411, 2, -1}, {1413, 1, -1}, {1414, 5, -1}, {1419, 2, -1}, {1421, 4, -1}, {1425, 8, -1}, {1433, 1, -1},
+    {1434, 5, -1}, {1439, 6, -1}, {1445, 8, 215}, {1453, 1, -1}, {1454, 2, -1}, {1456, 1, -1}, {1457, 4, -1}, {1461, 2, -1},
+    {1463, 1, -1}, {1464, 1, -1}, {1465, 1, -1}, {1466, 1, -1}, {1467, 3, -1}, {1470, 2, -1}, {1472, 1, -1}, {1473, 2, -1},
+    {1475, 1, -1}, {1476, 2, -1}, {1478, 3, -1}, {1481, 2, -1}, {1483, 3, -1}, {1486, 1, -1}, {1487, 2, -1}, {1489, 5, -1},
+    {1494, 2, -1}, {1496, 5, -1}, {1501, 1, -1}, {1502, 7, -1}, {1509, 1, -1}, {1510, 4, -1}, {1514, 3, -1}, {1517, 3, -1},
+    {1520, 1, -1}, {1521, 7, -1}, {1528, 1, -1}, {1529, 2, -1}, {1531, 3, -1}, {1534, 4, -1}, {1538, 7, -1}, {1545, 4, -1},
+    {1549, 2, -1}, {1551, 9, -1}, {1560, 3, -1}, {1563, 1, -1}, {1564, 2, -1}, {1566, 2, -1}, {1568, 5, -1}, {1573, 1, -1},
+    {1574, 2, -1}, {1576, 3, -1}, {1579, 2, -1}, {1581, 1, -1}, {1582, 4, -1}, {1586, 3, -1}, {1589, 1, -1}, {1590, 3, -1},
+    {1593, 7, -1}, {1600, 3, -1}, {1603, 1, -1}, {1604, 1, -1}, {1605, 1, -1}, {1606, 1, -1}, {1607, 1, -1}, {1608, 1, -1},
+    {1609, 1, -1}, {1610, 3, -1}, {1613, 3, -1}, {1616, 2, -1}, {1618, 1, -1}, {1619, 3, -1}, {1622, 10, -1}, {1632, 2, -1},
+    {1634, 1, -1}, {1635, 1, -1}, {1636, 1, -1}, {1637, 1, -1}, {1638, 1, -1}, {1639, 1, -1}, {1640, 3, -1}, {1643, 3, -1},
+    {1646, 1, -1}, {1647, 1, -1}, {1648, 7, -1}, {1655, 3, -1}, {1658, 4, -1}, {1662, 4, -1}, {1666, 3, -1}, {1669, 3, -1},
+    {1672, 2, -1}, {1674, 3, -1}, {1677, 3, -1}, {1680, 1, -1}, {1681, 1, -1}, {1682, 4, -1}, {1686, 2, -1}, {1688, 1, -1},
+    {1689, 4, -1}, {1693, 3, -1}, {1696, 1, -1}, {1697, 1, -1}, {1698, 1, -1}, {1699, 1, -1}, {1700, 10, -1}, {1710, 1, -1},
+    {1711, 7, -1}, {1718, 1, -1}, {1719, 4, -1}, {1723, 2, -1}, {1725, 1, -1}, {1726, 4, -1}, {1730, 3, -1}, {1733, 1, -1},
+    {1734, 3, -1}, {1737, 1, -1}, {1738, 4, -1}, {1742, 2, -1}, {1744, 5, -1}, {1749, 3, -1}, {1752, 1, -1}, {1753, 2, -1},
+    {1755, 1, -1}, {1756, 3, -1}, {1759, 1, -1}, {1760, 1, -1}, {1761, 1, -1}, {1762, 4, -1}, {1766, 3, -1}, {1769, 3, -1},
+    {1772, 1, -1}, {1773, 3, -1}, {1776, 3, -1}, {1779, 2, -1}, {1781, 1, -1}, {1782, 1, -1}, {1783, 2, -1}, {1785, 1, -1},
+    {1786, 2, -1}, {1788, 3, -1}, {1791, 2, -1}, {1793, 1, -1}, {1794, 2, -1}, {1796, 2, -1}, {1798, 2, -1}, {1800, 2, -1},
+    {1802, 6, -1}, {1808, 3, -1}, {1811, 1, -1}, {1812, 3, -1}, {1815, 2, -1}, {1817, 1, -1}, {1818, 1, -1}, {1819, 1, -1},
+    {1820, 1, -1}, {1821, 2, -1}, {1823, 1, -1}, {1824, 1, -1}, {1825, 3, -1}, {1828, 1, -1}, {1829, 1, -1}, {1830, 1, -1},
+    {1831, 1, -1}, {1832, 1, -1}, {1833, 1, -1}, {1834, 2, -1}, {1836, 1, -1}, {1837, 1, -1}, {1838, 2, -1}, {1840, 1, -1},
+    {1841, 1, -1}, {1842, 1, -1}, {1843, 2, -1}, {1845, 1, -1}, {1846, 3, -1}, {1849, 1, -1}, {1850, 1, -1}, {1851, 2, -1},
+    {1853, 1, -1}, {1854, 2, -1}, {1856, 1, -1}, {1857, 1, -1}, {1858, 3, -1}, {1861, 2, -1}, {1863, 2, -1}, {1865, 2, -1},
+    {1867, 1, -1}, {1868, 1, -1}, {1869, 1, -1}, {1870, 2, -1}, {1872, 1, -1}, {1873, 1, -1}, {1874, 1, -1}, {1875, 1, -1},
+    {1876, 1, -1}, {1877, 2, -1}, {1879, 1, -1}, {1880, 2, -1}, {1882, 1, -1}, {1883, 2, -1}, {1885, 1, -1}, {1886, 1, -1},
+    {1887, 1, -1}, {1888, 1, -1}, {1889, 1, -1}, {1890, 2, -1}, {1892, 1, -1}, {1893, 1, 1}, {1894, 1, -1}, {1895, 1, -1},
+    {1896, 1, -1}, {1897, 1, -1}, {1898, 1, -1}, {1899, 1, -1}, {1900, 1, -1}, {1901, 1, -1}, {1902, 1, -1}, {1903, 1, -1},
+    {1904, 1, -1}, {1905, 1, -1}, {1906, 1, -1}, {1907, 1, -1}, {1908, 1, -1}, {1909, 1, -1}, {1910, 1, -1}, {1911, 1, -1},
+    {1912, 1, -1}, {1913, 2, -1}, {1915, 1, -1}, {1916, 1, -1}, {1917, 1, -1}, {1918, 1, -1}, {1919, 1, -1}, {1920, 1, -1},
+    {1921, 1, -1}, {1922, 1, -1}, {1923, 1, -1}, {1924, 1, -1}, {1925, 1, -1}, {1926, 1, -1}, {1927, 2, -1}, {1929, 1, -1},
+    {1930, 1, -1}, {1931, 1, -1}, {1932, 1, -1}, {1933, 1, -1}, {1934, 1, -1}, {1935, 1, -1}, {1936, 1, -1}, {1937, 1, -1},
+    {1938, 1, -1}, {1939, 1, -1}, {1940, 2, -1}, {1942, 1, -1}, {1943, 3, -1}, {1946, 2, -1}, {1948, 1, -1}, {1949, 1, -1},
+    {1950, 1, -1}, {1951, 2, -1}, {1953, 0, 35}, {1953, 1, -1}, {1954, 1, -1}, {1955, 1, -1}, {1956, 1, -1}, {1957, 1, -1},
+    {1958, 1, -1}, {1959, 1, -1}, {1960, 1, -1}, {1961, 1, -1}, {1962, 2, -1}, {1964, 1, -1}, {1965, 2, -1}, {1967, 1, -1},
+    {1968, 1, -1}, {1969, 3, -1}, {1972, 1, -1}, {1973, 1, -1}, {1974, 1, -1}, {1975, 1, -1}, {1976, 1, -1}, {1977, 1, 114},
+    {1978, 1, -1}, {1979, 1, -1}, {1980, 1, -1}, {1981, 1, -1}, {1982, 1, -1}, {1983, 1, -1}, {1984, 1, -1}, {1985, 1, -1},
+    {1986, 1, -1}, {1987, 1, -1}, {1988, 1, -1}, {1989, 1, -1}, {1990, 1, -1}, {1991, 2, -1}, {1993, 1, -1}, {1994, 1, -1},
+    {1995, 1, -1}, {1996, 1, -1}, {1997, 1, -1}, {1998, 1, -1}, {1999, 1, -1}, {2000, 1, -1}, {2001, 1, -1}, {2002, 1, -1},
+    {2003, 1, -1}, {2004, 1, -1}, {2005, 1, -1}, {2006, 1, -1}, {2007, 0, 146}, {2007, 1, -1}, {2008, 1, -1}, {2009, 1, -1},
+    {2010, 1, -1}, {2011, 1, -1}, {2012, 1, -1}, {2013, 1, -1}, {2014, 0, 155}, {2014, 1, -1}, {2015, 1, -1}, {2016, 1, -1},
+    {2017, 0, 165}, {2017, 1, -1}, {2018, 1, -1}, {2019, 1, -1}, {2020, 1, -1}, {2021, 1, -1}, {2022, 1, -1}, {2023, 1, -1},
+    {2024, 1, -1}, {2025, 1, -1}, {2026, 1, -1}, {2027, 1, -1}, {2028, 1, -1}, {2029, 1, -1}, {2030, 1, -1}, {2031, 1, -1},
+    {2032, 1, -1}, {2033, 1, -1}, {2034, 1, -1}, {2035, 1, -1}, {2036, 1, -1}, {2037, 0, 183}, {2037, 2, -1}, {2039, 1, -1},
+    {2040, 2, -1}, {2042, 1, -1}, {2043, 1, -1}, {2044, 1, -1}, {2045, 1, -1}, {2046, 1, -1}, {2047, 1, -1}, {2048, 1, -1},
+    {2049, 1, -1}, {2050, 1, -1}, {2051, 1, -1}, {2052, 1, -1}, {2053, 1, -1}, {2054, 1, -1}, {2055, 1, -1}, {2056, 1, -1},
+    {2057, 1, -1}, {2058, 1, -1}, {2059, 1, -1}, {2060, 1, -1}, {2061, 1, -1}, {2062, 1, -1}, {2063, 1, -1}, {2064, 1, -1},
+    {2065, 1, -1}, {2066, 0, 215}, {2066, 1, -1}, {2067, 1, -1}, {2068, 1, -1}, {2069, 1, -1}, {2070, 1, -1}, {2071, 1, -1},
+    {2072, 1, -1}, {2073, 1, -1}, {2074, 1, -1}, {2075, 1, -1}, {2076, 1, -1}, {2077, 0, 255}, {2077, 1, -1}, {2078, 1, -1},
+    {2079, 1, -1}, {2080, 1, -1}, {2081, 1, -1}, {2082, 1, -1}, {2083, 1, -1}, {2084, 1, -1}, {2085, 0, 266}, {2085, 1, -1},
+    {2086, 1, -1}, {2087, 1, -1}, {2088, 1, -1}, {2089, 1, -1}, {2090, 1, -1}, {2091, 1, -1}, {2092, 1, -1}, {2093, 0, 274},
+    {2093, 1, -1}, {2094, 1, -1}, {2095, 1, -1}, {2096, 1, -1}, {2097, 1, -1}, {2098, 1, -1}, {2099, 1, -1}, {2100, 1, -1},
+    {2101, 1, -1}, {2102, 1, -1}, {2103, 1, -1}, {2104, 1, -1}, {2105, 13, -1}, {2118, 1, -1}, {2119, 1, -1}, {2120, 0, 340},
+    {2120, 1, -1}, {2121, 1, -1}, {2122, 1, -1}, {2123, 1, -1}, {2124, 1, -1}, {2125, 1, -1}, {2126, 1, -1}, {2127, 1, -1},
+    {2128, 1, -1}, {2129, 1, -1}, {2130, 1, -1}, {2131, 1, -1}, {2132, 0, 354}, {2132, 1, -1}, {2133, 1, -1}, {2134, 2, -1},
+    {2136, 1, -1}, {2137, 1, -1}, {2138, 1, -1}, {2139, 1, -1}, {2140, 1, -1}, {2141, 1, -1}, {2142, 0, 368}, {2142, 1, -1},
+    {2143, 1, -1}, {2144, 1, -1}, {2145, 0, 371}, {2145, 1, -1}, {2146, 1, -1}, {2147, 2, -1}, {2149, 1, -1}, {2150, 1, -1},
+    {2151, 1, -1}, {2152, 1, -1}, {2153, 1, -1}, {2154, 1, -1}, {2155, 1, -1}, {2156, 1, 386}, {2157, 1, -1}, {2158, 1, -1},
+    {2159, 1, -1}, {2160, 1, -1}, {2161, 1, -1}, {2162, 1, -1}, {2163, 0, 394}, {2163, 1, -1}, {2164, 1, -1}, {2165, 1, -1},
+    {2166, 1, -1}, {2167, 1, -1}, {2168, 1, -1}, {2169, 1, -1}, {2170, 1, -1}, {2171, 1, -1}, {2172, 1, -1}, {2173, 1, -1},
+    {2174, 1, -1}, {2175, 1, -1}, {2176, 1, -1}, {2177, 0, 431}, {2177, 1, -1}, {2178, 1, -1}, {2179, 1, -1}, {2180, 1, -1},
+    {2181, 1, -1}, {2182, 1, -1}, {2183, 1, -1}, {2184, 1, -1}, {2185, 1, -1}, {2186, 1, -1}, {2187, 1, -1}, {2188, 1, -1},
+    {2189, 1, -1}, {2190, 2, -1}, {2192, 2, -1}, {2194, 1, -1}, {2195, 3, -1}, {2198, 1, -1}, {2199, 1, -1}, {2200, 1, -1},
+    {2201, 1, -1}, {2202, 1, -1}, {2203, 1, -1}, {2204, 1, -1}, {2205, 1, -1}, {2206, 1, -1}, {2207, 1, -1}, {2208, 2, -1},
+    {2210, 2, -1}, {2212, 1, -1}, {2213, 1, -1}, {2214, 1, -1}, {2215, 1, -1}, {2216, 1, -1}, {2217, 1, -1}, {2218, 1, -1},
+    {2219, 2, -1}, {2221, 1, -1}, {2222, 1, -1}, {2223, 1, -1}, {2224, 1, -1}, {2225, 1, -1}, {2226, 1, -1}, {2227, 1, -1},
+    {2228, 1, -1}, {2229, 1, -1}, {2230, 1, -1}, {2231, 1, -1}, {2232, 1, -1}, {2233, 1, -1}, {2234, 1, -1}, {2235, 1, -1},
+    {2236, 1, -1}, {2237, 1, -1}, {2238, 1, -1}, {2239, 1, -1}, {2240, 1, -1}, {2241, 1, -1}, {2242, 1, -1}, {2243, 1, -1},
+    {2244, 1, -1}, {2245, 1, -1}, {2246, 1, -1}, {2247, 1, -1}, {2248, 3, -1}, {2251, 1, -1}, {2252, 1, -1}, {2253, 1, -1},
+    {2254, 1, -1}, {2255, 1, -1}, {2256, 1, -1}, {2257, 1, -1}, {2258, 1, -1}, {2259, 1, -1}, {2260, 1, -1}, {2261, 0, 538},
+    {2261, 1, -1}, {2262, 1, -1}, {2263, 1, -1}, {2264, 1, -1}, {2265, 1, -1}, {2266, 1, -1}, {2267, 1, -1}, {2268, 1, -1},
+    {2269, 1, -1}, {2270, 1, -1}, {2271, 1, -1}, {2272, 1, -1}, {2273, 1, -1}, {2274, 1, -1}, {2275, 1, -1}, {2276, 1, -1},
+    {2277, 1, -1}, {2278, 1, -1}, {2279, 1, -1}, {2280, 1, -1}, {2281, 1, -1}, {2282, 1, -1}, {2283, 1, -1}, {2284, 1, -1},
+    {2285, 0, 562}, {2285, 1, -1}, {2286, 1, -1}, {2287, 1, -1}, {2288, 1, -1}, {2289, 1, -1}, {2290, 1, -1}, {2291, 0, 14},
+    {2291, 1, -1}, {2292, 1, -1}, {2293, 2, -1}, {2295, 1, -1}, {2296, 2, -1}, {2298, 1, 1}, {2299, 5, -1}, {2304, 7, -1},
+    {2311, 1, -1}, {2312, 1, -1}, {2313, 0, 478}, {2313, 1, -1}, {2314, 1, -1}, {2315, 1, -1}, {2316, 1, -1}, {2317, 1, -1},
+    {2318, 1, -1}, {2319, 1, -1}, {2320, 1, -1}, {2321, 1, -1}, {2322, 1, -1}, {2323, 1, -1}, {2324, 1, -1}, {2325, 1, -1},
+    {2326, 1, -1}, {2327, 1, -1}, {2328, 1, -1}, {2329, 2, -1}, {2331, 1, -1}, {2332, 1, -1}, {2333, 1, -1}, {2334, 1, -1},
+    {2335, 1, -1}, {2336, 1, -1}, {2337, 1, -1}, {2338, 1, -1}, {2339, 3, -1}, {2342, 1, -1}, {2343, 7, -1}, {2350, 1, -1},
+    {2351, 2, -1}, {2353, 2, -1}, {2355, 1, -1}, {2356, 2, -1}, {2358, 1, -1}, {2359, 1, -1}, {2360, 2, -1}, {2362, 1, -1},
+    {2363, 12, -1}, {2375, 1, -1}, {2376, 1, -1}, {2377, 1, -1}, {2378, 1, -1}, {2379, 1, -1}, {2380, 1, -1}, {2381, 1, -1},
+    {2382, 1, -1}, {2383, 1, -1}, {2384, 1, -1}, {2385, 6, -1}, {2391, 2, -1}, {2393, 2, -1}, {2395, 1, -1}, {2396, 1, -1},
+    {2397, 1, -1}, {2398, 1, -1}, {2399, 1, -1}, {2400, 1, -1}, {2401, 1, -1}, {2402, 1, -1}, {2403, 1, -1}, {2404, 1, -1},
+    {2405, 1, -1}, {2406, 7, -1}, {2413, 1, -1}, {2414, 1, -1}, {2415, 2, -1}, {2417, 2, -1}, {2419, 3, -1}, {2422, 1, -1},
+    {2423, 1, -1}, {2424, 1, -1}, {2425, 2, -1}, {2427, 1, -1}, {2428, 1, -1}, {2429, 2, -1}, {2431, 1, -1}, {2432, 6, -1},
+    {2438, 4, -1}, {2442, 1, -1}, {2443, 1, -1}, {2444, 1, -1}, {2445, 1, -1}, {2446, 1, -1}, {2447, 1, -1}, {2448, 1, -1},
+    {2449, 1, -1}, {2450, 1, -1}, {2451, 1, -1}, {2452, 1, -1}, {2453, 1, -1}, {2454, 1, -1}, {2455, 1, -1}, {2456, 1, -1},
+    {2457, 0, 82}, {2457, 2, -1}, {2459, 1, -1}, {2460, 1, 779}, {2461, 1, -1}, {2462, 1, -1}, {2463, 1, -1}, {2464, 1, -1},
+    {2465, 1, -1}, {2466, 1, -1}, {2467, 1, -1}, {2468, 1, -1}, {2469, 1, -1}, {2470, 3, -1}, {2473, 1, -1}, {2474, 2, -1},
+    {2476, 1, -1}, {2477, 1, -1}, {2478, 5, -1}, {2483, 1, -1}, {2484, 1, -1}, {2485, 1, -1}, {2486, 2, -1}, {2488, 2, -1},
+    {2490, 1, -1}, {2491, 1, -1}, {2492, 1, -1}, {2493, 1, -1}, {2494, 1, -1}, {2495, 1, -1}, {2496, 1, -1}, {2497, 1, -1},
+    {2498, 1, -1}, {2499, 1, -1}, {2500, 1, -1}, {2501, 1, -1}, {2502, 1, -1}, {2503, 1, -1}, {2504, 1, -1}, {2505, 1, -1},
+    {2506, 1, -1}, {2507, 1, -1}, {2508, 0, 137}, {2508, 1, -1}, {2509, 1, -1}, {2510, 0, 819}, {2510, 1, -1}, {2511, 2, -1},
+    {2513, 0, 823}, {2513, 1, -1}, {2514, 1, -1}, {2515, 2, -1}, {2517, 1, -1}, {2518, 1, -1}, {2519, 1, -1}, {2520, 1, -1},
+    {2521, 1, -1}, {2522, 1, -1}, {2523, 1, -1}, {2524, 1, -1}, {2525, 1, -1}, {2526, 1, -1}, {2527, 2, -1}, {2529, 2, -1},
+    {2531, 3, -1}, {2534, 1, -1}, {2535, 1, -1}, {2536, 1, -1}, {2537, 1, -1}, {2538, 1, -1}, {2539, 1, -1}, {2540, 1, -1},
+    {2541, 1, 850}, {2542, 1, -1}, {2543, 1, -1}, {2544, 1, -1}, {2545, 1, -1}, {2546, 2, -1}, {2548, 1, -1}, {2549, 1, -1},
+    {2550, 1, -1}, {2551, 1, -1}, {2552, 2, -1}, {2554, 1, -1}, {2555, 1, -1}, {2556, 1, -1}, {2557, 1, -1}, {2558, 1, -1},
+    {2559, 1, -1}, {2560, 1, -1}, {2561, 1, -1}, {2562, 2, -1}, {2564, 1, -1}, {2565, 2, -1}, {2567, 1, -1}, {2568, 1, -1},
+    {2569, 0, 159}, {2569, 1, -1}, {2570, 1, -1}, {2571, 1, -1}, {2572, 1, -1}, {2573, 1, -1}, {2574, 1, -1}, {2575, 1, -1},
+    {2576, 1, -1}, {2577, 0, 157}, {2577, 1, -1}, {2578, 3, -1}, {2581, 4, -1}, {2585, 1, -1}, {2586, 0, 165}, {2586, 1, -1},
+    {2587, 1, -1}, {2588, 1, -1}, {2589, 0, 161}, {2589, 1, -1}, {2590, 1, -1}, {2591, 1, -1}, {2592, 1, -1}, {2593, 1, -1},
+    {2594, 2, -1}, {2596, 1, -1}, {2597, 1, -1}, {2598, 1, -1}, {2599, 1, -1}, {2600, 1, -1}, {2601, 0, 146}, {2601, 2, -1},
+    {2603, 1, -1}, {2604, 1, -1}, {2605, 1, -1}, {2606, 5, -1}, {2611, 1, -1}, {2612, 1, -1}, {2613, 1, -1}, {2614, 1, -1},
+    {2615, 1, -1}, {2616, 1, -1}, {2617, 2, -1}, {2619, 1, -1}, {2620, 1, -1}, {2621, 1, -1}, {2622, 1, -1}, {2623, 1, -1},
+    {2624, 1, -1}, {2625, 2, -1}, {2627, 1, -1}, {2628, 1, -1}, {2629, 1, -1}, {2630, 1, -1}, {2631, 1, -1}, {2632, 1, -1},
+    {2633, 1, -1}, {2634, 1, -1}, {2635, 1, -1}, {2636, 1, -1}, {2637, 1, -1}, {2638, 0, 190}, {2638, 1, -1}, {2639, 1, -1},
+    {2640, 1, -1}, {2641, 1, -1}, {2642, 1, -1}, {2643, 1, -1}, {2644, 1, -1}, {2645, 0, 186}, {2645, 2, -1}, {2647, 1, -1},
+    {2648, 1, -1}, {2649, 1, -1}, {2650, 3, -1}, {2653, 1, -1}, {2654, 1, -1}, {2655, 0, 122}, {2655, 1, -1}, {2656, 1, -1},
+    {2657, 1, -1}, {2658, 5, -1}, {2663, 1, -1}, {2664, 1, -1}, {2665, 1, -1}, {2666, 1, -1}, {2667, 1, -1}, {2668, 1, -1},
+    {2669, 1, -1}, {2670, 1, -1}, {2671, 0, 191}, {2671, 1, -1}, {2672, 1, -1}, {2673, 1, -1}, {2674, 1, -1}, {2675, 1, -1},
+    {2676, 1, -1}, {2677, 1, -1}, {2678, 1, -1}, {2679, 1, -1}, {2680, 1, -1}, {2681, 1, -1}, {2682, 1, -1}, {2683, 1, -1},
+    {2684, 1, -1}, {2685, 1, -1}, {2686, 1, -1}, {2687, 1, -1}, {2688, 1, -1}, {2689, 1, -1}, {2690, 1, -1}, {2691, 1, -1},
+    {2692, 1, -1}, {2693, 1, -1}, {2694, 1, -1}, {2695, 0, 249}, {2695, 1, -1}, {2696, 1, -1}, {2697, 1, -1}, {2698, 1, -1},
+    {2699, 1, -1}, {2700, 1, -1}, {2701, 1, -1}, {2702, 1, -1}, {2703, 1, -1}, {2704, 1, -1}, {2705, 3, -1}, {2708, 1, -1},
+    {2709, 1, -1}, {2710, 2, -1}, {2712, 1, -1}, {2713, 2, -1}, {2715, 1, -1}, {2716, 1, -1}, {2717, 1, -1}, {2718, 1, -1},
+    {2719, 2, -1}, {2721, 1, -1}, {2722, 0, 1030}, {2722, 1, -1}, {2723, 1, -1}, {2724, 3, -1}, {2727, 5, -1}, {2732, 1, -1},
+    {2733, 1, -1}, {2734, 1, -1}, {2735, 0, 250}, {2735, 1, -1}, {2736, 1, -1}, {2737, 1, -1}, {2738, 1, -1}, {2739, 0, 266},
+    {2739, 1, -1}, {2740, 1, -1}, {2741, 1, -1}, {2742, 1, -1}, {2743, 1, -1}, {2744, 1, -1}, {2745, 1, -1}, {2746, 1, -1},
+    {2747, 2, -1}, {2749, 1, -1}, {2750, 2, -1}, {2752, 1, -1}, {2753, 1, -1}, {2754, 1, -1}, {2755, 3, -1}, {2758, 1, -1},
+    {2759, 2, -1}, {2761, 3, -1}, {2764, 1, -1}, {2765, 1, -1}, {2766, 1, -1}, {2767, 1, -1}, {2768, 1, -1}, {2769, 1, -1},
+    {2770, 1, -1}, {2771, 1, -1}, {2772, 1, -1}, {2773, 1, -1}, {2774, 2, -1}, {2776, 1, -1}, {2777, 0, 215}, {2777, 2, -1},
+    {2779, 1, -1}, {2780, 1, -1}, {2781, 1, -1}, {2782, 1, -1}, {2783, 1, -1}, {2784, 2, -1}, {2786, 2, -1}, {2788, 1, -1},
+    {2789, 1, -1}, {2790, 1, -1}, {2791, 1, -1}, {2792, 2, -1}, {2794, 2, -1}, {2796, 1, -1}, {2797, 1, -1}, {2798, 1, -1},
+    {2799, 1, -1}, {2800, 1, -1}, {2801, 1, -1}, {2802, 1, -1}, {2803, 1, -1}, {2804, 4, -1}, {2808, 1, -1}, {2809, 1, -1},
+    {2810, 1, -1}, {2811, 1, -1}, {2812, 1, -1}, {2813, 1, -1}, {2814, 0, 272}, {2814, 1, -1}, {2815, 1, -1}, {2816, 0, 1103},
+    {2816, 1, -1}, {2817, 1, -1}, {2818, 1, -1}, {2819, 2, -1}, {2821, 1, -1}, {2822, 1, -1}, {2823, 2, -1}, {2825, 1, -1},
+    {2826, 1, -1}, {2827, 1, -1}, {2828, 1, -1}, {2829, 1, -1}, {2830, 1, -1}, {2831, 5, -1}, {2836, 1, -1}, {2837, 1, -1},
+    {2838, 1, -1}, {2839, 2, -1}, {2841, 1, -1}, {2842, 1, -1}, {2843, 1, -1}, {2844, 1, -1}, {2845, 1, -1}, {2846, 0, 291},
+    {2846, 1, -1}, {2847, 1, -1}, {2848, 1, -1}, {2849, 1, -1}, {2850, 2, -1}, {2852, 1, -1}, {2853, 1, -1}, {2854, 1, -1},
+    {2855, 3, -1}, {2858, 1, -1}, {2859, 2, -1}, {2861, 1, -1}, {2862, 1, -1}, {2863, 1, -1}, {2864, 0, 395}, {2864, 2, -1},
+    {2866, 1, -1}, {2867, 1, -1}, {2868, 1, -1}, {2869, 1, -1}, {2870, 1, -1}, {2871, 1, -1}, {2872, 4, -1}, {2876, 1, -1},
+    {2877, 2, -1}, {2879, 1, -1}, {2880, 1, -1}, {2881, 3, 1141}, {2884, 1, -1}, {2885, 1, -1}, {2886, 3, -1}, {2889, 1, -1},
+    {2890, 1, -1}, {2891, 1, -1}, {2892, 1, -1}, {2893, 4, -1}, {2897, 1, -1}, {2898, 1, -1}, {2899, 1, -1}, {2900, 1, -1},
+    {2901, 1, -1}, {2902, 3, -1}, {2905, 1, -1}, {2906, 1, -1}, {2907, 1, -1}, {2908, 1, -1}, {2909, 0, 1160}, {2909, 3, -1},
+    {2912, 1, -1}, {2913, 1, -1}, {2914, 1, -1}, {2915, 1, -1}, {2916, 2, -1}, {2918, 1, -1}, {2919, 3, -1}, {2922, 2, -1},
+    {2924, 1, -1}, {2925, 1, -1}, {2926, 1, -1}, {2927, 1, -1}, {2928, 0, 727}, {2928, 1, -1}, {2929, 1, -1}, {2930, 1, -1},
+    {2931, 1, -1}, {2932, 1, -1}, {2933, 1, -1}, {2934, 1, -1}, {2935, 1, -1}, {2936, 1, -1}, {2937, 1, -1}, {2938, 1, -1},
+    {2939, 1, -1}, {2940, 1, -1}, {2941, 1, -1}, {2942, 1, -1}, {2943, 1, -1}, {2944, 1, -1}, {2945, 1, -1}, {2946, 1, -1},
+    {2947, 2, -1}, {2949, 1, -1}, {2950, 1, -1}, {2951, 1, -1}, {2952, 1, -1}, {2953, 3, -1}, {2956, 1, -1}, {2957, 1, -1},
+    {2958, 1, -1}, {2959, 1, -1}, {2960, 0, 1204}, {2960, 1, -1}, {2961, 4, -1}, {2965, 1, -1}, {2966, 1, -1}, {2967, 1, -1},
+    {2968, 1, -1}, {2969, 1, -1}, {2970, 1, -1}, {2971, 1, -1}, {2972, 2, -1}, {2974, 1, -1}, {2975, 1, -1}, {2976, 4, -1},
+    {2980, 1, -1}, {2981, 5, -1}, {2986, 1, -1}, {2987, 2, -1}, {2989, 1, -1}, {2990, 1, -1}, {2991, 0, 1231}, {2991, 1, -1},
+    {2992, 1, -1}, {2993, 1, -1}, {2994, 1, -1}, {2995, 0, 369}, {2995, 1, -1}, {2996, 1, -1}, {2997, 1, -1}, {2998, 0, 372},
+    {2998, 1, -1}, {2999, 1, -1}, {3000, 1, -1}, {3001, 2, -1}, {3003, 1, -1}, {3004, 3, -1}, {3007, 3, -1}, {3010, 1, -1},
+    {3011, 1, -1}, {3012, 1, -1}, {3013, 1, -1}, {3014, 1, -1}, {3015, 1, -1}, {3016, 1, -1}, {3017, 1, -1}, {3018, 1, -1},
+    {3019, 1, -1}, {3020, 1, -1}, {3021, 1, -1}, {3022, 1, -1}, {3023, 1, -1}, {3024, 1, -1}, {3025, 1, -1}, {3026, 1, -1},
+    {3027, 1, -1}, {3028, 2, -1}, {3030, 1, -1}, {3031, 1, -1}, {3032, 1, -1}, {3033, 1, -1}, {3034, 1, -1}, {3035, 2, -1},
+    {3037, 1, -1}, {3038, 1, -1}, {3039, 2, -1}, {3041, 1, -1}, {3042, 2, -1}, {3044, 1, -1}, {3045, 1, -1}, {3046, 1, -1},
+    {3047, 1, -1}, {3048, 1, -1}, {3049, 1, -1}, {3050, 1, -1}, {3051, 1, -1}, {3052, 1, 386}, {3053, 1, -1}, {3054, 1, -1},
+    {3055, 1, -1}, {3056, 1, -1}, {3057, 2, -1}, {3059, 1, -1}, {3060, 1, -1}, {3061, 1, -1}, {3062, 1, -1}, {3063, 1, -1},
+    {3064, 1, -1}, {3065, 1, -1}, {3066, 1, -1}, {3067, 2, -1}, {3069, 1, -1}, {3070, 3, -1}, {3073, 1, -1}, {3074, 1, -1},
+    {3075, 1, -1}, {3076, 1, -1}, {3077, 1, -1}, {3078, 1, -1}, {3079, 1, -1}, {3080, 2, -1}, {3082, 1, -1}, {3083, 1, -1},
+    {3084, 1, -1}, {3085, 1, -1}, {3086, 0, 1320}, {3086, 1, -1}, {3087, 1, -1}, {3088, 0, 453}, {3088, 1, -1}, {3089, 2, -1},
+    {3091, 1, -1}, {3092, 2, -1}, {3094, 1, -1}, {3095, 3, -1}, {3098, 1, -1}, {3099, 1, -1}, {3100, 1, -1}, {3101, 1, -1},
+    {3102, 1, -1}, {3103, 1, -1}, {3104, 1, -1}, {3105, 1, -1}, {3106, 1, -1}, {3107, 1, -1}, {3108, 1, -1}, {3109, 2, -1},
+    {3111, 1, -1}, {3112, 2, -1}, {3114, 1, -1}, {3115, 1, 1343}, {3116, 1, -1}, {3117, 8, -1}, {3125, 1, -1}, {3126, 2, -1},
+    {3128, 1, -1}, {3129, 2, -1}, {3131, 2, -1}, {3133, 1, -1}, {3134, 2, -1}, {3136, 1, -1}, {3137, 2, -1}, {3139, 2, -1},
+    {3141, 1, -1}, {3142, 3, -1}, {3145, 1, -1}, {3146, 1, -1}, {3147, 1, -1}, {3148, 1, -1}, {3149, 1, -1}, {3150, 1, -1},
+    {3151, 2, -1}, {3153, 9, -1}, {3162, 1, -1}, {3163, 1, -1}, {3164, 1, -1}, {3165, 13, -1}, {3178, 1, -1}, {3179, 1, -1},
+    {3180, 1, -1}, {3181, 1, -1}, {3182, 1, -1}, {3183, 1, -1}, {3184, 1, -1}, {3185, 1, -1}, {3186, 1, -1}, {3187, 1, -1},
+    {3188, 1, -1}, {3189, 1, -1}, {3190, 1, -1}, {3191, 2, -1}, {3193, 2, -1}, {3195, 2, -1}, {3197, 1, -1}, {3198, 1, -1},
+    {3199, 1, -1}, {3200, 1, -1}, {3201, 1, -1}, {3202, 4, -1}, {3206, 1, -1}, {3207, 1, -1}, {3208, 1, -1}, {3209, 7, -1},
+    {3216, 1, -1}, {3217, 2, -1}, {3219, 1, -1}, {3220, 1, -1}, {3221, 1, -1}, {3222, 1, -1}, {3223, 1, -1}, {3224, 1, -1},
+    {3225, 1, -1}, {3226, 1, -1}, {3227, 2, -1}, {3229, 1, -1}, {3230, 1, -1}, {3231, 1, -1}, {3232, 1, -1}, {3233, 1, -1},
+    {3234, 1, -1}, {3235, 1, -1}, {3236, 1, -1}, {3237, 1, -1}, {3238, 1, -1}, {3239, 2, -1}, {3241, 1, -1}, {3242, 1, -1},
+    {3243, 1, 84}, {3244, 1, -1}, {3245, 1, -1}, {3246, 1, -1}, {3247, 1, -1}, {3248, 1, -1}, {3249, 1, -1}, {3250, 1, -1},
+    {3251, 1, -1}, {3252, 2, -1}, {3254, 1, -1}, {3255, 1, -1}, {3256, 1, -1}, {3257, 1, -1}, {3258, 1, -1}, {3259, 1, -1},
+    {3260, 1, -1}, {3261, 1, -1}, {3262, 1, -1}, {3263, 1, -1}, {3264, 1, -1}, {3265, 1, -1}, {3266, 1, -1}, {3267, 7, -1},
+    {3274, 1, -1}, {3275, 1, -1}, {3276, 3, -1}, {3279, 1, -1}, {3280, 2, -1}, {3282, 1, -1}, {3283, 1, -1}, {3284, 1, -1},
+    {3285, 1, -1}, {3286, 1, -1}, {3287, 1, -1}, {3288, 1, -1}, {3289, 2, -1}, {3291, 1, -1}, {3292, 1, -1}, {3293, 2, -1},
+    {3295, 1, -1}, {3296, 1, -1}, {3297, 1, -1}, {3298, 0, 1479}, {3298, 0, 526}, {3298, 1, -1}, {3299, 1, -1}, {3300, 1, -1},
+    {3301, 1, -1}, {3302, 1, -1}, {3303, 1, -1}, {3304, 1, -1}, {3305, 1, -1}, {3306, 1, -1}, {3307, 0, 1484}, {3307, 1, -1},
+    {3308, 1, -1}, {3309, 1, -1}, {3310, 1, -1}, {3311, 1, -1}, {3312, 2, -1}, {3314, 1, -1}, {3315, 1, -1}, {3316, 1, -1},
+    {3317, 1, -1}, {3318, 1, -1}, {3319, 1, -1}, {3320, 1, -1}, {3321, 1, -1}, {3322, 1, -1}, {3323, 2, -1}, {3325, 1, -1},
+    {3326, 1, -1}, {3327, 1, 1492}, {3328, 1, -1}, {3329, 1, -1}, {3330, 1, -1}, {3331, 1, -1}, {3332, 1, -1}, {3333, 1, -1},
+    {3334, 1, -1}, {3335, 1, -1}, {3336, 1, -1}, {3337, 1, -1}, {3338, 1, -1}, {3339, 1, -1}, {3340, 1, -1}, {3341, 1, -1},
+    {3342, 1, -1}, {3343, 1, -1}, {3344, 1, -1}, {3345, 1, -1}, {3346, 1, -1}, {3347, 1, -1}, {3348, 0, 1}, {3348, 1, 2},
+    {3349, 1, -1}, {3350, 1, -1}, {3351, 1, -1}, {3352, 0, 6}, {3352, 0, 7}, {3352, 1, -1}, {3353, 1, -1}, {3354, 1, -1},
+    {3355, 0, 11}, {3355, 1, -1}, {3356, 1, -1}, {3357, 1, -1}, {3358, 1, -1}, {3359, 1, -1}, {3360, 1, -1}, {3361, 1, -1},
+    {3362, 1, 19}, {3363, 1, -1}, {3364, 1, -1}, {3365, 1, -1}, {3366, 0, 23}, {3366, 1, -1}, {3367, 1, -1}, {3368, 1, -1},
+    {3369, 0, 27}, {3369, 1, -1}, {3370, 1, -1}, {3371, 1, -1}, {3372, 1, -1}, {3373, 1, -1}, {3374, 1, 32}, {3375, 1, -1},
+    {3376, 0, 34}, {3376, 1, -1}, {3377, 1, -1}, {3378, 1, -1}, {3379, 1, -1}, {3380, 1, -1}, {3381, 1, -1}, {3382, 1, -1},
+    {3383, 1, -1}, {3384, 1, -1}, {3385, 0, 36}, {3385, 0, 44}, {3385, 1, -1}, {3386, 1, -1}, {3387, 1, -1}, {3388, 1, -1},
+    {3389, 1, -1}, {3390, 1, -1}, {3391, 1, -1}, {3392, 1, -1}, {3393, 1, -1}, {3394, 1, -1}, {3395, 1, -1}, {3396, 1, -1},
+    {3397, 0, 62}, {3397, 1, -1}, {3398, 1, -1}, {3399, 1, -1}, {3400, 1, -1}, {3401, 1, -1}, {3402, 1, -1}, {3403, 1, -1},
+    {3404, 1, -1}, {3405, 1, -1}, {3406, 0, 72}, {3406, 0, 73}, {3406, 1, -1}, {3407, 0, 75}, {3407, 1, -1}, {3408, 1, -1},
+    {3409, 1, -1}, {3410, 1, -1}, {3411, 0, 84}, {3411, 1, -1}, {3412, 1, -1}, {3413, 1, -1}, {3414, 6, -1}, {3420, 1, -1},
+    {3421, 1, -1}, {3422, 0, 113}, {3422, 0, 114}, {3422, 1, -1}, {3423, 1, -1}, {3424, 1, -1}, {3425, 0, 118}, {3425, 1, -1},
+    {3426, 0, 120}, {3426, 1, -1}, {3427, 1, -1}, {3428, 1, -1}, {3429, 1, -1}, {3430, 1, -1}, {3431, 1, -1}, {3432, 1, -1},
+    {3433, 1, -1}, {3434, 1, -1}, {3435, 1, -1}, {3436, 1, -1}, {3437, 0, 134}, {3437, 1, 135}, {3438, 1, -1}, {3439, 1, -1},
+    {3440, 0, 138}, {3440, 0, 139}, {3440, 1, -1}, {3441, 1, -1}, {3442, 1, -1}, {3443, 1, -1}, {3444, 1, -1}, {3445, 1, -1},
+    {3446, 1, -1}, {3447, 1, -1}, {3448, 1, -1}, {3449, 1, -1}, {3450, 0, 152}, {3450, 1, -1}, {3451, 0, 154}, {3451, 1, -1},
+    {3452, 1, -1}, {3453, 1, -1}, {3454, 1, -1}, {3455, 1, -1}, {3456, 0, 168}, {3456, 1, -1}, {3457, 0, 170}, {3457, 1, -1},
+    {3458, 1, -1}, {3459, 1, -1}, {3460, 1, -1}, {3461, 1, -1}, {3462, 2, -1}, {3464, 1, -1}, {3465, 1, -1}, {3466, 1, -1},
+    {3467, 1, -1}, {3468, 1, -1}, {3469, 0, 181}, {3469, 1, -1}, {3470, 0, 183}, {3470, 1, -1}, {3471, 1, -1}, {3472, 1, -1},
+    {3473, 1, -1}, {3474, 0, 187}, {3474, 2, -1}, {3476, 1, -1}, {3477, 1, -1}, {3478, 1, -1}, {3479, 1, -1}, {3480, 1, -1},
+    {3481, 1, -1}, {3482, 1, -1}, {3483, 1, 198}, {3484, 1, -1}, {3485, 0, 200}, {3485, 0, 201}, {3485, 1, -1}, {3486, 1, -1},
+    {3487, 1, -1}, {3488, 1, -1}, {3489, 1, -1}, {3490, 1, -1}, {3491, 1, -1}, {3492, 1, -1}, {3493, 0, 210}, {3493, 0, 211},
+    {3493, 1, -1}, {3494, 1, -1}, {3495, 1, -1}, {3496, 1, -1}, {3497, 1, -1}, {3498, 1, -1}, {3499, 1, -1}, {3500, 1, -1},
+    {3501, 1, -1}, {3502, 1, -1}, {3503, 0, 223}, {3503, 10, -1}, {3513, 6, -1}, {3519, 0, 254}, {3519, 1, -1}, {3520, 1, -1},
+    {3521, 4, -1}, {3525, 1, -1}, {3526, 1, -1}, {3527, 1, -1}, {3528, 0, 264}, {3528, 1, -1}, {3529, 0, 267}, {3529, 0, 268},
+    {3529, 1, -1}, {3530, 1, -1}, {3531, 0, 271}, {3531, 1, -1}, {3532, 1, -1}, {3533, 1, -1}, {3534, 1, -1}, {3535, 1, -1},
+    {3536, 1, -1}, {3537, 1, -1}, {3538, 0, 279}, {3538, 1, -1}, {3539, 1, -1}, {3540, 1, -1}, {3541, 0, 282}, {3541, 1, -1},
+    {3542, 1, -1}, {3543, 1, -1}, {3544, 0, 286}, {3544, 2, -1}, {3546, 1, -1}, {3547, 3, -1}, {3550, 1, -1}, {3551, 1, -1},
+    {3552, 1, -1}, {3553, 1, -1}, {3554, 1, -1}, {3555, 2, -1}, {3557, 2, -1}, {3559, 1, -1}, {3560, 1, -1}, {3561, 1, -1},
+    {3562, 1, -1}, {3563, 1, -1}, {3564, 1, -1}, {3565, 1, -1}, {3566, 0, 344}, {3566, 1, -1}, {3567, 0, 346}, {3567, 1, -1},
+    {3568, 1, -1}, {3569, 1, -1}, {3570, 1, -1}, {3571, 1, -1}, {3572, 1, -1}, {3573, 1, -1}, {3574, 1, -1}, {3575, 1, -1},
+    {3576, 1, -1}, {3577, 1, 359}, {3578, 2, -1}, {3580, 1, -1}, {3581, 0, 365}, {3581, 0, 366}, {3581, 0, 367}, {3581, 1, -1},
+    {3582, 1, -1}, {3583, 1, -1}, {3584, 1, -1}, {3585, 1, -1}, {3586, 1, -1}, {3587, 1, -1}, {3588, 1, -1}, {3589, 0, 380},
+    {3589, 1, 381}, {3590, 0, 382}, {3590, 1, -1}, {3591, 1, -1}, {3592, 1, -1}, {3593, 0, 386}, {3593, 1, -1}, {3594, 1, -1},
+    {3595, 2, -1}, {3597, 1, -1}, {3598, 1, -1}, {3599, 0, 393}, {3599, 1, -1}, {3600, 0, 394}, {3600, 0, 398}, {3600, 1, -1},
+    {3601, 1, -1}, {3602, 1, -1}, {3603, 1, -1}, {3604, 1, -1}, {3605, 0, 425}, {3605, 1, -1}, {3606, 1, -1}, {3607, 1, -1},
+    {3608, 1, -1}, {3609, 1, -1}, {3610, 1, -1}, {3611, 1, -1}, {3612, 1, -1}, {3613, 0, 435}, {3613, 0, 436}, {3613, 1, -1},
+    {3614, 1, -1}, {3615, 1, -1}, {3616, 1, -1}, {3617, 1, -1}, {3618, 1, -1}, {3619, 1, -1}, {3620, 1, -1}, {3621, 0, 451},
+    {3621, 1, -1}, {3622, 1, -1}, {3623, 1, -1}, {3624, 0, 457}, {3624, 0, 458}, {3624, 1, -1}, {3625, 1, -1}, {3626, 1, -1},
+    {3627, 1, -1}, {3628, 1, -1}, {3629, 1, -1}, {3630, 0, 465}, {3630, 0, 466}, {3630, 1, -1}, {3631, 1, -1}, {3632, 0, 469},
+    {3632, 0, 470}, {3632, 1, -1}, {3633, 1, -1}, {3634, 1, -1}, {3635, 1, -1}, {3636, 1, -1}, {3637, 1, -1}, {3638, 1, -1},
+    {3639, 1, -1}, {3640, 1, -1}, {3641, 1, -1}, {3642, 2, -1}, {3644, 1, -1}, {3645, 1, -1}, {3646, 1, -1}, {3647, 0, 489},
+    {3647, 1, -1}, {3648, 0, 491}, {3648, 1, -1}, {3649, 1, -1}, {3650, 1, -1}, {3651, 1, -1}, {3652, 1, -1}, {3653, 1, -1},
+    {3654, 1, -1}, {3655, 1, -1}, {3656, 1, -1}, {3657, 1, -1}, {3658, 1, -1}, {3659, 1, -1}, {3660, 1, -1}, {3661, 2, -1},
+    {3663, 1, -1}, {3664, 1, -1}, {3665, 1, -1}, {3666, 1, 515}, {3667, 1, -1}, {3668, 1, -1}, {3669, 0, 518}, {3669, 1, -1},
+    {3670, 0, 521}, {3670, 1, -1}, {3671, 2, -1}, {3673, 1, -1}, {3674, 0, 528}, {3674, 1, -1}, {3675, 1, -1}, {3676, 1, -1},
+    {3677, 1, -1}, {3678, 1, -1}, {3679, 0, 534}, {3679, 1, -1}, {3680, 1, -1}, {3681, 0, 537}, {3681, 1, -1}, {3682, 1, -1},
+    {3683, 1, -1}, {3684, 1, -1}, {3685, 1, -1}, {3686, 1, -1}, {3687, 1, -1}, {3688, 0, 546}, {3688, 0, 547}, {3688, 1, -1},
+    {3689, 1, -1}, {3690, 1, -1}, {3691, 1, -1}, {3692, 1, -1}, {3693, 1, -1}, {3694, 0, 554}, {3694, 1, -1}, {3695, 1, -1},
+    {3696, 1, -1}, {3697, 0, 557}, {3697, 1, -1}, {3698, 1, -1}, {3699, 1, -1}, {3700, 1, -1}, {3701, 0, 563}, {3701, 0, 564},
+    {3701, 1, -1}, {3702, 1, -1}, {3703, 0, 566}, {3703, 1, -1}, {3704, 0, 568}, {3704, 1, -1}, {3705, 1, -1}, {3706, 1, -1},
+    {3707, 1, -1}, {3708, 1, -1}, {3709, 1, -1}, {3710, 0, 1}, {3710, 0, 574}, {3710, 1, -1}, {3711, 1, -1}, {3712, 1, -1},
+    {3713, 1, -1}, {3714, 0, 579}, {3714, 1, -1}, {3715, 1, -1}, {3716, 1, -1}, {3717, 1, -1}, {3718, 2, -1}, {3720, 1, -1},
+    {3721, 1, -1}, {3722, 1, -1}, {3723, 0, 597}, {3723, 1, -1}, {3724, 0, 599}, {3724, 1, -1}, {3725, 1, 2}, {3726, 1, -1},
+    {3727, 1, -1}, {3728, 1, -1}, {3729, 0, 603}, {3729, 1, -1}, {3730, 1, -1}, {3731, 1, 605}, {3732, 1, -1}, {3733, 1, -1},
+    {3734, 1, -1}, {3735, 4, -1}, {3739, 1, -1}, {3740, 1, -1}, {3741, 2, -1}, {3743, 1, -1}, {3744, 0, 616}, {3744, 1, -1},
+    {3745, 1, -1}, {3746, 1, -1}, {3747, 1, -1}, {3748, 1, -1}, {3749, 1, -1}, {3750, 1, -1}, {3751, 1, -1}, {3752, 0, 622},
+    {3752, 3, -1}, {3755, 3, -1}, {3758, 2, -1}, {3760, 1, -1}, {3761, 1, -1}, {3762, 1, -1}, {3763, 1, -1}, {3764, 1, -1},
+    {3765, 1, -1}, {3766, 1, -1}, {3767, 2, -1}, {3769, 1, -1}, {3770, 1, -1}, {3771, 0, 643}, {3771, 1, -1}, {3772, 1, -1},
+    {3773, 1, -1}, {3774, 0, 506}, {3774, 1, -1}, {3775, 1, -1}, {3776, 4, -1}, {3780, 5, -1}, {3785, 4, -1}, {3789, 7, -1},
+    {3796, 1, -1}, {3797, 4, -1}, {3801, 5, -1}, {3806, 1, -1}, {3807, 1, -1}, {3808, 1, -1}, {3809, 4, -1}, {3813, 7, -1},
+    {3820, 1, -1}, {3821, 1, -1}, {3822, 1, -1}, {3823, 1, -1}, {3824, 1, -1}, {3825, 2, -1}, {3827, 3, -1}, {3830, 2, -1},
+    {3832, 3, -1}, {3835, 1, -1}, {3836, 0, 700}, {3836, 1, -1}, {3837, 1, -1}, {3838, 2, -1}, {3840, 1, -1}, {3841, 1, -1},
+    {3842, 1, -1}, {3843, 1, -1}, {3844, 1, -1}, {3845, 1, -1}, {3846, 1, -1}, {3847, 1, -1}, {3848, 1, -1}, {3849, 1, -1},
+    {3850, 1, -1}, {3851, 1, -1}, {3852, 2, 716}, {3854, 0, 717}, {3854, 1, -1}, {3855, 1, -1}, {3856, 0, 720}, {3856, 0, 721},
+    {3856, 1, -1}, {3857, 3, -1}, {3860, 1, -1}, {3861, 1, -1}, {3862, 1, -1}, {3863, 1, -1}, {3864, 1, -1}, {3865, 1, -1},
+    {3866, 1, -1}, {3867, 3, -1}, {3870, 2, -1}, {3872, 1, -1}, {3873, 1, -1}, {3874, 1, -1}, {3875, 2, 32}, {3877, 1, -1},
+    {3878, 1, -1}, {3879, 1, -1}, {3880, 2, -1}, {3882, 2, -1}, {3884, 1, -1}, {3885, 1, -1}, {3886, 1, -1}, {3887, 1, -1},
+    {3888, 1, -1}, {3889, 0, 756}, {3889, 1, -1}, {3890, 2, -1}, {3892, 1, -1}, {3893, 1, -1}, {3894, 1, -1}, {3895, 1, -1},
+    {3896, 1, -1}, {3897, 1, -1}, {3898, 1, -1}, {3899, 1, -1}, {3900, 1, -1}, {3901, 1, -1}, {3902, 1, -1}, {3903, 1, -1},
+    {3904, 1, -1}, {3905, 1, -1}, {3906, 1, -1}, {3907, 1, -1}, {3908, 1, -1}, {3909, 2, -1}, {3911, 1, -1}, {3912, 1, -1},
+    {3913, 1, -1}, {3914, 0, 776}, {3914, 1, -1}, {3915, 1, -1}, {3916, 1, -1}, {3917, 0, 779}, {3917, 1, -1}, {3918, 1, -1},
+    {3919, 1, -1}, {3920, 0, 783}, {3920, 2, -1}, {3922, 3, -1}, {3925, 0, 84}, {3925, 1, -1}, {3926, 1, -1}, {3927, 0, 787},
+    {3927, 1, -1}, {3928, 1, -1}, {3929, 1, -1}, {3930, 1, -1}, {3931, 1, -1}, {3932, 1, -1}, {3933, 1, -1}, {3934, 0, 77},
+    {3934, 1, -1}, {3935, 1, -1}, {3936, 1, -1}, {3937, 1, -1}, {3938, 1, -1}, {3939, 3, -1}, {3942, 1, -1}, {3943, 1, -1},
+    {3944, 1, -1}, {3945, 1, -1}, {3946, 1, -1}, {3947, 1, -1}, {3948, 1, -1}, {3949, 1, -1}, {3950, 2, -1}, {3952, 1, -1},
+    {3953, 1, -1}, {3954, 1, -1}, {3955, 1, -1}, {3956, 1, -1}, {3957, 1, -1}, {3958, 1, -1}, {3959, 1, -1}, {3960, 1, -1},
+    {3961, 1, -1}, {3962, 2, -1}, {3964, 1, -1}, {3965, 0, 815}, {3965, 1, -1}, {3966, 1, -1}, {3967, 0, 818}, {3967, 1, -1},
+    {3968, 0, 821}, {3968, 1, -1}, {3969, 1, -1}, {3970, 0, 825}, {3970, 0, 826}, {3970, 1, -1}, {3971, 1, -1}, {3972, 1, -1},
+    {3973, 2, -1}, {3975, 0, 833}, {3975, 1, -1}, {3976, 1, -1}, {3977, 1, -1}, {3978, 2, -1}, {3980, 1, -1}, {3981, 3, -1},
+    {3984, 1, -1}, {3985, 1, -1}, {3986, 1, -1}, {3987, 1, -1}, {3988, 1, -1}, {3989, 1, -1}, {3990, 1, -1}, {3991, 1, -1},
+    {3992, 1, -1}, {3993, 1, -1}, {3994, 1, -1}, {3995, 1, -1}, {3996, 1, -1}, {3997, 0, 849}, {3997, 0, 850}, {3997, 1, 851},
+    {3998, 1, -1}, {3999, 1, -1}, {4000, 1, -1}, {4001, 1, -1}, {4002, 1, -1}, {4003, 1, -1}, {4004, 0, 854}, {4004, 1, -1},
+    {4005, 1, -1}, {4006, 1, -1}, {4007, 1, -1}, {4008, 0, 859}, {4008, 1, -1}, {4009, 1, -1}, {4010, 1, -1}, {4011, 1, -1},
+    {4012, 1, -1}, {4013, 1, -1}, {4014, 1, -1}, {4015, 1, -1}, {4016, 2, -1}, {4018, 1, -1}, {4019, 6, -1}, {4025, 1, -1},
+    {4026, 1, -1}, {4027, 1, -1}, {4028, 0, 888}, {4028, 1, -1}, {4029, 1, -1}, {4030, 0, 891}, {4030, 1, -1}, {4031, 1, -1},
+    {4032, 0, 894}, {4032, 1, -1}, {4033, 0, 158}, {4033, 0, 157}, {4033, 1, -1}, {4034, 1, -1}, {4035, 0, 162}, {4035, 1, -1},
+    {4036, 1, -1}, {4037, 2, -1}, {4039, 0, 902}, {4039, 0, 155}, {4039, 1, -1}, {4040, 1, -1}, {4041, 0, 905}, {4041, 0, 906},
+    {4041, 0, 907}, {4041, 0, 908}, {4041, 2, -1}, {4043, 0, 910}, {4043, 2, -1}, {4045, 1, -1}, {4046, 1, -1}, {4047, 1, -1},
+    {4048, 1, -1}, {4049, 3, -1}, {4052, 1, -1}, {4053, 1, -1}, {4054, 1, -1}, {4055, 1, -1}, {4056, 1, -1}, {4057, 2, -1},
+    {4059, 1, -1}, {4060, 1, -1}, {4061, 1, -1}, {4062, 1, -1}, {4063, 1, -1}, {4064, 1, -1}, {4065, 1, -1}, {4066, 1, -1},
+    {4067, 1, -1}, {4068, 1, -1}, {4069, 1, -1}, {4070, 3, -1}, {4073, 1, -1}, {4074, 1, -1}, {4075, 1, -1}, {4076, 1, -1},
+    {4077, 1, -1}, {4078, 0, 931}, {4078, 1, -1}, {4079, 1, -1}, {4080, 1, -1}, {4081, 1, -1}, {4082, 2, -1}, {4084, 1, -1},
+    {4085, 1, -1}, {4086, 1, -1}, {4087, 1, -1}, {4088, 1, -1}, {4089, 1, -1}, {4090, 1, -1}, {4091, 1, -1}, {4092, 1, -1},
+    {4093, 0, 945}, {4093, 1, -1}, {4094, 1, -1}, {4095, 0, 89}, {4095, 0, 948}, {4095, 1, -1}, {4096, 1, -1}, {4097, 1, -1},
+    {4098, 1, -1}, {4099, 1, -1}, {4100, 1, -1}, {4101, 1, -1}, {4102, 3, -1}, {4105, 1, -1}, {4106, 1, -1}, {4107, 1, -1},
+    {4108, 1, -1}, {4109, 1, -1}, {4110, 1, -1}, {4111, 0, 188}, {4111, 1, -1}, {4112, 2, -1}, {4114, 1, -1}, {4115, 1, -1},
+    {4116, 1, -1}, {4117, 1, -1}, {4118, 1, -1}, {4119, 1, -1}, {4120, 1, -1}, {4121, 1, -1}, {4122, 1, -1}, {4123, 5, -1},
+    {4128, 1, -1}, {4129, 1, -1}, {4130, 1, 977}, {4131, 1, -1}, {4132, 0, 979}, {4132, 0, 980}, {4132, 1, -1}, {4133, 1, -1},
+    {4134, 1, -1}, {4135, 1, -1}, {4136, 1, -1}, {4137, 1, -1}, {4138, 1, -1}, {4139, 0, 989}, {4139, 0, 990}, {4139, 1, -1},
+    {4140, 1, -1}, {4141, 1, -1}, {4142, 1, -1}, {4143, 1, -1}, {4144, 1, -1}, {4145, 1, -1}, {4146, 1, -1}, {4147, 1, -1},
+    {4148, 0, 998}, {4148, 1, -1}, {4149, 1, -1}, {4150, 1, -1}, {4151, 1, -1}, {4152, 1, -1}, {4153, 3, -1}, {4156, 0, 1004},
+    {4156, 1, -1}, {4157, 8, -1}, {4165, 0, 1012}, {4165, 1, -1}, {4166, 2, -1}, {4168, 1, -1}, {4169, 1, -1}, {4170, 1, -1},
+    {4171, 2, -1}, {4173, 1, -1}, {4174, 1, -1}, {4175, 1, -1}, {4176, 1, -1}, {4177, 0, 1025}, {4177, 1, -1}, {4178, 1, -1},
+    {4179, 1, -1}, {4180, 1, -1}, {4181, 1, -1}, {4182, 5, -1}, {4187, 0, 248}, {4187, 0, 1030}, {4187, 1, -1}, {4188, 1, -1},
+    {4189, 0, 252}, {4189, 1, -1}, {4190, 1, -1}, {4191, 2, -1}, {4193, 5, -1}, {4198, 1, -1}, {4199, 1, -1}, {4200, 0, 1041},
+    {4200, 0, 1042}, {4200, 2, -1}, {4202, 1, -1}, {4203, 1, -1}, {4204, 1, -1}, {4205, 1, -1}, {4206, 1, -1}, {4207, 1, -1},
+    {4208, 1, -1}, {4209, 1, -1}, {4210, 0, 1050}, {4210, 2, -1}, {4212, 0, 1052}, {4212, 2, -1}, {4214, 1, -1}, {4215, 1, -1},
+    {4216, 1, -1}, {4217, 1, -1}, {4218, 3, -1}, {4221, 1, -1}, {4222, 1, -1}, {4223, 1, -1}, {4224, 1, -1}, {4225, 1, -1},
+    {4226, 1, -1}, {4227, 1, -1}, {4228, 0, 1063}, {4228, 1, -1}, {4229, 1, -1}, {4230, 2, -1}, {4232, 1, -1}, {4233, 1, -1},
+    {4234, 1, -1}, {4235, 0, 1067}, {4235, 1, -1}, {4236, 1, -1}, {4237, 1, -1}, {4238, 0, 264}, {4238, 3, -1}, {4241, 1, -1},
+    {4242, 1, -1}, {4243, 1, -1}, {4244, 1, -1}, {4245, 1, -1}, {4246, 1, -1}, {4247, 1, -1}, {4248, 1, -1}, {4249, 1, -1},
+    {4250, 1, -1}, {4251, 1, -1}, {4252, 3, -1}, {4255, 1, -1}, {4256, 1, -1}, {4257, 1, -1}, {4258, 1, -1}, {4259, 1, -1},
+    {4260, 1, 1086}, {4261, 1, -1}, {4262, 2, -1}, {4264, 0, 410}, {4264, 1, -1}, {4265, 1, -1}, {4266, 1, -1}, {4267, 0, 1091},
+    {4267, 1, -1}, {4268, 1, -1}, {4269, 0, 1093}, {4269, 0, 1094}, {4269, 1, -1}, {4270, 0, 523}, {4270, 1, -1}, {4271, 1, -1},
+    {4272, 1, -1}, {4273, 1, -1}, {4274, 1, -1}, {4275, 1, -1}, {4276, 1, -1}, {4277, 1, -1}, {4278, 1, -1}, {4279, 1, -1},
+    {4280, 1, -1}, {4281, 1, -1}, {4282, 1, -1}, {4283, 0, 1105}, {4283, 0, 1106}, {4283, 1, -1}, {4284, 1, -1}, {4285, 0, 1109},
+    {4285, 0, 1110}, {4285, 1, -1}, {4286, 1, -1}, {4287, 1, -1}, {4288, 1, -1}, {4289, 1, -1}, {4290, 1, -1}, {4291, 1, -1},
+    {4292, 0, 336}, {4292, 1, -1}, {4293, 1, -1}, {4294, 1, -1}, {4295, 1, -1}, {4296, 1, -1}, {4297, 1, 284}, {4298, 1, -1},
+    {4299, 1, -1}, {4300, 1, -1}, {4301, 1, -1}, {4302, 1, -1}, {4303, 1, -1}, {4304, 0, 1125}, {4304, 1, -1}, {4305, 1, -1},
+    {4306, 2, -1}, {4308, 1, -1}, {4309, 1, -1}, {4310, 1, -1}, {4311, 1, -1}, {4312, 1, -1}, {4313, 0, 1131}, {4313, 0, 296},
+    {4313, 0, 295}, {4313, 3, -1}, {4316, 1, -1}, {4317, 1, -1}, {4318, 0, 294}, {4318, 1, -1}, {4319, 1, -1}, {4320, 1, -1},
+    {4321, 1, -1}, {4322, 0, 1134}, {4322, 1, -1}, {4323, 0, 395}, {4323, 1, -1}, {4324, 1, -1}, {4325, 0, 1137}, {4325, 1, -1},
+    {4326, 1, -1}, {4327, 0, 307}, {4327, 1, -1}, {4328, 3, -1}, {4331, 2, -1}, {4333, 1, -1}, {4334, 0, 306}, {4334, 1, -1},
+    {4335, 1, -1}, {4336, 1, -1}, {4337, 0, 1141}, {4337, 1, -1}, {4338, 1, -1}, {4339, 4, -1}, {4343, 1, -1}, {4344, 0, 314},
+    {4344, 1, -1}, {4345, 2, -1}, {4347, 1, -1}, {4348, 1, -1}, {4349, 1, -1}, {4350, 1, -1}, {4351, 0, 327}, {4351, 1, -1},
+    {4352, 1, -1}, {4353, 1, -1}, {4354, 1, -1}, {4355, 2, -1}, {4357, 1, -1}, {4358, 1, -1}, {4359, 1, -1}, {4360, 4, -1},
+    {4364, 1, -1}, {4365, 4, -1}, {4369, 1, -1}, {4370, 1, -1}, {4371, 1, -1}, {4372, 1, -1}, {4373, 0, 1161}, {4373, 1, -1},
+    {4374, 1, -1}, {4375, 1, -1}, {4376, 1, -1}, {4377, 1, -1}, {4378, 1, -1}, {4379, 1, -1}, {4380, 1, -1}, {4381, 1, -1},
+    {4382, 1, -1}, {4383, 1, -1}, {4384, 2, -1}, {4386, 1, -1}, {4387, 1, -1}, {4388, 1, -1}, {4389, 1, -1}, {4390, 2, -1},
+    {4392, 1, -1}, {4393, 1, -1}, {4394, 1, -1}, {4395, 2, -1}, {4397, 0, 1183}, {4397, 1, -1}, {4398, 1, -1}, {4399, 1, -1},
+    {4400, 1, -1}, {4401, 1, -1}, {4402, 1, -1}, {4403, 1, -1}, {4404, 0, 1189}, {4404, 1, -1}, {4405, 1, -1}, {4406, 0, 1192},
+    {4406, 1, -1}, {4407, 0, 349}, {4407, 1, -1}, {4408, 1, -1}, {4409, 1, -1}, {4410, 1, -1}, {4411, 1, -1}, {4412, 0, 1196},
+    {4412, 1, -1}, {4413, 1, -1}, {4414, 1, -1}, {4415, 1, -1}, {4416, 1, -1}, {4417, 1, -1}, {4418, 1, -1}, {4419, 1, -1},
+    {4420, 1, -1}, {4421, 1, -1}, {4422, 0, 1205}, {4422, 1, -1}, {4423, 1, 1207}, {4424, 1, 1208}, {4425, 1, -1}, {4426, 1, -1},
+    {4427, 1, -1}, {4428, 0, 1212}, {4428, 1, -1}, {4429, 1, -1}, {4430, 1, -1}, {4431, 1, -1}, {4432, 1, -1}, {4433, 1, 1217},
+    {4434, 1, -1}, {4435, 0, 97}, {4435, 2, 1219}, {4437, 2, -1}, {4439, 1, -1}, {4440, 0, 1222}, {4440, 1, -1}, {4441, 1, -1},
+    {4442, 1, -1}, {4443, 1, -1}, {4444, 1, -1}, {4445, 0, 1227}, {4445, 0, 1228}, {4445, 1, -1}, {4446, 1, -1}, {4447, 1, -1},
+    {4448, 1, -1}, {4449, 0, 1232}, {4449, 2, -1}, {4451, 9, -1}, {4460, 1, -1}, {4461, 1, -1}, {4462, 1, -1}, {4463, 0, 1244},
+    {4463, 1, -1}, {4464, 1, -1}, {4465, 0, 373}, {4465, 6, -1}, {4471, 1, -1}, {4472, 1, -1}, {4473, 1, -1}, {4474, 1, -1},
+    {4475, 1, -1}, {4476, 3, -1}, {4479, 2, -1}, {4481, 1, -1}, {4482, 1, -1}, {4483, 1, -1}, {4484, 0, 1255}, {4484, 1, -1},
+    {4485, 0, 1257}, {4485, 1, -1}, {4486, 1, -1}, {4487, 1, -1}, {4488, 1, -1}, {4489, 2, -1}, {4491, 1, -1}, {4492, 1, 381},
+    {4493, 1, -1}, {4494, 1, -1}, {4495, 1, -1}, {4496, 1, -1}, {4497, 1, -1}, {4498, 1, -1}, {4499, 1, -1}, {4500, 1, -1},
+    {4501, 1, -1}, {4502, 4, -1}, {4506, 1, -1}, {4507, 11, -1}, {4518, 1, -1}, {4519, 1, -1}, {4520, 1, -1}, {4521, 1, -1},
+    {4522, 1, -1}, {4523, 2, -1}, {4525, 1, -1}, {4526, 1, -1}, {4527, 1, -1}, {4528, 1, -1}, {4529, 0, 1289}, {4529, 1, -1},
+    {4530, 1, -1}, {4531, 1, -1}, {4532, 1, -1}, {4533, 4, -1}, {4537, 1, -1}, {4538, 0, 386}, {4538, 1, -1}, {4539, 1, -1},
+    {4540, 0, 1295}, {4540, 2, -1}, {4542, 0, 1297}, {4542, 1, -1}, {4543, 1, -1}, {4544, 1, -1}, {4545, 1, -1}, {4546, 1, -1},
+    {4547, 1, -1}, {4548, 0, 1302}, {4548, 1, -1}, {4549, 1, -1}, {4550, 1, -1}, {4551, 1, -1}, {4552, 1, -1}, {4553, 1, -1},
+    {4554, 1, -1}, {4555, 1, -1}, {4556, 1, -1}, {4557, 2, -1}, {4559, 1, -1}, {4560, 1, -1}, {4561, 1, -1}, {4562, 1, -1},
+    {4563, 0, 425}, {4563, 1, -1}, {4564, 1, -1}, {4565, 1, -1}, {4566, 1, -1}, {4567, 4, -1}, {4571, 1, -1}, {4572, 1, -1},
+    {4573, 1, -1}, {4574, 0, 1322}, {4574, 1, -1}, {4575, 1, -1}, {4576, 1, -1}, {4577, 0, 454}, {4577, 1, -1}, {4578, 1, -1},
+    {4579, 1, -1}, {4580, 1, -1}, {4581, 1, -1}, {4582, 1, -1}, {4583, 1, -1}, {4584, 0, 1331}, {4584, 3, -1}, {4587, 1, -1},
+    {4588, 2, -1}, {4590, 1, 1335}, {4591, 1, -1}, {4592, 1, -1}, {4593, 2, -1}, {4595, 1, -1}, {4596, 0, 1339}, {4596, 1, -1},
+    {4597, 1, -1}, {4598, 1, -1}, {4599, 1, -1}, {4600, 1, -1}, {4601, 0, 1343}, {4601, 1, -1}, {4602, 0, 475}, {4602, 1, -1},
+    {4603, 2, -1}, {4605, 2, -1}, {4607, 2, -1}, {4609, 1, -1}, {4610, 1, -1}, {4611, 1, -1}, {4612, 1, -1}, {4613, 1, -1},
+    {4614, 1, -1}, {4615, 1, -1}, {4616, 1, -1}, {4617, 1, -1}, {4618, 0, 1357}, {4618, 2, -1}, {4620, 1, -1}, {4621, 0, 1361},
+    {4621, 2, -1}, {4623, 1, -1}, {4624, 1, -1}, {4625, 1, -1}, {4626, 1, -1}, {4627, 1, -1}, {4628, 2, -1}, {4630, 0, 442},
+    {4630, 1, -1}, {4631, 1, -1}, {4632, 1, -1}, {4633, 1, -1}, {4634, 1, -1}, {4635, 1, -1}, {4636, 1, -1}, {4637, 2, -1},
+    {4639, 1, -1}, {4640, 1, -1}, {4641, 0, 1370}, {4641, 1, -1}, {4642, 1, -1}, {4643, 2, -1}, {4645, 1, -1}, {4646, 2, -1},
+    {4648, 1, -1}, {4649, 1, -1}, {4650, 3, -1}, {4653, 6, -1}, {4659, 0, 457}, {4659, 1, -1}, {4660, 1, 1383}, {4661, 1, 1384},
+    {4662, 1, 1385}, {4663, 0, 459}, {4663, 1, -1}, {4664, 2, -1}, {4666, 2, -1}, {4668, 1, -1}, {4669, 1, -1}, {4670, 1, -1},
+    {4671, 2, -1}, {4673, 1, -1}, {4674, 3, -1}, {4677, 1, -1}, {4678, 2, -1}, {4680, 1, -1}, {4681, 1, -1}, {4682, 1, -1},
+    {4683, 0, 1404}, {4683, 1, -1}, {4684, 1, -1}, {4685, 1, -1}, {4686, 0, 1407}, {4686, 1, -1}, {4687, 1, -1}, {4688, 0, 1409},
+    {4688, 1, -1}, {4689, 1, -1}, {4690, 1, -1}, {4691, 1, -1}, {4692, 1, -1}, {4693, 1, -1}, {4694, 1, -1}, {4695, 1, -1},
+    {4696, 1, -1}, {4697, 1, -1}, {4698, 1, -1}, {4699, 0, 109}, {4699, 1, -1}, {4700, 1, -1}, {4701, 2, -1}, {4703, 1, -1},
+    {4704, 1, -1}, {4705, 1, -1}, {4706, 1, -1}, {4707, 1, -1}, {4708, 1, -1}, {4709, 1, -1}, {4710, 1, -1}, {4711, 1, -1},
+    {4712, 1, -1}, {4713, 1, -1}, {4714, 1, -1}, {4715, 1, -1}, {4716, 1, -1}, {4717, 1, -1}, {4718, 1, -1}, {4719, 1, -1},
+    {4720, 1, -1}, {4721, 1, -1}, {4722, 1, -1}, {4723, 1, -1}, {4724, 1, -1}, {4725, 1, -1}, {4726, 1, -1}, {4727, 0, 1438},
+    {4727, 1, -1}, {4728, 1, -1}, {4729, 1, -1}, {4730, 1, -1}, {4731, 0, 1441}, {4731, 1, -1}, {4732, 2, -1}, {4734, 1, -1},
+    {4735, 1, -1}, {4736, 1, -1}, {4737, 1, -1}, {4738, 1, -1}, {4739, 0, 84}, {4739, 1, -1}, {4740, 1, -1}, {4741, 1, -1},
+    {4742, 1, -1}, {4743, 1, -1}, {4744, 1, -1}, {4745, 3, -1}, {4748, 1, -1}, {4749, 1, -1}, {4750, 1, -1}, {4751, 1, -1},
+    {4752, 1, -1}, {4753, 1, -1}, {4754, 1, -1}, {4755, 1, -1}, {4756, 2, -1}, {4758, 1, -1}, {4759, 1, 1459}, {4760, 1, -1},
+    {4761, 1, -1}, {4762, 2, -1}, {4764, 1, -1}, {4765, 1, -1}, {4766, 1, -1}, {4767, 1, -1}, {4768, 1, -1}, {4769, 3, -1},
+    {4772, 2, -1}, {4774, 2, -1}, {4776, 2, -1}, {4778, 0, 1468}, {4778, 1, -1}, {4779, 0, 1204}, {4779, 1, -1}, {4780, 1, -1},
+    {4781, 1, -1}, {4782, 1, -1}, {4783, 1, -1}, {4784, 0, 1472}, {4784, 1, -1}, {4785, 2, -1}, {4787, 1, -1}, {4788, 1, -1},
+    {4789, 1, -1}, {4790, 1, -1}, {4791, 1, -1}, {4792, 1, -1}, {4793, 1, -1}, {4794, 1, -1}, {4795, 1, -1}, {4796, 1, -1},
+    {4797, 1, -1}, {4798, 0, 1480}, {4798, 1, -1}, {4799, 1, -1}, {4800, 1, -1}, {4801, 1, -1}, {4802, 1, -1}, {4803, 1, -1},
+    {4804, 1, -1}, {4805, 0, 1483}, {4805, 1, -1}, {4806, 1, -1}, {4807, 1, -1}, {4808, 1, -1}, {4809, 1, -1}, {4810, 1, -1},
+    {4811, 1, -1}, {4812, 1, -1}, {4813, 1, -1}, {4814, 1, -1}, {4815, 1, -1}, {4816, 1, -1}, {4817, 1, -1}, {4818, 1, -1},
+    {4819, 1, -1}, {4820, 1, -1}, {4821, 1, -1}, {4822, 1, -1}, {4823, 1, -1}, {4824, 1, -1}, {4825, 1, -1}, {4826, 0, 1491},
+    {4826, 0, 1492}, {4826, 0, 1493}, {4826, 1, -1}, {4827, 1, -1}, {4828, 1, -1}, {4829, 1, -1}, {4830, 1, 1498}, {4831, 1, -1},
+    {4832, 1, -1}, {4833, 0, 1501}, {4833, 1, -1}, {4834, 1, -1}, {4835, 1, -1}, {4836, 0, 1504}, {4836, 1, -1}, {4837, 1, -1},
+    {4838, 1, -1}, {4839, 1, -1}, {4840, 0, 1509}, {4840, 1, -1}, {4841, 1, 0}, {4842, 0, 2}, {4842, 1, -1}, {4843, 1, -1},
+    {4844, 1, 5}, {4845, 1, -1}, {4846, 1, -1}, {4847, 1, -1}, {4848, 1, -1}, {4849, 0, 13}, {4849, 1, -1}, {4850, 1, 15},
+    {4851, 0, 16}, {4851, 1, -1}, {4852, 1, -1}, {4853, 0, 19}, {4853, 1, -1}, {4854, 0, 21}, {4854, 1, -1}, {4855, 1, -1},
+    {4856, 1, -1}, {4857, 0, 26}, {4857, 0, 28}, {4857, 1, -1}, {4858, 0, 25}, {4858, 1, -1}, {4859, 0, 31}, {4859, 0, 32},
+    {4859, 1, -1}, {4860, 1, -1}, {4861, 1, -1}, {4862, 1, -1}, {4863, 1, -1}, {4864, 1, -1}, {4865, 1, -1}, {4866, 0, 41},
+    {4866, 1, -1}, {4867, 1, -1}, {4868, 1, -1}, {4869, 1, -1}, {4870, 1, -1}, {4871, 2, -1}, {4873, 1, -1}, {4874, 1, -1},
+    {4875, 1, -1}, {4876, 0, 57}, {4876, 1, -1}, {4877, 1, -1}, {4878, 1, -1}, {4879, 0, 61}, {4879, 1, -1}, {4880, 1, -1},
+    {4881, 0, 65}, {4881, 0, 66}, {4881, 0, 67}, {4881, 1, -1}, {4882, 0, 69}, {4882, 1, -1}, {4883, 1, -1}, {4884, 1, -1},
+    {4885, 1, -1}, {4886, 1, -1}, {4887, 1, -1}, {4888, 0, 83}, {4888, 1, -1}, {4889, 1, -1}, {4890, 1, -1}, {4891, 1, -1},
+    {4892, 1, -1}, {4893, 1, -1}, {4894, 1, -1}, {4895, 1, -1}, {4896, 1, -1}, {4897, 0, 111}, {4897, 1, -1}, {4898, 1, -1},
+    {4899, 1, -1}, {4900, 1, 117}, {4901, 0, 119}, {4901, 1, -1}, {4902, 1, -1}, {4903, 1, -1}, {4904, 2, -1}, {4906, 1, -1},
+    {4907, 0, 127}, {4907, 1, -1}, {4908, 2, -1}, {4910, 1, -1}, {4911, 0, 132}, {4911, 0, 133}, {4911, 0, 135}, {4911, 1, -1},
+    {4912, 1, -1}, {4913, 1, -1}, {4914, 0, 142}, {4914, 1, -1}, {4915, 1, -1}, {4916, 0, 144}, {4916, 0, 145}, {4916, 2, -1},
+    {4918, 1, -1}, {4919, 1, -1}, {4920, 1, -1}, {4921, 0, 153}, {4921, 0, 156}, {4921, 1, -1}, {4922, 0, 164}, {4922, 1, -1},
+    {4923, 1, -1}, {4924, 1, -1}, {4925, 1, -1}, {4926, 0, 172}, {4926, 1, -1}, {4927, 0, 171}, {4927, 1, -1}, {4928, 1, -1},
+    {4929, 1, -1}, {4930, 0, 176}, {4930, 1, -1}, {4931, 0, 178}, {4931, 1, -1}, {4932, 1, 180}, {4933, 0, 182}, {4933, 1, -1},
+    {4934, 1, -1}, {4935, 1, -1}, {4936, 1, -1}, {4937, 1, -1}, {4938, 1, -1}, {4939, 1, -1}, {4940, 1, -1}, {4941, 0, 193},
+    {4941, 0, 194}, {4941, 0, 195}, {4941, 1, -1}, {4942, 1, -1}, {4943, 0, 198}, {4943, 1, -1}, {4944, 0, 202}, {4944, 0, 203},
+    {4944, 1, -1}, {4945, 1, -1}, {4946, 0, 206}, {4946, 0, 207}, {4946, 1, -1}, {4947, 1, -1}, {4948, 0, 212}, {4948, 0, 213},
+    {4948, 0, 214}, {4948, 1, -1}, {4949, 1, -1}, {4950, 0, 218}, {4950, 1, -1}, {4951, 0, 220}, {4951, 1, -1}, {4952, 1, -1},
+    {4953, 2, -1}, {4955, 1, -1}, {4956, 1, -1}, {4957, 1, -1}, {4958, 1, -1}, {4959, 2, -1}, {4961, 1, -1}, {4962, 1, -1},
+    {4963, 1, -1}, {4964, 1, -1}, {4965, 1, -1}, {4966, 1, -1}, {4967, 1, -1}, {4968, 1, -1}, {4969, 1, -1}, {4970, 1, -1},
+    {4971, 1, -1}, {4972, 1, -1}, {4973, 1, -1}, {4974, 1, -1}, {4975, 1, -1}, {4976, 1, -1}, {4977, 0, 261}, {4977, 2, -1},
+    {4979, 0, 219}, {4979, 1, -1}, {4980, 1, -1}, {4981, 1, -1}, {4982, 1, -1}, {4983, 0, 273}, {4983, 0, 270}, {4983, 0, 275},
+    {4983, 1, -1}, {4984, 1, -1}, {4985, 1, -1}, {4986, 1, -1}, {4987, 1, -1}, {4988, 1, -1}, {4989, 1, -1}, {4990, 1, -1},
+    {4991, 0, 285}, {4991, 1, -1}, {4992, 1, -1}, {4993, 1, -1}, {4994, 1, -1}, {4995, 1, -1}, {4996, 1, -1}, {4997, 1, -1},
+    {4998, 1, -1}, {4999, 2, -1}, {5001, 1, -1}, {5002, 1, -1}, {5003, 1, -1}, {5004, 1, -1}, {5005, 1, -1}, {5006, 3, -1},
+    {5009, 1, -1}, {5010, 1, -1}, {5011, 0, 338}, {5011, 1, -1}, {5012, 1, -1}, {5013, 1, -1}, {5014, 1, 343}, {5015, 1, -1},
+    {5016, 1, -1}, {5017, 1, -1}, {5018, 1, -1}, {5019, 1, -1}, {5020, 0, 351}, {5020, 1, -1}, {5021, 0, 355}, {5021, 1, -1},
+    {5022, 1, -1}, {5023, 1, -1}, {5024, 0, 359}, {5024, 2, -1}, {5026, 1, -1}, {5027, 1, -1}, {5028, 1, -1}, {5029, 1, -1},
+    {5030, 0, 370}, {5030, 1, -1}, {5031, 1, -1}, {5032, 1, -1}, {5033, 1, -1}, {5034, 0, 379}, {5034, 0, 381}, {5034, 0, 383},
+    {5034, 0, 384}, {5034, 1, -1}, {5035, 1, -1}, {5036, 0, 388}, {5036, 0, 389}, {5036, 1, -1}, {5037, 1, -1}, {5038, 1, -1},
+    {5039, 1, -1}, {5040, 8, -1}, {5048, 0, 421}, {5048, 1, -1}, {5049, 1, -1}, {5050, 0, 424}, {5050, 1, -1}, {5051, 1, -1},
+    {5052, 0, 428}, {5052, 1, -1}, {5053, 1, -1}, {5054, 1, -1}, {5055, 1, -1}, {5056, 1, -1}, {5057, 4, -1}, {5061, 1, -1},
+    {5062, 1, -1}, {5063, 0, 440}, {5063, 0, 441}, {5063, 1, -1}, {5064, 0, 449}, {5064, 0, 450}, {5064, 1, -1}, {5065, 1, -1},
+    {5066, 1, -1}, {5067, 1, -1}, {5068, 1, -1}, {5069, 1, 461}, {5070, 1, -1}, {5071, 1, -1}, {5072, 0, 464}, {5072, 1, -1},
+    {5073, 1, -1}, {5074, 1, -1}, {5075, 1, -1}, {5076, 1, -1}, {5077, 1, -1}, {5078, 4, -1}, {5082, 0, 479}, {5082, 1, -1},
+    {5083, 0, 481}, {5083, 1, -1}, {5084, 1, -1}, {5085, 0, 484}, {5085, 1, -1}, {5086, 1, -1}, {5087, 1, -1}, {5088, 1, 488},
+    {5089, 1, -1}, {5090, 1, -1}, {5091, 1, -1}, {5092, 2, -1}, {5094, 2, -1}, {5096, 1, -1}, {5097, 0, 501}, {5097, 1, -1},
+    {5098, 1, -1}, {5099, 1, -1}, {5100, 2, -1}, {5102, 1, -1}, {5103, 1, -1}, {5104, 2, -1}, {5106, 0, 510}, {5106, 1, -1},
+    {5107, 1, -1}, {5108, 0, 513}, {5108, 1, -1}, {5109, 0, 515}, {5109, 1, -1}, {5110, 0, 517}, {5110, 2, -1}, {5112, 1, -1},
+    {5113, 0, 522}, {5113, 1, -1}, {5114, 1, -1}, {5115, 0, 529}, {5115, 0, 530}, {5115, 1, -1}, {5116, 1, -1}, {5117, 1, -1},
+    {5118, 0, 535}, {5118, 0, 536}, {5118, 0, 539}, {5118, 0, 540}, {5118, 0, 541}, {5118, 0, 542}, {5118, 0, 543}, {5118, 1, -1},
+    {5119, 1, -1}, {5120, 0, 548}, {5120, 0, 549}, {5120, 0, 550}, {5120, 0, 551}, {5120, 1, -1}, {5121, 1, -1}, {5122, 0, 555},
+    {5122, 1, -1}, {5123, 0, 556}, {5123, 0, 558}, {5123, 0, 559}, {5123, 1, -1}, {5124, 1, -1}, {5125, 1, 565}, {5126, 1, 76},
+    {5127, 1, 567}, {5128, 1, -1}, {5129, 1, -1}, {5130, 1, -1}, {5131, 1, -1}, {5132, 1, -1}, {5133, 1, -1}, {5134, 1, -1},
+    {5135, 0, 576}, {5135, 1, -1}, {5136, 0, 578}, {5136, 0, 580}, {5136, 1, -1}, {5137, 1, -1}, {5138, 2, -1}, {5140, 1, -1},
+    {5141, 1, -1}, {5142, 1, -1}, {5143, 1, -1}, {5144, 0, 596}, {5144, 1, -1}, {5145, 0, 600}, {5145, 0, 2}, {5145, 1, -1},
+    {5146, 1, 601}, {5147, 0, 602}, {5147, 2, -1}, {5149, 1, -1}, {5150, 0, 605}, {5150, 1, -1}, {5151, 1, -1}, {5152, 0, 607},
+    {5152, 1, -1}, {5153, 1, -1}, {5154, 1, -1}, {5155, 1, -1}, {5156, 1, -1}, {5157, 1, -1}, {5158, 0, 496}, {5158, 1, -1},
+    {5159, 1, -1}, {5160, 1, -1}, {5161, 1, -1}, {5162, 1, -1}, {5163, 1, -1}, {5164, 1, -1}, {5165, 0, 619}, {5165, 0, 620},
+    {5165, 1, -1}, {5166, 1, -1}, {5167, 1, -1}, {5168, 1, -1}, {5169, 1, -1}, {5170, 1, -1}, {5171, 1, -1}, {5172, 1, -1},
+    {5173, 1, -1}, {5174, 1, -1}, {5175, 1, -1}, {5176, 1, -1}, {5177, 1, -1}, {5178, 1, -1}, {5179, 3, -1}, {5182, 1, -1},
+    {5183, 1, -1}, {5184, 1, -1}, {5185, 1, -1}, {5186, 1, -1}, {5187, 1, -1}, {5188, 0, 645}, {5188, 0, 646}, {5188, 1, -1},
+    {5189, 1, -1}, {5190, 1, -1}, {5191, 1, -1}, {5192, 1, -1}, {5193, 1, -1}, {5194, 0, 652}, {5194, 1, -1}, {5195, 1, -1},
+    {5196, 1, -1}, {5197, 1, -1}, {5198, 1, -1}, {5199, 1, -1}, {5200, 1, -1}, {5201, 1, -1}, {5202, 0, 661}, {5202, 1, -1},
+    {5203, 1, -1}, {5204, 1, -1}, {5205, 1, -1}, {5206, 1, -1}, {5207, 1, -1}, {5208, 1, -1}, {5209, 1, -1}, {5210, 1, -1},
+    {5211, 1, -1}, {5212, 1, -1}, {5213, 0, 173}, {5213, 1, -1}, {5214, 1, -1}, {5215, 1, -1}, {5216, 1, -1}, {5217, 1, -1},
+    {5218, 1, -1}, {5219, 1, -1}, {5220, 1, -1}, {5221, 1, -1}, {5222, 1, -1}, {5223, 1, -1}, {5224, 0, 684}, {5224, 1, -1},
+    {5225, 1, -1}, {5226, 1, -1}, {5227, 1, -1}, {5228, 1, -1}, {5229, 1, -1}, {5230, 1, -1}, {5231, 1, -1}, {5232, 1, -1},
+    {5233, 0, 692}, {5233, 1, -1}, {5234, 0, 611}, {5234, 1, -1}, {5235, 0, 694}, {5235, 1, -1}, {5236, 1, -1}, {5237, 0, 697},
+    {5237, 1, -1}, {5238, 0, 30}, {5238, 1, -1}, {5239, 2, -1}, {5241, 1, -1}, {5242, 1, -1}, {5243, 1, -1}, {5244, 1, -1},
+    {5245, 1, -1}, {5246, 1, -1}, {5247, 0, 706}, {5247, 1, -1}, {5248, 1, -1}, {5249, 1, -1}, {5250, 1, -1}, {5251, 1, -1},
+    {5252, 1, -1}, {5253, 2, -1}, {5255, 0, 714}, {5255, 1, 42}, {5256, 1, -1}, {5257, 0, 716}, {5257, 1, -1}, {5258, 0, 718},
+    {5258, 2, -1}, {5260, 0, 722}, {5260, 0, 723}, {5260, 1, -1}, {5261, 1, -1}, {5262, 0, 724}, {5262, 1, -1}, {5263, 1, -1},
+    {5264, 1, -1}, {5265, 2, -1}, {5267, 2, -1}, {5269, 2, -1}, {5271, 0, 738}, {5271, 1, -1}, {5272, 1, -1}, {5273, 0, 477},
+    {5273, 1, -1}, {5274, 1, -1}, {5275, 0, 740}, {5275, 1, -1}, {5276, 0, 32}, {5276, 1, -1}, {5277, 1, -1}, {5278, 1, -1},
+    {5279, 0, 744}, {5279, 0, 745}, {5279, 1, -1}, {5280, 0, 747}, {5280, 1, -1}, {5281, 1, -1}, {5282, 1, -1}, {5283, 1, -1},
+    {5284, 1, -1}, {5285, 1, -1}, {5286, 1, -1}, {5287, 1, -1}, {5288, 1, -1}, {5289, 1, -1}, {5290, 1, -1}, {5291, 0, 762},
+    {5291, 1, -1}, {5292, 3, -1}, {5295, 1, -1}, {5296, 1, -1}, {5297, 1, -1}, {5298, 1, -1}, {5299, 1, -1}, {5300, 1, -1},
+    {5301, 1, -1}, {5302, 0, 87}, {5302, 0, 770}, {5302, 1, -1}, {5303, 1, -1}, {5304, 0, 98}, {5304, 0, 773}, {5304, 1, -1},
+    {5305, 1, -1}, {5306, 1, -1}, {5307, 1, -1}, {5308, 1, -1}, {5309, 1, -1}, {5310, 1, -1}, {5311, 1, -1}, {5312, 1, -1},
+    {5313, 1, -1}, {5314, 1, -1}, {5315, 1, -1}, {5316, 0, 81}, {5316, 1, -1}, {5317, 1, -1}, {5318, 1, -1}, {5319, 1, -1},
+    {5320, 1, -1}, {5321, 1, -1}, {5322, 0, 789}, {5322, 1, -1}, {5323, 1, -1}, {5324, 1, -1}, {5325, 0, 793}, {5325, 2, -1},
+    {5327, 1, -1}, {5328, 1, -1}, {5329, 1, -1}, {5330, 1, -1}, {5331, 1, -1}, {5332, 1, -1}, {5333, 1, -1}, {5334, 1, -1},
+    {5335, 1, -1}, {5336, 1, -1}, {5337, 0, 800}, {5337, 0, 801}, {5337, 0, 802}, {5337, 1, -1}, {5338, 1, -1}, {5339, 0, 805},
+    {5339, 1, -1}, {5340, 1, -1}, {5341, 1, -1}, {5342, 1, -1}, {5343, 0, 807}, {5343, 1, -1}, {5344, 1, -1}, {5345, 0, 794},
+    {5345, 1, -1}, {5346, 1, -1}, {5347, 1, -1}, {5348, 0, 812}, {5348, 1, 813}, {5349, 1, -1}, {5350, 0, 816}, {5350, 1, -1},
+    {5351, 1, -1}, {5352, 1, -1}, {5353, 1, -1}, {5354, 1, -1}, {5355, 1, -1}, {5356, 3, -1}, {5359, 2, -1}, {5361, 0, 832},
+    {5361, 0, 834}, {5361, 1, -1}, {5362, 0, 836}, {5362, 0, 837}, {5362, 1, -1}, {5363, 1, -1}, {5364, 0, 840}, {5364, 1, -1},
+    {5365, 1, -1}, {5366, 1, -1}, {5367, 1, -1}, {5368, 1, -1}, {5369, 1, -1}, {5370, 1, -1}, {5371, 1, -1}, {5372, 2, -1},
+    {5374, 1, -1}, {5375, 1, -1}, {5376, 1, -1}, {5377, 0, 848}, {5377, 1, -1}, {5378, 0, 130}, {5378, 0, 851}, {5378, 0, 852},
+    {5378, 0, 853}, {5378, 1, -1}, {5379, 1, -1}, {5380, 1, -1}, {5381, 1, -1}, {5382, 1, -1}, {5383, 1, -1}, {5384, 1, -1},
+    {5385, 1, -1}, {5386, 1, -1}, {5387, 1, -1}, {5388, 0, 862}, {5388, 1, -1}, {5389, 1, -1}, {5390, 0, 865}, {5390, 0, 866},
+    {5390, 1, -1}, {5391, 0, 867}, {5391, 1, -1}, {5392, 1, -1}, {5393, 6, -1}, {5399, 2, -1}, {5401, 3, -1}, {5404, 1, -1},
+    {5405, 2, -1}, {5407, 1, -1}, {5408, 1, -1}, {5409, 1, -1}, {5410, 0, 887}, {5410, 1, -1}, {5411, 2, -1}, {5413, 1, -1},
+    {5414, 1, -1}, {5415, 0, 895}, {5415, 0, 159}, {5415, 1, -1}, {5416, 1, -1}, {5417, 1, -1}, {5418, 0, 900}, {5418, 1, -1},
+    {5419, 1, -1}, {5420, 0, 904}, {5420, 0, 909}, {5420, 1, -1}, {5421, 0, 910}, {5421, 1, -1}, {5422, 1, -1}, {5423, 0, 912},
+    {5423, 1, -1}, {5424, 0, 913}, {5424, 0, 163}, {5424, 1, -1}, {5425, 1, -1}, {5426, 0, 916}, {5426, 1, -1}, {5427, 1, -1},
+    {5428, 1, -1}, {5429, 1, -1}, {5430, 1, -1}, {5431, 1, -1}, {5432, 1, -1}, {5433, 2, -1}, {5435, 1, -1}, {5436, 1, -1},
+    {5437, 1, -1}, {5438, 0, 922}, {5438, 0, 89}, {5438, 1, -1}, {5439, 0, 870}, {5439, 1, -1}, {5440, 1, -1}, {5441, 0, 234},
+    {5441, 1, -1}, {5442, 1, -1}, {5443, 0, 926}, {5443, 1, -1}, {5444, 1, -1}, {5445, 1, -1}, {5446, 1, -1}, {5447, 1, -1},
+    {5448, 1, -1}, {5449, 1, -1}, {5450, 1, -1}, {5451, 1, -1}, {5452, 1, -1}, {5453, 0, 938}, {5453, 1, -1}, {5454, 0, 940},
+    {5454, 1, -1}, {5455, 1, -1}, {5456, 1, -1}, {5457, 1, -1}, {5458, 1, -1}, {5459, 1, 944}, {5460, 0, 946}, {5460, 1, 947},
+    {5461, 1, -1}, {5462, 1, -1}, {5463, 1, -1}, {5464, 1, -1}, {5465, 1, -1}, {5466, 1, -1}, {5467, 1, -1}, {5468, 1, -1},
+    {5469, 1, -1}, {5470, 1, -1}, {5471, 1, -1}, {5472, 0, 957}, {5472, 1, -1}, {5473, 1, -1}, {5474, 2, -1}, {5476, 1, -1},
+    {5477, 1, -1}, {5478, 1, -1}, {5479, 1, -1}, {5480, 1, -1}, {5481, 1, -1}, {5482, 0, 965}, {5482, 1, -1}, {5483, 0, 967},
+    {5483, 0, 968}, {5483, 1, -1}, {5484, 1, -1}, {5485, 0, 970}, {5485, 0, 122}, {5485, 1, -1}, {5486, 1, -1}, {5487, 2, -1},
+    {5489, 1, -1}, {5490, 1, -1}, {5491, 1, -1}, {5492, 0, 977}, {5492, 1, -1}, {5493, 1, -1}, {5494, 0, 982}, {5494, 0, 983},
+    {5494, 1, -1}, {5495, 1, -1}, {5496, 2, -1}, {5498, 1, -1}, {5499, 1, -1}, {5500, 0, 992}, {5500, 0, 993}, {5500, 0, 994},
+    {5500, 0, 995}, {5500, 1, -1}, {5501, 0, 88}, {5501, 1, -1}, {5502, 1, -1}, {5503, 0, 999}, {5503, 1, -1}, {5504, 1, -1},
+    {5505, 1, -1}, {5506, 1, -1}, {5507, 0, 224}, {5507, 1, -1}, {5508, 1, -1}, {5509, 1, 1005}, {5510, 0, 225}, {5510, 2, -1},
+    {5512, 1, -1}, {5513, 1, -1}, {5514, 1, -1}, {5515, 1, -1}, {5516, 1, -1}, {5517, 1, -1}, {5518, 1, -1}, {5519, 0, 1014},
+    {5519, 1, -1}, {5520, 1, -1}, {5521, 1, -1}, {5522, 2, -1}, {5524, 1, -1}, {5525, 1, -1}, {5526, 1, -1}, {5527, 1, -1},
+    {5528, 1, -1}, {5529, 0, 1018}, {5529, 0, 1026}, {5529, 2, -1}, {5531, 1, -1}, {5532, 1, -1}, {5533, 0, 1029}, {5533, 1, -1},
+    {5534, 1, -1}, {5535, 1, -1}, {5536, 1, -1}, {5537, 1, -1}, {5538, 0, 249}, {5538, 1, -1}, {5539, 1, -1}, {5540, 1, -1},
+    {5541, 0, 1037}, {5541, 1, -1}, {5542, 1, -1}, {5543, 1, -1}, {5544, 1, -1}, {5545, 1, -1}, {5546, 1, -1}, {5547, 1, -1},
+    {5548, 1, -1}, {5549, 1, -1}, {5550, 2, -1}, {5552, 1, -1}, {5553, 0, 1045}, {5553, 1, -1}, {5554, 1, -1}, {5555, 1, -1},
+    {5556, 1, -1}, {5557, 1, -1}, {5558, 1, -1}, {5559, 0, 1051}, {5559, 1, -1}, {5560, 0, 1052}, {5560, 1, -1}, {5561, 1, -1},
+    {5562, 1, -1}, {5563, 1, -1}, {5564, 1, -1}, {5565, 1, -1}, {5566, 1, -1}, {5567, 1, -1}, {5568, 1, -1}, {5569, 1, -1},
+    {5570, 0, 1059}, {5570, 1, -1}, {5571, 1, -1}, {5572, 1, -1}, {5573, 1, -1}, {5574, 1, -1}, {5575, 0, 633}, {5575, 0, 1064},
+    {5575, 1, -1}, {5576, 1, -1}, {5577, 1, -1}, {5578, 2, -1}, {5580, 1, -1}, {5581, 1, -1}, {5582, 0, 1070}, {5582, 0, 253},
+    {5582, 1, -1}, {5583, 1, -1}, {5584, 0, 1019}, {5584, 2, -1}, {5586, 1, -1}, {5587, 0, 1075}, {5587, 1, -1}, {5588, 1, -1},
+    {5589, 1, -1}, {5590, 1, -1}, {5591, 1, -1}, {5592, 1, -1}, {5593, 1, -1}, {5594, 0, 1081}, {5594, 1, -1}, {5595, 1, -1},
+    {5596, 1, -1}, {5597, 1, -1}, {5598, 1, -1}, {5599, 0, 1084}, {5599, 1, -1}, {5600, 0, 1086}, {5600, 0, 1087}, {5600, 0, 1088},
+    {5600, 1, -1}, {5601, 1, -1}, {5602, 1, -1}, {5603, 1, -1}, {5604, 1, -1}, {5605, 1, -1}, {5606, 1, 1095}, {5607, 1, -1},
+    {5608, 1, -1}, {5609, 1, -1}, {5610, 3, -1}, {5613, 0, 1099}, {5613, 0, 929}, {5613, 1, -1}, {5614, 1, -1}, {5615, 0, 1101},
+    {5615, 0, 1102}, {5615, 1, -1}, {5616, 1, -1}, {5617, 1, -1}, {5618, 0, 297}, {5618, 2, -1}, {5620, 0, 309}, {5620, 1, -1},
+    {5621, 1, -1}, {5622, 1, -1}, {5623, 1, -1}, {5624, 1, -1}, {5625, 0, 1115}, {5625, 0, 1116}, {5625, 1, -1}, {5626, 1, -1},
+    {5627, 1, -1}, {5628, 2, -1}, {5630, 0, 284}, {5630, 2, -1}, {5632, 0, 1120}, {5632, 1, -1}, {5633, 1, -1}, {5634, 2, -1},
+    {5636, 0, 1124}, {5636, 1, -1}, {5637, 1, -1}, {5638, 1, -1}, {5639, 2, -1}, {5641, 1, -1}, {5642, 1, -1}, {5643, 1, -1},
+    {5644, 1, -1}, {5645, 1, -1}, {5646, 0, 295}, {5646, 1, -1}, {5647, 1, -1}, {5648, 0, 299}, {5648, 1, -1}, {5649, 0, 294},
+    {5649, 1, -1}, {5650, 1, -1}, {5651, 1, -1}, {5652, 0, 1135}, {5652, 0, 1136}, {5652, 1, -1}, {5653, 1, -1}, {5654, 0, 1139},
+    {5654, 2, -1}, {5656, 0, 307}, {5656, 1, -1}, {5657, 1, -1}, {5658, 0, 310}, {5658, 1, -1}, {5659, 1, -1}, {5660, 2, -1},
+    {5662, 0, 337}, {5662, 0, 1140}, {5662, 4, -1}, {5666, 2, -1}, {5668, 0, 289}, {5668, 1, -1}, {5669, 1, -1}, {5670, 1, -1},
+    {5671, 1, -1}, {5672, 1, -1}, {5673, 0, 315}, {5673, 2, -1}, {5675, 1, -1}, {5676, 3, -1}, {5679, 1, -1}, {5680, 2, -1},
+    {5682, 1, -1}, {5683, 0, 328}, {5683, 0, 1154}, {5683, 1, -1}, {5684, 0, 333}, {5684, 2, -1}, {5686, 1, -1}, {5687, 1, -1},
+    {5688, 2, -1}, {5690, 0, 1155}, {5690, 1, -1}, {5691, 1, -1}, {5692, 1, -1}, {5693, 2, -1}, {5695, 0, 1157}, {5695, 1, -1},
+    {5696, 1, -1}, {5697, 1, -1}, {5698, 0, 298}, {5698, 1, -1}, {5699, 0, 308}, {5699, 1, -1}, {5700, 1, -1}, {5701, 1, -1},
+    {5702, 1, -1}, {5703, 1, -1}, {5704, 0, 1166}, {5704, 1, -1}, {5705, 0, 1168}, {5705, 0, 1169}, {5705, 1, -1}, {5706, 1, -1},
+    {5707, 0, 1172}, {5707, 0, 1173}, {5707, 1, -1}, {5708, 1, -1}, {5709, 1, -1}, {5710, 1, -1}, {5711, 1, -1}, {5712, 1, -1},
+    {5713, 2, -1}, {5715, 1, -1}, {5716, 1, -1}, {5717, 0, 728}, {5717, 0, 729}, {5717, 1, 1182}, {5718, 1, -1}, {5719, 1, -1},
+    {5720, 0, 1185}, {5720, 0, 45}, {5720, 1, -1}, {5721, 1, -1}, {5722, 1, -1}, {5723, 0, 1190}, {5723, 1, -1}, {5724, 1, -1},
+    {5725, 0, 56}, {5725, 1, -1}, {5726, 1, -1}, {5727, 1, -1}, {5728, 1, -1}, {5729, 1, -1}, {5730, 1, -1}, {5731, 1, -1},
+    {5732, 0, 1200}, {5732, 1, -1}, {5733, 0, 1201}, {5733, 0, 1202}, {5733, 1, -1}, {5734, 1, -1}, {5735, 1, -1}, {5736, 2, -1},
+    {5738, 0, 1207}, {5738, 0, 1208}, {5738, 1, -1}, {5739, 0, 1210}, {5739, 1, -1}, {5740, 0, 1206}, {5740, 1, -1}, {5741, 0, 1214},
+    {5741, 1, -1}, {5742, 1, -1}, {5743, 0, 1217}, {5743, 1, -1}, {5744, 0, 1219}, {5744, 1, -1}, {5745, 1, -1}, {5746, 1, -1},
+    {5747, 0, 364}, {5747, 1, -1}, {5748, 1, -1}, {5749, 1, -1}, {5750, 0, 506}, {5750, 1, -1}, {5751, 0, 1229}, {5751, 1, -1},
+    {5752, 1, -1}, {5753, 1, -1}, {5754, 1, -1}, {5755, 1, -1}, {5756, 0, 1234}, {5756, 1, -1}, {5757, 1, -1}, {5758, 1, -1},
+    {5759, 2, -1}, {5761, 1, -1}, {5762, 1, -1}, {5763, 1, -1}, {5764, 1, -1}, {5765, 1, -1}, {5766, 0, 1242}, {5766, 1, 1243},
+    {5767, 0, 1245}, {5767, 1, -1}, {5768, 0, 372}, {5768, 1, -1}, {5769, 1, -1}, {5770, 1, -1}, {5771, 3, -1}, {5774, 1, -1},
+    {5775, 2, -1}, {5777, 0, 1247}, {5777, 1, -1}, {5778, 1, -1}, {5779, 0, 377}, {5779, 1, -1}, {5780, 1, -1}, {5781, 1, -1},
+    {5782, 0, 378}, {5782, 1, -1}, {5783, 1, -1}, {5784, 1, -1}, {5785, 0, 1254}, {5785, 1, -1}, {5786, 0, 950}, {5786, 0, 1258},
+    {5786, 1, -1}, {5787, 0, 1260}, {5787, 1, -1}, {5788, 1, -1}, {5789, 2, -1}, {5791, 0, 381}, {5791, 1, -1}, {5792, 0, 93},
+    {5792, 1, -1}, {5793, 1, -1}, {5794, 0, 1264}, {5794, 0, 1265}, {5794, 1, -1}, {5795, 1, -1}, {5796, 1, -1}, {5797, 0, 399},
+    {5797, 1, -1}, {5798, 1, -1}, {5799, 1, -1}, {5800, 1, 1270}, {5801, 0, 400}, {5801, 1, -1}, {5802, 2, -1}, {5804, 1, -1},
+    {5805, 1, -1}, {5806, 1, -1}, {5807, 1, -1}, {5808, 1, -1}, {5809, 1, -1}, {5810, 1, -1}, {5811, 1, -1}, {5812, 1, -1},
+    {5813, 2, -1}, {5815, 1, -1}, {5816, 1, -1}, {5817, 2, -1}, {5819, 1, -1}, {5820, 1, -1}, {5821, 1, -1}, {5822, 1, -1},
+    {5823, 1, -1}, {5824, 0, 1282}, {5824, 0, 1290}, {5824, 1, -1}, {5825, 2, -1}, {5827, 0, 1292}, {5827, 0, 394}, {5827, 1, -1},
+    {5828, 1, -1}, {5829, 1, -1}, {5830, 0, 1293}, {5830, 1, -1}, {5831, 1, -1}, {5832, 1, -1}, {5833, 2, -1}, {5835, 0, 1298},
+    {5835, 6, -1}, {5841, 0, 1301}, {5841, 1, -1}, {5842, 1, -1}, {5843, 1, -1}, {5844, 1, -1}, {5845, 1, -1}, {5846, 1, -1},
+    {5847, 1, -1}, {5848, 1, -1}, {5849, 1, -1}, {5850, 0, 1308}, {5850, 1, -1}, {5851, 1, -1}, {5852, 0, 1311}, {5852, 1, -1},
+    {5853, 1, -1}, {5854, 1, -1}, {5855, 1, -1}, {5856, 0, 1315}, {5856, 0, 1283}, {5856, 2, -1}, {5858, 1, -1}, {5859, 1, -1},
+    {5860, 0, 1317}, {5860, 1, -1}, {5861, 1, -1}, {5862, 1, -1}, {5863, 1, -1}, {5864, 1, -1}, {5865, 1, -1}, {5866, 0, 1323},
+    {5866, 1, -1}, {5867, 1, -1}, {5868, 1, -1}, {5869, 1, -1}, {5870, 0, 1327}, {5870, 1, -1}, {5871, 1, -1}, {5872, 1, -1},
+    {5873, 1, -1}, {5874, 0, 1332}, {5874, 1, -1}, {5875, 1, -1}, {5876, 1, -1}, {5877, 1, -1}, {5878, 2, -1}, {5880, 0, 1335},
+    {5880, 0, 1336}, {5880, 1, -1}, {5881, 1, -1}, {5882, 1, -1}, {5883, 0, 1338}, {5883, 1, -1}, {5884, 1, -1}, {5885, 1, -1},
+    {5886, 0, 1342}, {5886, 2, -1}, {5888, 3, -1}, {5891, 1, -1}, {5892, 0, 476}, {5892, 1, -1}, {5893, 0, 1347}, {5893, 1, -1},
+    {5894, 0, 1349}, {5894, 1, -1}, {5895, 1, -1}, {5896, 1, -1}, {5897, 1, -1}, {5898, 1, -1}, {5899, 1, -1}, {5900, 1, -1},
+    {5901, 1, -1}, {5902, 0, 523}, {5902, 1, -1}, {5903, 0, 1358}, {5903, 1, -1}, {5904, 1, -1}, {5905, 0, 1362}, {5905, 1, -1},
+    {5906, 0, 1364}, {5906, 1, -1}, {5907, 0, 97}, {5907, 2, -1}, {5909, 2, -1}, {5911, 3, -1}, {5914, 3, -1}, {5917, 2, -1},
+    {5919, 0, 141}, {5919, 1, -1}, {5920, 0, 1368}, {5920, 1, -1}, {5921, 1, -1}, {5922, 1, -1}, {5923, 0, 1369}, {5923, 1, -1},
+    {5924, 1, -1}, {5925, 1, -1}, {5926, 0, 1371}, {5926, 1, -1}, {5927, 0, 452}, {5927, 1, -1}, {5928, 1, -1}, {5929, 1, -1},
+    {5930, 1, -1}, {5931, 1, -1}, {5932, 1, -1}, {5933, 1, -1}, {5934, 1, -1}, {5935, 2, -1}, {5937, 0, 453}, {5937, 1, -1},
+    {5938, 1, -1}, {5939, 1, -1}, {5940, 3, -1}, {5943, 1, -1}, {5944, 0, 1382}, {5944, 0, 1383}, {5944, 0, 1384}, {5944, 0, 1385},
+    {5944, 0, 1386}, {5944, 1, -1}, {5945, 1, -1}, {5946, 0, 460}, {5946, 1, -1}, {5947, 2, -1}, {5949, 1, -1}, {5950, 1, -1},
+    {5951, 1, -1}, {5952, 1, -1}, {5953, 1, -1}, {5954, 1, -1}, {5955, 1, -1}, {5956, 2, -1}, {5958, 1, -1}, {5959, 1, -1},
+    {5960, 2, -1}, {5962, 1, -1}, {5963, 1, 1402}, {5964, 1, -1}, {5965, 0, 362}, {5965, 1, -1}, {5966, 1, -1}, {5967, 0, 480},
+    {5967, 1, -1}, {5968, 2, -1}, {5970, 3, -1}, {5973, 2, -1}, {5975, 1, -1}, {5976, 1, -1}, {5977, 1, -1}, {5978, 1, 1412},
+    {5979, 1, -1}, {5980, 3, 1413}, {5983, 0, 951}, {5983, 0, 1130}, {5983, 1, -1}, {5984, 1, -1}, {5985, 0, 1418}, {5985, 1, -1},
+    {5986, 0, 1337}, {5986, 1, -1}, {5987, 1, -1}, {5988, 1, -1}, {5989, 1, -1}, {5990, 0, 1422}, {5990, 1, -1}, {5991, 1, -1},
+    {5992, 1, -1}, {5993, 1, -1}, {5994, 1, -1}, {5995, 0, 1429}, {5995, 0, 1430}, {5995, 1, -1}, {5996, 1, -1}, {5997, 1, -1},
+    {5998, 1, -1}, {5999, 0, 95}, {5999, 0, 1433}, {5999, 1, -1}, {6000, 0, 437}, {6000, 1, -1}, {6001, 1, -1}, {6002, 1, 1437},
+    {6003, 1, -1}, {6004, 1, -1}, {6005, 1, -1}, {6006, 1, -1}, {6007, 1, -1}, {6008, 1, -1}, {6009, 1, -1}, {6010, 1, -1},
+    {6011, 1, -1}, {6012, 1, -1}, {6013, 1, -1}, {6014, 1, -1}, {6015, 1, -1}, {6016, 0, 1449}, {6016, 1, -1}, {6017, 1, -1},
+    {6018, 1, -1}, {6019, 1, -1}, {6020, 0, 1450}, {6020, 1, -1}, {6021, 1, -1}, {6022, 1, -1}, {6023, 1, -1}, {6024, 1, -1},
+    {6025, 1, -1}, {6026, 1, -1}, {6027, 0, 1456}, {6027, 1, -1}, {6028, 1, -1}, {6029, 0, 1421}, {6029, 1, -1}, {6030, 1, -1},
+    {6031, 0, 1459}, {6031, 1, -1}, {6032, 0, 96}, {6032, 0, 1461}, {6032, 1, -1}, {6033, 1, -1}, {6034, 1, -1}, {6035, 1, -1},
+    {6036, 1, -1}, {6037, 1, -1}, {6038, 1, -1}, {6039, 1, -1}, {6040, 1, -1}, {6041, 0, 504}, {6041, 1, -1}, {6042, 1, -1},
+    {6043, 2, -1}, {6045, 1, -1}, {6046, 1, -1}, {6047, 1, -1}, {6048, 1, -1}, {6049, 1, -1}, {6050, 1, -1}, {6051, 1, -1},
+    {6052, 0, 524}, {6052, 1, -1}, {6053, 1, -1}, {6054, 1, -1}, {6055, 0, 1473}, {6055, 1, -1}, {6056, 1, -1}, {6057, 0, 1474},
+    {6057, 2, -1}, {6059, 2, -1}, {6061, 1, -1}, {6062, 1, -1}, {6063, 1, -1}, {6064, 2, -1}, {6066, 1, -1}, {6067, 0, 1481},
+    {6067, 1, -1}, {6068, 0, 1482}, {6068, 0, 189}, {6068, 1, -1}, {6069, 0, 498}, {6069, 1, -1}, {6070, 1, -1}, {6071, 1, -1},
+    {6072, 1, -1}, {6073, 1, -1}, {6074, 0, 1056}, {6074, 0, 1485}, {6074, 1, -1}, {6075, 0, 1486}, {6075, 1, -1}, {6076, 1, -1},
+    {6077, 1, -1}, {6078, 1, -1}, {6079, 0, 1487}, {6079, 1, -1}, {6080, 1, -1}, {6081, 1, -1}, {6082, 0, 521}, {6082, 1, -1},
+    {6083, 1, -1}, {6084, 0, 1489}, {6084, 1, -1}, {6085, 0, 1494}, {6085, 0, 1495}, {6085, 0, 1496}, {6085, 0, 1497}, {6085, 0, 1498},
+    {6085, 1, -1}, {6086, 1, -1}, {6087, 0, 1502}, {6087, 1, -1}, {6088, 0, 1503}, {6088, 0, 1505}, {6088, 1, -1}, {6089, 0, 1507},
+    {6089, 0, 1508}, {6089, 0, 1510}, {6089, 0, 0}, {6089, 1, 3}, {6090, 1, -1}, {6091, 0, 5}, {6091, 1, 8}, {6092, 0, 9},
+    {6092, 0, 10}, {6092, 0, 12}, {6092, 1, -1}, {6093, 0, 15}, {6093, 1, -1}, {6094, 1, 18}, {6095, 1, -1}, {6096, 1, -1},
+    {6097, 1, -1}, {6098, 1, -1}, {6099, 0, 29}, {6099, 1, -1}, {6100, 1, -1}, {6101, 1, -1}, {6102, 1, -1}, {6103, 1, -1},
+    {6104, 1, 38}, {6105, 0, 39}, {6105, 1, -1}, {6106, 1, -1}, {6107, 1, -1}, {6108, 4, -1}, {6112, 1, -1}, {6113, 1, -1},
+    {6114, 0, 52}, {6114, 1, -1}, {6115, 1, -1}, {6116, 1, -1}, {6117, 1, -1}, {6118, 1, -1}, {6119, 1, -1}, {6120, 0, 60},
+    {6120, 1, -1}, {6121, 1, -1}, {6122, 1, -1}, {6123, 0, 70}, {6123, 1, -1}, {6124, 0, 74}, {6124, 1, -1}, {6125, 1, -1},
+    {6126, 1, -1}, {6127, 1, -1}, {6128, 1, -1}, {6129, 6, -1}, {6135, 1, -1}, {6136, 1, -1}, {6137, 1, -1}, {6138, 1, -1},
+    {6139, 1, -1}, {6140, 1, -1}, {6141, 1, -1}, {6142, 1, 115}, {6143, 1, -1}, {6144, 0, 117}, {6144, 1, 121}, {6145, 1, -1},
+    {6146, 0, 123}, {6146, 1, -1}, {6147, 1, -1}, {6148, 0, 126}, {6148, 1, -1}, {6149, 0, 129}, {6149, 1, -1}, {6150, 1, -1},
+    {6151, 1, -1}, {6152, 1, -1}, {6153, 2, -1}, {6155, 1, -1}, {6156, 1, -1}, {6157, 0, 147}, {6157, 1, -1}, {6158, 1, -1},
+    {6159, 1, -1}, {6160, 0, 151}, {6160, 1, -1}, {6161, 1, -1}, {6162, 0, 167}, {6162, 0, 169}, {6162, 1, -1}, {6163, 1, -1},
+    {6164, 1, -1}, {6165, 1, -1}, {6166, 1, -1}, {6167, 0, 177}, {6167, 1, 179}, {6168, 0, 180}, {6168, 1, 184}, {6169, 0, 185},
+    {6169, 1, -1}, {6170, 1, -1}, {6171, 1, -1}, {6172, 1, -1}, {6173, 1, -1}, {6174, 0, 192}, {6174, 1, -1}, {6175, 0, 197},
+    {6175, 0, 199}, {6175, 1, -1}, {6176, 0, 205}, {6176, 0, 208}, {6176, 1, -1}, {6177, 1, -1}, {6178, 1, -1}, {6179, 1, -1},
+    {6180, 1, -1}, {6181, 1, -1}, {6182, 1, -1}, {6183, 1, -1}, {6184, 1, -1}, {6185, 2, -1}, {6187, 1, -1}, {6188, 1, -1},
+    {6189, 1, -1}, {6190, 1, -1}, {6191, 3, -1}, {6194, 1, -1}, {6195, 1, -1}, {6196, 1, -1}, {6197, 1, -1}, {6198, 1, -1},
+    {6199, 1, -1}, {6200, 1, -1}, {6201, 1, -1}, {6202, 1, -1}, {6203, 1, -1}, {6204, 1, -1}, {6205, 1, -1}, {6206, 1, -1},
+    {6207, 1, -1}, {6208, 1, -1}, {6209, 1, -1}, {6210, 1, -1}, {6211, 1, -1}, {6212, 1, -1}, {6213, 1, -1}, {6214, 1, -1},
+    {6215, 1, -1}, {6216, 1, -1}, {6217, 1, -1}, {6218, 1, -1}, {6219, 2, -1}, {6221, 1, -1}, {6222, 1, -1}, {6223, 1, -1},
+    {6224, 1, -1}, {6225, 1, -1}, {6226, 1, -1}, {6227, 1, -1}, {6228, 1, -1}, {6229, 1, -1}, {6230, 1, -1}, {6231, 1, -1},
+    {6232, 1, -1}, {6233, 1, -1}, {6234, 1, -1}, {6235, 1, -1}, {6236, 1, -1}, {6237, 1, -1}, {6238, 1, -1}, {6239, 1, -1},
+    {6240, 1, -1}, {6241, 1, -1}, {6242, 1, -1}, {6243, 1, -1}, {6244, 1, 339}, {6245, 0, 341}, {6245, 1, 342}, {6246, 0, 343},
+    {6246, 1, -1}, {6247, 1, 347}, {6248, 0, 348}, {6248, 0, 349}, {6248, 1, -1}, {6249, 1, -1}, {6250, 1, 356}, {6251, 1, 357},
+    {6252, 1, -1}, {6253, 1, -1}, {6254, 1, -1}, {6255, 1, -1}, {6256, 1, -1}, {6257, 1, -1}, {6258, 1, -1}, {6259, 1, -1},
+    {6260, 0, 376}, {6260, 1, -1}, {6261, 1, -1}, {6262, 0, 385}, {6262, 1, -1}, {6263, 1, -1}, {6264, 1, -1}, {6265, 1, -1},
+    {6266, 1, -1}, {6267, 2, -1}, {6269, 1, -1}, {6270, 1, -1}, {6271, 1, -1}, {6272, 2, -1}, {6274, 1, -1}, {6275, 1, -1},
+    {6276, 1, -1}, {6277, 1, -1}, {6278, 1, -1}, {6279, 1, -1}, {6280, 1, -1}, {6281, 1, -1}, {6282, 1, -1}, {6283, 1, -1},
+    {6284, 1, -1}, {6285, 0, 434}, {6285, 1, -1}, {6286, 1, -1}, {6287, 1, -1}, {6288, 1, -1}, {6289, 0, 438}, {6289, 1, -1},
+    {6290, 4, -1}, {6294, 2, -1}, {6296, 1, -1}, {6297, 1, -1}, {6298, 1, -1}, {6299, 1, -1}, {6300, 0, 461}, {6300, 0, 462},
+    {6300, 0, 463}, {6300, 1, -1}, {6301, 1, -1}, {6302, 1, -1}, {6303, 0, 472}, {6303, 1, -1}, {6304, 1, -1}, {6305, 0, 475},
+    {6305, 1, -1}, {6306, 1, -1}, {6307, 1, -1}, {6308, 1, -1}, {6309, 1, -1}, {6310, 1, 483}, {6311, 1, -1}, {6312, 0, 486},
+    {6312, 1, -1}, {6313, 0, 488}, {6313, 1, -1}, {6314, 1, 492}, {6315, 0, 493}, {6315, 2, -1}, {6317, 1, -1}, {6318, 0, 498},
+    {6318, 1, -1}, {6319, 0, 500}, {6319, 1, -1}, {6320, 1, -1}, {6321, 1, -1}, {6322, 0, 506}, {6322, 1, -1}, {6323, 1, -1},
+    {6324, 1, -1}, {6325, 1, -1}, {6326, 1, -1}, {6327, 1, -1}, {6328, 0, 512}, {6328, 1, -1}, {6329, 0, 516}, {6329, 0, 519},
+    {6329, 1, -1}, {6330, 1, -1}, {6331, 1, -1}, {6332, 1, -1}, {6333, 1, -1}, {6334, 0, 532}, {6334, 0, 533}, {6334, 1, 544},
+    {6335, 0, 545}, {6335, 1, -1}, {6336, 1, -1}, {6337, 1, -1}, {6338, 1, 560}, {6339, 1, -1}, {6340, 0, 565}, {6340, 0, 76},
+    {6340, 0, 567}, {6340, 1, 569}, {6341, 1, -1}, {6342, 0, 570}, {6342, 0, 571}, {6342, 0, 572}, {6342, 0, 573}, {6342, 1, -1},
+    {6343, 1, -1}, {6344, 0, 579}, {6344, 2, -1}, {6346, 0, 590}, {6346, 1, -1}, {6347, 1, -1}, {6348, 0, 15}, {6348, 1, -1},
+    {6349, 0, 595}, {6349, 1, -1}, {6350, 2, -1}, {6352, 0, 601}, {6352, 0, 478}, {6352, 1, -1}, {6353, 1, 604}, {6354, 1, -1},
+    {6355, 0, 606}, {6355, 1, -1}, {6356, 1, -1}, {6357, 1, -1}, {6358, 1, -1}, {6359, 1, -1}, {6360, 2, -1}, {6362, 1, -1},
+    {6363, 0, 608}, {6363, 0, 617}, {6363, 2, -1}, {6365, 1, -1}, {6366, 0, 609}, {6366, 1, -1}, {6367, 1, -1}, {6368, 1, -1},
+    {6369, 1, -1}, {6370, 1, -1}, {6371, 1, -1}, {6372, 1, -1}, {6373, 1, -1}, {6374, 1, -1}, {6375, 1, -1}, {6376, 1, -1},
+    {6377, 1, -1}, {6378, 1, -1}, {6379, 1, -1}, {6380, 1, -1}, {6381, 1, -1}, {6382, 1, -1}, {6383, 1, -1}, {6384, 0, 638},
+    {6384, 0, 639}, {6384, 0, 640}, {6384, 0, 641}, {6384, 0, 642}, {6384, 1, -1}, {6385, 1, -1}, {6386, 1, -1}, {6387, 0, 648},
+    {6387, 0, 649}, {6387, 0, 650}, {6387, 0, 651}, {6387, 0, 653}, {6387, 0, 654}, {6387, 0, 655}, {6387, 0, 656}, {6387, 0, 657},
+    {6387, 0, 658}, {6387, 0, 659}, {6387, 0, 660}, {6387, 0, 662}, {6387, 0, 663}, {6387, 0, 664}, {6387, 0, 665}, {6387, 0, 666},
+    {6387, 0, 667}, {6387, 1, -1}, {6388, 0, 669}, {6388, 0, 670}, {6388, 0, 671}, {6388, 0, 672}, {6388, 0, 673}, {6388, 0, 674},
+    {6388, 0, 675}, {6388, 0, 676}, {6388, 1, -1}, {6389, 1, -1}, {6390, 1, -1}, {6391, 0, 680}, {6391, 0, 681}, {6391, 0, 682},
+    {6391, 0, 683}, {6391, 0, 685}, {6391, 0, 686}, {6391, 0, 687}, {6391, 0, 688}, {6391, 0, 689}, {6391, 0, 690}, {6391, 1, -1},
+    {6392, 0, 29}, {6392, 1, 691}, {6393, 0, 693}, {6393, 0, 612}, {6393, 0, 695}, {6393, 1, -1}, {6394, 1, -1}, {6395, 0, 698},
+    {6395, 0, 175}, {6395, 1, -1}, {6396, 1, -1}, {6397, 1, -1}, {6398, 1, -1}, {6399, 1, -1}, {6400, 1, -1}, {6401, 1, -1},
+    {6402, 0, 707}, {6402, 0, 167}, {6402, 0, 708}, {6402, 1, -1}, {6403, 1, 710}, {6404, 0, 711}, {6404, 0, 712}, {6404, 1, -1},
+    {6405, 0, 42}, {6405, 1, -1}, {6406, 1, -1}, {6407, 0, 719}, {6407, 1, -1}, {6408, 1, -1}, {6409, 2, -1}, {6411, 1, -1},
+    {6412, 1, -1}, {6413, 1, -1}, {6414, 0, 734}, {6414, 1, -1}, {6415, 0, 735}, {6415, 2, -1}, {6417, 0, 736}, {6417, 1, -1},
+    {6418, 1, -1}, {6419, 2, -1}, {6421, 1, -1}, {6422, 1, -1}, {6423, 1, -1}, {6424, 1, -1}, {6425, 0, 742}, {6425, 0, 743},
+    {6425, 0, 746}, {6425, 0, 748}, {6425, 0, 749}, {6425, 2, -1}, {6427, 0, 752}, {6427, 0, 753}, {6427, 2, -1}, {6429, 1, -1},
+    {6430, 1, -1}, {6431, 1, -1}, {6432, 1, -1}, {6433, 0, 761}, {6433, 2, -1}, {6435, 1, -1}, {6436, 1, -1}, {6437, 1, -1},
+    {6438, 1, 767}, {6439, 1, -1}, {6440, 0, 765}, {6440, 0, 766}, {6440, 1, -1}, {6441, 0, 768}, {6441, 1, -1}, {6442, 1, -1},
+    {6443, 1, -1}, {6444, 0, 236}, {6444, 1, -1}, {6445, 0, 78}, {6445, 1, -1}, {6446, 1, -1}, {6447, 0, 777}, {6447, 1, -1},
+    {6448, 0, 780}, {6448, 1, -1}, {6449, 1, -1}, {6450, 0, 231}, {6450, 0, 406}, {6450, 1, -1}, {6451, 0, 784}, {6451, 1, -1},
+    {6452, 0, 786}, {6452, 2, 787}, {6454, 1, -1}, {6455, 1, -1}, {6456, 1, -1}, {6457, 1, -1}, {6458, 0, 86}, {6458, 1, -1},
+    {6459, 1, -1}, {6460, 1, -1}, {6461, 1, -1}, {6462, 1, -1}, {6463, 1, -1}, {6464, 1, -1}, {6465, 1, -1}, {6466, 1, -1},
+    {6467, 1, -1}, {6468, 1, -1}, {6469, 1, -1}, {6470, 0, 804}, {6470, 0, 635}, {6470, 0, 100}, {6470, 0, 397}, {6470, 1, -1},
+    {6471, 1, -1}, {6472, 0, 778}, {6472, 1, 809}, {6473, 1, -1}, {6474, 1, -1}, {6475, 0, 813}, {6475, 1, -1}, {6476, 0, 817},
+    {6476, 1, 820}, {6477, 1, -1}, {6478, 1, -1}, {6479, 1, -1}, {6480, 0, 828}, {6480, 0, 829}, {6480, 1, -1}, {6481, 1, -1},
+    {6482, 1, -1}, {6483, 1, -1}, {6484, 0, 835}, {6484, 1, -1}, {6485, 0, 839}, {6485, 1, -1}, {6486, 0, 841}, {6486, 1, -1},
+    {6487, 1, -1}, {6488, 0, 130}, {6488, 1, -1}, {6489, 1, -1}, {6490, 1, -1}, {6491, 0, 54}, {6491, 1, -1}, {6492, 1, -1},
+    {6493, 0, 846}, {6493, 0, 847}, {6493, 0, 86}, {6493, 0, 136}, {6493, 1, -1}, {6494, 1, -1}, {6495, 1, -1}, {6496, 1, -1},
+    {6497, 1, -1}, {6498, 0, 857}, {6498, 1, -1}, {6499, 0, 860}, {6499, 0, 861}, {6499, 0, 863}, {6499, 0, 864}, {6499, 1, -1},
+    {6500, 0, 868}, {6500, 1, -1}, {6501, 1, 870}, {6502, 1, -1}, {6503, 1, 872}, {6504, 1, -1}, {6505, 1, -1}, {6506, 1, -1},
+    {6507, 1, -1}, {6508, 1, -1}, {6509, 1, 878}, {6510, 1, -1}, {6511, 1, -1}, {6512, 1, -1}, {6513, 1, -1}, {6514, 1, -1},
+    {6515, 1, -1}, {6516, 0, 885}, {6516, 0, 886}, {6516, 1, -1}, {6517, 0, 890}, {6517, 1, -1}, {6518, 1, -1}, {6519, 0, 893},
+    {6519, 1, -1}, {6520, 0, 896}, {6520, 2, -1}, {6522, 1, -1}, {6523, 0, 903}, {6523, 1, -1}, {6524, 0, 908}, {6524, 0, 911},
+    {6524, 0, 79}, {6524, 0, 914}, {6524, 0, 915}, {6524, 0, 917}, {6524, 0, 918}, {6524, 1, -1}, {6525, 1, -1}, {6526, 1, -1},
+    {6527, 1, -1}, {6528, 1, -1}, {6529, 1, -1}, {6530, 1, -1}, {6531, 1, -1}, {6532, 1, -1}, {6533, 1, -1}, {6534, 1, -1},
+    {6535, 1, -1}, {6536, 1, -1}, {6537, 1, -1}, {6538, 0, 925}, {6538, 0, 927}, {6538, 2, -1}, {6540, 1, -1}, {6541, 1, -1},
+    {6542, 1, -1}, {6543, 1, -1}, {6544, 0, 934}, {6544, 1, -1}, {6545, 1, -1}, {6546, 1, -1}, {6547, 1, -1}, {6548, 1, -1},
+    {6549, 1, -1}, {6550, 1, -1}, {6551, 1, -1}, {6552, 1, 943}, {6553, 0, 944}, {6553, 0, 947}, {6553, 1, 949}, {6554, 1, -1},
+    {6555, 0, 951}, {6555, 1, -1}, {6556, 0, 953}, {6556, 0, 954}, {6556, 0, 955}, {6556, 0, 183}, {6556, 1, -1}, {6557, 1, -1},
+    {6558, 0, 956}, {6558, 0, 958}, {6558, 1, -1}, {6559, 0, 960}, {6559, 1, -1}, {6560, 1, -1}, {6561, 1, -1}, {6562, 1, -1},
+    {6563, 1, -1}, {6564, 1, -1}, {6565, 1, -1}, {6566, 0, 966}, {6566, 0, 964}, {6566, 1, 969}, {6567, 0, 971}, {6567, 1, -1},
+    {6568, 0, 973}, {6568, 1, -1}, {6569, 0, 122}, {6569, 1, -1}, {6570, 0, 976}, {6570, 0, 978}, {6570, 0, 981}, {6570, 1, -1},
+    {6571, 0, 985}, {6571, 0, 986}, {6571, 1, -1}, {6572, 1, -1}, {6573, 1, -1}, {6574, 0, 256}, {6574, 1, -1}, {6575, 0, 997},
+    {6575, 1, -1}, {6576, 1, -1}, {6577, 1, -1}, {6578, 1, -1}, {6579, 0, 1003}, {6579, 1, -1}, {6580, 0, 1005}, {6580, 0, 226},
+    {6580, 1, -1}, {6581, 1, -1}, {6582, 1, -1}, {6583, 1, -1}, {6584, 1, -1}, {6585, 1, -1}, {6586, 1, -1}, {6587, 1, -1},
+    {6588, 0, 1015}, {6588, 0, 1016}, {6588, 0, 1017}, {6588, 1, -1}, {6589, 1, -1}, {6590, 0, 1020}, {6590, 2, -1}, {6592, 1, -1},
+    {6593, 1, -1}, {6594, 0, 228}, {6594, 0, 352}, {6594, 1, -1}, {6595, 1, -1}, {6596, 1, -1}, {6597, 1, -1}, {6598, 1, -1},
+    {6599, 1, -1}, {6600, 1, -1}, {6601, 1, -1}, {6602, 1, -1}, {6603, 0, 1033}, {6603, 2, -1}, {6605, 1, -1}, {6606, 1, -1},
+    {6607, 1, -1}, {6608, 2, -1}, {6610, 1, -1}, {6611, 1, -1}, {6612, 1, -1}, {6613, 1, -1}, {6614, 0, 104}, {6614, 0, 246},
+    {6614, 1, -1}, {6615, 0, 1044}, {6615, 0, 1031}, {6615, 1, -1}, {6616, 1, -1}, {6617, 0, 1047}, {6617, 1, -1}, {6618, 2, -1},
+    {6620, 1, -1}, {6621, 0, 1050}, {6621, 0, 1053}, {6621, 0, 1054}, {6621, 0, 1055}, {6621, 0, 229}, {6621, 1, -1}, {6622, 1, -1},
+    {6623, 1, -1}, {6624, 1, -1}, {6625, 0, 1058}, {6625, 1, -1}, {6626, 1, -1}, {6627, 1, -1}, {6628, 1, -1}, {6629, 1, -1},
+    {6630, 1, -1}, {6631, 0, 227}, {6631, 1, -1}, {6632, 0, 396}, {6632, 1, -1}, {6633, 0, 1068}, {6633, 1, -1}, {6634, 0, 1071},
+    {6634, 0, 1072}, {6634, 0, 353}, {6634, 1, -1}, {6635, 1, -1}, {6636, 0, 1076}, {6636, 0, 1039}, {6636, 1, -1}, {6637, 1, -1},
+    {6638, 1, -1}, {6639, 1, -1}, {6640, 1, -1}, {6641, 0, 241}, {6641, 0, 636}, {6641, 1, -1}, {6642, 1, -1}, {6643, 1, -1},
+    {6644, 0, 1085}, {6644, 1, -1}, {6645, 4, -1}, {6649, 1, -1}, {6650, 1, -1}, {6651, 0, 1092}, {6651, 1, -1}, {6652, 0, 1095},
+    {6652, 1, -1}, {6653, 1, -1}, {6654, 1, 43}, {6655, 0, 1097}, {6655, 1, -1}, {6656, 2, -1}, {6658, 1, -1}, {6659, 1, -1},
+    {6660, 1, -1}, {6661, 1, -1}, {6662, 0, 1104}, {6662, 1, -1}, {6663, 1, -1}, {6664, 1, -1}, {6665, 1, -1}, {6666, 1, -1},
+    {6667, 0, 73}, {6667, 1, -1}, {6668, 0, 1117}, {6668, 0, 1118}, {6668, 1, -1}, {6669, 0, 1119}, {6669, 1, -1}, {6670, 0, 301},
+    {6670, 1, -1}, {6671, 1, -1}, {6672, 1, -1}, {6673, 0, 335}, {6673, 1, -1}, {6674, 0, 1126}, {6674, 0, 1127}, {6674, 1, -1},
+    {6675, 0, 509}, {6675, 1, -1}, {6676, 0, 1129}, {6676, 1, -1}, {6677, 1, -1}, {6678, 0, 292}, {6678, 2, -1}, {6680, 0, 296},
+    {6680, 1, -1}, {6681, 0, 300}, {6681, 0, 1108}, {6681, 0, 1132}, {6681, 0, 1133}, {6681, 0, 1107}, {6681, 0, 1138}, {6681, 1, -1},
+    {6682, 1, -1}, {6683, 0, 1137}, {6683, 1, -1}, {6684, 0, 306}, {6684, 0, 311}, {6684, 0, 303}, {6684, 1, -1}, {6685, 0, 290},
+    {6685, 1, -1}, {6686, 1, -1}, {6687, 3, -1}, {6690, 0, 317}, {6690, 3, -1}, {6693, 1, -1}, {6694, 1, -1}, {6695, 0, 1149},
+    {6695, 1, -1}, {6696, 1, -1}, {6697, 0, 314}, {6697, 1, -1}, {6698, 0, 1111}, {6698, 0, 1151}, {6698, 1, -1}, {6699, 1, -1},
+    {6700, 1, -1}, {6701, 0, 318}, {6701, 1, -1}, {6702, 1, -1}, {6703, 2, -1}, {6705, 0, 334}, {6705, 1, -1}, {6706, 0, 337},
+    {6706, 0, 289}, {6706, 1, -1}, {6707, 1, -1}, {6708, 0, 1156}, {6708, 0, 326}, {6708, 1, -1}, {6709, 0, 327}, {6709, 1, -1},
+    {6710, 0, 1158}, {6710, 0, 332}, {6710, 1, -1}, {6711, 1, 1159}, {6712, 1, -1}, {6713, 1, -1}, {6714, 0, 1163}, {6714, 1, -1},
+    {6715, 1, -1}, {6716, 1, -1}, {6717, 1, -1}, {6718, 1, -1}, {6719, 1, -1}, {6720, 1, -1}, {6721, 1, -1}, {6722, 0, 1177},
+    {6722, 0, 1178}, {6722, 1, -1}, {6723, 0, 508}, {6723, 1, -1}, {6724, 1, -1}, {6725, 1, 1181}, {6726, 0, 1182}, {6726, 0, 730},
+    {6726, 1, -1}, {6727, 1, -1}, {6728, 0, 1187}, {6728, 0, 1188}, {6728, 1, 1191}, {6729, 0, 1193}, {6729, 0, 725}, {6729, 0, 1194},
+    {6729, 1, -1}, {6730, 0, 360}, {6730, 0, 1197}, {6730, 0, 1198}, {6730, 1, -1}, {6731, 1, -1}, {6732, 0, 1203}, {6732, 0, 47},
+    {6732, 0, 726}, {6732, 0, 1206}, {6732, 1, -1}, {6733, 1, -1}, {6734, 1, -1}, {6735, 1, 1213}, {6736, 1, 1215}, {6737, 2, -1},
+    {6739, 0, 1218}, {6739, 1, -1}, {6740, 1, -1}, {6741, 0, 1221}, {6741, 1, -1}, {6742, 1, -1}, {6743, 1, -1}, {6744, 1, -1},
+    {6745, 1, -1}, {6746, 0, 1230}, {6746, 1, -1}, {6747, 2, -1}, {6749, 1, -1}, {6750, 1, -1}, {6751, 0, 678}, {6751, 1, -1},
+    {6752, 1, -1}, {6753, 1, -1}, {6754, 0, 1238}, {6754, 1, 369}, {6755, 1, -1}, {6756, 1, -1}, {6757, 1, -1}, {6758, 0, 1243},
+    {6758, 0, 374}, {6758, 1, -1}, {6759, 1, -1}, {6760, 1, -1}, {6761, 1, -1}, {6762, 1, -1}, {6763, 1, -1}, {6764, 1, -1},
+    {6765, 0, 1249}, {6765, 1, -1}, {6766, 0, 1246}, {6766, 1, -1}, {6767, 1, -1}, {6768, 1, -1}, {6769, 1, -1}, {6770, 1, -1},
+    {6771, 0, 375}, {6771, 1, -1}, {6772, 1, -1}, {6773, 1, -1}, {6774, 1, -1}, {6775, 1, -1}, {6776, 0, 1262}, {6776, 1, -1},
+    {6777, 0, 423}, {6777, 1, -1}, {6778, 0, 774}, {6778, 1, -1}, {6779, 0, 441}, {6779, 1, -1}, {6780, 0, 1268}, {6780, 0, 1269},
+    {6780, 1, -1}, {6781, 0, 1270}, {6781, 1, -1}, {6782, 0, 401}, {6782, 1, -1}, {6783, 0, 1273}, {6783, 1, -1}, {6784, 1, -1},
+    {6785, 1, -1}, {6786, 1, -1}, {6787, 1, -1}, {6788, 1, -1}, {6789, 0, 1278}, {6789, 1, -1}, {6790, 0, 1280}, {6790, 1, -1},
+    {6791, 0, 632}, {6791, 0, 1281}, {6791, 1, -1}, {6792, 1, -1}, {6793, 0, 1284}, {6793, 2, -1}, {6795, 1, -1}, {6796, 1, -1},
+    {6797, 0, 403}, {6797, 1, -1}, {6798, 0, 50}, {6798, 1, -1}, {6799, 1, -1}, {6800, 1, -1}, {6801, 0, 421}, {6801, 1, -1},
+    {6802, 1, -1}, {6803, 0, 107}, {6803, 0, 419}, {6803, 1, -1}, {6804, 1, -1}, {6805, 1, -1}, {6806, 1, -1}, {6807, 1, -1},
+    {6808, 1, -1}, {6809, 1, -1}, {6810, 1, -1}, {6811, 0, 402}, {6811, 0, 131}, {6811, 2, -1}, {6813, 0, 1304}, {6813, 0, 1305},
+    {6813, 0, 1306}, {6813, 0, 404}, {6813, 0, 1307}, {6813, 1, -1}, {6814, 1, -1}, {6815, 1, -1}, {6816, 1, -1}, {6817, 0, 1299},
+    {6817, 1, -1}, {6818, 0, 51}, {6818, 1, -1}, {6819, 1, -1}, {6820, 1, -1}, {6821, 0, 414}, {6821, 0, 637}, {6821, 1, -1},
+    {6822, 1, -1}, {6823, 1, -1}, {6824, 0, 1073}, {6824, 1, -1}, {6825, 0, 455}, {6825, 1, -1}, {6826, 0, 1326}, {6826, 0, 1328},
+    {6826, 1, -1}, {6827, 1, -1}, {6828, 0, 456}, {6828, 0, 797}, {6828, 0, 1333}, {6828, 0, 1334}, {6828, 1, -1}, {6829, 0, 263},
+    {6829, 1, -1}, {6830, 1, -1}, {6831, 1, -1}, {6832, 0, 20}, {6832, 1, -1}, {6833, 0, 1340}, {6833, 1, -1}, {6834, 1, -1},
+    {6835, 1, -1}, {6836, 0, 1344}, {6836, 1, -1}, {6837, 1, -1}, {6838, 1, -1}, {6839, 0, 476}, {6839, 0, 1348}, {6839, 0, 1350},
+    {6839, 0, 1351}, {6839, 1, -1}, {6840, 1, -1}, {6841, 0, 225}, {6841, 1, -1}, {6842, 1, -1}, {6843, 1, -1}, {6844, 0, 1356},
+    {6844, 0, 1359}, {6844, 1, -1}, {6845, 1, -1}, {6846, 2, -1}, {6848, 0, 443}, {6848, 1, -1}, {6849, 0, 448}, {6849, 1, -1},
+    {6850, 0, 444}, {6850, 1, -1}, {6851, 1, -1}, {6852, 0, 446}, {6852, 1, -1}, {6853, 1, -1}, {6854, 1, -1}, {6855, 1, -1},
+    {6856, 0, 400}, {6856, 1, -1}, {6857, 1, -1}, {6858, 1, -1}, {6859, 0, 628}, {6859, 1, -1}, {6860, 0, 1086}, {6860, 1, -1},
+    {6861, 1, -1}, {6862, 1, -1}, {6863, 0, 1375}, {6863, 0, 1376}, {6863, 1, -1}, {6864, 1, -1}, {6865, 3, -1}, {6868, 1, -1},
+    {6869, 1, -1}, {6870, 1, -1}, {6871, 1, -1}, {6872, 1, -1}, {6873, 1, -1}, {6874, 1, -1}, {6875, 1, -1}, {6876, 1, -1},
+    {6877, 1, -1}, {6878, 1, -1}, {6879, 1, -1}, {6880, 1, -1}, {6881, 1, -1}, {6882, 1, -1}, {6883, 1, -1}, {6884, 1, -1},
+    {6885, 0, 1394}, {6885, 0, 1395}, {6885, 1, -1}, {6886, 3, -1}, {6889, 1, -1}, {6890, 1, -1}, {6891, 1, -1}, {6892, 0, 1400},
+    {6892, 1, -1}, {6893, 0, 262}, {6893, 1, -1}, {6894, 1, -1}, {6895, 0, 1402}, {6895, 1, -1}, {6896, 1, -1}, {6897, 1, -1},
+    {6898, 1, -1}, {6899, 1, -1}, {6900, 1, -1}, {6901, 0, 1410}, {6901, 1, -1}, {6902, 1, -1}, {6903, 1, -1}, {6904, 1, -1},
+    {6905, 1, -1}, {6906, 0, 478}, {6906, 1, -1}, {6907, 0, 1412}, {6907, 0, 80}, {6907, 0, 1413}, {6907, 2, -1}, {6909, 1, -1},
+    {6910, 1, -1}, {6911, 1, -1}, {6912, 1, -1}, {6913, 1, -1}, {6914, 0, 462}, {6914, 1, -1}, {6915, 1, -1}, {6916, 1, -1},
+    {6917, 1, -1}, {6918, 0, 1426}, {6918, 1, -1}, {6919, 1, -1}, {6920, 0, 1431}, {6920, 1, -1}, {6921, 0, 621}, {6921, 1, -1},
+    {6922, 1, 1434}, {6923, 0, 1435}, {6923, 1, -1}, {6924, 0, 1437}, {6924, 0, 503}, {6924, 1, -1}, {6925, 0, 505}, {6925, 1, -1},
+    {6926, 1, 1442}, {6927, 0, 244}, {6927, 0, 417}, {6927, 0, 1443}, {6927, 2, -1}, {6929, 1, -1}, {6930, 0, 1446}, {6930, 0, 1447},
+    {6930, 0, 1448}, {6930, 1, -1}, {6931, 1, -1}, {6932, 1, -1}, {6933, 0, 499}, {6933, 0, 510}, {6933, 1, -1}, {6934, 1, -1},
+    {6935, 2, -1}, {6937, 1, -1}, {6938, 0, 1454}, {6938, 0, 1455}, {6938, 0, 1457}, {6938, 1, -1}, {6939, 0, 634}, {6939, 0, 1451},
+    {6939, 1, -1}, {6940, 0, 1462}, {6940, 0, 94}, {6940, 1, -1}, {6941, 1, -1}, {6942, 1, -1}, {6943, 1, -1}, {6944, 1, -1},
+    {6945, 0, 1232}, {6945, 1, -1}, {6946, 1, -1}, {6947, 1, -1}, {6948, 1, -1}, {6949, 1, -1}, {6950, 1, -1}, {6951, 1, -1},
+    {6952, 0, 409}, {6952, 1, -1}, {6953, 0, 1470}, {6953, 1, -1}, {6954, 1, -1}, {6955, 0, 239}, {6955, 0, 325}, {6955, 0, 331},
+    {6955, 0, 378}, {6955, 0, 412}, {6955, 1, -1}, {6956, 1, -1}, {6957, 1, -1}, {6958, 1, -1}, {6959, 1, -1}, {6960, 0, 1476},
+    {6960, 1, -1}, {6961, 0, 574}, {6961, 1, -1}, {6962, 1, -1}, {6963, 1, -1}, {6964, 0, 623}, {6964, 0, 629}, {6964, 0, 91},
+    {6964, 0, 259}, {6964, 0, 90}, {6964, 0, 258}, {6964, 0, 624}, {6964, 1, -1}, {6965, 1, -1}, {6966, 0, 92}, {6966, 0, 260},
+    {6966, 1, -1}, {6967, 1, -1}, {6968, 0, 630}, {6968, 1, -1}, {6969, 1, 1488}, {6970, 0, 1490}, {6970, 1, -1}, {6971, 1, -1},
+    {6972, 1, -1}, {6973, 1, -1}, {6974, 0, 3}, {6974, 0, 4}, {6974, 0, 8}, {6974, 1, -1}, {6975, 0, 17}, {6975, 0, 18},
+    {6975, 1, -1}, {6976, 0, 22}, {6976, 1, -1}, {6977, 1, -1}, {6978, 0, 30}, {6978, 0, 33}, {6978, 1, -1}, {6979, 1, -1},
+    {6980, 0, 37}, {6980, 0, 38}, {6980, 1, -1}, {6981, 1, -1}, {6982, 1, -1}, {6983, 1, -1}, {6984, 1, -1}, {6985, 1, -1},
+    {6986, 1, -1}, {6987, 1, -1}, {6988, 1, -1}, {6989, 0, 53}, {6989, 1, -1}, {6990, 0, 55}, {6990, 1, -1}, {6991, 1, -1},
+    {6992, 1, -1}, {6993, 0, 63}, {6993, 1, -1}, {6994, 0, 68}, {6994, 0, 71}, {6994, 1, -1}, {6995, 1, -1}, {6996, 1, -1},
+    {6997, 0, 85}, {6997, 1, -1}, {6998, 1, -1}, {6999, 1, -1}, {7000, 2, -1}, {7002, 1, -1}, {7003, 1, -1}, {7004, 1, -1},
+    {7005, 1, -1}, {7006, 1, -1}, {7007, 1, -1}, {7008, 1, -1}, {7009, 2, -1}, {7011, 1, -1}, {7012, 0, 112}, {7012, 0, 115},
+    {7012, 0, 116}, {7012, 0, 121}, {7012, 1, -1}, {7013, 1, -1}, {7014, 1, -1}, {7015, 1, -1}, {7016, 1, -1}, {7017, 1, -1},
+    {7018, 0, 136}, {7018, 1, -1}, {7019, 1, -1}, {7020, 1, -1}, {7021, 0, 143}, {7021, 1, -1}, {7022, 0, 148}, {7022, 0, 149},
+    {7022, 0, 150}, {7022, 6, -1}, {7028, 0, 166}, {7028, 1, -1}, {7029, 1, -1}, {7030, 0, 174}, {7030, 1, -1}, {7031, 1, -1},
+    {7032, 0, 179}, {7032, 0, 184}, {7032, 1, -1}, {7033, 1, -1}, {7034, 1, -1}, {7035, 1, -1}, {7036, 1, -1}, {7037, 0, 196},
+    {7037, 0, 204}, {7037, 0, 209}, {7037, 0, 216}, {7037, 0, 217}, {7037, 1, -1}, {7038, 0, 221}, {7038, 0, 222}, {7038, 1, -1},
+    {7039, 1, -1}, {7040, 1, -1}, {7041, 1, -1}, {7042, 1, -1}, {7043, 1, -1}, {7044, 1, -1}, {7045, 3, -1}, {7048, 1, -1},
+    {7049, 1, -1}, {7050, 1, -1}, {7051, 1, -1}, {7052, 1, -1}, {7053, 1, -1}, {7054, 1, -1}, {7055, 1, -1}, {7056, 1, -1},
+    {7057, 1, -1}, {7058, 1, -1}, {7059, 1, -1}, {7060, 1, -1}, {7061, 1, -1}, {7062, 0, 257}, {7062, 1, -1}, {7063, 1, -1},
+    {7064, 1, -1}, {7065, 1, -1}, {7066, 1, -1}, {7067, 1, -1}, {7068, 0, 265}, {7068, 1, -1}, {7069, 1, -1}, {7070, 1, -1},
+    {7071, 0, 276}, {7071, 0, 277}, {7071, 0, 278}, {7071, 1, -1}, {7072, 1, -1}, {7073, 1, -1}, {7074, 1, -1}, {7075, 1, -1},
+    {7076, 1, -1}, {7077, 1, -1}, {7078, 1, -1}, {7079, 1, -1}, {7080, 1, -1}, {7081, 1, -1}, {7082, 1, -1}, {7083, 1, -1},
+    {7084, 2, -1}, {7086, 1, -1}, {7087, 6, -1}, {7093, 1, -1}, {7094, 1, -1}, {7095, 1, -1}, {7096, 1, -1}, {7097, 1, -1},
+    {7098, 1, -1}, {7099, 1, -1}, {7100, 1, -1}, {7101, 1, -1}, {7102, 1, -1}, {7103, 0, 339}, {7103, 0, 342}, {7103, 0, 345},
+    {7103, 0, 347}, {7103, 1, -1}, {7104, 1, -1}, {7105, 0, 356}, {7105, 0, 357}, {7105, 0, 358}, {7105, 1, -1}, {7106, 1, -1},
+    {7107, 1, -1}, {7108, 1, -1}, {7109, 1, -1}, {7110, 1, -1}, {7111, 1, -1}, {7112, 1, -1}, {7113, 1, -1}, {7114, 0, 387},
+    {7114, 0, 390}, {7114, 0, 391}, {7114, 0, 392}, {7114, 2, -1}, {7116, 1, -1}, {7117, 1, -1}, {7118, 1, -1}, {7119, 2, -1},
+    {7121, 1, -1}, {7122, 1, -1}, {7123, 1, -1}, {7124, 3, -1}, {7127, 1, -1}, {7128, 1, -1}, {7129, 1, -1}, {7130, 1, -1},
+    {7131, 1, -1}, {7132, 0, 427}, {7132, 0, 429}, {7132, 0, 430}, {7132, 0, 432}, {7132, 0, 433}, {7132, 1, -1}, {7133, 1, -1},
+    {7134, 1, -1}, {7135, 1, -1}, {7136, 1, -1}, {7137, 0, 442}, {7137, 1, -1}, {7138, 1, -1}, {7139, 1, -1}, {7140, 0, 451},
+    {7140, 1, -1}, {7141, 1, -1}, {7142, 1, -1}, {7143, 1, -1}, {7144, 0, 458}, {7144, 0, 467}, {7144, 0, 468}, {7144, 1, -1},
+    {7145, 1, -1}, {7146, 1, -1}, {7147, 1, -1}, {7148, 1, -1}, {7149, 1, -1}, {7150, 1, -1}, {7151, 0, 482}, {7151, 0, 483},
+    {7151, 1, -1}, {7152, 0, 487}, {7152, 0, 490}, {7152, 0, 492}, {7152, 1, -1}, {7153, 1, -1}, {7154, 1, -1}, {7155, 1, -1},
+    {7156, 3, -1}, {7159, 1, -1}, {7160, 1, -1}, {7161, 1, -1}, {7162, 1, -1}, {7163, 1, -1}, {7164, 1, -1}, {7165, 1, -1},
+    {7166, 1, -1}, {7167, 0, 514}, {7167, 0, 520}, {7167, 0, 522}, {7167, 1, -1}, {7168, 1, -1}, {7169, 0, 531}, {7169, 0, 544},
+    {7169, 0, 552}, {7169, 0, 553}, {7169, 1, -1}, {7170, 0, 560}, {7170, 0, 561}, {7170, 0, 569}, {7170, 1, -1}, {7171, 0, 575},
+    {7171, 1, -1}, {7172, 0, 581}, {7172, 8, -1}, {7180, 2, -1}, {7182, 0, 593}, {7182, 1, -1}, {7183, 0, 598}, {7183, 0, 478},
+    {7183, 1, -1}, {7184, 1, -1}, {7185, 0, 604}, {7185, 1, -1}, {7186, 1, -1}, {7187, 1, -1}, {7188, 1, -1}, {7189, 2, -1},
+    {7191, 0, 613}, {7191, 0, 614}, {7191, 1, -1}, {7192, 1, -1}, {7193, 0, 24}, {7193, 1, -1}, {7194, 1, -1}, {7195, 0, 25},
+    {7195, 1, -1}, {7196, 0, 189}, {7196, 1, -1}, {7197, 0, 498}, {7197, 1, -1}, {7198, 1, -1}, {7199, 1, -1}, {7200, 1, -1},
+    {7201, 1, -1}, {7202, 1, -1}, {7203, 1, -1}, {7204, 0, 521}, {7204, 1, -1}, {7205, 0, 632}, {7205, 1, -1}, {7206, 1, -1},
+    {7207, 1, -1}, {7208, 1, -1}, {7209, 0, 506}, {7209, 0, 647}, {7209, 0, 668}, {7209, 1, -1}, {7210, 1, -1}, {7211, 1, -1},
+    {7212, 0, 610}, {7212, 0, 691}, {7212, 1, -1}, {7213, 0, 697}, {7213, 0, 175}, {7213, 0, 699}, {7213, 0, 701}, {7213, 1, -1},
+    {7214, 0, 703}, {7214, 0, 704}, {7214, 0, 705}, {7214, 0, 709}, {7214, 0, 710}, {7214, 1, -1}, {7215, 1, -1}, {7216, 1, -1},
+    {7217, 1, -1}, {7218, 0, 724}, {7218, 1, -1}, {7219, 5, -1}, {7224, 1, -1}, {7225, 0, 732}, {7225, 1, -1}, {7226, 1, -1},
+    {7227, 0, 17}, {7227, 1, -1}, {7228, 0, 737}, {7228, 0, 439}, {7228, 1, -1}, {7229, 1, -1}, {7230, 1, -1}, {7231, 0, 56},
+    {7231, 0, 58}, {7231, 0, 741}, {7231, 1, -1}, {7232, 1, -1}, {7233, 0, 754}, {7233, 1, -1}, {7234, 1, -1}, {7235, 0, 758},
+    {7235, 0, 759}, {7235, 0, 760}, {7235, 0, 763}, {7235, 1, -1}, {7236, 2, -1}, {7238, 1, -1}, {7239, 1, -1}, {7240, 0, 767},
+    {7240, 1, -1}, {7241, 1, -1}, {7242, 0, 769}, {7242, 0, 771}, {7242, 0, 772}, {7242, 1, -1}, {7243, 0, 775}, {7243, 1, -1},
+    {7244, 1, -1}, {7245, 1, -1}, {7246, 0, 782}, {7246, 2, -1}, {7248, 1, -1}, {7249, 0, 787}, {7249, 1, -1}, {7250, 0, 788},
+    {7250, 0, 790}, {7250, 0, 791}, {7250, 0, 792}, {7250, 1, -1}, {7251, 1, -1}, {7252, 1, -1}, {7253, 1, -1}, {7254, 1, -1},
+    {7255, 1, -1}, {7256, 1, -1}, {7257, 1, -1}, {7258, 1, -1}, {7259, 0, 798}, {7259, 0, 799}, {7259, 0, 803}, {7259, 1, -1},
+    {7260, 1, -1}, {7261, 0, 809}, {7261, 0, 810}, {7261, 0, 811}, {7261, 0, 814}, {7261, 0, 820}, {7261, 0, 822}, {7261, 1, -1},
+    {7262, 0, 827}, {7262, 1, -1}, {7263, 0, 829}, {7263, 0, 830}, {7263, 0, 831}, {7263, 0, 838}, {7263, 1, -1}, {7264, 0, 812},
+    {7264, 1, -1}, {7265, 2, -1}, {7267, 0, 842}, {7267, 0, 843}, {7267, 1, -1}, {7268, 1, -1}, {7269, 1, -1}, {7270, 1, -1},
+    {7271, 1, -1}, {7272, 0, 855}, {7272, 0, 856}, {7272, 0, 858}, {7272, 0, 143}, {7272, 1, -1}, {7273, 0, 870}, {7273, 0, 871},
+    {7273, 0, 872}, {7273, 0, 873}, {7273, 0, 874}, {7273, 0, 875}, {7273, 0, 876}, {7273, 0, 877}, {7273, 0, 878}, {7273, 0, 879},
+    {7273, 0, 880}, {7273, 0, 881}, {7273, 0, 882}, {7273, 0, 883}, {7273, 0, 884}, {7273, 0, 889}, {7273, 0, 785}, {7273, 0, 892},
+    {7273, 1, -1}, {7274, 0, 897}, {7274, 2, -1}, {7276, 0, 901}, {7276, 1, -1}, {7277, 0, 919}, {7277, 1, -1}, {7278, 1, -1},
+    {7279, 0, 921}, {7279, 0, 918}, {7279, 1, -1}, {7280, 1, -1}, {7281, 1, -1}, {7282, 0, 163}, {7282, 1, -1}, {7283, 0, 527},
+    {7283, 0, 171}, {7283, 0, 923}, {7283, 1, -1}, {7284, 0, 928}, {7284, 1, -1}, {7285, 0, 929}, {7285, 0, 930}, {7285, 1, -1},
+    {7286, 1, -1}, {7287, 0, 935}, {7287, 1, -1}, {7288, 1, -1}, {7289, 0, 939}, {7289, 0, 926}, {7289, 0, 941}, {7289, 0, 942},
+    {7289, 0, 773}, {7289, 0, 943}, {7289, 0, 949}, {7289, 0, 950}, {7289, 0, 952}, {7289, 1, -1}, {7290, 1, -1}, {7291, 0, 959},
+    {7291, 1, -1}, {7292, 0, 956}, {7292, 0, 962}, {7292, 1, -1}, {7293, 1, -1}, {7294, 1, -1}, {7295, 1, -1}, {7296, 0, 969},
+    {7296, 1, -1}, {7297, 0, 974}, {7297, 0, 975}, {7297, 0, 984}, {7297, 0, 987}, {7297, 0, 988}, {7297, 0, 991}, {7297, 0, 996},
+    {7297, 0, 1000}, {7297, 1, -1}, {7298, 0, 219}, {7298, 0, 1002}, {7298, 0, 224}, {7298, 1, -1}, {7299, 0, 1007}, {7299, 0, 936},
+    {7299, 0, 1008}, {7299, 0, 1009}, {7299, 1, -1}, {7300, 0, 1011}, {7300, 0, 1013}, {7300, 0, 1018}, {7300, 0, 1019}, {7300, 1, -1},
+    {7301, 1, -1}, {7302, 0, 1023}, {7302, 0, 1024}, {7302, 0, 617}, {7302, 1, -1}, {7303, 1, -1}, {7304, 1, -1}, {7305, 1, -1},
+    {7306, 1, -1}, {7307, 1, -1}, {7308, 1, -1}, {7309, 1, -1}, {7310, 0, 1034}, {7310, 2, -1}, {7312, 0, 1038}, {7312, 1, -1},
+    {7313, 1, -1}, {7314, 1, -1}, {7315, 1, -1}, {7316, 1, -1}, {7317, 1, -1}, {7318, 0, 1040}, {7318, 0, 233}, {7318, 0, 1043},
+    {7318, 1, -1}, {7319, 0, 1046}, {7319, 0, 1048}, {7319, 0, 1049}, {7319, 1, -1}, {7320, 1, -1}, {7321, 1, -1}, {7322, 1, -1},
+    {7323, 1, -1}, {7324, 1, -1}, {7325, 0, 1060}, {7325, 1, -1}, {7326, 0, 1062}, {7326, 0, 494}, {7326, 1, -1}, {7327, 0, 1065},
+    {7327, 1, -1}, {7328, 0, 1066}, {7328, 0, 1069}, {7328, 0, 1073}, {7328, 0, 1074}, {7328, 0, 1032}, {7328, 0, 1077}, {7328, 0, 1078},
+    {7328, 1, -1}, {7329, 0, 1080}, {7329, 1, -1}, {7330, 1, -1}, {7331, 1, -1}, {7332, 1, -1}, {7333, 0, 410}, {7333, 1, -1},
+    {7334, 1, -1}, {7335, 1, -1}, {7336, 0, 1089}, {7336, 0, 1090}, {7336, 1, -1}, {7337, 0, 603}, {7337, 0, 1096}, {7337, 0, 43},
+    {7337, 0, 677}, {7337, 0, 795}, {7337, 1, -1}, {7338, 0, 272}, {7338, 0, 1100}, {7338, 0, 562}, {7338, 1, -1}, {7339, 1, -1},
+    {7340, 1, -1}, {7341, 1, -1}, {7342, 0, 1112}, {7342, 0, 1113}, {7342, 0, 1114}, {7342, 1, -1}, {7343, 2, -1}, {7345, 0, 302},
+    {7345, 0, 1121}, {7345, 0, 1122}, {7345, 1, -1}, {7346, 0, 1128}, {7346, 1, -1}, {7347, 0, 287}, {7347, 0, 1130}, {7347, 0, 293},
+    {7347, 1, -1}, {7348, 1, -1}, {7349, 1, -1}, {7350, 1, -1}, {7351, 1, -1}, {7352, 0, 305}, {7352, 0, 1142}, {7352, 1, -1},
+    {7353, 1, -1}, {7354, 1, -1}, {7355, 1, -1}, {7356, 1, -1}, {7357, 1, -1}, {7358, 1, -1}, {7359, 1, -1}, {7360, 0, 1148},
+    {7360, 1, -1}, {7361, 0, 316}, {7361, 1, -1}, {7362, 0, 1152}, {7362, 0, 1153}, {7362, 1, -1}, {7363, 0, 320}, {7363, 0, 329},
+    {7363, 1, -1}, {7364, 1, -1}, {7365, 0, 334}, {7365, 1, -1}, {7366, 1, -1}, {7367, 2, -1}, {7369, 1, -1}, {7370, 2, -1},
+    {7372, 0, 1159}, {7372, 1, -1}, {7373, 0, 1162}, {7373, 0, 1164}, {7373, 0, 1165}, {7373, 0, 1167}, {7373, 1, -1}, {7374, 0, 1171},
+    {7374, 1, -1}, {7375, 0, 1175}, {7375, 1, -1}, {7376, 0, 1179}, {7376, 1, -1}, {7377, 0, 1180}, {7377, 0, 1181}, {7377, 0, 1184},
+    {7377, 0, 1186}, {7377, 0, 1191}, {7377, 1, -1}, {7378, 1, -1}, {7379, 0, 46}, {7379, 1, -1}, {7380, 0, 1209}, {7380, 1, -1},
+    {7381, 0, 1213}, {7381, 0, 1215}, {7381, 0, 48}, {7381, 1, -1}, {7382, 1, -1}, {7383, 0, 1220}, {7383, 0, 1223}, {7383, 0, 1224},
+    {7383, 0, 1225}, {7383, 1, -1}, {7384, 0, 270}, {7384, 1, -1}, {7385, 0, 926}, {7385, 1, -1}, {7386, 0, 926}, {7386, 1, -1},
+    {7387, 1, -1}, {7388, 0, 796}, {7388, 0, 1237}, {7388, 0, 369}, {7388, 1, -1}, {7389, 1, -1}, {7390, 1, -1}, {7391, 1, -1},
+    {7392, 1, -1}, {7393, 0, 373}, {7393, 1, -1}, {7394, 1, -1}, {7395, 1, -1}, {7396, 1, -1}, {7397, 0, 370}, {7397, 0, 1248},
+    {7397, 1, -1}, {7398, 1, -1}, {7399, 1, -1}, {7400, 0, 378}, {7400, 0, 1253}, {7400, 0, 1256}, {7400, 0, 1259}, {7400, 1, -1},
+    {7401, 1, -1}, {7402, 1, -1}, {7403, 0, 1263}, {7403, 0, 1266}, {7403, 1, -1}, {7404, 0, 399}, {7404, 0, 1271}, {7404, 1, -1},
+    {7405, 0, 1274}, {7405, 0, 937}, {7405, 0, 1057}, {7405, 0, 1275}, {7405, 1, -1}, {7406, 0, 1277}, {7406, 0, 1279}, {7406, 1, -1},
+    {7407, 0, 1282}, {7407, 0, 1283}, {7407, 1, -1}, {7408, 1, -1}, {7409, 0, 1287}, {7409, 0, 1288}, {7409, 1, -1}, {7410, 0, 50},
+    {7410, 1, -1}, {7411, 1, -1}, {7412, 0, 1294}, {7412, 0, 408}, {7412, 0, 1296}, {7412, 1, -1}, {7413, 1, -1}, {7414, 1, -1},
+    {7415, 1, -1}, {7416, 1, -1}, {7417, 1, -1}, {7418, 1, -1}, {7419, 0, 1303}, {7419, 1, -1}, {7420, 0, 1309}, {7420, 1, -1},
+    {7421, 0, 1312}, {7421, 1, -1}, {7422, 0, 1314}, {7422, 0, 51}, {7422, 0, 1300}, {7422, 0, 1316}, {7422, 1, -1}, {7423, 1, -1},
+    {7424, 0, 1321}, {7424, 0, 1324}, {7424, 0, 1325}, {7424, 0, 1329}, {7424, 1, -1}, {7425, 0, 932}, {7425, 1, -1}, {7426, 0, 1337},
+    {7426, 1, -1}, {7427, 0, 886}, {7427, 0, 1341}, {7427, 1, -1}, {7428, 1, -1}, {7429, 0, 1345}, {7429, 0, 1345}, {7429, 0, 1346},
+    {7429, 1, -1}, {7430, 1, -1}, {7431, 1, -1}, {7432, 0, 1354}, {7432, 1, -1}, {7433, 0, 1360}, {7433, 0, 1363}, {7433, 0, 1365},
+    {7433, 1, -1}, {7434, 0, 1366}, {7434, 0, 1367}, {7434, 0, 445}, {7434, 1, -1}, {7435, 0, 447}, {7435, 1, -1}, {7436, 0, 442},
+    {7436, 0, 141}, {7436, 0, 20}, {7436, 0, 1356}, {7436, 0, 450}, {7436, 1, -1}, {7437, 0, 1372}, {7437, 1, -1}, {7438, 1, -1},
+    {7439, 1, -1}, {7440, 1, -1}, {7441, 0, 1370}, {7441, 1, -1}, {7442, 1, -1}, {7443, 0, 1379}, {7443, 0, 1380}, {7443, 0, 1381},
+    {7443, 1, -1}, {7444, 1, -1}, {7445, 0, 454}, {7445, 1, -1}, {7446, 1, -1}, {7447, 1, -1}, {7448, 1, -1}, {7449, 0, 1387},
+    {7449, 1, -1}, {7450, 1, -1}, {7451, 1, -1}, {7452, 1, -1}, {7453, 1, -1}, {7454, 1, -1}, {7455, 1, -1}, {7456, 0, 459},
+    {7456, 1, -1}, {7457, 1, -1}, {7458, 0, 1397}, {7458, 0, 1398}, {7458, 0, 1399}, {7458, 0, 933}, {7458, 1, -1}, {7459, 0, 1401},
+    {7459, 0, 1403}, {7459, 0, 1405}, {7459, 0, 1406}, {7459, 0, 1408}, {7459, 0, 471}, {7459, 1, -1}, {7460, 1, -1}, {7461, 0, 1411},
+    {7461, 1, -1}, {7462, 1, -1}, {7463, 0, 474}, {7463, 0, 475}, {7463, 0, 679}, {7463, 1, -1}, {7464, 0, 1415}, {7464, 0, 1416},
+    {7464, 0, 1417}, {7464, 1, -1}, {7465, 0, 1420}, {7465, 1, -1}, {7466, 0, 1423}, {7466, 1, -1}, {7467, 1, -1}, {7468, 1, -1},
+    {7469, 1, -1}, {7470, 0, 1432}, {7470, 2, -1}, {7472, 0, 1434}, {7472, 0, 1436}, {7472, 0, 1439}, {7472, 0, 1440}, {7472, 0, 1442},
+    {7472, 0, 1444}, {7472, 1, -1}, {7473, 0, 1445}, {7473, 1, -1}, {7474, 1, -1}, {7475, 1, -1}, {7476, 1, -1}, {7477, 1, -1},
+    {7478, 0, 1452}, {7478, 1, -1}, {7479, 0, 1453}, {7479, 0, 1458}, {7479, 1, -1}, {7480, 0, 1463}, {7480, 1, -1}, {7481, 1, -1},
+    {7482, 1, -1}, {7483, 0, 1229}, {7483, 1, -1}, {7484, 0, 1298}, {7484, 1, -1}, {7485, 1, -1}, {7486, 1, -1}, {7487, 1, -1},
+    {7488, 1, -1}, {7489, 0, 1469}, {7489, 0, 1471}, {7489, 0, 524}, {7489, 0, 1465}, {7489, 0, 1464}, {7489, 0, 1467}, {7489, 0, 1466},
+    {7489, 1, -1}, {7490, 0, 1477}, {7490, 0, 1478}, {7490, 0, 1479}, {7490, 0, 526}, {7490, 0, 625}, {7490, 0, 626}, {7490, 0, 627},
+    {7490, 0, 631}, {7490, 0, 533}, {7490, 0, 1488}, {7490, 0, 1499}, {7490, 0, 1500}, {7490, 0, 557}, {7490, 1, -1}, {7491, 1, -1},
+    {7492, 1, -1}, {7493, 0, 24}, {7493, 1, -1}, {7494, 1, -1}, {7495, 0, 36}, {7495, 0, 40}, {7495, 0, 42}, {7495, 1, -1},
+    {7496, 1, -1}, {7497, 1, -1}, {7498, 1, -1}, {7499, 1, -1}, {7500, 1, -1}, {7501, 1, -1}, {7502, 1, -1}, {7503, 1, -1},
+    {7504, 1, -1}, {7505, 1, -1}, {7506, 1, -1}, {7507, 1, -1}, {7508, 0, 81}, {7508, 1, -1}, {7509, 1, -1}, {7510, 1, -1},
+    {7511, 2, -1}, {7513, 1, -1}, {7514, 1, -1}, {7515, 1, -1}, {7516, 2, -1}, {7518, 1, -1}, {7519, 1, -1}, {7520, 1, -1},
+    {7521, 3, -1}, {7524, 1, -1}, {7525, 0, 109}, {7525, 1, -1}, {7526, 1, -1}, {7527, 0, 122}, {7527, 1, -1}, {7528, 1, -1},
+    {7529, 0, 128}, {7529, 1, -1}, {7530, 1, -1}, {7531, 1, -1}, {7532, 1, -1}, {7533, 1, -1}, {7534, 1, -1}, {7535, 1, -1},
+    {7536, 1, -1}, {7537, 1, -1}, {7538, 1, -1}, {7539, 1, -1}, {7540, 1, -1}, {7541, 1, -1}, {7542, 1, -1}, {7543, 1, -1},
+    {7544, 1, -1}, {7545, 1, -1}, {7546, 0, 93}, {7546, 1, -1}, {7547, 1, -1}, {7548, 1, -1}, {7549, 1, -1}, {7550, 1, -1},
+    {7551, 1, -1}, {7552, 1, -1}, {7553, 1, -1}, {7554, 2, -1}, {7556, 1, -1}, {7557, 1, -1}, {7558, 0, 236}, {7558, 1, -1},
+    {7559, 1, -1}, {7560, 1, -1}, {7561, 1, -1}, {7562, 1, -1}, {7563, 1, -1}, {7564, 1, -1}, {7565, 1, -1}, {7566, 1, -1},
+    {7567, 1, -1}, {7568, 1, -1}, {7569, 1, -1}, {7570, 1, -1}, {7571, 1, -1}, {7572, 1, -1}, {7573, 1, -1}, {7574, 2, -1},
+    {7576, 1, -1}, {7577, 2, -1}, {7579, 1, -1}, {7580, 1, -1}, {7581, 1, -1}, {7582, 1, -1}, {7583, 1, -1}, {7584, 1, -1},
+    {7585, 3, -1}, {7588, 1, -1}, {7589, 1, -1}, {7590, 0, 281}, {7590, 0, 283}, {7590, 1, -1}, {7591, 1, -1}, {7592, 1, -1},
+    {7593, 1, -1}, {7594, 1, -1}, {7595, 2, -1}, {7597, 1, -1}, {7598, 1, -1}, {7599, 1, -1}, {7600, 1, -1}, {7601, 1, -1},
+    {7602, 0, 306}, {7602, 1, -1}, {7603, 1, -1}, {7604, 1, -1}, {7605, 1, -1}, {7606, 1, -1}, {7607, 1, -1}, {7608, 1, -1},
+    {7609, 1, -1}, {7610, 1, -1}, {7611, 1, -1}, {7612, 1, -1}, {7613, 1, -1}, {7614, 1, -1}, {7615, 4, -1}, {7619, 1, -1},
+    {7620, 0, 350}, {7620, 1, -1}, {7621, 0, 360}, {7621, 2, -1}, {7623, 1, -1}, {7624, 1, -1}, {7625, 1, -1}, {7626, 1, -1},
+    {7627, 4, -1}, {7631, 0, 377}, {7631, 1, -1}, {7632, 2, -1}, {7634, 1, -1}, {7635, 1, -1}, {7636, 1, -1}, {7637, 1, -1},
+    {7638, 1, -1}, {7639, 1, -1}, {7640, 1, -1}, {7641, 3, -1}, {7644, 1, -1}, {7645, 1, -1}, {7646, 1, -1}, {7647, 1, -1},
+    {7648, 1, -1}, {7649, 1, -1}, {7650, 1, -1}, {7651, 1, -1}, {7652, 1, -1}, {7653, 1, -1}, {7654, 1, -1}, {7655, 1, -1},
+    {7656, 1, -1}, {7657, 1, -1}, {7658, 1, -1}, {7659, 2, -1}, {7661, 1, -1}, {7662, 1, -1}, {7663, 4, -1}, {7667, 1, -1},
+    {7668, 2, -1}, {7670, 1, -1}, {7671, 1, -1}, {7672, 1, -1}, {7673, 1, -1}, {7674, 1, -1}, {7675, 1, -1}, {7676, 1, -1},
+    {7677, 1, -1}, {7678, 1, -1}, {7679, 1, -1}, {7680, 1, -1}, {7681, 1, -1}, {7682, 0, 437}, {7682, 1, -1}, {7683, 1, -1},
+    {7684, 1, -1}, {7685, 1, -1}, {7686, 1, -1}, {7687, 0, 95}, {7687, 1, -1}, {7688, 1, -1}, {7689, 1, -1}, {7690, 0, 511},
+    {7690, 4, -1}, {7694, 1, -1}, {7695, 1, -1}, {7696, 0, 570}, {7696, 1, -1}, {7697, 1, -1}, {7698, 1, -1}, {7699, 1, -1},
+    {7700, 1, -1}, {7701, 1, -1}, {7702, 1, -1}, {7703, 1, -1}, {7704, 1, -1}, {7705, 0, 591}, {7705, 1, -1}, {7706, 0, 594},
+    {7706, 1, -1}, {7707, 0, 63}, {7707, 1, -1}, {7708, 1, -1}, {7709, 1, -1}, {7710, 1, -1}, {7711, 0, 611}, {7711, 1, -1},
+    {7712, 1, -1}, {7713, 1, -1}, {7714, 0, 24}, {7714, 0, 618}, {7714, 0, 621}, {7714, 0, 623}, {7714, 0, 624}, {7714, 1, -1},
+    {7715, 1, -1}, {7716, 1, -1}, {7717, 0, 628}, {7717, 1, -1}, {7718, 1, -1}, {7719, 1, -1}, {7720, 1, -1}, {7721, 1, -1},
+    {7722, 1, -1}, {7723, 0, 644}, {7723, 1, -1}, {7724, 0, 678}, {7724, 1, -1}, {7725, 1, -1}, {7726, 1, -1}, {7727, 0, 713},
+    {7727, 0, 715}, {7727, 1, -1}, {7728, 1, -1}, {7729, 1, -1}, {7730, 1, -1}, {7731, 1, -1}, {7732, 1, -1}, {7733, 1, -1},
+    {7734, 1, -1}, {7735, 1, -1}, {7736, 0, 733}, {7736, 1, -1}, {7737, 0, 17}, {7737, 1, -1}, {7738, 1, -1}, {7739, 0, 739},
+    {7739, 0, 750}, {7739, 0, 751}, {7739, 0, 755}, {7739, 1, -1}, {7740, 0, 764}, {7740, 1, -1}, {7741, 1, -1}, {7742, 1, -1},
+    {7743, 1, -1}, {7744, 1, -1}, {7745, 1, -1}, {7746, 0, 774}, {7746, 0, 68}, {7746, 0, 778}, {7746, 0, 781}, {7746, 0, 81},
+    {7746, 1, -1}, {7747, 0, 785}, {7747, 1, -1}, {7748, 1, -1}, {7749, 1, -1}, {7750, 0, 796}, {7750, 1, -1}, {7751, 1, -1},
+    {7752, 1, -1}, {7753, 1, -1}, {7754, 1, -1}, {7755, 1, -1}, {7756, 0, 806}, {7756, 1, -1}, {7757, 1, -1}, {7758, 1, -1},
+    {7759, 0, 840}, {7759, 0, 814}, {7759, 1, -1}, {7760, 1, -1}, {7761, 0, 844}, {7761, 1, -1}, {7762, 1, -1}, {7763, 1, -1},
+    {7764, 1, -1}, {7765, 1, -1}, {7766, 1, -1}, {7767, 0, 898}, {7767, 1, -1}, {7768, 1, -1}, {7769, 0, 920}, {7769, 1, -1},
+    {7770, 1, -1}, {7771, 1, -1}, {7772, 0, 161}, {7772, 1, -1}, {7773, 0, 924}, {7773, 1, -1}, {7774, 1, -1}, {7775, 1, -1},
+    {7776, 1, -1}, {7777, 1, -1}, {7778, 1, -1}, {7779, 1, -1}, {7780, 1, -1}, {7781, 1, -1}, {7782, 1, -1}, {7783, 1, -1},
+    {7784, 0, 964}, {7784, 0, 972}, {7784, 1, -1}, {7785, 0, 1006}, {7785, 0, 1010}, {7785, 0, 1021}, {7785, 0, 1022}, {7785, 0, 1027},
+    {7785, 1, -1}, {7786, 1, -1}, {7787, 1, -1}, {7788, 1, -1}, {7789, 1, -1}, {7790, 1, -1}, {7791, 1, -1}, {7792, 0, 1035},
+    {7792, 1, -1}, {7793, 1, -1}, {7794, 0, 1039}, {7794, 1, -1}, {7795, 1, -1}, {7796, 0, 250}, {7796, 0, 253}, {7796, 1, -1},
+    {7797, 1, -1}, {7798, 1, -1}, {7799, 2, -1}, {7801, 1, -1}, {7802, 1, -1}, {7803, 1, -1}, {7804, 0, 1061}, {7804, 0, 1063},
+    {7804, 1, -1}, {7805, 0, 1079}, {7805, 1, -1}, {7806, 0, 1083}, {7806, 1, -1}, {7807, 0, 1088}, {7807, 1, -1}, {7808, 1, -1},
+    {7809, 1, -1}, {7810, 1, -1}, {7811, 0, 1098}, {7811, 1, -1}, {7812, 1, -1}, {7813, 1, -1}, {7814, 1, -1}, {7815, 0, 336},
+    {7815, 0, 1119}, {7815, 1, -1}, {7816, 1, -1}, {7817, 0, 509}, {7817, 0, 293}, {7817, 1, -1}, {7818, 1, -1}, {7819, 1, -1},
+    {7820, 1, -1}, {7821, 1, -1}, {7822, 0, 290}, {7822, 0, 1144}, {7822, 0, 1145}, {7822, 0, 317}, {7822, 0, 1146}, {7822, 0, 1147},
+    {7822, 1, -1}, {7823, 0, 1150}, {7823, 0, 315}, {7823, 1, -1}, {7824, 1, -1}, {7825, 1, -1}, {7826, 0, 322}, {7826, 0, 324},
+    {7826, 0, 325}, {7826, 1, -1}, {7827, 0, 328}, {7827, 0, 331}, {7827, 1, -1}, {7828, 1, -1}, {7829, 0, 1170}, {7829, 0, 1174},
+    {7829, 0, 1176}, {7829, 0, 508}, {7829, 0, 1195}, {7829, 0, 1199}, {7829, 0, 1206}, {7829, 0, 1211}, {7829, 1, -1}, {7830, 1, -1},
+    {7831, 0, 1226}, {7831, 1, -1}, {7832, 0, 1233}, {7832, 1, -1}, {7833, 0, 1236}, {7833, 0, 1239}, {7833, 0, 1240}, {7833, 1, -1},
+    {7834, 1, -1}, {7835, 1, -1}, {7836, 1, -1}, {7837, 1, -1}, {7838, 1, -1}, {7839, 0, 375}, {7839, 1, -1}, {7840, 1, -1},
+    {7841, 1, -1}, {7842, 1, -1}, {7843, 0, 1261}, {7843, 0, 843}, {7843, 1, -1}, {7844, 0, 1272}, {7844, 0, 1276}, {7844, 1, -1},
+    {7845, 0, 1285}, {7845, 0, 1286}, {7845, 0, 1291}, {7845, 0, 424}, {7845, 1, -1}, {7846, 1, -1}, {7847, 1, -1}, {7848, 1, -1},
+    {7849, 1, -1}, {7850, 1, -1}, {7851, 1, -1}, {7852, 1, -1}, {7853, 1, -1}, {7854, 0, 1310}, {7854, 1, -1}, {7855, 1, -1},
+    {7856, 0, 1319}, {7856, 1, -1}, {7857, 0, 263}, {7857, 1, -1}, {7858, 1, -1}, {7859, 1, -1}, {7860, 0, 1352}, {7860, 0, 1353},
+    {7860, 1, -1}, {7861, 1, -1}, {7862, 1, -1}, {7863, 2, -1}, {7865, 2, -1}, {7867, 2, -1}, {7869, 0, 1373}, {7869, 0, 1374},
+    {7869, 0, 1377}, {7869, 0, 1378}, {7869, 2, -1}, {7871, 1, -1}, {7872, 1, -1}, {7873, 1, -1}, {7874, 1, -1}, {7875, 1, -1},
+    {7876, 1, -1}, {7877, 0, 456}, {7877, 0, 1388}, {7877, 0, 1389}, {7877, 0, 1390}, {7877, 0, 1391}, {7877, 0, 1392}, {7877, 0, 1393},
+    {7877, 0, 1396}, {7877, 2, -1}, {7879, 1, -1}, {7880, 0, 262}, {7880, 1, -1}, {7881, 1, -1}, {7882, 1, -1}, {7883, 1, -1},
+    {7884, 1, -1}, {7885, 0, 1419}, {7885, 5, -1}, {7890, 1, -1}, {7891, 0, 1425}, {7891, 0, 1427}, {7891, 1, -1}, {7892, 1, -1},
+    {7893, 1, -1}, {7894, 1, -1}, {7895, 0, 437}, {7895, 1, -1}, {7896, 1, -1}, {7897, 0, 1450}, {7897, 1, -1}, {7898, 1, -1},
+    {7899, 0, 1460}, {7899, 1, -1}, {7900, 1, -1}, {7901, 1, -1}, {7902, 1, -1}, {7903, 1, -1}, {7904, 1, -1}, {7905, 1, -1},
+    {7906, 1, -1}, {7907, 1, -1}, {7908, 0, 1475}, {7908, 0, 1506}, {7908, 1, -1}, {7909, 1, -1}, {7910, 1, -1}, {7911, 1, -1},
+    {7912, 1, -1}, {7913, 1, -1}, {7914, 1, -1}, {7915, 1, -1}, {7916, 1, -1}, {7917, 1, -1}, {7918, 1, -1}, {7919, 1, -1},
+    {7920, 1, -1}, {7921, 1, -1}, {7922, 1, -1}, {7923, 0, 64}, {7923, 1, -1}, {7924, 1, -1}, {7925, 0, 86}, {7925, 1, -1},
+    {7926, 1, -1}, {7927, 1, -1}, {7928, 1, -1}, {7929, 1, -1}, {7930, 1, -1}, {7931, 1, -1}, {7932, 1, -1}, {7933, 1, -1},
+    {7934, 3, -1}, {7937, 1, -1}, {7938, 1, -1}, {7939, 1, -1}, {7940, 1, -1}, {7941, 2, -1}, {7943, 1, -1}, {7944, 1, -1},
+    {7945, 1, -1}, {7946, 1, -1}, {7947, 1, -1}, {7948, 1, -1}, {7949, 1, -1}, {7950, 1, -1}, {7951, 1, -1}, {7952, 1, -1},
+    {7953, 1, -1}, {7954, 1, -1}, {7955, 1, -1}, {7956, 1, -1}, {7957, 1, -1}, {7958, 1, -1}, {7959, 1, -1}, {7960, 1, -1},
+    {7961, 1, -1}, {7962, 1, -1}, {7963, 1, -1}, {7964, 0, 188}, {7964, 1, -1}, {7965, 2, -1}, {7967, 1, -1}, {7968, 1, -1},
+    {7969, 3, -1}, {7972, 1, -1}, {7973, 1, -1}, {7974, 1, -1}, {7975, 1, -1}, {7976, 1, -1}, {7977, 2, -1}, {7979, 1, -1},
+    {7980, 1, -1}, {7981, 1, -1}, {7982, 1, -1}, {7983, 1, -1}, {7984, 1, -1}, {7985, 1, -1}, {7986, 1, -1}, {7987, 1, -1},
+    {7988, 1, -1}, {7989, 1, -1}, {7990, 1, -1}, {7991, 0, 251}, {7991, 1, -1}, {7992, 1, -1}, {7993, 1, -1}, {7994, 1, -1},
+    {7995, 1, -1}, {7996, 1, -1}, {7997, 1, -1}, {7998, 1, -1}, {7999, 1, -1}, {8000, 1, -1}, {8001, 1, -1}, {8002, 1, -1},
+    {8003, 1, -1}, {8004, 1, -1}, {8005, 1, -1}, {8006, 1, -1}, {8007, 1, -1}, {8008, 1, -1}, {8009, 1, -1}, {8010, 1, -1},
+    {8011, 1, -1}, {8012, 1, -1}, {8013, 1, -1}, {8014, 1, -1}, {8015, 0, 291}, {8015, 1, -1}, {8016, 1, -1}, {8017, 1, -1},
+    {8018, 1, -1}, {8019, 1, -1}, {8020, 1, -1}, {8021, 1, -1}, {8022, 1, -1}, {8023, 1, -1}, {8024, 1, -1}, {8025, 1, -1},
+    {8026, 2, -1}, {8028, 1, -1}, {8029, 1, -1}, {8030, 1, -1}, {8031, 1, -1}, {8032, 2, -1}, {8034, 1, -1}, {8035, 1, -1},
+    {8036, 0, 333}, {8036, 1, -1}, {8037, 1, -1}, {8038, 1, -1}, {8039, 1, -1}, {8040, 2, -1}, {8042, 1, -1}, {8043, 1, -1},
+    {8044, 1, -1}, {8045, 0, 364}, {8045, 1, -1}, {8046, 1, -1}, {8047, 0, 372}, {8047, 1, -1}, {8048, 1, -1}, {8049, 1, -1},
+    {8050, 1, -1}, {8051, 1, -1}, {8052, 1, -1}, {8053, 1, -1}, {8054, 1, -1}, {8055, 1, -1}, {8056, 1, -1}, {8057, 1, -1},
+    {8058, 2, -1}, {8060, 1, -1}, {8061, 0, 409}, {8061, 1, -1}, {8062, 1, -1}, {8063, 1, -1}, {8064, 1, -1}, {8065, 1, -1},
+    {8066, 1, -1}, {8067, 1, -1}, {8068, 1, -1}, {8069, 1, -1}, {8070, 1, -1}, {8071, 1, -1}, {8072, 1, -1}, {8073, 1, -1},
+    {8074, 1, -1}, {8075, 1, -1}, {8076, 1, -1}, {8077, 1, -1}, {8078, 1, -1}, {8079, 1, -1}, {8080, 1, -1}, {8081, 1, -1},
+    {8082, 0, 453}, {8082, 1, -1}, {8083, 1, -1}, {8084, 1, -1}, {8085, 0, 395}, {8085, 0, 459}, {8085, 1, -1}, {8086, 1, -1},
+    {8087, 1, -1}, {8088, 1, -1}, {8089, 1, -1}, {8090, 1, -1}, {8091, 1, -1}, {8092, 1, -1}, {8093, 0, 485}, {8093, 0, 494},
+    {8093, 2, -1}, {8095, 1, -1}, {8096, 1, -1}, {8097, 1, -1}, {8098, 1, -1}, {8099, 1, -1}, {8100, 1, -1}, {8101, 1, -1},
+    {8102, 1, -1}, {8103, 1, -1}, {8104, 1, -1}, {8105, 1, -1}, {8106, 1, -1}, {8107, 1, -1}, {8108, 1, -1}, {8109, 1, -1},
+    {8110, 1, -1}, {8111, 0, 577}, {8111, 0, 582}, {8111, 0, 583}, {8111, 0, 584}, {8111, 0, 585}, {8111, 0, 586}, {8111, 0, 587},
+    {8111, 0, 588}, {8111, 0, 589}, {8111, 0, 592}, {8111, 0, 599}, {8111, 0, 59}, {8111, 0, 608}, {8111, 1, -1}, {8112, 1, -1},
+    {8113, 1, -1}, {8114, 0, 614}, {8114, 0, 615}, {8114, 0, 625}, {8114, 1, -1}, {8115, 0, 627}, {8115, 1, -1}, {8116, 0, 631},
+    {8116, 0, 533}, {8116, 1, -1}, {8117, 1, -1}, {8118, 1, -1}, {8119, 0, 677}, {8119, 0, 679}, {8119, 0, 696}, {8119, 0, 702},
+    {8119, 1, -1}, {8120, 1, -1}, {8121, 1, -1}, {8122, 0, 386}, {8122, 0, 727}, {8122, 1, -1}, {8123, 1, -1}, {8124, 1, -1},
+    {8125, 0, 731}, {8125, 0, 734}, {8125, 1, -1}, {8126, 1, -1}, {8127, 0, 757}, {8127, 1, -1}, {8128, 1, -1}, {8129, 0, 765},
+    {8129, 1, -1}, {8130, 1, -1}, {8131, 0, 49}, {8131, 1, -1}, {8132, 1, -1}, {8133, 0, 794}, {8133, 0, 795}, {8133, 1, -1},
+    {8134, 1, -1}, {8135, 1, -1}, {8136, 1, -1}, {8137, 1, -1}, {8138, 0, 385}, {8138, 0, 808}, {8138, 0, 824}, {8138, 0, 829},
+    {8138, 1, -1}, {8139, 1, -1}, {8140, 0, 845}, {8140, 1, -1}, {8141, 1, -1}, {8142, 1, -1}, {8143, 0, 869}, {8143, 0, 162},
+    {8143, 0, 899}, {8143, 0, 909}, {8143, 1, -1}, {8144, 1, -1}, {8145, 1, -1}, {8146, 1, -1}, {8147, 1, -1}, {8148, 0, 932},
+    {8148, 0, 933}, {8148, 1, -1}, {8149, 1, -1}, {8150, 0, 195}, {8150, 0, 183}, {8150, 0, 961}, {8150, 0, 558}, {8150, 0, 962},
+    {8150, 0, 963}, {8150, 0, 1001}, {8150, 0, 1028}, {8150, 2, -1}, {8152, 1, -1}, {8153, 1, -1}, {8154, 3, -1}, {8157, 1, -1},
+    {8158, 0, 252}, {8158, 0, 1036}, {8158, 1, -1}, {8159, 1, -1}, {8160, 1, -1}, {8161, 0, 790}, {8161, 1, -1}, {8162, 0, 1051},
+    {8162, 1, -1}, {8163, 1, -1}, {8164, 1, -1}, {8165, 1, -1}, {8166, 2, -1}, {8168, 0, 798}, {8168, 0, 1082}, {8168, 1, -1},
+    {8169, 1, -1}, {8170, 1, -1}, {8171, 0, 507}, {8171, 1, -1}, {8172, 0, 1104}, {8172, 1, -1}, {8173, 1, -1}, {8174, 1, -1},
+    {8175, 0, 285}, {8175, 0, 1123}, {8175, 1, -1}, {8176, 1, -1}, {8177, 1, -1}, {8178, 1, -1}, {8179, 0, 1143}, {8179, 1, -1},
+    {8180, 1, -1}, {8181, 1, -1}, {8182, 1, -1}, {8183, 2, -1}, {8185, 2, -1}, {8187, 2, -1}, {8189, 0, 1216}, {8189, 0, 97},
+    {8189, 1, -1}, {8190, 0, 1235}, {8190, 0, 1241}, {8190, 1, -1}, {8191, 1, -1}, {8192, 1, -1}, {8193, 0, 1247}, {8193, 0, 1248},
+    {8193, 0, 1250}, {8193, 0, 1251}, {8193, 0, 1252}, {8193, 1, -1}, {8194, 0, 1267}, {8194, 1, -1}, {8195, 0, 394}, {8195, 1, -1},
+    {8196, 1, -1}, {8197, 2, -1}, {8199, 1, -1}, {8200, 1, -1}, {8201, 1, -1}, {8202, 1, -1}, {8203, 1, -1}, {8204, 0, 1313},
+    {8204, 0, 1318}, {8204, 0, 1330}, {8204, 0, 20}, {8204, 0, 523}, {8204, 1, -1}, {8205, 1, -1}, {8206, 0, 1355}, {8206, 1, -1},
+    {8207, 0, 444}, {8207, 1, -1}, {8208, 0, 446}, {8208, 1, -1}, {8209, 1, -1}, {8210, 1, -1}, {8211, 0, 452}, {8211, 1, -1},
+    {8212, 2, -1}, {8214, 1, -1}, {8215, 1, -1}, {8216, 1, -1}, {8217, 0, 1327}, {8217, 0, 1329}, {8217, 0, 460}, {8217, 1, -1},
+    {8218, 2, -1}, {8220, 1, -1}, {8221, 0, 1411}, {8221, 1, -1}, {8222, 0, 475}, {8222, 0, 1414}, {8222, 0, 1421}, {8222, 1, -1},
+    {8223, 1, -1}, {8224, 1, -1}, {8225, 1, -1}, {8226, 0, 1424}, {8226, 0, 1428}, {8226, 1, -1}, {8227, 1, -1}, {8228, 0, 1444},
+    {8228, 1, -1}, {8229, 2, -1}, {8231, 1, -1}, {8232, 0, 1452}, {8232, 1, -1}, {8233, 0, 987}, {8233, 1, -1}, {8234, 1, -1},
+    {8235, 0, 1345}, {8235, 1, -1}, {8236, 1, -1}, {8237, 0, 1411}, {8237, 1, -1}, {8238, 1, -1}, {8239, 0, 20}, {8239, 1, -1},
+    {8240, 1, -1}, {8241, 0, 43}, {8241, 0, 45}, {8241, 1, -1}, {8242, 1, -1}, {8243, 1, -1}, {8244, 1, -1}, {8245, 2, -1},
+    {8247, 0, 54}, {8247, 1, -1}, {8248, 0, 58}, {8248, 1, -1}, {8249, 1, -1}, {8250, 1, -1}, {8251, 1, -1}, {8252, 0, 84},
+    {8252, 1, -1}, {8253, 3, -1}, {8256, 2, -1}, {8258, 1, -1}, {8259, 1, -1}, {8260, 1, -1}, {8261, 1, -1}, {8262, 0, 98},
+    {8262, 1, -1}, {8263, 1, -1}, {8264, 0, 101}, {8264, 1, -1}, {8265, 1, -1}, {8266, 1, -1}, {8267, 1, -1}, {8268, 1, -1},
+    {8269, 1, -1}, {8270, 0, 87}, {8270, 1, -1}, {8271, 1, -1}, {8272, 1, -1}, {8273, 1, -1}, {8274, 1, -1}, {8275, 1, -1},
+    {8276, 1, -1}, {8277, 1, -1}, {8278, 1, -1}, {8279, 1, -1}, {8280, 1, -1}, {8281, 1, -1}, {8282, 1, -1}, {8283, 1, -1},
+    {8284, 1, -1}, {8285, 1, -1}, {8286, 1, -1}, {8287, 0, 175}, {8287, 1, -1}, {8288, 1, -1}, {8289, 1, -1}, {8290, 1, -1},
+    {8291, 1, -1}, {8292, 1, -1}, {8293, 0, 225}, {8293, 1, -1}, {8294, 1, -1}, {8295, 1, -1}, {8296, 1, -1}, {8297, 1, -1},
+    {8298, 1, -1}, {8299, 0, 233}, {8299, 1, -1}, {8300, 1, -1}, {8301, 1, -1}, {8302, 1, -1}, {8303, 1, -1}, {8304, 1, -1},
+    {8305, 1, -1}, {8306, 1, -1}, {8307, 2, -1}, {8309, 0, 88}, {8309, 1, -1}, {8310, 1, -1}, {8311, 1, -1}, {8312, 1, -1},
+    {8313, 1, -1}, {8314, 0, 253}, {8314, 1, -1}, {8315, 1, -1}, {8316, 1, -1}, {8317, 1, -1}, {8318, 1, -1}, {8319, 1, -1},
+    {8320, 1, -1}, {8321, 1, -1}, {8322, 1, -1}, {8323, 1, -1}, {8324, 0, 270}, {8324, 0, 272}, {8324, 1, -1}, {8325, 1, -1},
+    {8326, 1, -1}, {8327, 1, -1}, {8328, 1, -1}, {8329, 1, -1}, {8330, 1, -1}, {8331, 0, 288}, {8331, 1, -1}, {8332, 1, -1},
+    {8333, 1, -1}, {8334, 0, 293}, {8334, 7, -1}, {8341, 1, -1}, {8342, 1, -1}, {8343, 1, -1}, {8344, 1, -1}, {8345, 1, -1},
+    {8346, 1, -1}, {8347, 1, -1}, {8348, 1, -1}, {8349, 1, -1}, {8350, 1, -1}, {8351, 1, -1}, {8352, 1, -1}, {8353, 1, -1},
+    {8354, 1, -1}, {8355, 0, 325}, {8355, 1, -1}, {8356, 1, -1}, {8357, 1, -1}, {8358, 1, -1}, {8359, 1, -1}, {8360, 1, -1},
+    {8361, 1, -1}, {8362, 1, -1}, {8363, 1, -1}, {8364, 0, 361}, {8364, 1, -1}, {8365, 1, -1}, {8366, 0, 369}, {8366, 1, -1},
+    {8367, 1, -1}, {8368, 1, -1}, {8369, 1, -1}, {8370, 2, -1}, {8372, 1, -1}, {8373, 1, -1}, {8374, 1, -1}, {8375, 1, -1},
+    {8376, 3, -1}, {8379, 1, -1}, {8380, 1, -1}, {8381, 1, -1}, {8382, 1, -1}, {8383, 1, -1}, {8384, 1, -1}, {8385, 1, -1},
+    {8386, 1, -1}, {8387, 1, -1}, {8388, 1, -1}, {8389, 1, -1}, {8390, 1, -1}, {8391, 1, -1}, {8392, 1, -1}, {8393, 1, -1},
+    {8394, 1, -1}, {8395, 1, -1}, {8396, 1, -1}, {8397, 1, -1}, {8398, 1, -1}, {8399, 1, -1}, {8400, 1, -1}, {8401, 1, -1},
+    {8402, 1, -1}, {8403, 1, -1}, {8404, 1, -1}, {8405, 1, -1}, {8406, 1, -1}, {8407, 1, -1}, {8408, 1, -1}, {8409, 0, 471},
+    {8409, 1, -1}, {8410, 0, 474}, {8410, 1, -1}, {8411, 1, -1}, {8412, 1, -1}, {8413, 0, 480}, {8413, 1, -1}, {8414, 1, -1},
+    {8415, 1, -1}, {8416, 0, 499}, {8416, 1, -1}, {8417, 1, -1}, {8418, 1, -1}, {8419, 1, -1}, {8420, 1, -1}, {8421, 1, -1},
+    {8422, 1, -1}, {8423, 1, -1}, {8424, 1, -1}, {8425, 1, -1}, {8426, 1, -1}, {8427, 1, -1}, {8428, 1, -1}, {8429, 1, -1},
+    {8430, 1, -1}, {8431, 0, 610}, {8431, 0, 612}, {8431, 0, 626}, {8431, 1, -1}, {8432, 1, -1}, {8433, 1, -1}, {8434, 1, -1},
+    {8435, 0, 43}, {8435, 0, 719}, {8435, 1, -1}, {8436, 1, -1}, {8437, 1, -1}, {8438, 1, -1}, {8439, 1, -1}, {8440, 0, 57},
+    {8440, 1, -1}, {8441, 1, -1}, {8442, 1, -1}, {8443, 2, -1}, {8445, 1, -1}, {8446, 1, -1}, {8447, 0, 797}, {8447, 1, -1},
+    {8448, 0, 98}, {8448, 1, -1}, {8449, 1, -1}, {8450, 1, -1}, {8451, 1, -1}, {8452, 1, -1}, {8453, 1, -1}, {8454, 1, -1},
+    {8455, 0, 891}, {8455, 0, 158}, {8455, 1, -1}, {8456, 0, 922}, {8456, 0, 928}, {8456, 1, -1}, {8457, 1, -1}, {8458, 0, 225},
+    {8458, 1, -1}, {8459, 1, -1}, {8460, 1, -1}, {8461, 1, -1}, {8462, 1, -1}, {8463, 1, -1}, {8464, 1, -1}, {8465, 1, -1},
+    {8466, 0, 248}, {8466, 1, -1}, {8467, 1, -1}, {8468, 1, -1}, {8469, 1, -1}, {8470, 1, -1}, {8471, 1, -1}, {8472, 1, -1},
+    {8473, 1, -1}, {8474, 0, 1084}, {8474, 1, -1}, {8475, 1, -1}, {8476, 1, -1}, {8477, 1, -1}, {8478, 1, -1}, {8479, 1, -1},
+    {8480, 0, 299}, {8480, 1, -1}, {8481, 1, -1}, {8482, 0, 310}, {8482, 0, 289}, {8482, 1, -1}, {8483, 0, 337}, {8483, 1, -1},
+    {8484, 0, 326}, {8484, 1, -1}, {8485, 0, 332}, {8485, 1, -1}, {8486, 1, -1}, {8487, 1, -1}, {8488, 0, 867}, {8488, 1, -1},
+    {8489, 1, -1}, {8490, 1, -1}, {8491, 1, -1}, {8492, 0, 383}, {8492, 2, -1}, {8494, 1, -1}, {8495, 1, -1}, {8496, 1, -1},
+    {8497, 1, -1}, {8498, 1, -1}, {8499, 1, -1}, {8500, 1, -1}, {8501, 1, -1}, {8502, 1, -1}, {8503, 1, -1}, {8504, 0, 1365},
+    {8504, 1, -1}, {8505, 1, -1}, {8506, 1, -1}, {8507, 1, -1}, {8508, 0, 1371}, {8508, 0, 1376}, {8508, 1, -1}, {8509, 1, -1},
+    {8510, 1, -1}, {8511, 1, -1}, {8512, 0, 1386}, {8512, 0, 1395}, {8512, 1, -1}, {8513, 0, 471}, {8513, 1, -1}, {8514, 1, -1},
+    {8515, 1, -1}, {8516, 0, 1422}, {8516, 1, -1}, {8517, 1, -1}, {8518, 1, -1}, {8519, 1, -1}, {8520, 1, -1}, {8521, 1, -1},
+    {8522, 1, -1}, {8523, 1, -1}, {8524, 1, -1}, {8525, 0, 378}, {8525, 1, -1}, {8526, 1, -1}, {8527, 1, -1}, {8528, 1, -1},
+    {8529, 0, 25}, {8529, 1, -1}, {8530, 1, -1}, {8531, 0, 47}, {8531, 1, -1}, {8532, 1, -1}, {8533, 1, -1}, {8534, 1, -1},
+    {8535, 1, -1}, {8536, 1, -1}, {8537, 4, -1}, {8541, 1, -1}, {8542, 1, -1}, {8543, 1, -1}, {8544, 1, -1}, {8545, 1, -1},
+    {8546, 1, -1}, {8547, 1, -1}, {8548, 1, -1}, {8549, 2, -1}, {8551, 1, -1}, {8552, 1, -1}, {8553, 1, -1}, {8554, 1, -1},
+    {8555, 1, -1}, {8556, 1, -1}, {8557, 1, -1}, {8558, 1, -1}, {8559, 1, -1}, {8560, 1, -1}, {8561, 1, -1}, {8562, 1, -1},
+    {8563, 1, -1}, {8564, 0, 130}, {8564, 1, -1}, {8565, 1, -1}, {8566, 1, -1}, {8567, 1, -1}, {8568, 0, 144}, {8568, 1, -1},
+    {8569, 1, -1}, {8570, 1, -1}, {8571, 1, -1}, {8572, 1, -1}, {8573, 1, -1}, {8574, 1, -1}, {8575, 1, -1}, {8576, 1, -1},
+    {8577, 0, 186}, {8577, 1, -1}, {8578, 1, -1}, {8579, 1, -1}, {8580, 0, 219}, {8580, 1, -1}, {8581, 1, -1}, {8582, 1, -1},
+    {8583, 1, -1}, {8584, 1, -1}, {8585, 1, -1}, {8586, 1, -1}, {8587, 1, -1}, {8588, 1, -1}, {8589, 1, -1}, {8590, 1, -1},
+    {8591, 1, -1}, {8592, 1, -1}, {8593, 1, -1}, {8594, 1, -1}, {8595, 0, 246}, {8595, 1, -1}, {8596, 1, -1}, {8597, 1, -1},
+    {8598, 1, -1}, {8599, 1, -1}, {8600, 1, -1}, {8601, 0, 256}, {8601, 1, -1}, {8602, 1, -1}, {8603, 1, -1}, {8604, 1, -1},
+    {8605, 1, -1}, {8606, 1, -1}, {8607, 1, -1}, {8608, 1, -1}, {8609, 1, -1}, {8610, 1, -1}, {8611, 2, -1}, {8613, 1, -1},
+    {8614, 1, -1}, {8615, 1, -1}, {8616, 1, -1}, {8617, 1, -1}, {8618, 1, -1}, {8619, 0, 290}, {8619, 1, -1}, {8620, 0, 294},
+    {8620, 1, -1}, {8621, 1, -1}, {8622, 1, -1}, {8623, 1, -1}, {8624, 1, -1}, {8625, 1, -1}, {8626, 1, -1}, {8627, 1, -1},
+    {8628, 1, -1}, {8629, 1, -1}, {8630, 1, -1}, {8631, 1, -1}, {8632, 1, -1}, {8633, 1, -1}, {8634, 1, -1}, {8635, 1, -1},
+    {8636, 3, -1}, {8639, 1, -1}, {8640, 1, -1}, {8641, 2, -1}, {8643, 1, -1}, {8644, 4, -1}, {8648, 2, -1}, {8650, 1, -1},
+    {8651, 1, -1}, {8652, 1, -1}, {8653, 1, -1}, {8654, 1, -1}, {8655, 1, -1}, {8656, 1, -1}, {8657, 1, -1}, {8658, 1, -1},
+    {8659, 1, -1}, {8660, 1, -1}, {8661, 1, -1}, {8662, 0, 52}, {8662, 1, -1}, {8663, 1, -1}, {8664, 1, -1}, {8665, 1, -1},
+    {8666, 1, -1}, {8667, 0, 400}, {8667, 1, -1}, {8668, 1, -1}, {8669, 1, -1}, {8670, 1, -1}, {8671, 1, -1}, {8672, 1, -1},
+    {8673, 0, 408}, {8673, 1, -1}, {8674, 1, -1}, {8675, 1, -1}, {8676, 1, -1}, {8677, 1, -1}, {8678, 1, -1}, {8679, 2, -1},
+    {8681, 0, 93}, {8681, 1, -1}, {8682, 1, -1}, {8683, 1, -1}, {8684, 1, -1}, {8685, 1, -1}, {8686, 1, -1}, {8687, 1, -1},
+    {8688, 1, -1}, {8689, 1, -1}, {8690, 1, -1}, {8691, 1, -1}, {8692, 1, -1}, {8693, 1, -1}, {8694, 1, -1}, {8695, 1, -1},
+    {8696, 1, -1}, {8697, 1, -1}, {8698, 0, 473}, {8698, 0, 476}, {8698, 1, -1}, {8699, 0, 478}, {8699, 0, 495}, {8699, 1, -1},
+    {8700, 1, -1}, {8701, 0, 502}, {8701, 1, -1}, {8702, 1, -1}, {8703, 1, -1}, {8704, 0, 507}, {8704, 1, -1}, {8705, 1, -1},
+    {8706, 1, -1}, {8707, 1, -1}, {8708, 1, -1}, {8709, 1, -1}, {8710, 1, -1}, {8711, 1, -1}, {8712, 1, -1}, {8713, 1, -1},
+    {8714, 2, -1}, {8716, 1, -1}, {8717, 1, -1}, {8718, 1, -1}, {8719, 2, -1}, {8721, 0, 728}, {8721, 1, -1}, {8722, 1, -1},
+    {8723, 0, 738}, {8723, 1, -1}, {8724, 1, -1}, {8725, 0, 766}, {8725, 1, -1}, {8726, 1, -1}, {8727, 1, -1}, {8728, 1, -1},
+    {8729, 1, -1}, {8730, 1, -1}, {8731, 2, -1}, {8733, 0, 821}, {8733, 1, -1}, {8734, 1, -1}, {8735, 1, -1}, {8736, 1, -1},
+    {8737, 0, 888}, {8737, 1, -1}, {8738, 1, -1}, {8739, 1, -1}, {8740, 2, -1}, {8742, 1, -1}, {8743, 1, -1}, {8744, 1, -1},
+    {8745, 1, -1}, {8746, 1, -1}, {8747, 0, 1004}, {8747, 0, 998}, {8747, 0, 1049}, {8747, 1, -1}, {8748, 1, -1}, {8749, 0, 1056},
+    {8749, 1, -1}, {8750, 1, -1}, {8751, 1, -1}, {8752, 0, 110}, {8752, 0, 237}, {8752, 1, -1}, {8753, 0, 1107}, {8753, 1, -1},
+    {8754, 1, -1}, {8755, 0, 1138}, {8755, 1, -1}, {8756, 1, -1}, {8757, 1, -1}, {8758, 0, 1156}, {8758, 0, 1158}, {8758, 1, -1},
+    {8759, 1, -1}, {8760, 0, 1245}, {8760, 1, -1}, {8761, 1, -1}, {8762, 1, -1}, {8763, 0, 400}, {8763, 1, -1}, {8764, 1, -1},
+    {8765, 1, -1}, {8766, 1, -1}, {8767, 1, -1}, {8768, 1, -1}, {8769, 1, -1}, {8770, 1, -1}, {8771, 0, 1303}, {8771, 1, -1},
+    {8772, 1, -1}, {8773, 0, 445}, {8773, 0, 447}, {8773, 1, -1}, {8774, 1, -1}, {8775, 0, 1375}, {8775, 0, 1323}, {8775, 1, -1},
+    {8776, 1, -1}, {8777, 0, 1394}, {8777, 1, -1}, {8778, 1, -1}, {8779, 1, -1}, {8780, 1, -1}, {8781, 1, -1}, {8782, 1, -1},
+    {8783, 1, -1}, {8784, 1, -1}, {8785, 1, -1}, {8786, 0, 1451}, {8786, 0, 841}, {8786, 0, 829}, {8786, 1, -1}, {8787, 1, -1},
+    {8788, 2, -1}, {8790, 1, -1}, {8791, 1, -1}, {8792, 0, 46}, {8792, 0, 48}, {8792, 1, -1}, {8793, 1, -1}, {8794, 1, -1},
+    {8795, 1, -1}, {8796, 1, -1}, {8797, 1, -1}, {8798, 1, -1}, {8799, 1, -1}, {8800, 1, -1}, {8801, 1, -1}, {8802, 1, -1},
+    {8803, 1, -1}, {8804, 1, -1}, {8805, 1, -1}, {8806, 1, -1}, {8807, 1, -1}, {8808, 1, -1}, {8809, 1, -1}, {8810, 1, -1},
+    {8811, 1, -1}, {8812, 1, -1}, {8813, 1, -1}, {8814, 1, -1}, {8815, 1, -1}, {8816, 1, -1}, {8817, 1, -1}, {8818, 1, -1},
+    {8819, 1, -1}, {8820, 1, -1}, {8821, 1, -1}, {8822, 1, -1}, {8823, 1, -1}, {8824, 0, 131}, {8824, 1, -1}, {8825, 1, -1},
+    {8826, 1, -1}, {8827, 2, -1}, {8829, 1, -1}, {8830, 1, -1}, {8831, 0, 161}, {8831, 1, -1}, {8832, 1, -1}, {8833, 1, -1},
+    {8834, 1, -1}, {8835, 1, -1}, {8836, 1, -1}, {8837, 1, -1}, {8838, 1, -1}, {8839, 1, -1}, {8840, 1, -1}, {8841, 1, -1},
+    {8842, 0, 228}, {8842, 1, -1}, {8843, 1, -1}, {8844, 1, -1}, {8845, 1, -1}, {8846, 1, -1}, {8847, 1, -1}, {8848, 1, -1},
+    {8849, 3, -1}, {8852, 1, -1}, {8853, 1, -1}, {8854, 2, -1}, {8856, 1, -1}, {8857, 1, -1}, {8858, 1, -1}, {8859, 1, -1},
+    {8860, 0, 250}, {8860, 1, -1}, {8861, 1, -1}, {8862, 1, -1}, {8863, 1, -1}, {8864, 1, -1}, {8865, 1, -1}, {8866, 1, -1},
+    {8867, 1, -1}, {8868, 1, -1}, {8869, 0, 269}, {8869, 1, -1}, {8870, 1, -1}, {8871, 1, -1}, {8872, 1, -1}, {8873, 1, -1},
+    {8874, 1, -1}, {8875, 1, -1}, {8876, 1, -1}, {8877, 1, -1}, {8878, 1, -1}, {8879, 1, -1}, {8880, 1, -1}, {8881, 1, -1},
+    {8882, 1, -1}, {8883, 1, -1}, {8884, 1, -1}, {8885, 1, -1}, {8886, 1, -1}, {8887, 1, -1}, {8888, 1, -1}, {8889, 1, -1},
+    {8890, 0, 309}, {8890, 1, -1}, {8891, 1, -1}, {8892, 1, -1}, {8893, 1, -1}, {8894, 0, 314}, {8894, 1, -1}, {8895, 1, -1},
+    {8896, 1, -1}, {8897, 1, -1}, {8898, 1, -1}, {8899, 1, -1}, {8900, 1, -1}, {8901, 0, 327}, {8901, 1, -1}, {8902, 1, -1},
+    {8903, 1, -1}, {8904, 0, 331}, {8904, 1, -1}, {8905, 1, -1}, {8906, 1, -1}, {8907, 1, -1}, {8908, 1, -1}, {8909, 1, -1},
+    {8910, 1, -1}, {8911, 0, 362}, {8911, 1, -1}, {8912, 1, -1}, {8913, 1, -1}, {8914, 1, -1}, {8915, 1, -1}, {8916, 1, -1},
+    {8917, 1, -1}, {8918, 1, -1}, {8919, 1, -1}, {8920, 1, -1}, {8921, 1, -1}, {8922, 1, -1}, {8923, 1, -1}, {8924, 1, -1},
+    {8925, 1, -1}, {8926, 1, -1}, {8927, 1, -1}, {8928, 1, -1}, {8929, 1, -1}, {8930, 1, -1}, {8931, 1, -1}, {8932, 1, -1},
+    {8933, 0, 419}, {8933, 1, -1}, {8934, 1, -1}, {8935, 0, 423}, {8935, 0, 426}, {8935, 1, -1}, {8936, 1, -1}, {8937, 1, -1},
+    {8938, 1, -1}, {8939, 0, 439}, {8939, 1, -1}, {8940, 2, -1}, {8942, 1, -1}, {8943, 0, 448}, {8943, 0, 452}, {8943, 1, -1},
+    {8944, 1, -1}, {8945, 1, -1}, {8946, 1, -1}, {8947, 1, -1}, {8948, 1, -1}, {8949, 1, -1}, {8950, 1, -1}, {8951, 0, 504},
+    {8951, 1, -1}, {8952, 0, 96}, {8952, 1, -1}, {8953, 1, -1}, {8954, 0, 523}, {8954, 1, -1}, {8955, 1, -1}, {8956, 1, -1},
+    {8957, 1, -1}, {8958, 1, -1}, {8959, 0, 609}, {8959, 1, -1}, {8960, 1, -1}, {8961, 1, -1}, {8962, 0, 141}, {8962, 1, -1},
+    {8963, 1, -1}, {8964, 1, -1}, {8965, 0, 729}, {8965, 0, 730}, {8965, 0, 752}, {8965, 0, 753}, {8965, 1, -1}, {8966, 1, -1},
+    {8967, 0, 784}, {8967, 1, -1}, {8968, 1, -1}, {8969, 1, -1}, {8970, 1, -1}, {8971, 1, -1}, {8972, 0, 826}, {8972, 0, 132},
+    {8972, 1, -1}, {8973, 1, -1}, {8974, 1, -1}, {8975, 1, -1}, {8976, 1, -1}, {8977, 1, -1}, {8978, 1, -1}, {8979, 1, -1},
+    {8980, 1, -1}, {8981, 1, -1}, {8982, 1, -1}, {8983, 1, -1}, {8984, 1, -1}, {8985, 1, -1}, {8986, 1, -1}, {8987, 1, -1},
+    {8988, 1, -1}, {8989, 1, -1}, {8990, 1, -1}, {8991, 0, 1111}, {8991, 1, -1}, {8992, 0, 1151}, {8992, 1, -1}, {8993, 1, -1},
+    {8994, 1, -1}, {8995, 0, 374}, {8995, 0, 1246}, {8995, 0, 172}, {8995, 1, -1}, {8996, 2, -1}, {8998, 1, -1}, {8999, 1, -1},
+    {9000, 1, -1}, {9001, 1, -1}, {9002, 1, -1}, {9003, 1, -1}, {9004, 1, -1}, {9005, 1, -1}, {9006, 1, -1}, {9007, 0, 1229},
+    {9007, 0, 455}, {9007, 0, 1328}, {9007, 0, 478}, {9007, 1, -1}, {9008, 2, -1}, {9010, 1, -1}, {9011, 1, -1}, {9012, 1, -1},
+    {9013, 0, 504}, {9013, 1, -1}, {9014, 1, -1}, {9015, 2, -1}, {9017, 2, -1}, {9019, 1, -1}, {9020, 1, -1}, {9021, 1, -1},
+    {9022, 1, -1}, {9023, 1, -1}, {9024, 1, -1}, {9025, 1, -1}, {9026, 1, -1}, {9027, 1, -1}, {9028, 1, -1}, {9029, 2, -1},
+    {9031, 1, -1}, {9032, 1, -1}, {9033, 1, -1}, {9034, 1, -1}, {9035, 1, -1}, {9036, 1, -1}, {9037, 1, -1}, {9038, 1, -1},
+    {9039, 1, -1}, {9040, 1, -1}, {9041, 1, -1}, {9042, 1, -1}, {9043, 1, -1}, {9044, 1, -1}, {9045, 1, -1}, {9046, 0, 99},
+    {9046, 1, -1}, {9047, 1, -1}, {9048, 1, -1}, {9049, 1, -1}, {9050, 1, -1}, {9051, 1, -1}, {9052, 0, 110}, {9052, 1, -1},
+    {9053, 1, -1}, {9054, 0, 137}, {9054, 1, -1}, {9055, 1, -1}, {9056, 0, 157}, {9056, 1, -1}, {9057, 1, -1}, {9058, 1, -1},
+    {9059, 1, -1}, {9060, 0, 163}, {9060, 0, 171}, {9060, 1, -1}, {9061, 0, 30}, {9061, 0, 189}, {9061, 1, -1}, {9062, 1, -1},
+    {9063, 1, -1}, {9064, 0, 226}, {9064, 1, -1}, {9065, 1, -1}, {9066, 1, -1}, {9067, 1, -1}, {9068, 1, -1}, {9069, 1, -1},
+    {9070, 0, 237}, {9070, 1, -1}, {9071, 0, 239}, {9071, 1, -1}, {9072, 1, -1}, {9073, 1, -1}, {9074, 1, -1}, {9075, 0, 244},
+    {9075, 1, -1}, {9076, 1, -1}, {9077, 1, -1}, {9078, 1, -1}, {9079, 1, -1}, {9080, 1, -1}, {9081, 1, -1}, {9082, 1, -1},
+    {9083, 1, -1}, {9084, 1, -1}, {9085, 1, -1}, {9086, 1, -1}, {9087, 1, -1}, {9088, 1, -1}, {9089, 1, -1}, {9090, 1, -1},
+    {9091, 1, -1}, {9092, 1, -1}, {9093, 1, -1}, {9094, 1, -1}, {9095, 1, -1}, {9096, 0, 287}, {9096, 1, -1}, {9097, 1, -1},
+    {9098, 1, -1}, {9099, 1, -1}, {9100, 1, -1}, {9101, 1, -1}, {9102, 1, -1}, {9103, 1, -1}, {9104, 1, -1}, {9105, 0, 302},
+    {9105, 1, -1}, {9106, 0, 307}, {9106, 1, -1}, {9107, 1, -1}, {9108, 0, 311}, {9108, 1, -1}, {9109, 1, -1}, {9110, 1, -1},
+    {9111, 1, -1}, {9112, 1, -1}, {9113, 1, -1}, {9114, 1, -1}, {9115, 1, -1}, {9116, 1, -1}, {9117, 1, -1}, {9118, 1, -1},
+    {9119, 1, -1}, {9120, 1, -1}, {9121, 1, -1}, {9122, 1, -1}, {9123, 1, -1}, {9124, 1, -1}, {9125, 1, -1}, {9126, 1, -1},
+    {9127, 1, -1}, {9128, 1, -1}, {9129, 1, -1}, {9130, 1, -1}, {9131, 1, -1}, {9132, 0, 378}, {9132, 1, -1}, {9133, 1, -1},
+    {9134, 1, -1}, {9135, 1, -1}, {9136, 1, -1}, {9137, 1, -1}, {9138, 0, 403}, {9138, 1, -1}, {9139, 1, -1}, {9140, 1, -1},
+    {9141, 1, -1}, {9142, 1, -1}, {9143, 3, -1}, {9146, 1, -1}, {9147, 1, -1}, {9148, 2, -1}, {9150, 1, -1}, {9151, 0, 422},
+    {9151, 1, -1}, {9152, 1, -1}, {9153, 1, -1}, {9154, 0, 437}, {9154, 1, -1}, {9155, 0, 444}, {9155, 1, -1}, {9156, 1, -1},
+    {9157, 1, -1}, {9158, 1, -1}, {9159, 1, -1}, {9160, 1, -1}, {9161, 1, -1}, {9162, 0, 496}, {9162, 1, -1}, {9163, 1, -1},
+    {9164, 1, -1}, {9165, 1, -1}, {9166, 1, -1}, {9167, 0, 524}, {9167, 1, -1}, {9168, 1, -1}, {9169, 1, -1}, {9170, 1, -1},
+    {9171, 1, -1}, {9172, 1, -1}, {9173, 0, 633}, {9173, 4, -1}, {9177, 1, -1}, {9178, 1, -1}, {9179, 1, -1}, {9180, 1, -1},
+    {9181, 1, -1}, {9182, 1, -1}, {9183, 1, -1}, {9184, 1, -1}, {9185, 1, -1}, {9186, 0, 137}, {9186, 1, -1}, {9187, 1, -1},
+    {9188, 1, -1}, {9189, 1, -1}, {9190, 1, -1}, {9191, 1, -1}, {9192, 1, -1}, {9193, 1, -1}, {9194, 1, -1}, {9195, 1, -1},
+    {9196, 1, -1}, {9197, 1, -1}, {9198, 1, -1}, {9199, 1, -1}, {9200, 1, -1}, {9201, 1, -1}, {9202, 1, -1}, {9203, 1, -1},
+    {9204, 1, -1}, {9205, 1, -1}, {9206, 2, -1}, {9208, 1, -1}, {9209, 1, -1}, {9210, 1, -1}, {9211, 1, -1}, {9212, 1, -1},
+    {9213, 1, -1}, {9214, 1, -1}, {9215, 1, -1}, {9216, 1, -1}, {9217, 0, 846}, {9217, 1, -1}, {9218, 1, -1}, {9219, 1, -1},
+    {9220, 0, 805}, {9220, 0, 1081}, {9220, 1, -1}, {9221, 2, -1}, {9223, 1, -1}, {9224, 1, -1}, {9225, 1, -1}, {9226, 1, -1},
+    {9227, 0, 1464}, {9227, 1, -1}, {9228, 0, 1466}, {9228, 1, -1}, {9229, 1, -1}, {9230, 1, -1}, {9231, 0, 14}, {9231, 1, -1},
+    {9232, 1, -1}, {9233, 1, -1}, {9234, 1, -1}, {9235, 1, -1}, {9236, 1, -1}, {9237, 1, -1}, {9238, 1, -1}, {9239, 1, -1},
+    {9240, 1, -1}, {9241, 1, -1}, {9242, 0, 82}, {9242, 1, -1}, {9243, 1, -1}, {9244, 1, -1}, {9245, 1, -1}, {9246, 0, 70},
+    {9246, 2, -1}, {9248, 1, -1}, {9249, 1, -1}, {9250, 1, -1}, {9251, 0, 95}, {9251, 1, -1}, {9252, 1, -1}, {9253, 1, -1},
+    {9254, 1, -1}, {9255, 1, -1}, {9256, 2, -1}, {9258, 1, -1}, {9259, 1, -1}, {9260, 1, -1}, {9261, 1, -1}, {9262, 1, -1},
+    {9263, 1, -1}, {9264, 1, -1}, {9265, 1, -1}, {9266, 1, -1}, {9267, 1, -1}, {9268, 1, -1}, {9269, 1, -1}, {9270, 1, -1},
+    {9271, 1, -1}, {9272, 1, -1}, {9273, 1, -1}, {9274, 1, -1}, {9275, 2, -1}, {9277, 1, -1}, {9278, 1, -1}, {9279, 0, 238},
+    {9279, 1, -1}, {9280, 1, -1}, {9281, 1, -1}, {9282, 1, -1}, {9283, 1, -1}, {9284, 0, 247}, {9284, 1, -1}, {9285, 1, -1},
+    {9286, 0, 249}, {9286, 1, -1}, {9287, 0, 258}, {9287, 1, -1}, {9288, 1, -1}, {9289, 0, 90}, {9289, 1, -1}, {9290, 1, -1},
+    {9291, 1, -1}, {9292, 1, -1}, {9293, 1, -1}, {9294, 1, -1}, {9295, 1, -1}, {9296, 1, -1}, {9297, 1, -1}, {9298, 1, -1},
+    {9299, 1, -1}, {9300, 1, -1}, {9301, 0, 292}, {9301, 1, -1}, {9302, 1, -1}, {9303, 1, -1}, {9304, 1, -1}, {9305, 1, -1},
+    {9306, 1, -1}, {9307, 1, -1}, {9308, 1, -1}, {9309, 1, -1}, {9310, 1, -1}, {9311, 1, -1}, {9312, 1, -1}, {9313, 1, -1},
+    {9314, 1, -1}, {9315, 1, -1}, {9316, 1, -1}, {9317, 1, -1}, {9318, 1, -1}, {9319, 1, -1}, {9320, 1, -1}, {9321, 1, -1},
+    {9322, 1, -1}, {9323, 1, -1}, {9324, 0, 334}, {9324, 1, -1}, {9325, 0, 336}, {9325, 1, -1}, {9326, 1, -1}, {9327, 1, -1},
+    {9328, 1, -1}, {9329, 0, 170}, {9329, 0, 373}, {9329, 1, -1}, {9330, 0, 375}, {9330, 1, -1}, {9331, 1, -1}, {9332, 1, -1},
+    {9333, 1, -1}, {9334, 0, 401}, {9334, 1, -1}, {9335, 1, -1}, {9336, 1, -1}, {9337, 1, -1}, {9338, 0, 410}, {9338, 1, -1},
+    {9339, 0, 412}, {9339, 1, -1}, {9340, 1, -1}, {9341, 1, -1}, {9342, 1, -1}, {9343, 0, 417}, {9343, 1, -1}, {9344, 1, -1},
+    {9345, 1, -1}, {9346, 1, -1}, {9347, 1, -1}, {9348, 1, -1}, {9349, 1, -1}, {9350, 2, -1}, {9352, 0, 454}, {9352, 1, -1},
+    {9353, 0, 456}, {9353, 0, 460}, {9353, 1, -1}, {9354, 1, -1}, {9355, 1, -1}, {9356, 0, 505}, {9356, 1, -1}, {9357, 1, -1},
+    {9358, 1, -1}, {9359, 0, 526}, {9359, 0, 527}, {9359, 1, -1}, {9360, 1, -1}, {9361, 0, 630}, {9361, 0, 634}, {9361, 1, -1},
+    {9362, 1, -1}, {9363, 1, -1}, {9364, 1, -1}, {9365, 1, -1}, {9366, 1, -1}, {9367, 1, -1}, {9368, 0, 788}, {9368, 1, -1},
+    {9369, 1, -1}, {9370, 1, -1}, {9371, 1, -1}, {9372, 0, 817}, {9372, 0, 936}, {9372, 1, -1}, {9373, 0, 1011}, {9373, 1, -1},
+    {9374, 0, 246}, {9374, 1, -1}, {9375, 2, -1}, {9377, 1, -1}, {9378, 1, -1}, {9379, 1, -1}, {9380, 0, 258}, {9380, 1, -1},
+    {9381, 1, -1}, {9382, 0, 1008}, {9382, 1, -1}, {9383, 0, 581}, {9383, 1, -1}, {9384, 1, -1}, {9385, 1, -1}, {9386, 0, 303},
+    {9386, 1, -1}, {9387, 2, -1}, {9389, 1, -1}, {9390, 1, -1}, {9391, 1, -1}, {9392, 1, -1}, {9393, 1, -1}, {9394, 1, -1},
+    {9395, 1, -1}, {9396, 1, -1}, {9397, 0, 97}, {9397, 0, 20}, {9397, 1, -1}, {9398, 1, -1}, {9399, 0, 1317}, {9399, 1, -1},
+    {9400, 1, -1}, {9401, 1, -1}, {9402, 0, 244}, {9402, 1, -1}, {9403, 0, 1465}, {9403, 0, 1467}, {9403, 1, -1}, {9404, 1, -1},
+    {9405, 1, -1}, {9406, 1, -1}, {9407, 1, -1}, {9408, 1, -1}, {9409, 1, -1}, {9410, 1, -1}, {9411, 1, -1}, {9412, 0, 77},
+    {9412, 1, -1}, {9413, 1, -1}, {9414, 1, -1}, {9415, 1, -1}, {9416, 1, -1}, {9417, 1, -1}, {9418, 1, -1}, {9419, 1, -1},
+    {9420, 1, -1}, {9421, 1, -1}, {9422, 1, -1}, {9423, 0, 94}, {9423, 1, -1}, {9424, 1, -1}, {9425, 1, -1}, {9426, 1, -1},
+    {9427, 1, -1}, {9428, 0, 104}, {9428, 1, -1}, {9429, 1, -1}, {9430, 2, -1}, {9432, 1, -1}, {9433, 1, -1}, {9434, 1, -1},
+    {9435, 1, -1}, {9436, 1, -1}, {9437, 1, -1}, {9438, 0, 160}, {9438, 1, -1}, {9439, 0, 173}, {9439, 0, 190}, {9439, 0, 191},
+    {9439, 1, -1}, {9440, 1, -1}, {9441, 1, -1}, {9442, 1, -1}, {9443, 0, 231}, {9443, 1, -1}, {9444, 0, 234}, {9444, 1, -1},
+    {9445, 1, -1}, {9446, 1, -1}, {9447, 1, -1}, {9448, 1, -1}, {9449, 1, -1}, {9450, 0, 89}, {9450, 1, -1}, {9451, 0, 252},
+    {9451, 1, -1}, {9452, 0, 260}, {9452, 1, -1}, {9453, 0, 92}, {9453, 0, 262}, {9453, 1, -1}, {9454, 1, -1}, {9455, 1, -1},
+    {9456, 1, -1}, {9457, 1, -1}, {9458, 1, -1}, {9459, 0, 266}, {9459, 1, -1}, {9460, 1, -1}, {9461, 1, -1}, {9462, 1, -1},
+    {9463, 1, -1}, {9464, 0, 298}, {9464, 1, -1}, {9465, 1, -1}, {9466, 1, -1}, {9467, 3, -1}, {9470, 0, 308}, {9470, 1, -1},
+    {9471, 1, -1}, {9472, 1, -1}, {9473, 1, -1}, {9474, 1, -1}, {9475, 1, -1}, {9476, 1, -1}, {9477, 2, -1}, {9479, 1, -1},
+    {9480, 0, 326}, {9480, 1, -1}, {9481, 1, -1}, {9482, 1, -1}, {9483, 1, -1}, {9484, 1, -1}, {9485, 0, 337}, {9485, 1, -1},
+    {9486, 0, 353}, {9486, 1, -1}, {9487, 1, -1}, {9488, 0, 395}, {9488, 1, -1}, {9489, 1, -1}, {9490, 1, -1}, {9491, 1, -1},
+    {9492, 1, -1}, {9493, 1, -1}, {9494, 2, -1}, {9496, 0, 411}, {9496, 1, -1}, {9497, 1, -1}, {9498, 1, -1}, {9499, 1, -1},
+    {9500, 1, -1}, {9501, 0, 420}, {9501, 0, 98}, {9501, 0, 225}, {9501, 1, -1}, {9502, 1, -1}, {9503, 1, -1}, {9504, 0, 446},
+    {9504, 1, -1}, {9505, 1, -1}, {9506, 0, 477}, {9506, 1, -1}, {9507, 1, -1}, {9508, 0, 508}, {9508, 1, -1}, {9509, 1, -1},
+    {9510, 0, 280}, {9510, 1, -1}, {9511, 1, -1}, {9512, 1, -1}, {9513, 1, -1}, {9514, 1, -1}, {9515, 1, -1}, {9516, 0, 754},
+    {9516, 1, -1}, {9517, 0, 22}, {9517, 0, 777}, {9517, 1, -1}, {9518, 1, -1}, {9519, 0, 937}, {9519, 1, -1}, {9520, 0, 1031},
+    {9520, 0, 234}, {9520, 1, -1}, {9521, 1, -1}, {9522, 1, -1}, {9523, 0, 1032}, {9523, 1, -1}, {9524, 0, 260}, {9524, 0, 1057},
+    {9524, 1, -1}, {9525, 1, -1}, {9526, 0, 289}, {9526, 1, -1}, {9527, 0, 318}, {9527, 1, -1}, {9528, 0, 1277}, {9528, 1, -1},
+    {9529, 0, 419}, {9529, 1, -1}, {9530, 1, -1}, {9531, 1, -1}, {9532, 1, -1}, {9533, 1, -1}, {9534, 1, -1}, {9535, 0, 241},
+    {9535, 1, -1}, {9536, 1, -1}, {9537, 1, -1}, {9538, 0, 417}, {9538, 1, -1}, {9539, 1, -1}, {9540, 1, -1}, {9541, 1, -1},
+    {9542, 1, -1}, {9543, 0, 51}, {9543, 0, 56}, {9543, 1, -1}, {9544, 1, -1}, {9545, 1, -1}, {9546, 1, -1}, {9547, 1, -1},
+    {9548, 1, -1}, {9549, 0, 87}, {9549, 0, 88}, {9549, 1, -1}, {9550, 1, -1}, {9551, 1, -1}, {9552, 1, -1}, {9553, 1, -1},
+    {9554, 1, -1}, {9555, 1, -1}, {9556, 1, -1}, {9557, 1, -1}, {9558, 1, -1}, {9559, 1, -1}, {9560, 1, -1}, {9561, 0, 107},
+    {9561, 1, -1}, {9562, 1, -1}, {9563, 1, -1}, {9564, 1, -1}, {9565, 1, -1}, {9566, 1, -1}, {9567, 1, -1}, {9568, 1, -1},
+    {9569, 1, -1}, {9570, 1, -1}, {9571, 1, -1}, {9572, 1, -1}, {9573, 1, -1}, {9574, 0, 235}, {9574, 0, 240}, {9574, 1, -1},
+    {9575, 1, -1}, {9576, 0, 243}, {9576, 0, 245}, {9576, 1, -1}, {9577, 1, -1}, {9578, 1, -1}, {9579, 0, 263}, {9579, 1, -1},
+    {9580, 1, -1}, {9581, 1, -1}, {9582, 1, -1}, {9583, 1, -1}, {9584, 1, -1}, {9585, 1, -1}, {9586, 0, 295}, {9586, 1, -1},
+    {9587, 1, -1}, {9588, 1, -1}, {9589, 0, 300}, {9589, 0, 301}, {9589, 0, 303}, {9589, 1, -1}, {9590, 1, -1}, {9591, 1, -1},
+    {9592, 1, -1}, {9593, 1, -1}, {9594, 1, -1}, {9595, 1, -1}, {9596, 1, -1}, {9597, 3, -1}, {9600, 0, 321}, {9600, 1, -1},
+    {9601, 1, -1}, {9602, 1, -1}, {9603, 1, -1}, {9604, 1, -1}, {9605, 1, -1}, {9606, 1, -1}, {9607, 1, -1}, {9608, 0, 363},
+    {9608, 1, -1}, {9609, 1, -1}, {9610, 1, -1}, {9611, 1, -1}, {9612, 1, -1}, {9613, 1, -1}, {9614, 1, -1}, {9615, 0, 406},
+    {9615, 1, -1}, {9616, 1, -1}, {9617, 1, -1}, {9618, 1, -1}, {9619, 1, -1}, {9620, 1, -1}, {9621, 0, 400}, {9621, 1, -1},
+    {9622, 1, -1}, {9623, 1, -1}, {9624, 1, -1}, {9625, 1, -1}, {9626, 1, -1}, {9627, 0, 509}, {9627, 1, -1}, {9628, 0, 629},
+    {9628, 1, -1}, {9629, 1, -1}, {9630, 1, -1}, {9631, 0, 725}, {9631, 1, -1}, {9632, 0, 763}, {9632, 0, 231}, {9632, 1, -1},
+    {9633, 0, 104}, {9633, 0, 227}, {9633, 1, -1}, {9634, 1, -1}, {9635, 1, -1}, {9636, 0, 1108}, {9636, 0, 1132}, {9636, 0, 305},
+    {9636, 1, -1}, {9637, 1, -1}, {9638, 0, 402}, {9638, 1, -1}, {9639, 1, -1}, {9640, 0, 1278}, {9640, 0, 1300}, {9640, 0, 841},
+    {9640, 0, 414}, {9640, 1, -1}, {9641, 1, -1}, {9642, 0, 239}, {9642, 1, -1}, {9643, 1, -1}, {9644, 1, -1}, {9645, 1, -1},
+    {9646, 1, -1}, {9647, 0, 76}, {9647, 1, -1}, {9648, 0, 79}, {9648, 0, 80}, {9648, 1, -1}, {9649, 1, -1}, {9650, 1, -1},
+    {9651, 1, -1}, {9652, 1, -1}, {9653, 0, 93}, {9653, 1, -1}, {9654, 1, -1}, {9655, 0, 100}, {9655, 1, -1}, {9656, 1, -1},
+    {9657, 1, -1}, {9658, 1, -1}, {9659, 1, -1}, {9660, 0, 124}, {9660, 1, -1}, {9661, 1, -1}, {9662, 1, -1}, {9663, 0, 158},
+    {9663, 0, 159}, {9663, 1, -1}, {9664, 0, 224}, {9664, 1, -1}, {9665, 1, -1}, {9666, 1, -1}, {9667, 1, -1}, {9668, 1, -1},
+    {9669, 0, 242}, {9669, 0, 248}, {9669, 1, -1}, {9670, 1, -1}, {9671, 1, -1}, {9672, 1, -1}, {9673, 1, -1}, {9674, 1, -1},
+    {9675, 1, -1}, {9676, 0, 284}, {9676, 1, -1}, {9677, 1, -1}, {9678, 1, -1}, {9679, 1, -1}, {9680, 1, -1}, {9681, 1, -1},
+    {9682, 1, -1}, {9683, 1, -1}, {9684, 1, -1}, {9685, 0, 315}, {9685, 1, -1}, {9686, 1, -1}, {9687, 0, 318}, {9687, 1, -1},
+    {9688, 1, -1}, {9689, 1, -1}, {9690, 2, -1}, {9692, 0, 328}, {9692, 1, -1}, {9693, 0, 330}, {9693, 0, 332}, {9693, 1, -1},
+    {9694, 1, -1}, {9695, 1, -1}, {9696, 1, -1}, {9697, 1, -1}, {9698, 1, -1}, {9699, 1, -1}, {9700, 1, -1}, {9701, 1, -1},
+    {9702, 1, -1}, {9703, 0, 413}, {9703, 1, -1}, {9704, 1, -1}, {9705, 0, 416}, {9705, 0, 418}, {9705, 1, -1}, {9706, 1, -1},
+    {9707, 1, -1}, {9708, 1, -1}, {9709, 0, 497}, {9709, 0, 503}, {9709, 1, -1}, {9710, 1, -1}, {9711, 1, -1}, {9712, 1, -1},
+    {9713, 0, 726}, {9713, 0, 406}, {9713, 1, -1}, {9714, 1, -1}, {9715, 1, -1}, {9716, 0, 320}, {9716, 0, 107}, {9716, 1, -1},
+    {9717, 0, 1299}, {9717, 0, 220}, {9717, 1, -1}, {9718, 0, 412}, {9718, 1, -1}, {9719, 1, -1}, {9720, 1, -1}, {9721, 1, -1},
+    {9722, 1, -1}, {9723, 1, -1}, {9724, 1, -1}, {9725, 1, -1}, {9726, 1, -1}, {9727, 1, -1}, {9728, 0, 96}, {9728, 0, 97},
+    {9728, 1, -1}, {9729, 0, 103}, {9729, 0, 105}, {9729, 1, -1}, {9730, 1, -1}, {9731, 1, -1}, {9732, 0, 140}, {9732, 1, -1},
+    {9733, 0, 162}, {9733, 1, -1}, {9734, 0, 229}, {9734, 0, 230}, {9734, 0, 232}, {9734, 0, 241}, {9734, 1, -1}, {9735, 1, -1},
+    {9736, 1, -1}, {9737, 1, -1}, {9738, 0, 280}, {9738, 1, -1}, {9739, 1, -1}, {9740, 1, -1}, {9741, 1, -1}, {9742, 0, 297},
+    {9742, 1, -1}, {9743, 1, -1}, {9744, 1, -1}, {9745, 0, 310}, {9745, 1, -1}, {9746, 0, 313}, {9746, 1, -1}, {9747, 0, 317},
+    {9747, 1, -1}, {9748, 1, -1}, {9749, 1, -1}, {9750, 0, 323}, {9750, 1, -1}, {9751, 1, -1}, {9752, 0, 335}, {9752, 1, -1},
+    {9753, 1, -1}, {9754, 1, -1}, {9755, 1, -1}, {9756, 0, 399}, {9756, 1, -1}, {9757, 1, -1}, {9758, 1, -1}, {9759, 1, -1},
+    {9760, 1, -1}, {9761, 0, 415}, {9761, 1, -1}, {9762, 0, 445}, {9762, 1, -1}, {9763, 1, -1}, {9764, 0, 525}, {9764, 0, 635},
+    {9764, 0, 636}, {9764, 1, -1}, {9765, 0, 396}, {9765, 1, -1}, {9766, 1, -1}, {9767, 0, 131}, {9767, 0, 389}, {9767, 1, -1},
+    {9768, 1, -1}, {9769, 1, -1}, {9770, 1, -1}, {9771, 1, -1}, {9772, 1, -1}, {9773, 1, -1}, {9774, 1, -1}, {9775, 1, -1},
+    {9776, 1, -1}, {9777, 1, -1}, {9778, 0, 106}, {9778, 0, 108}, {9778, 1, -1}, {9779, 1, -1}, {9780, 1, -1}, {9781, 0, 259},
+    {9781, 0, 91}, {9781, 1, -1}, {9782, 0, 280}, {9782, 1, -1}, {9783, 1, -1}, {9784, 1, -1}, {9785, 1, -1}, {9786, 1, -1},
+    {9787, 0, 304}, {9787, 1, -1}, {9788, 1, -1}, {9789, 1, -1}, {9790, 1, -1}, {9791, 1, -1}, {9792, 1, -1}, {9793, 1, -1},
+    {9794, 1, -1}, {9795, 1, -1}, {9796, 0, 374}, {9796, 0, 396}, {9796, 1, -1}, {9797, 1, -1}, {9798, 0, 404}, {9798, 0, 405},
+    {9798, 0, 407}, {9798, 0, 414}, {9798, 0, 443}, {9798, 1, -1}, {9799, 0, 455}, {9799, 0, 637}, {9799, 1, -1}, {9800, 0, 259},
+    {9800, 1, -1}, {9801, 1, -1}, {9802, 1, -1}, {9803, 1, -1}, {9804, 1, -1}, {9805, 1, -1}, {9806, 1, -1}, {9807, 0, 90},
+    {9807, 1, -1}, {9808, 1, -1}, {9809, 0, 102}, {9809, 1, -1}, {9810, 1, -1}, {9811, 0, 227}, {9811, 0, 280}, {9811, 1, -1},
+    {9812, 1, -1}, {9813, 1, -1}, {9814, 0, 296}, {9814, 1, -1}, {9815, 1, -1}, {9816, 1, -1}, {9817, 1, -1}, {9818, 0, 319},
+    {9818, 1, -1}, {9819, 1, -1}, {9820, 1, -1}, {9821, 1, -1}, {9822, 1, -1}, {9823, 1, -1}, {9824, 0, 402}, {9824, 0, 447},
+    {9824, 0, 925}, {9824, 0, 35}, {9824, 1, -1}, {9825, 1, -1}, {9826, 1, -1}, {9827, 1, -1}, {9828, 1, -1}, {9829, 0, 89},
+    {9829, 1, -1}, {9830, 0, 92}, {9830, 0, 125}, {9830, 1, -1}, {9831, 1, -1}, {9832, 0, 165}, {9832, 0, 289}, {9832, 0, 299},
+    {9832, 0, 305}, {9832, 1, -1}, {9833, 1, -1}, {9834, 1, -1}, {9835, 0, 322}, {9835, 1, -1}, {9836, 1, -1}, {9837, 0, 352},
+    {9837, 0, 397}, {9837, 1, -1}, {9838, 0, 50}, {9838, 1, -1}, {9839, 1, -1}, {9840, 0, 55}, {9840, 1, -1}, {9841, 0, 141},
+    {9841, 0, 280}, {9841, 1, -1}, {9842, 0, 316}, {9842, 0, 320}, {9842, 1, -1}, {9843, 0, 329}, {9843, 1, -1}, {9844, 1, -1},
+    {9845, 0, 78}, {9845, 1, -1}, {9846, 1, -1}, {9847, 0, 324}, {9847, 1, -1}, {9848, 1, -1}, {9849, 1, -1}, {9850, 0, 312},
+    {9850, 0, 49}, {9850, 1, -1}, {9851, 0, 91}, {9851, 1, -1}, {9852, 1, -1}, {9853, 1, -1}, {9854, 1, -1}, {9855, 1, -1},
+    {9856, 1, -1}, {9857, 0, 59},
+};
+
+inline constexpr Edge EDGES[9857] = {
+    {'A', 1}, {'B', 2}, {'C', 3}, {'D', 4}, {'E', 5}, {'F', 6}, {'G', 7}, {'H', 8},
+    {'I', 9}, {'J', 10}, {'K', 11}, {'L', 12}, {'M', 13}, {'N', 14}, {'O', 15}, {'P', 16},
+    {'Q', 17}, {'R', 18}, {'S', 19}, {'T', 20}, {'U', 21}, {'V', 22}, {'W', 23}, {'X', 24},
+    {'Y', 25}, {'Z', 26}, {'a', 27}, {'b', 28}, {'c', 29}, {'d', 30}, {'e', 31}, {'f', 32},
+    {'g', 33}, {'h', 34}, {'i', 35}, {'j', 36}, {'k', 37}, {'l', 38}, {'m', 39}, {'n', 40},
+    {'o', 41}, {'p', 42}, {'q', 43}, {'r', 44}, {'s', 45}, {'t', 46}, {'u', 47}, {'v', 48},
+    {'w', 49}, {'x', 50}, {'y', 51}, {'z', 52}, {'E', 53}, {'M', 54}, {'P', 55}, {'a', 56},
+    {'b', 57}, {'c', 58}, {'f', 59}, {'g', 60}, {'l', 61}, {'m', 62}, {'n', 63}, {'o', 64},
+    {'p', 65}, {'r', 66}, {'s', 67}, {'t', 68}, {'u', 69}, {'a', 70}, {'c', 71}, {'e', 72},
+    {'f', 73}, {'o', 74}, {'r', 75}, {'s', 76}, {'u', 77}, {'H', 78}, {'O', 79}, {'a', 80},
+    {'c', 81}, {'d', 82}, {'e', 83}, {'f', 84}, {'h', 85}, {'i', 86}, {'l', 87}, {'o', 88},
+    {'r', 89}, {'s', 90}, {'u', 91}, {'D', 92}, {'J', 93}, {'S', 94}, {'Z', 95}, {'a', 96},
+    {'c', 97}, {'e', 98}, {'f', 99}, {'i', 100}, {'o', 101}, {'s', 102}, {'N', 103}, {'T', 104},
+    {'a', 105}, {'c', 106}, {'d', 107}, {'f', 108}, {'g', 109}, {'l', 110}, {'m', 111}, {'o', 112},
+    {'p', 113}, {'q', 114}, {'s', 115}, {'t', 116}, {'u', 117}, {'x', 118}, {'c', 119}, {'f', 120},
+    {'i', 121}, {'o', 122}, {'s', 123}, {'J', 124}, {'T', 125}, {'a', 126}, {'b', 127}, {'c', 128},
+    {'d', 129}, {'f', 130}, {'g', 131}, {'o', 132}, {'r', 133}, {'s', 134}, {'t', 135}, {'A', 136},
+    {'a', 137}, {'c', 138}, {'f', 139}, {'i', 140}, {'o', 141}, {'s', 142}, {'u', 143}, {'E', 144},
+    {'J', 145}, {'O', 146}, {'a', 147}, {'c', 148}, {'d', 149}, {'f', 150}, {'g', 151}, {'m', 152},
+    {'n', 153}, {'o', 154}, {'s', 155}, {'t', 156}, {'u', 157}, {'c', 158}, {'f', 159}, {'o', 160},
+    {'s', 161}, {'u', 162}, {'H', 163}, {'J', 164}, {'a', 165}, {'c', 166}, {'f', 167}, {'o', 168},
+    {'s', 169}, {'J', 170}, {'T', 171}, {'a', 172}, {'c', 173}, {'e', 174}, {'f', 175}, {'l', 176},
+    {'m', 177}, {'o', 178}, {'s', 179}, {'t', 180}, {'a', 181}, {'c', 182}, {'e', 183}, {'f', 184},
+    {'i', 185}, {'o', 186}, {'s', 187}, {'u', 188}, {'J', 189}, {'a', 190}, {'c', 191}, {'e', 192},
+    {'f', 193}, {'o', 194}, {'s', 195}, {'t', 196}, {'u', 197}, {'E', 198}, {'a', 199}, {'c', 200},
+    {'d', 201}, {'f', 202}, {'g', 203}, {'m', 204}, {'o', 205}, {'p', 206}, {'r', 207}, {'s', 208},
+    {'t', 209}, {'u', 210}, {'v', 211}, {'a', 212}, {'c', 213}, {'f', 214}, {'h', 215}, {'i', 216},
+    {'l', 217}, {'o', 218}, {'r', 219}, {'s', 220}, {'U', 221}, {'f', 222}, {'o', 223}, {'s', 224},
+    {'B', 225}, {'E', 226}, {'a', 227}, {'c', 228}, {'e', 229}, {'f', 230}, {'h', 231}, {'i', 232},
+    {'o', 233}, {'r', 234}, {'s', 235}, {'u', 236}, {'H', 237}, {'O', 238}, {'a', 239}, {'c', 240},
+    {'f', 241}, {'h', 242}, {'i', 243}, {'m', 244}, {'o', 245}, {'q', 246}, {'s', 247}, {'t', 248},
+    {'u', 249}, {'H', 250}, {'R', 251}, {'S', 252}, {'a', 253}, {'c', 254}, {'f', 255}, {'h', 256},
+    {'i', 257}, {'o', 258}, {'r', 259}, {'s', 260}, {'a', 261}, {'b', 262}, {'c', 263}, {'d', 264},
+    {'f', 265}, {'g', 266}, {'m', 267}, {'n', 268}, {'o', 269}, {'p', 270}, {'r', 271}, {'s', 272},
+    {'t', 273}, {'u', 274}, {'D', 275}, {'b', 276}, {'c', 277}, {'d', 278}, {'e', 279}, {'f', 280},
+    {'o', 281}, {'s', 282}, {'v', 283}, {'c', 284}, {'e', 285}, {'f', 286}, {'o', 287}, {'s', 288},
+    {'f', 289}, {'i', 290}, {'o', 291}, {'s', 292}, {'A', 293}, {'I', 294}, {'U', 295}, {'a', 296},
+    {'c', 297}, {'f', 298}, {'o', 299}, {'s', 300}, {'u', 301}, {'H', 302}, {'a', 303}, {'c', 304},
+    {'d', 305}, {'e', 306}, {'f', 307}, {'o', 308}, {'s', 309}, {'a', 310}, {'b', 311}, {'c', 312},
+    {'e', 313}, {'f', 314}, {'g', 315}, {'l', 316}, {'m', 317}, {'n', 318}, {'o', 319}, {'p', 320},
+    {'r', 321}, {'s', 322}, {'t', 323}, {'u', 324}, {'w', 325}, {'N', 326}, {'a', 327}, {'b', 328},
+    {'c', 329}, {'d', 330}, {'e', 331}, {'f', 332}, {'i', 333}, {'k', 334}, {'l', 335}, {'n', 336},
+    {'o', 337}, {'p', 338}, {'r', 339}, {'s', 340}, {'u', 341}, {'a', 342}, {'c', 343}, {'d', 344},
+    {'e', 345}, {'f', 346}, {'h', 347}, {'i', 348}, {'l', 349}, {'o', 350}, {'r', 351}, {'s', 352},
+    {'t', 353}, {'u', 354}, {'w', 355}, {'y', 356}, {'A', 357}, {'H', 358}, {'a', 359}, {'b', 360},
+    {'c', 361}, {'d', 362}, {'e', 363}, {'f', 364}, {'h', 365}, {'i', 366}, {'j', 367}, {'l', 368},
+    {'o', 369}, {'r', 370}, {'s', 371}, {'t', 372}, {'u', 373}, {'w', 374}, {'z', 375}, {'D', 376},
+    {'a', 377}, {'c', 378}, {'d', 379}, {'e', 380}, {'f', 381}, {'g', 382}, {'l', 383}, {'m', 384},
+    {'n', 385}, {'o', 386}, {'p', 387}, {'q', 388}, {'r', 389}, {'s', 390}, {'t', 391}, {'u', 392},
+    {'x', 393}, {'a', 394}, {'c', 395}, {'e', 396}, {'f', 397}, {'i', 398}, {'j', 399}, {'l', 400},
+    {'n', 401}, {'o', 402}, {'p', 403}, {'r', 404}, {'s', 405}, {'E', 406}, {'a', 407}, {'b', 408},
+    {'c', 409}, {'d', 410}, {'e', 411}, {'f', 412}, {'g', 413}, {'i', 414}, {'j', 415}, {'l', 416},
+    {'n', 417}, {'o', 418}, {'r', 419}, {'s', 420}, {'t', 421}, {'v', 422}, {'A', 423}, {'a', 424},
+    {'b', 425}, {'c', 426}, {'e', 427}, {'f', 428}, {'k', 429}, {'o', 430}, {'s', 431}, {'y', 432},
+    {'a', 433}, {'c', 434}, {'e', 435}, {'f', 436}, {'g', 437}, {'i', 438}, {'j', 439}, {'m', 440},
+    {'n', 441}, {'o', 442}, {'p', 443}, {'q', 444}, {'s', 445}, {'t', 446}, {'u', 447}, {'c', 448},
+    {'f', 449}, {'m', 450}, {'o', 451}, {'s', 452}, {'u', 453}, {'a', 454}, {'c', 455}, {'f', 456},
+    {'g', 457}, {'h', 458}, {'j', 459}, {'o', 460}, {'s', 461}, {'A', 462}, {'B', 463}, {'E', 464},
+    {'H', 465}, {'a', 466}, {'b', 467}, {'c', 468}, {'d', 469}, {'e', 470}, {'f', 471}, {'g', 472},
+    {'h', 473}, {'j', 474}, {'l', 475}, {'m', 476}, {'n', 477}, {'o', 478}, {'p', 479}, {'r', 480},
+    {'s', 481}, {'t', 482}, {'u', 483}, {'v', 484}, {'D', 485}, {'a', 486}, {'c', 487}, {'d', 488},
+    {'e', 489}, {'f', 490}, {'h', 491}, {'i', 492}, {'l', 493}, {'n', 494}, {'o', 495}, {'p', 496},
+    {'s', 497}, {'u', 498}, {'G', 499}, {'L', 500}, {'R', 501}, {'V', 502}, {'a', 503}, {'b', 504},
+    {'c', 505}, {'d', 506}, {'e', 507}, {'f', 508}, {'g', 509}, {'h', 510}, {'i', 511}, {'j', 512},
+    {'l', 513}, {'m', 514}, {'o', 515}, {'p', 516}, {'r', 517}, {'s', 518}, {'t', 519}, {'u', 520},
+    {'v', 521}, {'w', 522}, {'S', 523}, {'a', 524}, {'c', 525}, {'d', 526}, {'e', 527}, {'f', 528},
+    {'g', 529}, {'h', 530}, {'i', 531}, {'l', 532}, {'m', 533}, {'o', 534}, {'p', 535}, {'r', 536},
+    {'s', 537}, {'t', 538}, {'u', 539}, {'v', 540}, {'a', 541}, {'c', 542}, {'e', 543}, {'f', 544},
+    {'h', 545}, {'i', 546}, {'l', 547}, {'m', 548}, {'o', 549}, {'r', 550}, {'s', 551}, {'u', 552},
+    {'f', 553}, {'i', 554}, {'o', 555}, {'p', 556}, {'s', 557}, {'u', 558}, {'A', 559}, {'B', 560},
+    {'H', 561}, {'a', 562}, {'b', 563}, {'c', 564}, {'d', 565}, {'e', 566}, {'f', 567}, {'h', 568},
+    {'i', 569}, {'l', 570}, {'m', 571}, {'n', 572}, {'o', 573}, {'p', 574}, {'r', 575}, {'s', 576},
+    {'t', 577}, {'u', 578}, {'x', 579}, {'a', 580}, {'b', 581}, {'c', 582}, {'d', 583}, {'e', 584},
+    {'f', 585}, {'h', 586}, {'i', 587}, {'l', 588}, {'m', 589}, {'o', 590}, {'p', 591}, {'q', 592},
+    {'r', 593}, {'s', 594}, {'t', 595}, {'u', 596}, {'w', 597}, {'z', 598}, {'a', 599}, {'b', 600},
+    {'c', 601}, {'d', 602}, {'e', 603}, {'f', 604}, {'h', 605}, {'i', 606}, {'o', 607}, {'p', 608},
+    {'r', 609}, {'s', 610}, {'w', 611}, {'A', 612}, {'H', 613}, {'a', 614}, {'b', 615}, {'c', 616},
+    {'d', 617}, {'f', 618}, {'g', 619}, {'h', 620}, {'l', 621}, {'m', 622}, {'o', 623}, {'p', 624},
+    {'r', 625}, {'s', 626}, {'t', 627}, {'u', 628}, {'w', 629}, {'A', 630}, {'B', 631}, {'D', 632},
+    {'a', 633}, {'c', 634}, {'d', 635}, {'e', 636}, {'f', 637}, {'l', 638}, {'n', 639}, {'o', 640},
+    {'p', 641}, {'r', 642}, {'s', 643}, {'z', 644}, {'c', 645}, {'e', 646}, {'f', 647}, {'o', 648},
+    {'p', 649}, {'r', 650}, {'s', 651}, {'c', 652}, {'d', 653}, {'f', 654}, {'h', 655}, {'i', 656},
+    {'l', 657}, {'m', 658}, {'n', 659}, {'o', 660}, {'r', 661}, {'s', 662}, {'u', 663}, {'v', 664},
+    {'w', 665}, {'a', 666}, {'c', 667}, {'e', 668}, {'f', 669}, {'i', 670}, {'o', 671}, {'s', 672},
+    {'u', 673}, {'a', 674}, {'c', 675}, {'d', 676}, {'e', 677}, {'f', 678}, {'h', 679}, {'i', 680},
+    {'o', 681}, {'s', 682}, {'w', 683}, {'l', 684}, {'P', 685}, {'O', 686}, {'c', 687}, {'r', 688},
+    {'i', 689}, {'y', 690}, {'r', 691}, {'r', 692}, {'p', 693}, {'a', 694}, {'d', 695}, {'g', 696},
+    {'p', 697}, {'p', 698}, {'i', 699}, {'c', 700}, {'s', 701}, {'i', 702}, {'m', 703}, {'c', 704},
+    {'r', 705}, {'y', 706}, {'c', 707}, {'r', 708}, {'t', 709}, {'r', 710}, {'p', 711}, {'e', 712},
+    {'c', 713}, {'m', 714}, {'c', 715}, {'P', 716}, {'c', 717}, {'p', 718}, {'y', 719}, {'a', 720},
+    {'e', 721}, {'i', 722}, {'o', 723}, {'o', 724}, {'d', 725}, {'n', 726}, {'r', 727}, {'i', 728},
+    {'r', 729}, {'o', 730}, {'l', 731}, {'n', 732}, {'p', 733}, {'u', 734}, {'o', 735}, {'c', 736},
+    {'p', 737}, {';', 738}, {'o', 739}, {'c', 740}, {'c', 741}, {'c', 742}, {'g', 743}, {'r', 744},
+    {'s', 745}, {'a', 746}, {'y', 747}, {'l', 748}, {'r', 749}, {'a', 750}, {'f', 751}, {'p', 752},
+    {'t', 753}, {'u', 754}, {'w', 755}, {'c', 756}, {'t', 757}, {'G', 758}, {'H', 759}, {'c', 760},
+    {'a', 761}, {'i', 762}, {'y', 763}, {'o', 764}, {'r', 765}, {'r', 766}, {'e', 767}, {'a', 768},
+    {'p', 769}, {'g', 770}, {'p', 771}, {'s', 772}, {'u', 773}, {'c', 774}, {'i', 775}, {'a', 776},
+    {'m', 777}, {'i', 778}, {'p', 779}, {'y', 780}, {'r', 781}, {'l', 782}, {'p', 783}, {'r', 784},
+    {'u', 785}, {'c', 786}, {'c', 787}, {';', 788}, {'m', 789}, {'r', 790}, {'e', 791}, {'i', 792},
+    {'y', 793}, {'o', 794}, {'r', 795}, {';', 796}, {'p', 797}, {'e', 798}, {'c', 799}, {';', 800},
+    {'R', 801}, {'c', 802}, {'t', 803}, {'i', 804}, {'r', 805}, {'l', 806}, {'p', 807}, {'r', 808},
+    {'c', 809}, {'t', 810}, {'m', 811}, {'c', 812}, {'l', 813}, {'c', 814}, {'c', 815}, {'i', 816},
+    {'y', 817}, {'o', 818}, {'r', 819}, {'r', 820}, {';', 821}, {'a', 822}, {'p', 823}, {'t', 824},
+    {'v', 825}, {'g', 826}, {'p', 827}, {'t', 828}, {'c', 829}, {'i', 830}, {'k', 831}, {'m', 832},
+    {'i', 833}, {'y', 834}, {'r', 835}, {'p', 836}, {'c', 837}, {'e', 838}, {'k', 839}, {'c', 840},
+    {'c', 841}, {'p', 842}, {'e', 843}, {'y', 844}, {'r', 845}, {'p', 846}, {'c', 847}, {'c', 848},
+    {';', 849}, {'c', 850}, {'m', 851}, {'n', 852}, {'p', 853}, {'r', 854}, {'a', 855}, {'e', 856},
+    {'y', 857}, {'f', 858}, {'s', 859}, {'r', 860}, {';', 861}, {'e', 862}, {'i', 863}, {'n', 864},
+    {'p', 865}, {'w', 866}, {'c', 867}, {'h', 868}, {'t', 869}, {';', 870}, {'p', 871}, {'y', 872},
+    {'d', 873}, {'l', 874}, {'r', 875}, {'n', 876}, {'p', 877}, {'c', 878}, {';', 879}, {'c', 880},
+    {'c', 881}, {'a', 882}, {'e', 883}, {'y', 884}, {'g', 885}, {'s', 886}, {'w', 887}, {'r', 888},
+    {'B', 889}, {'n', 890}, {'p', 891}, {'t', 892}, {'c', 893}, {'i', 894}, {';', 895}, {'l', 896},
+    {'c', 897}, {'i', 898}, {'y', 899}, {'b', 900}, {'r', 901}, {'r', 902}, {'a', 903}, {'e', 904},
+    {'i', 905}, {'p', 906}, {'e', 907}, {';', 908}, {'c', 909}, {'l', 910}, {'i', 911}, {'m', 912},
+    {'e', 913}, {'r', 914}, {'y', 915}, {'r', 916}, {'i', 917}, {';', 918}, {'u', 919}, {'i', 920},
+    {'p', 921}, {';', 922}, {'e', 923}, {'i', 924}, {'o', 925}, {'c', 926}, {'i', 927}, {'O', 928},
+    {'r', 929}, {'p', 930}, {'c', 931}, {'a', 932}, {'G', 933}, {'c', 934}, {'n', 935}, {'r', 936},
+    {'a', 937}, {'e', 938}, {'y', 939}, {';', 940}, {'v', 941}, {'r', 942}, {'o', 943}, {'g', 944},
+    {'p', 945}, {'u', 946}, {'i', 947}, {'c', 948}, {'h', 949}, {'l', 950}, {'C', 951}, {'c', 952},
+    {'F', 953}, {'c', 954}, {';', 955}, {'a', 956}, {'e', 957}, {'i', 958}, {'y', 959}, {'r', 960},
+    {'o', 961}, {'g', 962}, {'a', 963}, {'p', 964}, {'r', 965}, {'u', 966}, {'c', 967}, {'a', 968},
+    {'b', 969}, {'c', 970}, {'m', 971}, {'p', 972}, {'O', 973}, {'A', 974}, {'H', 975}, {'c', 976},
+    {'b', 977}, {'u', 978}, {'a', 979}, {'e', 980}, {'y', 981}, {'r', 982}, {'e', 983}, {'i', 984},
+    {'l', 985}, {'p', 986}, {'i', 987}, {'c', 988}, {'t', 989}, {'c', 990}, {'r', 991}, {'r', 992},
+    {'i', 993}, {'y', 994}, {'b', 995}, {'r', 996}, {'r', 997}, {'a', 998}, {'d', 999}, {'i', 1000},
+    {'g', 1001}, {'p', 1002}, {'A', 1003}, {'D', 1004}, {'E', 1005}, {'T', 1006}, {'a', 1007}, {'d', 1008},
+    {'p', 1009}, {'s', 1010}, {'i', 1011}, {'c', 1012}, {'i', 1013}, {'m', 1014}, {'a', 1015}, {'a', 1016},
+    {'y', 1017}, {'a', 1018}, {'e', 1019}, {'r', 1020}, {'r', 1021}, {'p', 1022}, {'c', 1023}, {'d', 1024},
+    {'i', 1025}, {'d', 1026}, {'r', 1027}, {'p', 1028}, {'c', 1029}, {'r', 1030}, {';', 1031}, {'p', 1032},
+    {'c', 1033}, {'c', 1034}, {'c', 1035}, {'c', 1036}, {'c', 1037}, {'i', 1038}, {'y', 1039}, {'r', 1040},
+    {'p', 1041}, {'c', 1042}, {'m', 1043}, {'c', 1044}, {'c', 1045}, {'a', 1046}, {'y', 1047}, {'o', 1048},
+    {'r', 1049}, {'t', 1050}, {'r', 1051}, {'p', 1052}, {'c', 1053}, {'c', 1054}, {'r', 1055}, {';', 1056},
+    {'E', 1057}, {'d', 1058}, {'i', 1059}, {'u', 1060}, {'y', 1061}, {'l', 1062}, {';', 1063}, {'r', 1064},
+    {'r', 1065}, {'e', 1066}, {'p', 1067}, {'a', 1068}, {'p', 1069}, {'d', 1070}, {'g', 1071}, {'g', 1072},
+    {'p', 1073}, {';', 1074}, {'E', 1075}, {'a', 1076}, {'e', 1077}, {'i', 1078}, {'o', 1079}, {'p', 1080},
+    {'i', 1081}, {'c', 1082}, {'t', 1083}, {'y', 1084}, {'i', 1085}, {'m', 1086}, {'c', 1087}, {'i', 1088},
+    {'o', 1089}, {'c', 1090}, {'r', 1091}, {'r', 1092}, {'o', 1093}, {'y', 1094}, {'q', 1095}, {'c', 1096},
+    {'m', 1097}, {'p', 1098}, {'r', 1099}, {'t', 1100}, {'r', 1101}, {'g', 1102}, {'a', 1103}, {'a', 1104},
+    {'k', 1105}, {'o', 1106}, {'e', 1107}, {'o', 1108}, {'p', 1109}, {'t', 1110}, {'w', 1111}, {'x', 1112},
+    {'r', 1113}, {'e', 1114}, {'v', 1115}, {'c', 1116}, {'e', 1117}, {'i', 1118}, {'o', 1119}, {'l', 1120},
+    {'m', 1121}, {'c', 1122}, {'p', 1123}, {'r', 1124}, {'a', 1125}, {'e', 1126}, {'i', 1127}, {'u', 1128},
+    {'o', 1129}, {'d', 1130}, {'m', 1131}, {'n', 1132}, {'r', 1133}, {'c', 1134}, {'e', 1135}, {'i', 1136},
+    {'r', 1137}, {'u', 1138}, {'l', 1139}, {'m', 1140}, {'n', 1141}, {'p', 1142}, {'a', 1143}, {'o', 1144},
+    {'c', 1145}, {'u', 1146}, {'d', 1147}, {'d', 1148}, {'e', 1149}, {'l', 1150}, {'p', 1151}, {'r', 1152},
+    {'v', 1153}, {'w', 1154}, {'c', 1155}, {'i', 1156}, {'l', 1157}, {'r', 1158}, {'a', 1159}, {'g', 1160},
+    {'l', 1161}, {'r', 1162}, {'s', 1163}, {'k', 1164}, {'l', 1165}, {'a', 1166}, {'y', 1167}, {';', 1168},
+    {'a', 1169}, {'o', 1170}, {'g', 1171}, {'l', 1172}, {'m', 1173}, {'i', 1174}, {'r', 1175}, {'a', 1176},
+    {'a', 1177}, {'e', 1178}, {'g', 1179}, {'s', 1180}, {'v', 1181}, {'c', 1182}, {'c', 1183}, {'l', 1184},
+    {'p', 1185}, {'t', 1186}, {'u', 1187}, {'w', 1188}, {'b', 1189}, {'c', 1190}, {'c', 1191}, {'o', 1192},
+    {'t', 1193}, {'d', 1194}, {'r', 1195}, {'a', 1196}, {'h', 1197}, {'a', 1198}, {'c', 1199}, {'i', 1200},
+    {'D', 1201}, {'o', 1202}, {'c', 1203}, {'s', 1204}, {'a', 1205}, {'i', 1206}, {'o', 1207}, {'y', 1208},
+    {'o', 1209}, {';', 1210}, {'D', 1211}, {'r', 1212}, {';', 1213}, {'r', 1214}, {'s', 1215}, {';', 1216},
+    {'i', 1217}, {'l', 1218}, {'s', 1219}, {'a', 1220}, {'p', 1221}, {'s', 1222}, {'g', 1223}, {'s', 1224},
+    {'g', 1225}, {'p', 1226}, {'a', 1227}, {'l', 1228}, {'s', 1229}, {'c', 1230}, {'s', 1231}, {'u', 1232},
+    {'v', 1233}, {'D', 1234}, {'a', 1235}, {'c', 1236}, {'d', 1237}, {'i', 1238}, {'a', 1239}, {'h', 1240},
+    {'m', 1241}, {'r', 1242}, {'c', 1243}, {'i', 1244}, {'p', 1245}, {'l', 1246}, {'y', 1247}, {'m', 1248},
+    {'i', 1249}, {'l', 1250}, {'r', 1251}, {'l', 1252}, {'l', 1253}, {'a', 1254}, {'l', 1255}, {'t', 1256},
+    {'o', 1257}, {'p', 1258}, {'r', 1259}, {'a', 1260}, {'a', 1261}, {'o', 1262}, {'c', 1263}, {';', 1264},
+    {'l', 1265}, {'c', 1266}, {'m', 1267}, {'p', 1268}, {'r', 1269}, {'i', 1270}, {'y', 1271}, {'o', 1272},
+    {';', 1273}, {'l', 1274}, {'q', 1275}, {'s', 1276}, {'r', 1277}, {';', 1278}, {'g', 1279}, {'m', 1280},
+    {'c', 1281}, {';', 1282}, {'E', 1283}, {'a', 1284}, {'j', 1285}, {'E', 1286}, {'a', 1287}, {'e', 1288},
+    {'s', 1289}, {'p', 1290}, {'a', 1291}, {'c', 1292}, {'i', 1293}, {';', 1294}, {'c', 1295}, {'d', 1296},
+    {'l', 1297}, {'q', 1298}, {'r', 1299}, {'e', 1300}, {'n', 1301}, {'r', 1302}, {'i', 1303}, {'l', 1304},
+    {'m', 1305}, {'r', 1306}, {'a', 1307}, {'i', 1308}, {'a', 1309}, {'l', 1310}, {'r', 1311}, {'r', 1312},
+    {'s', 1313}, {'a', 1314}, {'m', 1315}, {'o', 1316}, {'p', 1317}, {'r', 1318}, {'c', 1319}, {'l', 1320},
+    {'t', 1321}, {'b', 1322}, {'p', 1323}, {'c', 1324}, {';', 1325}, {'i', 1326}, {'y', 1327}, {'c', 1328},
+    {'x', 1329}, {'f', 1330}, {'r', 1331}, {'r', 1332}, {';', 1333}, {'i', 1334}, {'n', 1335}, {'o', 1336},
+    {'l', 1337}, {'a', 1338}, {'o', 1339}, {'p', 1340}, {';', 1341}, {'c', 1342}, {'f', 1343}, {'o', 1344},
+    {'t', 1345}, {'c', 1346}, {'g', 1347}, {'p', 1348}, {'t', 1349}, {'r', 1350}, {'u', 1351}, {'c', 1352},
+    {'i', 1353}, {';', 1354}, {'i', 1355}, {'k', 1356}, {'m', 1357}, {'i', 1358}, {'y', 1359}, {'r', 1360},
+    {'a', 1361}, {'p', 1362}, {'c', 1363}, {'e', 1364}, {'k', 1365}, {'p', 1366}, {'e', 1367}, {'y', 1368},
+    {'r', 1369}, {'r', 1370}, {'c', 1371}, {'c', 1372}, {'p', 1373}, {'c', 1374}, {'a', 1375}, {'r', 1376},
+    {'t', 1377}, {'a', 1378}, {';', 1379}, {'g', 1380}, {'a', 1381}, {'c', 1382}, {'e', 1383}, {'g', 1384},
+    {'m', 1385}, {'n', 1386}, {'p', 1387}, {'q', 1388}, {'r', 1389}, {'t', 1390}, {'a', 1391}, {'b', 1392},
+    {'r', 1393}, {'a', 1394}, {'e', 1395}, {'u', 1396}, {'y', 1397}, {'c', 1398}, {'q', 1399}, {'r', 1400},
+    {'s', 1401}, {';', 1402}, {'f', 1403}, {'g', 1404}, {'q', 1405}, {'s', 1406}, {'i', 1407}, {'l', 1408},
+    {'r', 1409}, {';', 1410}, {'E', 1411}, {'a', 1412}, {'b', 1413}, {'c', 1414}, {';', 1415}, {'a', 1416},
+    {'c', 1417}, {'h', 1418}, {'t', 1419}, {'i', 1420}, {'o', 1421}, {'E', 1422}, {'a', 1423}, {'e', 1424},
+    {'s', 1425}, {'a', 1426}, {'b', 1427}, {'n', 1428}, {'o', 1429}, {'p', 1430}, {'t', 1431}, {'w', 1432},
+    {'z', 1433}, {'a', 1434}, {'a', 1435}, {'c', 1436}, {'h', 1437}, {'m', 1438}, {'t', 1439}, {'a', 1440},
+    {'c', 1441}, {'h', 1442}, {'i', 1443}, {'q', 1444}, {'t', 1445}, {';', 1446}, {'c', 1447}, {'d', 1448},
+    {'h', 1449}, {'i', 1450}, {'l', 1451}, {'q', 1452}, {'r', 1453}, {'r', 1454}, {'e', 1455}, {'n', 1456},
+    {'D', 1457}, {'c', 1458}, {'l', 1459}, {'p', 1460}, {'r', 1461}, {'o', 1462}, {'y', 1463}, {'a', 1464},
+    {'a', 1465}, {'r', 1466}, {'o', 1467}, {'c', 1468}, {'d', 1469}, {'n', 1470}, {'c', 1471}, {'d', 1472},
+    {'p', 1473}, {'d', 1474}, {'p', 1475}, {';', 1476}, {'c', 1477}, {'t', 1478}, {';', 1479}, {'l', 1480},
+    {'m', 1481}, {'g', 1482}, {'t', 1483}, {'e', 1484}, {'l', 1485}, {'t', 1486}, {'i', 1487}, {'D', 1488},
+    {'d', 1489}, {'b', 1490}, {'c', 1491}, {'n', 1492}, {'p', 1493}, {'t', 1494}, {'s', 1495}, {'u', 1496},
+    {'a', 1497}, {'e', 1498}, {'o', 1499}, {'u', 1500}, {'y', 1501}, {'a', 1502}, {';', 1503}, {'A', 1504},
+    {'a', 1505}, {'d', 1506}, {'q', 1507}, {'s', 1508}, {'x', 1509}, {'r', 1510}, {'E', 1511}, {'e', 1512},
+    {'s', 1513}, {'t', 1514}, {'A', 1515}, {'a', 1516}, {'p', 1517}, {';', 1518}, {'s', 1519}, {'v', 1520},
+    {'c', 1521}, {'A', 1522}, {'E', 1523}, {'a', 1524}, {'d', 1525}, {'e', 1526}, {'s', 1527}, {'t', 1528},
+    {'i', 1529}, {'p', 1530}, {'t', 1531}, {'a', 1532}, {'o', 1533}, {'r', 1534}, {'A', 1535}, {'a', 1536},
+    {'i', 1537}, {'t', 1538}, {'c', 1539}, {'h', 1540}, {'i', 1541}, {'m', 1542}, {'p', 1543}, {'q', 1544},
+    {'u', 1545}, {'g', 1546}, {'i', 1547}, {'l', 1548}, {'r', 1549}, {';', 1550}, {'m', 1551}, {'D', 1552},
+    {'H', 1553}, {'a', 1554}, {'d', 1555}, {'g', 1556}, {'i', 1557}, {'l', 1558}, {'r', 1559}, {'s', 1560},
+    {'A', 1561}, {'a', 1562}, {'n', 1563}, {';', 1564}, {'c', 1565}, {'s', 1566}, {'i', 1567}, {'y', 1568},
+    {'a', 1569}, {'b', 1570}, {'i', 1571}, {'o', 1572}, {'s', 1573}, {'l', 1574}, {'c', 1575}, {'r', 1576},
+    {'o', 1577}, {'r', 1578}, {'t', 1579}, {'b', 1580}, {'m', 1581}, {'n', 1582}, {'a', 1583}, {'c', 1584},
+    {'i', 1585}, {'t', 1586}, {'a', 1587}, {'e', 1588}, {'i', 1589}, {'p', 1590}, {'a', 1591}, {'e', 1592},
+    {'l', 1593}, {';', 1594}, {'a', 1595}, {'d', 1596}, {'i', 1597}, {'o', 1598}, {'s', 1599}, {'v', 1600},
+    {'c', 1601}, {'l', 1602}, {'o', 1603}, {'i', 1604}, {'m', 1605}, {'b', 1606}, {'r', 1607}, {'y', 1608},
+    {'r', 1609}, {'r', 1610}, {'i', 1611}, {'m', 1612}, {'o', 1613}, {';', 1614}, {'t', 1615}, {'v', 1616},
+    {'a', 1617}, {'u', 1618}, {';', 1619}, {'i', 1620}, {'p', 1621}, {'u', 1622}, {';', 1623}, {'E', 1624},
+    {'a', 1625}, {'c', 1626}, {'e', 1627}, {'i', 1628}, {'n', 1629}, {'o', 1630}, {'s', 1631}, {'u', 1632},
+    {'c', 1633}, {'i', 1634}, {'n', 1635}, {'r', 1636}, {'n', 1637}, {'p', 1638}, {'r', 1639}, {'c', 1640},
+    {'a', 1641}, {'e', 1642}, {'o', 1643}, {'a', 1644}, {'r', 1645}, {'t', 1646}, {'a', 1647}, {'a', 1648},
+    {'c', 1649}, {'d', 1650}, {'e', 1651}, {'n', 1652}, {'q', 1653}, {'r', 1654}, {'t', 1655}, {'a', 1656},
+    {'b', 1657}, {'r', 1658}, {'a', 1659}, {'e', 1660}, {'u', 1661}, {'y', 1662}, {'c', 1663}, {'l', 1664},
+    {'q', 1665}, {'s', 1666}, {'a', 1667}, {'c', 1668}, {'g', 1669}, {'i', 1670}, {'l', 1671}, {'r', 1672},
+    {'a', 1673}, {'o', 1674}, {'g', 1675}, {'n', 1676}, {'s', 1677}, {'a', 1678}, {'h', 1679}, {'m', 1680},
+    {'o', 1681}, {'m', 1682}, {'a', 1683}, {'b', 1684}, {'p', 1685}, {'t', 1686}, {'a', 1687}, {'p', 1688},
+    {'a', 1689}, {'a', 1690}, {'c', 1691}, {'h', 1692}, {'q', 1693}, {'h', 1694}, {'i', 1695}, {'r', 1696},
+    {'l', 1697}, {';', 1698}, {'c', 1699}, {'q', 1700}, {';', 1701}, {'E', 1702}, {'a', 1703}, {'c', 1704},
+    {'e', 1705}, {'i', 1706}, {'n', 1707}, {'p', 1708}, {'s', 1709}, {'y', 1710}, {'o', 1711}, {'A', 1712},
+    {'a', 1713}, {'c', 1714}, {'m', 1715}, {'s', 1716}, {'t', 1717}, {'x', 1718}, {'r', 1719}, {'a', 1720},
+    {'c', 1721}, {'o', 1722}, {'y', 1723}, {'g', 1724}, {'m', 1725}, {'a', 1726}, {'a', 1727}, {'e', 1728},
+    {'i', 1729}, {'t', 1730}, {'f', 1731}, {'l', 1732}, {'p', 1733}, {'a', 1734}, {'c', 1735}, {'s', 1736},
+    {'u', 1737}, {'a', 1738}, {'c', 1739}, {'e', 1740}, {'m', 1741}, {'t', 1742}, {'a', 1743}, {'r', 1744},
+    {'b', 1745}, {'c', 1746}, {'m', 1747}, {'n', 1748}, {'p', 1749}, {'A', 1750}, {'a', 1751}, {'n', 1752},
+    {'l', 1753}, {'r', 1754}, {'u', 1755}, {'r', 1756}, {'a', 1757}, {'e', 1758}, {'y', 1759}, {'o', 1760},
+    {'l', 1761}, {'r', 1762}, {'e', 1763}, {'i', 1764}, {'k', 1765}, {'o', 1766}, {'l', 1767}, {'m', 1768},
+    {'n', 1769}, {'e', 1770}, {'p', 1771}, {'s', 1772}, {'r', 1773}, {'a', 1774}, {'i', 1775}, {'p', 1776},
+    {'c', 1777}, {'h', 1778}, {'t', 1779}, {'i', 1780}, {'o', 1781}, {'r', 1782}, {'a', 1783}, {'c', 1784},
+    {'r', 1785}, {'r', 1786}, {'i', 1787}, {'y', 1788}, {'a', 1789}, {'b', 1790}, {'h', 1791}, {'i', 1792},
+    {'r', 1793}, {'r', 1794}, {'a', 1795}, {'b', 1796}, {'c', 1797}, {'t', 1798}, {'a', 1799}, {'l', 1800},
+    {'g', 1801}, {'p', 1802}, {'a', 1803}, {'d', 1804}, {'h', 1805}, {'l', 1806}, {'s', 1807}, {'u', 1808},
+    {'c', 1809}, {'i', 1810}, {'t', 1811}, {'c', 1812}, {'d', 1813}, {'i', 1814}, {'r', 1815}, {'a', 1816},
+    {'m', 1817}, {'a', 1818}, {'r', 1819}, {'a', 1820}, {'a', 1821}, {'n', 1822}, {'r', 1823}, {'y', 1824},
+    {'a', 1825}, {'e', 1826}, {'l', 1827}, {'r', 1828}, {'r', 1829}, {'t', 1830}, {'s', 1831}, {'p', 1832},
+    {'r', 1833}, {'t', 1834}, {'c', 1835}, {'u', 1836}, {'i', 1837}, {'i', 1838}, {'d', 1839}, {'i', 1840},
+    {'r', 1841}, {'p', 1842}, {';', 1843}, {';', 1844}, {'e', 1845}, {'c', 1846}, {'a', 1847}, {'i', 1848},
+    {'u', 1849}, {'t', 1850}, {'r', 1851}, {'A', 1852}, {'a', 1853}, {';', 1854}, {'A', 1855}, {'a', 1856},
+    {'a', 1857}, {'i', 1858}, {'d', 1859}, {'p', 1860}, {'t', 1861}, {'A', 1862}, {'a', 1863}, {'c', 1864},
+    {'q', 1865}, {'p', 1866}, {'t', 1867}, {'e', 1868}, {'e', 1869}, {'c', 1870}, {'i', 1871}, {'y', 1872},
+    {'n', 1873}, {'r', 1874}, {'c', 1875}, {'p', 1876}, {'c', 1877}, {'c', 1878}, {'m', 1879}, {'c', 1880},
+    {'a', 1881}, {'y', 1882}, {'o', 1883}, {'e', 1884}, {'t', 1885}, {'r', 1886}, {'c', 1887}, {'g', 1888},
+    {'p', 1889}, {'c', 1890}, {'j', 1891}, {'n', 1892}, {'i', 1893}, {';', 1894}, {'S', 1895}, {'u', 1896},
+    {'e', 1897}, {'r', 1898}, {';', 1899}, {';', 1900}, {'a', 1901}, {'h', 1902}, {'c', 1903}, {';', 1904},
+    {'o', 1905}, {'f', 1906}, {'l', 1907}, {'n', 1908}, {'r', 1909}, {'i', 1910}, {'l', 1911}, {'l', 1912},
+    {'k', 1913}, {'v', 1914}, {'w', 1915}, {';', 1916}, {'a', 1917}, {'n', 1918}, {'a', 1919}, {';', 1920},
+    {'f', 1921}, {'v', 1922}, {'r', 1923}, {'p', 1924}, {'y', 1925}, {'Y', 1926}, {'u', 1927}, {';', 1928},
+    {'i', 1929}, {'l', 1930}, {'r', 1931}, {'d', 1932}, {'r', 1933}, {'n', 1934}, {'t', 1935}, {'i', 1936},
+    {'t', 1937}, {';', 1938}, {';', 1939}, {'c', 1940}, {'c', 1941}, {'s', 1942}, {'o', 1943}, {'g', 1944},
+    {'i', 1945}, {'t', 1946}, {'f', 1947}, {'r', 1948}, {'n', 1949}, {'s', 1950}, {'r', 1951}, {';', 1952},
+    {'C', 1953}, {'t', 1954}, {'y', 1955}, {'y', 1956}, {'y', 1957}, {'g', 1958}, {'r', 1959}, {'h', 1960},
+    {'r', 1961}, {';', 1962}, {';', 1963}, {'t', 1964}, {';', 1965}, {'c', 1966}, {'m', 1967}, {'f', 1968},
+    {'f', 1969}, {';', 1970}, {'D', 1971}, {'E', 1972}, {'b', 1973}, {'n', 1974}, {'r', 1975}, {'r', 1976},
+    {';', 1977}, {';', 1978}, {'u', 1979}, {'r', 1980}, {'r', 1981}, {';', 1982}, {'t', 1983}, {';', 1984},
+    {'a', 1985}, {'m', 1986}, {'c', 1987}, {'t', 1988}, {'o', 1989}, {'f', 1990}, {'i', 1991}, {'a', 1992},
+    {'i', 1993}, {'r', 1994}, {'m', 1995}, {';', 1996}, {'l', 1997}, {'s', 1998}, {'o', 1999}, {';', 2000},
+    {';', 2001}, {'l', 2002}, {'f', 2003}, {'A', 2004}, {'r', 2005}, {'r', 2006}, {'y', 2007}, {'m', 2008},
+    {'e', 2009}, {'d', 2010}, {'r', 2011}, {';', 2012}, {'t', 2013}, {';', 2014}, {'f', 2015}, {'a', 2016},
+    {'r', 2017}, {'D', 2018}, {'e', 2019}, {';', 2020}, {'r', 2021}, {';', 2022}, {'b', 2023}, {'f', 2024},
+    {'i', 2025}, {'r', 2026}, {'r', 2027}, {'p', 2028}, {'y', 2029}, {'i', 2030}, {'y', 2031}, {'u', 2032},
+    {'r', 2033}, {';', 2034}, {'t', 2035}, {';', 2036}, {'a', 2037}, {'c', 2038}, {'g', 2039}, {'l', 2040},
+    {';', 2041}, {'e', 2042}, {'i', 2043}, {'o', 2044}, {'f', 2045}, {'a', 2046}, {'r', 2047}, {'l', 2048},
+    {'c', 2049}, {'l', 2050}, {'r', 2051}, {';', 2052}, {';', 2053}, {'f', 2054}, {'r', 2055}, {'r', 2056},
+    {'c', 2057}, {'y', 2058}, {'y', 2059}, {'p', 2060}, {'d', 2061}, {';', 2062}, {';', 2063}, {'f', 2064},
+    {'r', 2065}, {'y', 2066}, {'u', 2067}, {'b', 2068}, {'g', 2069}, {'l', 2070}, {'r', 2071}, {'r', 2072},
+    {'d', 2073}, {';', 2074}, {'t', 2075}, {'s', 2076}, {';', 2077}, {'f', 2078}, {'d', 2079}, {'g', 2080},
+    {'f', 2081}, {'e', 2082}, {'r', 2083}, {';', 2084}, {'r', 2085}, {';', 2086}, {';', 2087}, {'i', 2088},
+    {'l', 2089}, {';', 2090}, {'u', 2091}, {'f', 2092}, {'r', 2093}, {'y', 2094}, {'u', 2095}, {'r', 2096},
+    {'d', 2097}, {';', 2098}, {'a', 2099}, {'t', 2100}, {'L', 2101}, {';', 2102}, {'r', 2103}, {'B', 2104},
+    {'f', 2105}, {';', 2106}, {'C', 2107}, {'D', 2108}, {'E', 2109}, {'G', 2110}, {'H', 2111}, {'L', 2112},
+    {'N', 2113}, {'P', 2114}, {'R', 2115}, {'S', 2116}, {'T', 2117}, {'V', 2118}, {'r', 2119}, {'l', 2120},
+    {'i', 2121}, {'u', 2122}, {'r', 2123}, {';', 2124}, {'l', 2125}, {';', 2126}, {'a', 2127}, {'c', 2128},
+    {'g', 2129}, {'c', 2130}, {'f', 2131}, {'n', 2132}, {'r', 2133}, {'a', 2134}, {'l', 2135}, {'m', 2136},
+    {'l', 2137}, {'r', 2138}, {'t', 2139}, {';', 2140}, {';', 2141}, {';', 2142}, {'s', 2143}, {'n', 2144},
+    {'f', 2145}, {'c', 2146}, {'m', 2147}, {'d', 2148}, {'p', 2149}, {'r', 2150}, {';', 2151}, {'T', 2152},
+    {';', 2153}, {'f', 2154}, {'r', 2155}, {'r', 2156}, {';', 2157}, {'u', 2158}, {'g', 2159}, {'r', 2160},
+    {'r', 2161}, {'d', 2162}, {';', 2163}, {'e', 2164}, {';', 2165}, {';', 2166}, {'h', 2167}, {'f', 2168},
+    {'n', 2169}, {'g', 2170}, {'r', 2171}, {';', 2172}, {'e', 2173}, {'H', 2174}, {'y', 2175}, {'T', 2176},
+    {'u', 2177}, {'r', 2178}, {'d', 2179}, {'r', 2180}, {';', 2181}, {';', 2182}, {'r', 2183}, {'m', 2184},
+    {'l', 2185}, {'f', 2186}, {'t', 2187}, {'a', 2188}, {'r', 2189}, {'r', 2190}, {';', 2191}, {'s', 2192},
+    {'c', 2193}, {'h', 2194}, {';', 2195}, {';', 2196}, {'e', 2197}, {'s', 2198}, {'R', 2199}, {'D', 2200},
+    {'c', 2201}, {'y', 2202}, {';', 2203}, {';', 2204}, {'r', 2205}, {'d', 2206}, {';', 2207}, {';', 2208},
+    {'r', 2209}, {'t', 2210}, {'c', 2211}, {'n', 2212}, {'d', 2213}, {'f', 2214}, {'p', 2215}, {'r', 2216},
+    {'r', 2217}, {'u', 2218}, {'r', 2219}, {'c', 2220}, {'e', 2221}, {'r', 2222}, {';', 2223}, {'l', 2224},
+    {';', 2225}, {'a', 2226}, {'c', 2227}, {'e', 2228}, {'o', 2229}, {'o', 2230}, {'f', 2231}, {'r', 2232},
+    {'o', 2233}, {'q', 2234}, {'e', 2235}, {'r', 2236}, {'o', 2237}, {'e', 2238}, {'i', 2239}, {'n', 2240},
+    {'r', 2241}, {'l', 2242}, {'l', 2243}, {'s', 2244}, {'r', 2245}, {';', 2246}, {'s', 2247}, {';', 2248},
+    {'b', 2249}, {'t', 2250}, {'y', 2251}, {';', 2252}, {'f', 2253}, {'r', 2254}, {'a', 2255}, {'r', 2256},
+    {'g', 2257}, {';', 2258}, {'f', 2259}, {'r', 2260}, {';', 2261}, {'f', 2262}, {'r', 2263}, {'y', 2264},
+    {'y', 2265}, {'y', 2266}, {'u', 2267}, {'r', 2268}, {';', 2269}, {';', 2270}, {'f', 2271}, {'r', 2272},
+    {'l', 2273}, {'y', 2274}, {'u', 2275}, {'r', 2276}, {';', 2277}, {'t', 2278}, {'o', 2279}, {'a', 2280},
+    {';', 2281}, {'f', 2282}, {'r', 2283}, {'u', 2284}, {'e', 2285}, {';', 2286}, {';', 2287}, {'r', 2288},
+    {'t', 2289}, {';', 2290}, {'i', 2291}, {';', 2292}, {'a', 2293}, {'f', 2294}, {'p', 2295}, {'h', 2296},
+    {'c', 2297}, {'l', 2298}, {';', 2299}, {';', 2300}, {'a', 2301}, {'d', 2302}, {'s', 2303}, {'v', 2304},
+    {';', 2305}, {'e', 2306}, {'l', 2307}, {'m', 2308}, {'r', 2309}, {'s', 2310}, {'z', 2311}, {'o', 2312},
+    {'f', 2313}, {';', 2314}, {'c', 2315}, {';', 2316}, {'d', 2317}, {'s', 2318}, {'r', 2319}, {'n', 2320},
+    {'r', 2321}, {';', 2322}, {'m', 2323}, {'l', 2324}, {'l', 2325}, {'o', 2326}, {'n', 2327}, {'t', 2328},
+    {'k', 2329}, {'v', 2330}, {'w', 2331}, {'k', 2332}, {'n', 2333}, {';', 2334}, {'u', 2335}, {'a', 2336},
+    {'p', 2337}, {'s', 2338}, {'n', 2339}, {'a', 2340}, {'h', 2341}, {'w', 2342}, {';', 2343}, {'c', 2344},
+    {'o', 2345}, {'s', 2346}, {'t', 2347}, {'u', 2348}, {'v', 2349}, {'w', 2350}, {'r', 2351}, {'c', 2352},
+    {'n', 2353}, {'1', 2354}, {'3', 2355}, {'c', 2356}, {';', 2357}, {'q', 2358}, {'t', 2359}, {'f', 2360},
+    {';', 2361}, {'t', 2362}, {'t', 2363}, {'D', 2364}, {'H', 2365}, {'U', 2366}, {'V', 2367}, {'b', 2368},
+    {'d', 2369}, {'h', 2370}, {'m', 2371}, {'p', 2372}, {'t', 2373}, {'u', 2374}, {'v', 2375}, {'i', 2376},
+    {'v', 2377}, {'b', 2378}, {'r', 2379}, {'m', 2380}, {'m', 2381}, {'l', 2382}, {'l', 2383}, {'p', 2384},
+    {'u', 2385}, {';', 2386}, {'a', 2387}, {'b', 2388}, {'c', 2389}, {'d', 2390}, {'s', 2391}, {'e', 2392},
+    {'o', 2393}, {'p', 2394}, {'r', 2395}, {'d', 2396}, {'r', 2397}, {'p', 2398}, {'t', 2399}, {'i', 2400},
+    {'p', 2401}, {'t', 2402}, {';', 2403}, {'y', 2404}, {'c', 2405}, {';', 2406}, {';', 2407}, {'E', 2408},
+    {'c', 2409}, {'e', 2410}, {'f', 2411}, {'m', 2412}, {'s', 2413}, {'b', 2414}, {'o', 2415}, {'m', 2416},
+    {'p', 2417}, {'g', 2418}, {'i', 2419}, {'f', 2420}, {'r', 2421}, {'y', 2422}, {'r', 2423}, {'s', 2424},
+    {'r', 2425}, {'b', 2426}, {'p', 2427}, {'o', 2428}, {'a', 2429}, {'p', 2430}, {'s', 2431}, {'a', 2432},
+    {';', 2433}, {'b', 2434}, {'c', 2435}, {'d', 2436}, {'o', 2437}, {'s', 2438}, {'a', 2439}, {'l', 2440},
+    {'r', 2441}, {'v', 2442}, {'e', 2443}, {'e', 2444}, {'o', 2445}, {'n', 2446}, {'c', 2447}, {'r', 2448},
+    {'r', 2449}, {'g', 2450}, {'e', 2451}, {'r', 2452}, {'h', 2453}, {'a', 2454}, {'a', 2455}, {'r', 2456},
+    {';', 2457}, {'g', 2458}, {'r', 2459}, {'t', 2460}, {';', 2461}, {'t', 2462}, {'p', 2463}, {'s', 2464},
+    {';', 2465}, {'r', 2466}, {'m', 2467}, {';', 2468}, {'a', 2469}, {'i', 2470}, {';', 2471}, {'i', 2472},
+    {'o', 2473}, {'y', 2474}, {'o', 2475}, {'r', 2476}, {'l', 2477}, {'f', 2478}, {';', 2479}, {'e', 2480},
+    {'m', 2481}, {'p', 2482}, {'s', 2483}, {'b', 2484}, {'n', 2485}, {'k', 2486}, {'o', 2487}, {'r', 2488},
+    {'r', 2489}, {'y', 2490}, {'l', 2491}, {'r', 2492}, {'o', 2493}, {'i', 2494}, {'r', 2495}, {'a', 2496},
+    {'n', 2497}, {'y', 2498}, {'g', 2499}, {'o', 2500}, {'t', 2501}, {'u', 2502}, {'t', 2503}, {'r', 2504},
+    {'r', 2505}, {'l', 2506}, {';', 2507}, {'t', 2508}, {'o', 2509}, {';', 2510}, {'a', 2511}, {';', 2512},
+    {'d', 2513}, {'n', 2514}, {';', 2515}, {';', 2516}, {'d', 2517}, {'c', 2518}, {'t', 2519}, {'p', 2520},
+    {';', 2521}, {'p', 2522}, {'o', 2523}, {'f', 2524}, {'r', 2525}, {'u', 2526}, {'i', 2527}, {'i', 2528},
+    {'o', 2529}, {'i', 2530}, {'l', 2531}, {'a', 2532}, {'e', 2533}, {'i', 2534}, {'p', 2535}, {'o', 2536},
+    {'r', 2537}, {'r', 2538}, {'o', 2539}, {'m', 2540}, {';', 2541}, {';', 2542}, {'l', 2543}, {'o', 2544},
+    {'l', 2545}, {'s', 2546}, {'e', 2547}, {'o', 2548}, {'l', 2549}, {';', 2550}, {'a', 2551}, {'l', 2552},
+    {'i', 2553}, {'l', 2554}, {';', 2555}, {'i', 2556}, {'i', 2557}, {'t', 2558}, {'i', 2559}, {'n', 2560},
+    {'f', 2561}, {'f', 2562}, {'a', 2563}, {'k', 2564}, {'r', 2565}, {'c', 2566}, {'s', 2567}, {'w', 2568},
+    {'r', 2569}, {';', 2570}, {'u', 2571}, {'m', 2572}, {';', 2573}, {'e', 2574}, {'r', 2575}, {';', 2576},
+    {'t', 2577}, {';', 2578}, {';', 2579}, {'q', 2580}, {'s', 2581}, {';', 2582}, {'c', 2583}, {'d', 2584},
+    {'l', 2585}, {';', 2586}, {';', 2587}, {'e', 2588}, {'y', 2589}, {';', 2590}, {';', 2591}, {';', 2592},
+    {';', 2593}, {'p', 2594}, {';', 2595}, {'q', 2596}, {'i', 2597}, {'f', 2598}, {'v', 2599}, {'r', 2600},
+    {'m', 2601}, {'c', 2602}, {'i', 2603}, {'o', 2604}, {'P', 2605}, {'u', 2606}, {'a', 2607}, {'d', 2608},
+    {'e', 2609}, {'l', 2610}, {'s', 2611}, {'r', 2612}, {'E', 2613}, {'r', 2614}, {'r', 2615}, {'f', 2616},
+    {'i', 2617}, {'d', 2618}, {'r', 2619}, {'r', 2620}, {'r', 2621}, {'r', 2622}, {'l', 2623}, {'c', 2624},
+    {';', 2625}, {'e', 2626}, {'w', 2627}, {'r', 2628}, {'t', 2629}, {'k', 2630}, {'f', 2631}, {'b', 2632},
+    {'r', 2633}, {'a', 2634}, {'r', 2635}, {'u', 2636}, {'h', 2637}, {'u', 2638}, {'r', 2639}, {';', 2640},
+    {'y', 2641}, {'c', 2642}, {';', 2643}, {';', 2644}, {'a', 2645}, {'i', 2646}, {'n', 2647}, {'f', 2648},
+    {'t', 2649}, {'i', 2650}, {'c', 2651}, {'g', 2652}, {'t', 2653}, {'f', 2654}, {'e', 2655}, {'a', 2656},
+    {'i', 2657}, {'d', 2658}, {';', 2659}, {'c', 2660}, {'e', 2661}, {'l', 2662}, {'p', 2663}, {'y', 2664},
+    {'o', 2665}, {'f', 2666}, {'a', 2667}, {'o', 2668}, {'e', 2669}, {'r', 2670}, {'n', 2671}, {'l', 2672},
+    {'c', 2673}, {'l', 2674}, {'r', 2675}, {';', 2676}, {';', 2677}, {'t', 2678}, {'f', 2679}, {'r', 2680},
+    {'r', 2681}, {'c', 2682}, {'p', 2683}, {'d', 2684}, {';', 2685}, {';', 2686}, {'e', 2687}, {'y', 2688},
+    {'y', 2689}, {'f', 2690}, {'r', 2691}, {'r', 2692}, {'r', 2693}, {'a', 2694}, {'r', 2695}, {';', 2696},
+    {'r', 2697}, {'u', 2698}, {'m', 2699}, {'r', 2700}, {'b', 2701}, {'g', 2702}, {';', 2703}, {'u', 2704},
+    {'r', 2705}, {';', 2706}, {'a', 2707}, {'e', 2708}, {'r', 2709}, {'r', 2710}, {'a', 2711}, {'k', 2712},
+    {'r', 2713}, {'d', 2714}, {'i', 2715}, {'b', 2716}, {';', 2717}, {'a', 2718}, {'u', 2719}, {'d', 2720},
+    {'u', 2721}, {'h', 2722}, {'t', 2723}, {';', 2724}, {';', 2725}, {'q', 2726}, {'s', 2727}, {';', 2728},
+    {'c', 2729}, {'d', 2730}, {'g', 2731}, {'s', 2732}, {'s', 2733}, {'o', 2734}, {';', 2735}, {';', 2736},
+    {'r', 2737}, {'l', 2738}, {'y', 2739}, {'r', 2740}, {'o', 2741}, {'a', 2742}, {'r', 2743}, {'d', 2744},
+    {'u', 2745}, {';', 2746}, {'p', 2747}, {';', 2748}, {'q', 2749}, {'i', 2750}, {'n', 2751}, {'r', 2752},
+    {'r', 2753}, {'g', 2754}, {'p', 2755}, {'a', 2756}, {'f', 2757}, {'l', 2758}, {'i', 2759}, {'a', 2760},
+    {'b', 2761}, {';', 2762}, {'e', 2763}, {'f', 2764}, {'r', 2765}, {'r', 2766}, {'o', 2767}, {'a', 2768},
+    {';', 2769}, {'r', 2770}, {'q', 2771}, {'r', 2772}, {';', 2773}, {'m', 2774}, {'b', 2775}, {'u', 2776},
+    {'r', 2777}, {'c', 2778}, {'i', 2779}, {'o', 2780}, {'r', 2781}, {'m', 2782}, {'a', 2783}, {'u', 2784},
+    {'P', 2785}, {'i', 2786}, {'d', 2787}, {'u', 2788}, {'r', 2789}, {'E', 2790}, {'o', 2791}, {'r', 2792},
+    {'e', 2793}, {'t', 2794}, {';', 2795}, {'s', 2796}, {'k', 2797}, {'m', 2798}, {';', 2799}, {'s', 2800},
+    {'s', 2801}, {';', 2802}, {';', 2803}, {'r', 2804}, {';', 2805}, {'a', 2806}, {'c', 2807}, {'d', 2808},
+    {'u', 2809}, {'p', 2810}, {'r', 2811}, {'l', 2812}, {'e', 2813}, {'f', 2814}, {'r', 2815}, {'p', 2816},
+    {'t', 2817}, {'a', 2818}, {';', 2819}, {';', 2820}, {'v', 2821}, {'f', 2822}, {';', 2823}, {';', 2824},
+    {'v', 2825}, {'g', 2826}, {'a', 2827}, {'a', 2828}, {'l', 2829}, {'u', 2830}, {'g', 2831}, {';', 2832},
+    {'E', 2833}, {'i', 2834}, {'o', 2835}, {'p', 2836}, {'u', 2837}, {'p', 2838}, {'m', 2839}, {'p', 2840},
+    {'r', 2841}, {'d', 2842}, {'n', 2843}, {'p', 2844}, {';', 2845}, {'s', 2846}, {'r', 2847}, {'r', 2848},
+    {'o', 2849}, {'u', 2850}, {'e', 2851}, {'i', 2852}, {'i', 2853}, {';', 2854}, {';', 2855}, {';', 2856},
+    {'q', 2857}, {'s', 2858}, {'i', 2859}, {';', 2860}, {'r', 2861}, {'r', 2862}, {'r', 2863}, {'a', 2864},
+    {';', 2865}, {'d', 2866}, {';', 2867}, {'y', 2868}, {'r', 2869}, {';', 2870}, {'r', 2871}, {'r', 2872},
+    {';', 2873}, {'f', 2874}, {'q', 2875}, {'s', 2876}, {'i', 2877}, {';', 2878}, {'r', 2879}, {'d', 2880},
+    {'f', 2881}, {';', 2882}, {'i', 2883}, {'n', 2884}, {'r', 2885}, {'l', 2886}, {';', 2887}, {'c', 2888},
+    {'e', 2889}, {'r', 2890}, {'r', 2891}, {'g', 2892}, {'r', 2893}, {';', 2894}, {'c', 2895}, {'e', 2896},
+    {'r', 2897}, {'o', 2898}, {'m', 2899}, {'i', 2900}, {'a', 2901}, {'s', 2902}, {'b', 2903}, {'c', 2904},
+    {'p', 2905}, {'l', 2906}, {'l', 2907}, {'g', 2908}, {'i', 2909}, {';', 2910}, {'e', 2911}, {'s', 2912},
+    {'a', 2913}, {'a', 2914}, {'p', 2915}, {'a', 2916}, {'e', 2917}, {'t', 2918}, {'n', 2919}, {'A', 2920},
+    {'e', 2921}, {'t', 2922}, {'A', 2923}, {'t', 2924}, {'i', 2925}, {'r', 2926}, {'r', 2927}, {'e', 2928},
+    {'u', 2929}, {'t', 2930}, {'r', 2931}, {';', 2932}, {'s', 2933}, {'l', 2934}, {'v', 2935}, {'t', 2936},
+    {'o', 2937}, {'i', 2938}, {'i', 2939}, {';', 2940}, {'n', 2941}, {'a', 2942}, {';', 2943}, {'a', 2944},
+    {';', 2945}, {'t', 2946}, {'r', 2947}, {'i', 2948}, {'r', 2949}, {'n', 2950}, {';', 2951}, {'c', 2952},
+    {'g', 2953}, {'c', 2954}, {'d', 2955}, {'n', 2956}, {'f', 2957}, {'r', 2958}, {'r', 2959}, {'u', 2960},
+    {'r', 2961}, {';', 2962}, {'e', 2963}, {'f', 2964}, {'m', 2965}, {'g', 2966}, {'r', 2967}, {'l', 2968},
+    {';', 2969}, {'r', 2970}, {'a', 2971}, {'l', 2972}, {'l', 2973}, {'m', 2974}, {'l', 2975}, {'a', 2976},
+    {';', 2977}, {'a', 2978}, {'s', 2979}, {'t', 2980}, {';', 2981}, {'c', 2982}, {'i', 2983}, {'m', 2984},
+    {'p', 2985}, {'t', 2986}, {';', 2987}, {';', 2988}, {'v', 2989}, {'m', 2990}, {'n', 2991}, {'c', 2992},
+    {';', 2993}, {'n', 2994}, {'s', 2995}, {'n', 2996}, {'f', 2997}, {'n', 2998}, {';', 2999}, {'p', 3000},
+    {'u', 3001}, {';', 3002}, {'c', 3003}, {'m', 3004}, {'E', 3005}, {'a', 3006}, {'s', 3007}, {'d', 3008},
+    {'f', 3009}, {'p', 3010}, {'i', 3011}, {'r', 3012}, {'r', 3013}, {';', 3014}, {'c', 3015}, {';', 3016},
+    {'t', 3017}, {'f', 3018}, {'i', 3019}, {'r', 3020}, {'t', 3021}, {'s', 3022}, {'t', 3023}, {'r', 3024},
+    {'r', 3025}, {'a', 3026}, {'r', 3027}, {'r', 3028}, {'e', 3029}, {'u', 3030}, {'i', 3031}, {'m', 3032},
+    {'g', 3033}, {'u', 3034}, {'r', 3035}, {'a', 3036}, {'i', 3037}, {'r', 3038}, {'r', 3039}, {'a', 3040},
+    {'k', 3041}, {'r', 3042}, {'d', 3043}, {'i', 3044}, {'b', 3045}, {';', 3046}, {'a', 3047}, {'d', 3048},
+    {'u', 3049}, {'h', 3050}, {'l', 3051}, {'t', 3052}, {';', 3053}, {'s', 3054}, {'o', 3055}, {';', 3056},
+    {'r', 3057}, {';', 3058}, {'v', 3059}, {'h', 3060}, {'g', 3061}, {'i', 3062}, {'r', 3063}, {'a', 3064},
+    {';', 3065}, {'u', 3066}, {'i', 3067}, {'n', 3068}, {'r', 3069}, {'r', 3070}, {'a', 3071}, {'f', 3072},
+    {'l', 3073}, {'i', 3074}, {'r', 3075}, {'o', 3076}, {'r', 3077}, {'q', 3078}, {'r', 3079}, {';', 3080},
+    {'b', 3081}, {'u', 3082}, {'r', 3083}, {'m', 3084}, {'i', 3085}, {'u', 3086}, {'u', 3087}, {'u', 3088},
+    {';', 3089}, {'p', 3090}, {'r', 3091}, {'u', 3092}, {';', 3093}, {'d', 3094}, {'r', 3095}, {'E', 3096},
+    {'a', 3097}, {'s', 3098}, {'o', 3099}, {'i', 3100}, {';', 3101}, {'t', 3102}, {'r', 3103}, {'r', 3104},
+    {'t', 3105}, {'i', 3106}, {'w', 3107}, {'m', 3108}, {'t', 3109}, {';', 3110}, {'o', 3111}, {'r', 3112},
+    {'h', 3113}, {'y', 3114}, {'r', 3115}, {';', 3116}, {'m', 3117}, {';', 3118}, {'d', 3119}, {'e', 3120},
+    {'g', 3121}, {'l', 3122}, {'n', 3123}, {'p', 3124}, {'r', 3125}, {'r', 3126}, {'l', 3127}, {'s', 3128},
+    {'p', 3129}, {'d', 3130}, {'l', 3131}, {';', 3132}, {'e', 3133}, {'t', 3134}, {';', 3135}, {'b', 3136},
+    {'f', 3137}, {'d', 3138}, {'r', 3139}, {'a', 3140}, {'u', 3141}, {'u', 3142}, {';', 3143}, {'a', 3144},
+    {'f', 3145}, {'r', 3146}, {'r', 3147}, {'t', 3148}, {'i', 3149}, {'a', 3150}, {'r', 3151}, {'a', 3152},
+    {'n', 3153}, {';', 3154}, {'E', 3155}, {'d', 3156}, {'e', 3157}, {'m', 3158}, {'n', 3159}, {'p', 3160},
+    {'r', 3161}, {'s', 3162}, {'c', 3163}, {';', 3164}, {'g', 3165}, {'1', 3166}, {'2', 3167}, {'3', 3168},
+    {';', 3169}, {'E', 3170}, {'d', 3171}, {'e', 3172}, {'h', 3173}, {'l', 3174}, {'m', 3175}, {'n', 3176},
+    {'p', 3177}, {'s', 3178}, {'r', 3179}, {'r', 3180}, {'w', 3181}, {'i', 3182}, {'g', 3183}, {';', 3184},
+    {'k', 3185}, {'r', 3186}, {'d', 3187}, {';', 3188}, {'t', 3189}, {'r', 3190}, {';', 3191}, {'r', 3192},
+    {'t', 3193}, {'c', 3194}, {'n', 3195}, {'a', 3196}, {'s', 3197}, {'r', 3198}, {'d', 3199}, {'e', 3200},
+    {'t', 3201}, {'a', 3202}, {';', 3203}, {'b', 3204}, {'c', 3205}, {'f', 3206}, {'a', 3207}, {'i', 3208},
+    {'d', 3209}, {'a', 3210}, {'d', 3211}, {'e', 3212}, {'m', 3213}, {'p', 3214}, {'s', 3215}, {'t', 3216},
+    {'e', 3217}, {'r', 3218}, {'y', 3219}, {'c', 3220}, {'r', 3221}, {'x', 3222}, {'h', 3223}, {'r', 3224},
+    {'r', 3225}, {'u', 3226}, {'r', 3227}, {'c', 3228}, {'e', 3229}, {'r', 3230}, {';', 3231}, {'r', 3232},
+    {'l', 3233}, {'a', 3234}, {'s', 3235}, {';', 3236}, {'a', 3237}, {'r', 3238}, {'l', 3239}, {'o', 3240},
+    {'r', 3241}, {'r', 3242}, {'c', 3243}, {';', 3244}, {'o', 3245}, {'f', 3246}, {'r', 3247}, {'o', 3248},
+    {'a', 3249}, {'u', 3250}, {'i', 3251}, {'p', 3252}, {'o', 3253}, {'r', 3254}, {'n', 3255}, {'r', 3256},
+    {'r', 3257}, {'o', 3258}, {'l', 3259}, {'i', 3260}, {'r', 3261}, {'l', 3262}, {'n', 3263}, {'r', 3264},
+    {'r', 3265}, {'s', 3266}, {'g', 3267}, {'e', 3268}, {'k', 3269}, {'n', 3270}, {'p', 3271}, {'r', 3272},
+    {'s', 3273}, {'t', 3274}, {';', 3275}, {'s', 3276}, {';', 3277}, {'b', 3278}, {'e', 3279}, {'l', 3280},
+    {'b', 3281}, {'t', 3282}, {';', 3283}, {'r', 3284}, {'u', 3285}, {'f', 3286}, {'o', 3287}, {'r', 3288},
+    {'r', 3289}, {'b', 3290}, {'p', 3291}, {'g', 3292}, {'r', 3293}, {'b', 3294}, {'g', 3295}, {'e', 3296},
+    {';', 3297}, {'f', 3298}, {'a', 3299}, {'r', 3300}, {'p', 3301}, {'r', 3302}, {'p', 3303}, {'r', 3304},
+    {';', 3305}, {'r', 3306}, {'r', 3307}, {'r', 3308}, {'r', 3309}, {'p', 3310}, {'s', 3311}, {'o', 3312},
+    {'f', 3313}, {'l', 3314}, {'i', 3315}, {'r', 3316}, {'r', 3317}, {'r', 3318}, {'c', 3319}, {'l', 3320},
+    {'r', 3321}, {'e', 3322}, {'d', 3323}, {'u', 3324}, {'y', 3325}, {'r', 3326}, {';', 3327}, {';', 3328},
+    {';', 3329}, {'y', 3330}, {'f', 3331}, {'r', 3332}, {'y', 3333}, {'l', 3334}, {'u', 3335}, {'r', 3336},
+    {';', 3337}, {'t', 3338}, {'t', 3339}, {'a', 3340}, {';', 3341}, {'y', 3342}, {'r', 3343}, {'f', 3344},
+    {'r', 3345}, {';', 3346}, {'j', 3347}, {'g', 3348}, {';', 3349}, {'t', 3350}, {'v', 3351}, {'c', 3352},
+    {'v', 3353}, {'a', 3354}, {'r', 3355}, {'n', 3356}, {';', 3357}, {'y', 3358}, {'g', 3359}, {';', 3360},
+    {'g', 3361}, {'d', 3362}, {';', 3363}, {'s', 3364}, {';', 3365}, {'e', 3366}, {'u', 3367}, {'o', 3368},
+    {';', 3369}, {';', 3370}, {'e', 3371}, {';', 3372}, {'e', 3373}, {';', 3374}, {';', 3375}, {'t', 3376},
+    {'t', 3377}, {'e', 3378}, {'o', 3379}, {'i', 3380}, {'c', 3381}, {'i', 3382}, {';', 3383}, {'l', 3384},
+    {'e', 3385}, {'l', 3386}, {'k', 3387}, {'e', 3388}, {'n', 3389}, {'r', 3390}, {'n', 3391}, {'o', 3392},
+    {';', 3393}, {'o', 3394}, {'t', 3395}, {'s', 3396}, {';', 3397}, {'a', 3398}, {'r', 3399}, {';', 3400},
+    {';', 3401}, {';', 3402}, {'e', 3403}, {';', 3404}, {'v', 3405}, {'o', 3406}, {'a', 3407}, {'r', 3408},
+    {'o', 3409}, {'e', 3410}, {';', 3411}, {'o', 3412}, {'q', 3413}, {'l', 3414}, {'A', 3415}, {'B', 3416},
+    {'L', 3417}, {'R', 3418}, {'T', 3419}, {'a', 3420}, {';', 3421}, {'o', 3422}, {'t', 3423}, {'o', 3424},
+    {'c', 3425}, {';', 3426}, {'v', 3427}, {'e', 3428}, {'r', 3429}, {'y', 3430}, {'n', 3431}, {';', 3432},
+    {'l', 3433}, {'l', 3434}, {'l', 3435}, {';', 3436}, {';', 3437}, {';', 3438}, {'t', 3439}, {'n', 3440},
+    {'e', 3441}, {';', 3442}, {'l', 3443}, {'i', 3444}, {';', 3445}, {';', 3446}, {'a', 3447}, {'v', 3448},
+    {'i', 3449}, {'c', 3450}, {';', 3451}, {';', 3452}, {'t', 3453}, {';', 3454}, {'c', 3455}, {'k', 3456},
+    {'c', 3457}, {'e', 3458}, {';', 3459}, {'z', 3460}, {';', 3461}, {'o', 3462}, {'D', 3463}, {'E', 3464},
+    {';', 3465}, {'g', 3466}, {';', 3467}, {'t', 3468}, {'c', 3469}, {';', 3470}, {'v', 3471}, {'r', 3472},
+    {'i', 3473}, {'i', 3474}, {'g', 3475}, {'r', 3476}, {'s', 3477}, {'n', 3478}, {';', 3479}, {';', 3480},
+    {';', 3481}, {'d', 3482}, {'y', 3483}, {';', 3484}, {'c', 3485}, {';', 3486}, {';', 3487}, {'c', 3488},
+    {'y', 3489}, {';', 3490}, {';', 3491}, {'a', 3492}, {'i', 3493}, {';', 3494}, {';', 3495}, {';', 3496},
+    {'t', 3497}, {'d', 3498}, {';', 3499}, {'a', 3500}, {';', 3501}, {'o', 3502}, {'i', 3503}, {'A', 3504},
+    {'C', 3505}, {'D', 3506}, {'F', 3507}, {'R', 3508}, {'T', 3509}, {'U', 3510}, {'V', 3511}, {'a', 3512},
+    {'r', 3513}, {'E', 3514}, {'F', 3515}, {'G', 3516}, {'L', 3517}, {'S', 3518}, {'T', 3519}, {'t', 3520},
+    {'o', 3521}, {'L', 3522}, {'R', 3523}, {'l', 3524}, {'r', 3525}, {';', 3526}, {'r', 3527}, {';', 3528},
+    {'o', 3529}, {'u', 3530}, {'i', 3531}, {'s', 3532}, {';', 3533}, {';', 3534}, {';', 3535}, {'t', 3536},
+    {'o', 3537}, {'i', 3538}, {'t', 3539}, {'e', 3540}, {'i', 3541}, {'e', 3542}, {'r', 3543}, {';', 3544},
+    {'o', 3545}, {'u', 3546}, {'o', 3547}, {'l', 3548}, {'q', 3549}, {'x', 3550}, {'r', 3551}, {'u', 3552},
+    {'e', 3553}, {'e', 3554}, {'r', 3555}, {'e', 3556}, {'i', 3557}, {'q', 3558}, {'u', 3559}, {'i', 3560},
+    {'e', 3561}, {';', 3562}, {'d', 3563}, {'g', 3564}, {'t', 3565}, {'c', 3566}, {'a', 3567}, {'v', 3568},
+    {'r', 3569}, {'a', 3570}, {'r', 3571}, {';', 3572}, {'C', 3573}, {';', 3574}, {'s', 3575}, {'d', 3576},
+    {'e', 3577}, {';', 3578}, {'B', 3579}, {'P', 3580}, {'i', 3581}, {'M', 3582}, {'c', 3583}, {';', 3584},
+    {'e', 3585}, {'e', 3586}, {'u', 3587}, {'o', 3588}, {';', 3589}, {';', 3590}, {';', 3591}, {';', 3592},
+    {'r', 3593}, {'t', 3594}, {';', 3595}, {';', 3596}, {'t', 3597}, {'o', 3598}, {'i', 3599}, {'r', 3600},
+    {'t', 3601}, {';', 3602}, {'d', 3603}, {'h', 3604}, {';', 3605}, {'D', 3606}, {'c', 3607}, {';', 3608},
+    {'c', 3609}, {'t', 3610}, {'o', 3611}, {'i', 3612}, {'c', 3613}, {'t', 3614}, {'a', 3615}, {'l', 3616},
+    {';', 3617}, {';', 3618}, {'r', 3619}, {';', 3620}, {';', 3621}, {'e', 3622}, {'e', 3623}, {'T', 3624},
+    {'r', 3625}, {'e', 3626}, {'N', 3627}, {'E', 3628}, {'y', 3629}, {';', 3630}, {'o', 3631}, {'i', 3632},
+    {'e', 3633}, {'a', 3634}, {'k', 3635}, {'S', 3636}, {'e', 3637}, {';', 3638}, {'l', 3639}, {';', 3640},
+    {'o', 3641}, {'t', 3642}, {';', 3643}, {'o', 3644}, {'y', 3645}, {'v', 3646}, {'c', 3647}, {'a', 3648},
+    {'v', 3649}, {'r', 3650}, {'r', 3651}, {'n', 3652}, {'n', 3653}, {';', 3654}, {'r', 3655}, {'w', 3656},
+    {'u', 3657}, {'e', 3658}, {'r', 3659}, {'w', 3660}, {'r', 3661}, {';', 3662}, {'l', 3663}, {'g', 3664},
+    {';', 3665}, {'d', 3666}, {';', 3667}, {'h', 3668}, {';', 3669}, {'h', 3670}, {'a', 3671}, {';', 3672},
+    {'i', 3673}, {'T', 3674}, {';', 3675}, {';', 3676}, {'s', 3677}, {'c', 3678}, {'e', 3679}, {';', 3680},
+    {';', 3681}, {';', 3682}, {';', 3683}, {';', 3684}, {';', 3685}, {';', 3686}, {'t', 3687}, {'c', 3688},
+    {';', 3689}, {';', 3690}, {';', 3691}, {';', 3692}, {'t', 3693}, {'o', 3694}, {';', 3695}, {'W', 3696},
+    {';', 3697}, {';', 3698}, {';', 3699}, {'t', 3700}, {'v', 3701}, {'c', 3702}, {'e', 3703}, {'g', 3704},
+    {'v', 3705}, {'s', 3706}, {'h', 3707}, {'a', 3708}, {'r', 3709}, {'g', 3710}, {'n', 3711}, {';', 3712},
+    {'l', 3713}, {';', 3714}, {';', 3715}, {'e', 3716}, {'s', 3717}, {'t', 3718}, {'p', 3719}, {'t', 3720},
+    {'a', 3721}, {'n', 3722}, {';', 3723}, {'i', 3724}, {';', 3725}, {';', 3726}, {'o', 3727}, {'g', 3728},
+    {';', 3729}, {'p', 3730}, {'d', 3731}, {';', 3732}, {'n', 3733}, {'t', 3734}, {';', 3735}, {'c', 3736},
+    {'e', 3737}, {'p', 3738}, {'s', 3739}, {'e', 3740}, {'e', 3741}, {';', 3742}, {'t', 3743}, {'g', 3744},
+    {'o', 3745}, {'u', 3746}, {'t', 3747}, {'i', 3748}, {'o', 3749}, {';', 3750}, {';', 3751}, {'e', 3752},
+    {'a', 3753}, {'i', 3754}, {'u', 3755}, {'d', 3756}, {'p', 3757}, {'t', 3758}, {'q', 3759}, {'t', 3760},
+    {'r', 3761}, {'p', 3762}, {'e', 3763}, {'e', 3764}, {'o', 3765}, {'k', 3766}, {'k', 3767}, {'2', 3768},
+    {'4', 3769}, {'4', 3770}, {'k', 3771}, {'u', 3772}, {';', 3773}, {';', 3774}, {'o', 3775}, {'i', 3776},
+    {'L', 3777}, {'R', 3778}, {'l', 3779}, {'r', 3780}, {';', 3781}, {'D', 3782}, {'U', 3783}, {'d', 3784},
+    {'u', 3785}, {'L', 3786}, {'R', 3787}, {'l', 3788}, {'r', 3789}, {';', 3790}, {'H', 3791}, {'L', 3792},
+    {'R', 3793}, {'h', 3794}, {'l', 3795}, {'r', 3796}, {'o', 3797}, {'L', 3798}, {'R', 3799}, {'l', 3800},
+    {'r', 3801}, {';', 3802}, {'D', 3803}, {'U', 3804}, {'d', 3805}, {'u', 3806}, {'i', 3807}, {'l', 3808},
+    {'i', 3809}, {'L', 3810}, {'R', 3811}, {'l', 3812}, {'r', 3813}, {';', 3814}, {'H', 3815}, {'L', 3816},
+    {'R', 3817}, {'h', 3818}, {'l', 3819}, {'r', 3820}, {'m', 3821}, {'e', 3822}, {'a', 3823}, {';', 3824},
+    {'i', 3825}, {';', 3826}, {'e', 3827}, {';', 3828}, {'b', 3829}, {'h', 3830}, {';', 3831}, {'e', 3832},
+    {';', 3833}, {'E', 3834}, {'e', 3835}, {'t', 3836}, {'n', 3837}, {'r', 3838}, {'a', 3839}, {'u', 3840},
+    {'o', 3841}, {';', 3842}, {'t', 3843}, {'n', 3844}, {'s', 3845}, {'o', 3846}, {'i', 3847}, {'c', 3848},
+    {'s', 3849}, {';', 3850}, {'l', 3851}, {'t', 3852}, {';', 3853}, {'e', 3854}, {';', 3855}, {'k', 3856},
+    {';', 3857}, {';', 3858}, {'e', 3859}, {'l', 3860}, {';', 3861}, {'n', 3862}, {'i', 3863}, {'c', 3864},
+    {'s', 3865}, {'n', 3866}, {'a', 3867}, {';', 3868}, {'f', 3869}, {'l', 3870}, {';', 3871}, {'d', 3872},
+    {'n', 3873}, {';', 3874}, {'o', 3875}, {';', 3876}, {'s', 3877}, {'r', 3878}, {'s', 3879}, {';', 3880},
+    {';', 3881}, {'e', 3882}, {';', 3883}, {'e', 3884}, {'t', 3885}, {'r', 3886}, {'r', 3887}, {'c', 3888},
+    {'r', 3889}, {'r', 3890}, {'a', 3891}, {'u', 3892}, {'o', 3893}, {'r', 3894}, {';', 3895}, {'r', 3896},
+    {'y', 3897}, {'e', 3898}, {'e', 3899}, {'e', 3900}, {'d', 3901}, {'n', 3902}, {'t', 3903}, {'t', 3904},
+    {';', 3905}, {';', 3906}, {'e', 3907}, {'t', 3908}, {';', 3909}, {';', 3910}, {'v', 3911}, {'r', 3912},
+    {'c', 3913}, {'o', 3914}, {'g', 3915}, {'r', 3916}, {'s', 3917}, {'a', 3918}, {'t', 3919}, {'h', 3920},
+    {'l', 3921}, {'r', 3922}, {';', 3923}, {'o', 3924}, {'s', 3925}, {'m', 3926}, {'n', 3927}, {'d', 3928},
+    {'n', 3929}, {';', 3930}, {'r', 3931}, {'o', 3932}, {'a', 3933}, {';', 3934}, {'q', 3935}, {'i', 3936},
+    {'l', 3937}, {'q', 3938}, {'l', 3939}, {'a', 3940}, {'d', 3941}, {'h', 3942}, {'a', 3943}, {'r', 3944},
+    {'o', 3945}, {';', 3946}, {';', 3947}, {';', 3948}, {'o', 3949}, {'t', 3950}, {';', 3951}, {'f', 3952},
+    {'r', 3953}, {'r', 3954}, {'g', 3955}, {';', 3956}, {'r', 3957}, {'t', 3958}, {';', 3959}, {'t', 3960},
+    {'e', 3961}, {'o', 3962}, {';', 3963}, {'c', 3964}, {'o', 3965}, {';', 3966}, {'t', 3967}, {'v', 3968},
+    {'o', 3969}, {'t', 3970}, {'o', 3971}, {'r', 3972}, {'y', 3973}, {'1', 3974}, {';', 3975}, {';', 3976},
+    {'n', 3977}, {';', 3978}, {';', 3979}, {'s', 3980}, {'s', 3981}, {';', 3982}, {'l', 3983}, {'v', 3984},
+    {'r', 3985}, {'l', 3986}, {'m', 3987}, {'a', 3988}, {'l', 3989}, {'s', 3990}, {'v', 3991}, {'a', 3992},
+    {'t', 3993}, {'r', 3994}, {';', 3995}, {'t', 3996}, {';', 3997}, {';', 3998}, {';', 3999}, {';', 4000},
+    {'t', 4001}, {'c', 4002}, {'n', 4003}, {'i', 4004}, {'l', 4005}, {'i', 4006}, {'g', 4007}, {'i', 4008},
+    {'g', 4009}, {'g', 4010}, {';', 4011}, {'g', 4012}, {'s', 4013}, {';', 4014}, {';', 4015}, {'l', 4016},
+    {';', 4017}, {'v', 4018}, {'t', 4019}, {'1', 4020}, {'2', 4021}, {'3', 4022}, {'4', 4023}, {'5', 4024},
+    {'7', 4025}, {'l', 4026}, {'n', 4027}, {';', 4028}, {'t', 4029}, {'a', 4030}, {'v', 4031}, {'c', 4032},
+    {';', 4033}, {';', 4034}, {'l', 4035}, {'c', 4036}, {'o', 4037}, {';', 4038}, {'e', 4039}, {'l', 4040},
+    {';', 4041}, {';', 4042}, {'p', 4043}, {';', 4044}, {'q', 4045}, {'m', 4046}, {';', 4047}, {'e', 4048},
+    {';', 4049}, {';', 4050}, {'e', 4051}, {'l', 4052}, {';', 4053}, {'r', 4054}, {'t', 4055}, {'a', 4056},
+    {'e', 4057}, {'p', 4058}, {'r', 4059}, {'o', 4060}, {'q', 4061}, {'e', 4062}, {'i', 4063}, {'t', 4064},
+    {';', 4065}, {';', 4066}, {'s', 4067}, {';', 4068}, {'l', 4069}, {'c', 4070}, {';', 4071}, {'c', 4072},
+    {'w', 4073}, {';', 4074}, {'c', 4075}, {'t', 4076}, {'i', 4077}, {'o', 4078}, {'a', 4079}, {'a', 4080},
+    {'r', 4081}, {'h', 4082}, {'l', 4083}, {'r', 4084}, {';', 4085}, {'a', 4086}, {';', 4087}, {'s', 4088},
+    {'o', 4089}, {'l', 4090}, {'e', 4091}, {'t', 4092}, {'c', 4093}, {';', 4094}, {'l', 4095}, {'v', 4096},
+    {'n', 4097}, {'t', 4098}, {'i', 4099}, {'a', 4100}, {'g', 4101}, {'r', 4102}, {'e', 4103}, {'l', 4104},
+    {'p', 4105}, {'h', 4106}, {';', 4107}, {'d', 4108}, {'r', 4109}, {'n', 4110}, {'o', 4111}, {'a', 4112},
+    {'g', 4113}, {'r', 4114}, {'a', 4115}, {'r', 4116}, {';', 4117}, {'n', 4118}, {';', 4119}, {';', 4120},
+    {'d', 4121}, {'s', 4122}, {';', 4123}, {';', 4124}, {'E', 4125}, {'d', 4126}, {'s', 4127}, {'v', 4128},
+    {'d', 4129}, {'y', 4130}, {';', 4131}, {'c', 4132}, {'h', 4133}, {';', 4134}, {';', 4135}, {'c', 4136},
+    {'y', 4137}, {'a', 4138}, {'i', 4139}, {'e', 4140}, {';', 4141}, {';', 4142}, {';', 4143}, {';', 4144},
+    {'r', 4145}, {';', 4146}, {'i', 4147}, {'r', 4148}, {';', 4149}, {'t', 4150}, {'p', 4151}, {'a', 4152},
+    {'d', 4153}, {';', 4154}, {'d', 4155}, {'l', 4156}, {'o', 4157}, {';', 4158}, {'b', 4159}, {'f', 4160},
+    {'h', 4161}, {'l', 4162}, {'p', 4163}, {'s', 4164}, {'t', 4165}, {'i', 4166}, {';', 4167}, {'s', 4168},
+    {'r', 4169}, {'k', 4170}, {'c', 4171}, {'e', 4172}, {'s', 4173}, {'o', 4174}, {'i', 4175}, {'l', 4176},
+    {';', 4177}, {';', 4178}, {'o', 4179}, {'h', 4180}, {'s', 4181}, {';', 4182}, {'a', 4183}, {'h', 4184},
+    {'l', 4185}, {'r', 4186}, {'t', 4187}, {';', 4188}, {'l', 4189}, {'c', 4190}, {'o', 4191}, {';', 4192},
+    {'e', 4193}, {'a', 4194}, {'d', 4195}, {'e', 4196}, {'g', 4197}, {'s', 4198}, {'h', 4199}, {'o', 4200},
+    {'d', 4201}, {'u', 4202}, {'k', 4203}, {';', 4204}, {'r', 4205}, {'r', 4206}, {'r', 4207}, {'i', 4208},
+    {'o', 4209}, {'s', 4210}, {';', 4211}, {'p', 4212}, {';', 4213}, {'q', 4214}, {'m', 4215}, {'g', 4216},
+    {'r', 4217}, {'k', 4218}, {'l', 4219}, {'m', 4220}, {'r', 4221}, {'a', 4222}, {'r', 4223}, {';', 4224},
+    {'u', 4225}, {'m', 4226}, {'s', 4227}, {'a', 4228}, {'n', 4229}, {';', 4230}, {';', 4231}, {'l', 4232},
+    {'r', 4233}, {'r', 4234}, {'r', 4235}, {'i', 4236}, {'u', 4237}, {';', 4238}, {';', 4239}, {'e', 4240},
+    {'g', 4241}, {';', 4242}, {'o', 4243}, {'o', 4244}, {';', 4245}, {'r', 4246}, {'t', 4247}, {'e', 4248},
+    {'e', 4249}, {'r', 4250}, {'e', 4251}, {'a', 4252}, {';', 4253}, {'e', 4254}, {'f', 4255}, {'s', 4256},
+    {'h', 4257}, {'t', 4258}, {';', 4259}, {'t', 4260}, {';', 4261}, {';', 4262}, {';', 4263}, {'e', 4264},
+    {'t', 4265}, {'e', 4266}, {'m', 4267}, {'h', 4268}, {'u', 4269}, {'o', 4270}, {'s', 4271}, {'i', 4272},
+    {'o', 4273}, {'s', 4274}, {';', 4275}, {';', 4276}, {'u', 4277}, {'l', 4278}, {';', 4279}, {';', 4280},
+    {'o', 4281}, {'i', 4282}, {'p', 4283}, {';', 4284}, {'t', 4285}, {';', 4286}, {'h', 4287}, {'s', 4288},
+    {'s', 4289}, {'a', 4290}, {'t', 4291}, {';', 4292}, {';', 4293}, {'d', 4294}, {'s', 4295}, {'r', 4296},
+    {'r', 4297}, {';', 4298}, {'p', 4299}, {';', 4300}, {'o', 4301}, {'i', 4302}, {'g', 4303}, {';', 4304},
+    {'h', 4305}, {'r', 4306}, {'h', 4307}, {'r', 4308}, {'t', 4309}, {'i', 4310}, {'a', 4311}, {'m', 4312},
+    {'s', 4313}, {';', 4314}, {'q', 4315}, {'s', 4316}, {';', 4317}, {'m', 4318}, {';', 4319}, {'r', 4320},
+    {'r', 4321}, {'r', 4322}, {';', 4323}, {';', 4324}, {'r', 4325}, {'r', 4326}, {';', 4327}, {'t', 4328},
+    {';', 4329}, {'q', 4330}, {'s', 4331}, {';', 4332}, {'s', 4333}, {'m', 4334}, {'i', 4335}, {';', 4336},
+    {';', 4337}, {'n', 4338}, {'i', 4339}, {';', 4340}, {'a', 4341}, {'s', 4342}, {'t', 4343}, {'i', 4344},
+    {'u', 4345}, {';', 4346}, {'c', 4347}, {'r', 4348}, {'r', 4349}, {'h', 4350}, {'i', 4351}, {'u', 4352},
+    {';', 4353}, {';', 4354}, {'r', 4355}, {';', 4356}, {'e', 4357}, {'d', 4358}, {'r', 4359}, {'u', 4360},
+    {';', 4361}, {'E', 4362}, {'e', 4363}, {'s', 4364}, {'c', 4365}, {';', 4366}, {'E', 4367}, {'e', 4368},
+    {'s', 4369}, {';', 4370}, {'d', 4371}, {';', 4372}, {'a', 4373}, {'r', 4374}, {'p', 4375}, {'s', 4376},
+    {'r', 4377}, {';', 4378}, {'s', 4379}, {';', 4380}, {';', 4381}, {'f', 4382}, {'r', 4383}, {';', 4384},
+    {';', 4385}, {'r', 4386}, {'r', 4387}, {'r', 4388}, {'m', 4389}, {'r', 4390}, {'h', 4391}, {'r', 4392},
+    {'a', 4393}, {'t', 4394}, {';', 4395}, {';', 4396}, {'c', 4397}, {'h', 4398}, {'a', 4399}, {';', 4400},
+    {';', 4401}, {'l', 4402}, {'g', 4403}, {'r', 4404}, {';', 4405}, {'v', 4406}, {'r', 4407}, {';', 4408},
+    {'r', 4409}, {'r', 4410}, {'o', 4411}, {'e', 4412}, {'r', 4413}, {'a', 4414}, {'r', 4415}, {';', 4416},
+    {'u', 4417}, {';', 4418}, {';', 4419}, {'p', 4420}, {'s', 4421}, {'r', 4422}, {'r', 4423}, {';', 4424},
+    {';', 4425}, {'o', 4426}, {';', 4427}, {'o', 4428}, {';', 4429}, {'s', 4430}, {';', 4431}, {'d', 4432},
+    {'e', 4433}, {';', 4434}, {'r', 4435}, {';', 4436}, {'l', 4437}, {'i', 4438}, {'l', 4439}, {';', 4440},
+    {'n', 4441}, {'o', 4442}, {'i', 4443}, {';', 4444}, {'e', 4445}, {';', 4446}, {'a', 4447}, {'e', 4448},
+    {'h', 4449}, {'c', 4450}, {'k', 4451}, {';', 4452}, {'a', 4453}, {'b', 4454}, {'c', 4455}, {'d', 4456},
+    {'e', 4457}, {'m', 4458}, {'s', 4459}, {'t', 4460}, {'t', 4461}, {';', 4462}, {'d', 4463}, {';', 4464},
+    {'e', 4465}, {';', 4466}, {'a', 4467}, {'c', 4468}, {'e', 4469}, {'n', 4470}, {'s', 4471}, {'e', 4472},
+    {';', 4473}, {'p', 4474}, {'i', 4475}, {';', 4476}, {'a', 4477}, {'l', 4478}, {'s', 4479}, {';', 4480},
+    {'t', 4481}, {'m', 4482}, {'e', 4483}, {';', 4484}, {'s', 4485}, {';', 4486}, {';', 4487}, {'m', 4488},
+    {';', 4489}, {'e', 4490}, {'i', 4491}, {'t', 4492}, {';', 4493}, {'r', 4494}, {';', 4495}, {'i', 4496},
+    {'r', 4497}, {';', 4498}, {';', 4499}, {'t', 4500}, {'c', 4501}, {'p', 4502}, {';', 4503}, {'d', 4504},
+    {'e', 4505}, {'l', 4506}, {'o', 4507}, {';', 4508}, {'a', 4509}, {'b', 4510}, {'c', 4511}, {'f', 4512},
+    {'h', 4513}, {'l', 4514}, {'p', 4515}, {'s', 4516}, {'t', 4517}, {'w', 4518}, {'i', 4519}, {'o', 4520},
+    {'r', 4521}, {'k', 4522}, {'c', 4523}, {'e', 4524}, {'s', 4525}, {'o', 4526}, {'i', 4527}, {'l', 4528},
+    {';', 4529}, {';', 4530}, {'h', 4531}, {'o', 4532}, {';', 4533}, {';', 4534}, {'i', 4535}, {'p', 4536},
+    {'s', 4537}, {';', 4538}, {'h', 4539}, {'o', 4540}, {'d', 4541}, {'u', 4542}, {';', 4543}, {'t', 4544},
+    {';', 4545}, {'n', 4546}, {'r', 4547}, {'r', 4548}, {'s', 4549}, {'d', 4550}, {'g', 4551}, {'r', 4552},
+    {'k', 4553}, {'r', 4554}, {';', 4555}, {'u', 4556}, {'m', 4557}, {';', 4558}, {'g', 4559}, {'l', 4560},
+    {'r', 4561}, {'u', 4562}, {';', 4563}, {';', 4564}, {'o', 4565}, {'e', 4566}, {'e', 4567}, {';', 4568},
+    {'e', 4569}, {'f', 4570}, {'l', 4571}, {'h', 4572}, {'t', 4573}, {'o', 4574}, {';', 4575}, {'o', 4576},
+    {'e', 4577}, {'i', 4578}, {'c', 4579}, {';', 4580}, {'p', 4581}, {'i', 4582}, {'l', 4583}, {'m', 4584},
+    {';', 4585}, {'b', 4586}, {'e', 4587}, {'r', 4588}, {'h', 4589}, {'r', 4590}, {';', 4591}, {';', 4592},
+    {'a', 4593}, {'i', 4594}, {'n', 4595}, {';', 4596}, {'w', 4597}, {'p', 4598}, {'c', 4599}, {';', 4600},
+    {'t', 4601}, {'a', 4602}, {'o', 4603}, {';', 4604}, {'q', 4605}, {';', 4606}, {'E', 4607}, {';', 4608},
+    {'E', 4609}, {'e', 4610}, {'l', 4611}, {'a', 4612}, {'r', 4613}, {'l', 4614}, {'h', 4615}, {'a', 4616},
+    {';', 4617}, {'e', 4618}, {';', 4619}, {'s', 4620}, {'c', 4621}, {';', 4622}, {'a', 4623}, {';', 4624},
+    {'e', 4625}, {';', 4626}, {'p', 4627}, {'p', 4628}, {'b', 4629}, {'p', 4630}, {'r', 4631}, {';', 4632},
+    {'r', 4633}, {';', 4634}, {'m', 4635}, {'l', 4636}, {'r', 4637}, {';', 4638}, {'f', 4639}, {'i', 4640},
+    {'s', 4641}, {';', 4642}, {'o', 4643}, {';', 4644}, {'d', 4645}, {'u', 4646}, {'E', 4647}, {'e', 4648},
+    {'l', 4649}, {'a', 4650}, {'e', 4651}, {'i', 4652}, {'u', 4653}, {';', 4654}, {'a', 4655}, {'c', 4656},
+    {'e', 4657}, {'n', 4658}, {'s', 4659}, {';', 4660}, {';', 4661}, {';', 4662}, {';', 4663}, {';', 4664},
+    {'o', 4665}, {'s', 4666}, {';', 4667}, {'d', 4668}, {'s', 4669}, {'a', 4670}, {'u', 4671}, {'E', 4672},
+    {'e', 4673}, {'l', 4674}, {'e', 4675}, {'i', 4676}, {'u', 4677}, {'r', 4678}, {'h', 4679}, {'r', 4680},
+    {'a', 4681}, {'g', 4682}, {'e', 4683}, {';', 4684}, {'o', 4685}, {'i', 4686}, {';', 4687}, {'e', 4688},
+    {'e', 4689}, {'a', 4690}, {'k', 4691}, {'s', 4692}, {'p', 4693}, {'i', 4694}, {'n', 4695}, {'e', 4696},
+    {'s', 4697}, {';', 4698}, {';', 4699}, {'o', 4700}, {'i', 4701}, {';', 4702}, {'o', 4703}, {';', 4704},
+    {'m', 4705}, {'e', 4706}, {'n', 4707}, {'o', 4708}, {';', 4709}, {'i', 4710}, {'l', 4711}, {'b', 4712},
+    {'i', 4713}, {'z', 4714}, {';', 4715}, {';', 4716}, {'y', 4717}, {'o', 4718}, {'t', 4719}, {'e', 4720},
+    {';', 4721}, {';', 4722}, {'t', 4723}, {';', 4724}, {'y', 4725}, {'v', 4726}, {'c', 4727}, {'r', 4728},
+    {'a', 4729}, {'r', 4730}, {'h', 4731}, {'v', 4732}, {'l', 4733}, {'r', 4734}, {'k', 4735}, {'r', 4736},
+    {'o', 4737}, {'i', 4738}, {'r', 4739}, {'n', 4740}, {';', 4741}, {'r', 4742}, {'w', 4743}, {'r', 4744},
+    {'s', 4745}, {';', 4746}, {'h', 4747}, {'l', 4748}, {'a', 4749}, {'r', 4750}, {'o', 4751}, {'g', 4752},
+    {'i', 4753}, {';', 4754}, {'t', 4755}, {'d', 4756}, {';', 4757}, {'f', 4758}, {'r', 4759}, {';', 4760},
+    {'g', 4761}, {';', 4762}, {';', 4763}, {'v', 4764}, {'h', 4765}, {'r', 4766}, {'p', 4767}, {'a', 4768},
+    {'o', 4769}, {'h', 4770}, {'i', 4771}, {'r', 4772}, {';', 4773}, {'h', 4774}, {'i', 4775}, {'u', 4776},
+    {'h', 4777}, {'r', 4778}, {'h', 4779}, {'a', 4780}, {'q', 4781}, {'i', 4782}, {'a', 4783}, {';', 4784},
+    {'i', 4785}, {'b', 4786}, {'p', 4787}, {';', 4788}, {'p', 4789}, {'i', 4790}, {';', 4791}, {'n', 4792},
+    {'n', 4793}, {'z', 4794}, {'c', 4795}, {'a', 4796}, {'e', 4797}, {'r', 4798}, {';', 4799}, {'t', 4800},
+    {';', 4801}, {';', 4802}, {'c', 4803}, {';', 4804}, {'i', 4805}, {'r', 4806}, {'r', 4807}, {'r', 4808},
+    {'r', 4809}, {';', 4810}, {';', 4811}, {'t', 4812}, {';', 4813}, {'u', 4814}, {'m', 4815}, {'r', 4816},
+    {'r', 4817}, {';', 4818}, {'u', 4819}, {'u', 4820}, {'i', 4821}, {';', 4822}, {'g', 4823}, {'t', 4824},
+    {';', 4825}, {'c', 4826}, {';', 4827}, {';', 4828}, {';', 4829}, {';', 4830}, {';', 4831}, {'t', 4832},
+    {'o', 4833}, {';', 4834}, {'r', 4835}, {';', 4836}, {';', 4837}, {'a', 4838}, {';', 4839}, {';', 4840},
+    {';', 4841}, {';', 4842}, {'e', 4843}, {'e', 4844}, {';', 4845}, {'e', 4846}, {';', 4847}, {';', 4848},
+    {';', 4849}, {'F', 4850}, {';', 4851}, {'n', 4852}, {'e', 4853}, {'l', 4854}, {'d', 4855}, {'s', 4856},
+    {'u', 4857}, {';', 4858}, {'q', 4859}, {'e', 4860}, {'a', 4861}, {'y', 4862}, {'n', 4863}, {'l', 4864},
+    {';', 4865}, {'n', 4866}, {'l', 4867}, {'r', 4868}, {'e', 4869}, {'w', 4870}, {'C', 4871}, {';', 4872},
+    {'e', 4873}, {'u', 4874}, {'t', 4875}, {'u', 4876}, {'d', 4877}, {'e', 4878}, {';', 4879}, {'p', 4880},
+    {'a', 4881}, {'r', 4882}, {';', 4883}, {'n', 4884}, {';', 4885}, {'i', 4886}, {'n', 4887}, {'r', 4888},
+    {'t', 4889}, {'u', 4890}, {'e', 4891}, {'r', 4892}, {'r', 4893}, {'e', 4894}, {'i', 4895}, {'e', 4896},
+    {'r', 4897}, {'k', 4898}, {'e', 4899}, {'n', 4900}, {';', 4901}, {'e', 4902}, {'n', 4903}, {';', 4904},
+    {'S', 4905}, {'V', 4906}, {';', 4907}, {'o', 4908}, {';', 4909}, {'T', 4910}, {'i', 4911}, {'s', 4912},
+    {'e', 4913}, {'d', 4914}, {'l', 4915}, {'e', 4916}, {';', 4917}, {'d', 4918}, {'e', 4919}, {'l', 4920},
+    {';', 4921}, {'e', 4922}, {'y', 4923}, {';', 4924}, {';', 4925}, {'r', 4926}, {'o', 4927}, {'k', 4928},
+    {'o', 4929}, {'q', 4930}, {';', 4931}, {'e', 4932}, {';', 4933}, {'e', 4934}, {';', 4935}, {'n', 4936},
+    {'e', 4937}, {'r', 4938}, {'s', 4939}, {'i', 4940}, {';', 4941}, {'e', 4942}, {';', 4943}, {';', 4944},
+    {'y', 4945}, {';', 4946}, {';', 4947}, {'l', 4948}, {'e', 4949}, {'a', 4950}, {'c', 4951}, {'n', 4952},
+    {'l', 4953}, {'n', 4954}, {'r', 4955}, {'e', 4956}, {'o', 4957}, {'l', 4958}, {'i', 4959}, {'e', 4960},
+    {'r', 4961}, {'p', 4962}, {'e', 4963}, {'r', 4964}, {'i', 4965}, {'q', 4966}, {'u', 4967}, {'r', 4968},
+    {'e', 4969}, {'l', 4970}, {'i', 4971}, {'a', 4972}, {'t', 4973}, {'e', 4974}, {'i', 4975}, {'e', 4976},
+    {'i', 4977}, {'L', 4978}, {'R', 4979}, {'k', 4980}, {'m', 4981}, {'n', 4982}, {'P', 4983}, {'e', 4984},
+    {'n', 4985}, {'l', 4986}, {'i', 4987}, {'d', 4988}, {'n', 4989}, {'a', 4990}, {'e', 4991}, {'n', 4992},
+    {'p', 4993}, {'u', 4994}, {'e', 4995}, {'u', 4996}, {'i', 4997}, {'e', 4998}, {'m', 4999}, {'f', 5000},
+    {'s', 5001}, {'s', 5002}, {'e', 5003}, {'v', 5004}, {'g', 5005}, {'u', 5006}, {'b', 5007}, {'c', 5008},
+    {'p', 5009}, {'l', 5010}, {'r', 5011}, {'e', 5012}, {';', 5013}, {'e', 5014}, {';', 5015}, {'c', 5016},
+    {'e', 5017}, {';', 5018}, {';', 5019}, {'o', 5020}, {'u', 5021}, {'h', 5022}, {'e', 5023}, {'s', 5024},
+    {'a', 5025}, {'r', 5026}, {'a', 5027}, {'a', 5028}, {'i', 5029}, {'a', 5030}, {'d', 5031}, {';', 5032},
+    {'c', 5033}, {'r', 5034}, {';', 5035}, {'e', 5036}, {'l', 5037}, {'n', 5038}, {'l', 5039}, {'s', 5040},
+    {'A', 5041}, {'C', 5042}, {'D', 5043}, {'F', 5044}, {'T', 5045}, {'U', 5046}, {'V', 5047}, {'a', 5048},
+    {'I', 5049}, {'t', 5050}, {'e', 5051}, {'y', 5052}, {'y', 5053}, {'e', 5054}, {'n', 5055}, {'l', 5056},
+    {';', 5057}, {'D', 5058}, {'L', 5059}, {'R', 5060}, {'U', 5061}, {';', 5062}, {'C', 5063}, {'e', 5064},
+    {'t', 5065}, {'e', 5066}, {'h', 5067}, {'s', 5068}, {'t', 5069}, {';', 5070}, {';', 5071}, {';', 5072},
+    {'n', 5073}, {'l', 5074}, {'f', 5075}, {';', 5076}, {'S', 5077}, {'p', 5078}, {';', 5079}, {'E', 5080},
+    {'F', 5081}, {'T', 5082}, {'e', 5083}, {'k', 5084}, {'e', 5085}, {'c', 5086}, {';', 5087}, {'e', 5088},
+    {';', 5089}, {'c', 5090}, {'e', 5091}, {';', 5092}, {'B', 5093}, {'P', 5094}, {';', 5095}, {'P', 5096},
+    {';', 5097}, {'o', 5098}, {'n', 5099}, {'i', 5100}, {';', 5101}, {'A', 5102}, {'o', 5103}, {'n', 5104},
+    {'L', 5105}, {'R', 5106}, {'o', 5107}, {';', 5108}, {'e', 5109}, {';', 5110}, {';', 5111}, {'l', 5112},
+    {'r', 5113}, {'c', 5114}, {'h', 5115}, {'h', 5116}, {';', 5117}, {';', 5118}, {'e', 5119}, {';', 5120},
+    {'e', 5121}, {'n', 5122}, {'i', 5123}, {'e', 5124}, {'e', 5125}, {';', 5126}, {';', 5127}, {';', 5128},
+    {'e', 5129}, {'y', 5130}, {';', 5131}, {';', 5132}, {';', 5133}, {';', 5134}, {'d', 5135}, {'o', 5136},
+    {';', 5137}, {'d', 5138}, {';', 5139}, {'v', 5140}, {'h', 5141}, {';', 5142}, {'r', 5143}, {';', 5144},
+    {'r', 5145}, {'x', 5146}, {';', 5147}, {';', 5148}, {'e', 5149}, {'e', 5150}, {'i', 5151}, {';', 5152},
+    {'o', 5153}, {'p', 5154}, {'r', 5155}, {'i', 5156}, {'e', 5157}, {'d', 5158}, {'b', 5159}, {';', 5160},
+    {';', 5161}, {'s', 5162}, {'y', 5163}, {';', 5164}, {'u', 5165}, {'e', 5166}, {'p', 5167}, {'r', 5168},
+    {'p', 5169}, {'o', 5170}, {'l', 5171}, {'i', 5172}, {'c', 5173}, {'a', 5174}, {'i', 5175}, {'l', 5176},
+    {'e', 5177}, {'d', 5178}, {'w', 5179}, {'l', 5180}, {'s', 5181}, {'t', 5182}, {';', 5183}, {';', 5184},
+    {';', 5185}, {';', 5186}, {';', 5187}, {'i', 5188}, {'m', 5189}, {'e', 5190}, {';', 5191}, {';', 5192},
+    {';', 5193}, {';', 5194}, {';', 5195}, {';', 5196}, {';', 5197}, {';', 5198}, {';', 5199}, {';', 5200},
+    {';', 5201}, {';', 5202}, {';', 5203}, {';', 5204}, {';', 5205}, {';', 5206}, {';', 5207}, {';', 5208},
+    {'x', 5209}, {';', 5210}, {';', 5211}, {';', 5212}, {';', 5213}, {';', 5214}, {';', 5215}, {';', 5216},
+    {';', 5217}, {'n', 5218}, {'u', 5219}, {'m', 5220}, {';', 5221}, {';', 5222}, {';', 5223}, {';', 5224},
+    {';', 5225}, {';', 5226}, {';', 5227}, {';', 5228}, {';', 5229}, {';', 5230}, {'e', 5231}, {';', 5232},
+    {'r', 5233}, {';', 5234}, {';', 5235}, {';', 5236}, {'s', 5237}, {'t', 5238}, {';', 5239}, {';', 5240},
+    {'q', 5241}, {'e', 5242}, {'d', 5243}, {'c', 5244}, {'p', 5245}, {'p', 5246}, {'t', 5247}, {';', 5248},
+    {';', 5249}, {';', 5250}, {'n', 5251}, {'l', 5252}, {';', 5253}, {';', 5254}, {'s', 5255}, {';', 5256},
+    {'y', 5257}, {'r', 5258}, {';', 5259}, {'m', 5260}, {'q', 5261}, {'e', 5262}, {'i', 5263}, {'d', 5264},
+    {'i', 5265}, {';', 5266}, {'u', 5267}, {';', 5268}, {'e', 5269}, {';', 5270}, {'t', 5271}, {'n', 5272},
+    {'e', 5273}, {'o', 5274}, {'t', 5275}, {'d', 5276}, {'r', 5277}, {';', 5278}, {';', 5279}, {';', 5280},
+    {';', 5281}, {';', 5282}, {'r', 5283}, {';', 5284}, {';', 5285}, {'r', 5286}, {'c', 5287}, {'p', 5288},
+    {'p', 5289}, {'t', 5290}, {';', 5291}, {'r', 5292}, {'e', 5293}, {'v', 5294}, {'w', 5295}, {'n', 5296},
+    {'a', 5297}, {';', 5298}, {';', 5299}, {'i', 5300}, {';', 5301}, {'y', 5302}, {'r', 5303}, {'h', 5304},
+    {';', 5305}, {'o', 5306}, {';', 5307}, {'n', 5308}, {'e', 5309}, {';', 5310}, {'e', 5311}, {';', 5312},
+    {'y', 5313}, {'t', 5314}, {';', 5315}, {';', 5316}, {'n', 5317}, {';', 5318}, {'m', 5319}, {';', 5320},
+    {'e', 5321}, {'x', 5322}, {'n', 5323}, {'p', 5324}, {'r', 5325}, {';', 5326}, {'d', 5327}, {'n', 5328},
+    {'u', 5329}, {'u', 5330}, {'e', 5331}, {'r', 5332}, {'o', 5333}, {'a', 5334}, {'r', 5335}, {'n', 5336},
+    {'p', 5337}, {'k', 5338}, {';', 5339}, {';', 5340}, {';', 5341}, {';', 5342}, {'l', 5343}, {'a', 5344},
+    {';', 5345}, {'e', 5346}, {'r', 5347}, {'n', 5348}, {';', 5349}, {'n', 5350}, {';', 5351}, {'e', 5352},
+    {'t', 5353}, {'e', 5354}, {'t', 5355}, {';', 5356}, {';', 5357}, {'s', 5358}, {'v', 5359}, {'3', 5360},
+    {'4', 5361}, {';', 5362}, {'l', 5363}, {';', 5364}, {'o', 5365}, {';', 5366}, {'c', 5367}, {'o', 5368},
+    {';', 5369}, {'n', 5370}, {'s', 5371}, {'t', 5372}, {';', 5373}, {'D', 5374}, {'r', 5375}, {';', 5376},
+    {';', 5377}, {';', 5378}, {';', 5379}, {'t', 5380}, {'e', 5381}, {'n', 5382}, {'e', 5383}, {'g', 5384},
+    {';', 5385}, {'g', 5386}, {';', 5387}, {';', 5388}, {';', 5389}, {';', 5390}, {'l', 5391}, {';', 5392},
+    {'i', 5393}, {'2', 5394}, {'3', 5395}, {'4', 5396}, {'5', 5397}, {'6', 5398}, {'8', 5399}, {'3', 5400},
+    {'5', 5401}, {'4', 5402}, {'5', 5403}, {'8', 5404}, {'5', 5405}, {'6', 5406}, {'8', 5407}, {'8', 5408},
+    {';', 5409}, {';', 5410}, {'e', 5411}, {';', 5412}, {'d', 5413}, {'e', 5414}, {';', 5415}, {'a', 5416},
+    {';', 5417}, {'t', 5418}, {'s', 5419}, {';', 5420}, {'r', 5421}, {';', 5422}, {';', 5423}, {';', 5424},
+    {';', 5425}, {';', 5426}, {';', 5427}, {';', 5428}, {'r', 5429}, {'s', 5430}, {'p', 5431}, {'r', 5432},
+    {'t', 5433}, {'l', 5434}, {'q', 5435}, {'s', 5436}, {'m', 5437}, {'n', 5438}, {'p', 5439}, {'t', 5440},
+    {'y', 5441}, {'i', 5442}, {';', 5443}, {';', 5444}, {'s', 5445}, {'p', 5446}, {'n', 5447}, {'r', 5448},
+    {'r', 5449}, {';', 5450}, {'t', 5451}, {'e', 5452}, {'i', 5453}, {'r', 5454}, {'h', 5455}, {'k', 5456},
+    {'l', 5457}, {'n', 5458}, {'e', 5459}, {';', 5460}, {';', 5461}, {'e', 5462}, {'t', 5463}, {';', 5464},
+    {'n', 5465}, {';', 5466}, {';', 5467}, {';', 5468}, {';', 5469}, {'i', 5470}, {'a', 5471}, {';', 5472},
+    {';', 5473}, {'e', 5474}, {';', 5475}, {'t', 5476}, {'t', 5477}, {'l', 5478}, {'e', 5479}, {'c', 5480},
+    {'r', 5481}, {'o', 5482}, {';', 5483}, {';', 5484}, {'t', 5485}, {';', 5486}, {'o', 5487}, {';', 5488},
+    {'v', 5489}, {';', 5490}, {'e', 5491}, {';', 5492}, {';', 5493}, {';', 5494}, {'y', 5495}, {';', 5496},
+    {';', 5497}, {'v', 5498}, {'l', 5499}, {'n', 5500}, {';', 5501}, {'l', 5502}, {';', 5503}, {'e', 5504},
+    {'t', 5505}, {'n', 5506}, {'a', 5507}, {';', 5508}, {'e', 5509}, {';', 5510}, {';', 5511}, {'f', 5512},
+    {'s', 5513}, {'k', 5514}, {'p', 5515}, {'l', 5516}, {'i', 5517}, {'l', 5518}, {'l', 5519}, {';', 5520},
+    {';', 5521}, {';', 5522}, {'e', 5523}, {'k', 5524}, {';', 5525}, {'l', 5526}, {'n', 5527}, {'l', 5528},
+    {';', 5529}, {';', 5530}, {'r', 5531}, {'a', 5532}, {'h', 5533}, {'r', 5534}, {'a', 5535}, {'e', 5536},
+    {'i', 5537}, {'h', 5538}, {'a', 5539}, {';', 5540}, {'t', 5541}, {'s', 5542}, {'p', 5543}, {'o', 5544},
+    {'q', 5545}, {'t', 5546}, {'i', 5547}, {'t', 5548}, {'r', 5549}, {';', 5550}, {';', 5551}, {'l', 5552},
+    {';', 5553}, {';', 5554}, {'n', 5555}, {'d', 5556}, {';', 5557}, {'t', 5558}, {'t', 5559}, {'r', 5560},
+    {';', 5561}, {';', 5562}, {';', 5563}, {';', 5564}, {';', 5565}, {'e', 5566}, {'a', 5567}, {'i', 5568},
+    {'r', 5569}, {';', 5570}, {'s', 5571}, {'e', 5572}, {'t', 5573}, {'r', 5574}, {'g', 5575}, {'t', 5576},
+    {';', 5577}, {'n', 5578}, {';', 5579}, {'d', 5580}, {';', 5581}, {'o', 5582}, {';', 5583}, {';', 5584},
+    {';', 5585}, {'r', 5586}, {'k', 5587}, {';', 5588}, {';', 5589}, {'e', 5590}, {'s', 5591}, {'r', 5592},
+    {'s', 5593}, {'r', 5594}, {';', 5595}, {';', 5596}, {'h', 5597}, {'a', 5598}, {'n', 5599}, {';', 5600},
+    {'s', 5601}, {'o', 5602}, {'r', 5603}, {'a', 5604}, {';', 5605}, {'r', 5606}, {';', 5607}, {'t', 5608},
+    {'r', 5609}, {'t', 5610}, {';', 5611}, {'b', 5612}, {'d', 5613}, {'s', 5614}, {'s', 5615}, {'s', 5616},
+    {'m', 5617}, {';', 5618}, {'a', 5619}, {'r', 5620}, {'t', 5621}, {'h', 5622}, {'h', 5623}, {';', 5624},
+    {'e', 5625}, {';', 5626}, {';', 5627}, {'o', 5628}, {';', 5629}, {'a', 5630}, {';', 5631}, {'e', 5632},
+    {'n', 5633}, {'l', 5634}, {';', 5635}, {'d', 5636}, {';', 5637}, {';', 5638}, {'k', 5639}, {';', 5640},
+    {'o', 5641}, {';', 5642}, {'v', 5643}, {'r', 5644}, {';', 5645}, {'t', 5646}, {';', 5647}, {'l', 5648},
+    {';', 5649}, {';', 5650}, {';', 5651}, {';', 5652}, {';', 5653}, {';', 5654}, {'a', 5655}, {'r', 5656},
+    {';', 5657}, {'l', 5658}, {';', 5659}, {';', 5660}, {';', 5661}, {'e', 5662}, {';', 5663}, {'E', 5664},
+    {'d', 5665}, {'v', 5666}, {';', 5667}, {'v', 5668}, {'l', 5669}, {'l', 5670}, {';', 5671}, {'n', 5672},
+    {'e', 5673}, {';', 5674}, {'e', 5675}, {';', 5676}, {';', 5677}, {'c', 5678}, {'w', 5679}, {'t', 5680},
+    {';', 5681}, {'e', 5682}, {'e', 5683}, {'t', 5684}, {';', 5685}, {'q', 5686}, {';', 5687}, {';', 5688},
+    {'b', 5689}, {'p', 5690}, {';', 5691}, {';', 5692}, {'e', 5693}, {';', 5694}, {'e', 5695}, {';', 5696},
+    {';', 5697}, {'e', 5698}, {'e', 5699}, {'n', 5700}, {'o', 5701}, {';', 5702}, {'h', 5703}, {'r', 5704},
+    {'h', 5705}, {'i', 5706}, {'r', 5707}, {'i', 5708}, {'r', 5709}, {'i', 5710}, {';', 5711}, {';', 5712},
+    {'k', 5713}, {';', 5714}, {'o', 5715}, {'r', 5716}, {'e', 5717}, {';', 5718}, {';', 5719}, {'c', 5720},
+    {'d', 5721}, {';', 5722}, {';', 5723}, {'e', 5724}, {';', 5725}, {';', 5726}, {';', 5727}, {'s', 5728},
+    {';', 5729}, {';', 5730}, {';', 5731}, {'o', 5732}, {'s', 5733}, {';', 5734}, {';', 5735}, {';', 5736},
+    {';', 5737}, {'o', 5738}, {'f', 5739}, {'p', 5740}, {'h', 5741}, {'e', 5742}, {'s', 5743}, {';', 5744},
+    {'l', 5745}, {'m', 5746}, {';', 5747}, {'t', 5748}, {'d', 5749}, {'l', 5750}, {'n', 5751}, {'t', 5752},
+    {';', 5753}, {'f', 5754}, {'k', 5755}, {'v', 5756}, {'c', 5757}, {';', 5758}, {'i', 5759}, {'o', 5760},
+    {'u', 5761}, {';', 5762}, {'n', 5763}, {'i', 5764}, {'w', 5765}, {'i', 5766}, {';', 5767}, {';', 5768},
+    {'p', 5769}, {'u', 5770}, {'q', 5771}, {'a', 5772}, {'e', 5773}, {'s', 5774}, {'i', 5775}, {';', 5776},
+    {'s', 5777}, {';', 5778}, {'m', 5779}, {'l', 5780}, {'i', 5781}, {'u', 5782}, {'o', 5783}, {';', 5784},
+    {'l', 5785}, {'p', 5786}, {'e', 5787}, {'r', 5788}, {'n', 5789}, {';', 5790}, {'e', 5791}, {';', 5792},
+    {'l', 5793}, {';', 5794}, {'e', 5795}, {';', 5796}, {'t', 5797}, {';', 5798}, {';', 5799}, {'e', 5800},
+    {';', 5801}, {'p', 5802}, {';', 5803}, {'f', 5804}, {';', 5805}, {'s', 5806}, {'k', 5807}, {'p', 5808},
+    {'l', 5809}, {'i', 5810}, {'l', 5811}, {';', 5812}, {'l', 5813}, {';', 5814}, {'n', 5815}, {';', 5816},
+    {';', 5817}, {'e', 5818}, {'k', 5819}, {';', 5820}, {'l', 5821}, {'n', 5822}, {'l', 5823}, {';', 5824},
+    {'a', 5825}, {';', 5826}, {'r', 5827}, {'n', 5828}, {'a', 5829}, {';', 5830}, {'t', 5831}, {'r', 5832},
+    {';', 5833}, {';', 5834}, {'l', 5835}, {'a', 5836}, {'h', 5837}, {'l', 5838}, {'r', 5839}, {'s', 5840},
+    {'t', 5841}, {'g', 5842}, {';', 5843}, {';', 5844}, {'t', 5845}, {';', 5846}, {';', 5847}, {';', 5848},
+    {';', 5849}, {';', 5850}, {'s', 5851}, {'e', 5852}, {'t', 5853}, {'i', 5854}, {';', 5855}, {'o', 5856},
+    {';', 5857}, {'r', 5858}, {'e', 5859}, {'s', 5860}, {';', 5861}, {';', 5862}, {'t', 5863}, {'a', 5864},
+    {'e', 5865}, {';', 5866}, {'n', 5867}, {';', 5868}, {'l', 5869}, {';', 5870}, {';', 5871}, {'m', 5872},
+    {'i', 5873}, {';', 5874}, {';', 5875}, {';', 5876}, {';', 5877}, {'k', 5878}, {';', 5879}, {'o', 5880},
+    {'r', 5881}, {'n', 5882}, {';', 5883}, {'n', 5884}, {';', 5885}, {'y', 5886}, {'m', 5887}, {'p', 5888},
+    {';', 5889}, {'f', 5890}, {'v', 5891}, {'t', 5892}, {';', 5893}, {';', 5894}, {';', 5895}, {';', 5896},
+    {'u', 5897}, {'r', 5898}, {';', 5899}, {'s', 5900}, {'p', 5901}, {'r', 5902}, {';', 5903}, {';', 5904},
+    {'y', 5905}, {'r', 5906}, {'s', 5907}, {';', 5908}, {'s', 5909}, {';', 5910}, {'s', 5911}, {';', 5912},
+    {'e', 5913}, {'s', 5914}, {';', 5915}, {'e', 5916}, {'s', 5917}, {'e', 5918}, {'f', 5919}, {';', 5920},
+    {'n', 5921}, {'e', 5922}, {'f', 5923}, {';', 5924}, {'g', 5925}, {';', 5926}, {'t', 5927}, {'o', 5928},
+    {'l', 5929}, {';', 5930}, {';', 5931}, {'u', 5932}, {'r', 5933}, {'t', 5934}, {'m', 5935}, {'b', 5936},
+    {'p', 5937}, {'p', 5938}, {'u', 5939}, {'q', 5940}, {'a', 5941}, {'e', 5942}, {'s', 5943}, {'i', 5944},
+    {'t', 5945}, {'u', 5946}, {'o', 5947}, {'o', 5948}, {'u', 5949}, {'r', 5950}, {'l', 5951}, {';', 5952},
+    {';', 5953}, {'u', 5954}, {'t', 5955}, {'m', 5956}, {'b', 5957}, {'p', 5958}, {';', 5959}, {'k', 5960},
+    {';', 5961}, {'o', 5962}, {'r', 5963}, {';', 5964}, {'t', 5965}, {'n', 5966}, {'l', 5967}, {'c', 5968},
+    {'4', 5969}, {'f', 5970}, {';', 5971}, {'s', 5972}, {'v', 5973}, {'a', 5974}, {'s', 5975}, {'p', 5976},
+    {';', 5977}, {'m', 5978}, {';', 5979}, {';', 5980}, {';', 5981}, {'b', 5982}, {'d', 5983}, {'t', 5984},
+    {'r', 5985}, {'r', 5986}, {'e', 5987}, {';', 5988}, {'g', 5989}, {'t', 5990}, {'n', 5991}, {'u', 5992},
+    {';', 5993}, {'m', 5994}, {'i', 5995}, {';', 5996}, {'k', 5997}, {';', 5998}, {'a', 5999}, {'e', 6000},
+    {';', 6001}, {'e', 6002}, {';', 6003}, {';', 6004}, {'c', 6005}, {';', 6006}, {'t', 6007}, {'e', 6008},
+    {';', 6009}, {';', 6010}, {';', 6011}, {'n', 6012}, {'p', 6013}, {';', 6014}, {';', 6015}, {';', 6016},
+    {'o', 6017}, {'n', 6018}, {'p', 6019}, {';', 6020}, {';', 6021}, {'o', 6022}, {'r', 6023}, {'n', 6024},
+    {'p', 6025}, {';', 6026}, {';', 6027}, {';', 6028}, {'e', 6029}, {';', 6030}, {';', 6031}, {'l', 6032},
+    {';', 6033}, {';', 6034}, {'t', 6035}, {'s', 6036}, {'p', 6037}, {'t', 6038}, {'i', 6039}, {';', 6040},
+    {'o', 6041}, {'o', 6042}, {'g', 6043}, {'b', 6044}, {'p', 6045}, {'e', 6046}, {'i', 6047}, {';', 6048},
+    {'r', 6049}, {';', 6050}, {'p', 6051}, {'r', 6052}, {';', 6053}, {';', 6054}, {';', 6055}, {';', 6056},
+    {';', 6057}, {'E', 6058}, {'e', 6059}, {'E', 6060}, {'e', 6061}, {'a', 6062}, {';', 6063}, {'r', 6064},
+    {';', 6065}, {'q', 6066}, {'p', 6067}, {'h', 6068}, {';', 6069}, {';', 6070}, {';', 6071}, {';', 6072},
+    {';', 6073}, {';', 6074}, {';', 6075}, {'s', 6076}, {'e', 6077}, {';', 6078}, {';', 6079}, {'p', 6080},
+    {'s', 6081}, {';', 6082}, {'e', 6083}, {'e', 6084}, {';', 6085}, {'e', 6086}, {'n', 6087}, {'f', 6088},
+    {'r', 6089}, {';', 6090}, {';', 6091}, {';', 6092}, {'u', 6093}, {';', 6094}, {';', 6095}, {'a', 6096},
+    {';', 6097}, {'e', 6098}, {'l', 6099}, {';', 6100}, {';', 6101}, {'l', 6102}, {'s', 6103}, {';', 6104},
+    {';', 6105}, {'t', 6106}, {'a', 6107}, {'D', 6108}, {'D', 6109}, {'M', 6110}, {'P', 6111}, {'T', 6112},
+    {'i', 6113}, {'u', 6114}, {';', 6115}, {'e', 6116}, {';', 6117}, {'r', 6118}, {'u', 6119}, {'r', 6120},
+    {';', 6121}, {'h', 6122}, {';', 6123}, {';', 6124}, {'t', 6125}, {'d', 6126}, {'e', 6127}, {';', 6128},
+    {'a', 6129}, {'C', 6130}, {'D', 6131}, {'L', 6132}, {'R', 6133}, {'U', 6134}, {'V', 6135}, {'r', 6136},
+    {'e', 6137}, {'f', 6138}, {'g', 6139}, {'e', 6140}, {'r', 6141}, {';', 6142}, {';', 6143}, {';', 6144},
+    {';', 6145}, {'t', 6146}, {'m', 6147}, {'e', 6148}, {'n', 6149}, {'i', 6150}, {'b', 6151}, {';', 6152},
+    {'n', 6153}, {'S', 6154}, {'V', 6155}, {';', 6156}, {'r', 6157}, {';', 6158}, {';', 6159}, {';', 6160},
+    {'r', 6161}, {';', 6162}, {'t', 6163}, {'n', 6164}, {';', 6165}, {'w', 6166}, {'u', 6167}, {';', 6168},
+    {';', 6169}, {'a', 6170}, {'s', 6171}, {'a', 6172}, {'e', 6173}, {'b', 6174}, {';', 6175}, {';', 6176},
+    {';', 6177}, {';', 6178}, {';', 6179}, {'e', 6180}, {';', 6181}, {';', 6182}, {'g', 6183}, {'r', 6184},
+    {'i', 6185}, {'u', 6186}, {'w', 6187}, {'o', 6188}, {'g', 6189}, {'e', 6190}, {'i', 6191}, {'D', 6192},
+    {'T', 6193}, {'V', 6194}, {'c', 6195}, {'r', 6196}, {'g', 6197}, {'u', 6198}, {'l', 6199}, {'e', 6200},
+    {'s', 6201}, {'a', 6202}, {'l', 6203}, {'r', 6204}, {';', 6205}, {'f', 6206}, {'g', 6207}, {'f', 6208},
+    {'g', 6209}, {'e', 6210}, {'i', 6211}, {';', 6212}, {'S', 6213}, {'t', 6214}, {'l', 6215}, {';', 6216},
+    {';', 6217}, {';', 6218}, {'v', 6219}, {'G', 6220}, {'L', 6221}, {'e', 6222}, {'k', 6223}, {'a', 6224},
+    {'g', 6225}, {'C', 6226}, {'b', 6227}, {'m', 6228}, {'a', 6229}, {'s', 6230}, {'a', 6231}, {'p', 6232},
+    {'t', 6233}, {'s', 6234}, {'t', 6235}, {'c', 6236}, {'e', 6237}, {'h', 6238}, {'a', 6239}, {'s', 6240},
+    {'c', 6241}, {'e', 6242}, {'d', 6243}, {'t', 6244}, {';', 6245}, {';', 6246}, {';', 6247}, {';', 6248},
+    {'n', 6249}, {'r', 6250}, {';', 6251}, {';', 6252}, {';', 6253}, {'r', 6254}, {'a', 6255}, {'r', 6256},
+    {'l', 6257}, {'n', 6258}, {'r', 6259}, {'e', 6260}, {'t', 6261}, {'t', 6262}, {';', 6263}, {';', 6264},
+    {';', 6265}, {';', 6266}, {'e', 6267}, {'n', 6268}, {'r', 6269}, {'e', 6270}, {'o', 6271}, {'l', 6272},
+    {'e', 6273}, {'r', 6274}, {'p', 6275}, {'e', 6276}, {'r', 6277}, {'m', 6278}, {'a', 6279}, {'l', 6280},
+    {';', 6281}, {';', 6282}, {';', 6283}, {';', 6284}, {';', 6285}, {'o', 6286}, {'e', 6287}, {'i', 6288},
+    {'p', 6289}, {'i', 6290}, {';', 6291}, {'I', 6292}, {'S', 6293}, {'U', 6294}, {';', 6295}, {'E', 6296},
+    {'d', 6297}, {'a', 6298}, {'e', 6299}, {';', 6300}, {';', 6301}, {';', 6302}, {'o', 6303}, {'p', 6304},
+    {'a', 6305}, {'q', 6306}, {'u', 6307}, {'i', 6308}, {'D', 6309}, {';', 6310}, {';', 6311}, {'i', 6312},
+    {';', 6313}, {';', 6314}, {';', 6315}, {'a', 6316}, {'r', 6317}, {'a', 6318}, {'l', 6319}, {'w', 6320},
+    {'A', 6321}, {'l', 6322}, {'r', 6323}, {'w', 6324}, {'a', 6325}, {'e', 6326}, {'i', 6327}, {'n', 6328},
+    {';', 6329}, {';', 6330}, {';', 6331}, {'a', 6332}, {'i', 6333}, {';', 6334}, {';', 6335}, {';', 6336},
+    {';', 6337}, {'d', 6338}, {';', 6339}, {';', 6340}, {';', 6341}, {'m', 6342}, {';', 6343}, {'p', 6344},
+    {';', 6345}, {'a', 6346}, {'b', 6347}, {';', 6348}, {'r', 6349}, {';', 6350}, {';', 6351}, {'e', 6352},
+    {'q', 6353}, {';', 6354}, {'n', 6355}, {'n', 6356}, {'s', 6357}, {'i', 6358}, {'m', 6359}, {';', 6360},
+    {';', 6361}, {'g', 6362}, {'r', 6363}, {';', 6364}, {'e', 6365}, {'v', 6366}, {';', 6367}, {'n', 6368},
+    {';', 6369}, {'c', 6370}, {';', 6371}, {'t', 6372}, {'u', 6373}, {'m', 6374}, {'u', 6375}, {'r', 6376},
+    {'a', 6377}, {'u', 6378}, {';', 6379}, {'g', 6380}, {';', 6381}, {'o', 6382}, {'q', 6383}, {'r', 6384},
+    {'v', 6385}, {';', 6386}, {';', 6387}, {';', 6388}, {'u', 6389}, {'s', 6390}, {'e', 6391}, {';', 6392},
+    {';', 6393}, {'u', 6394}, {';', 6395}, {';', 6396}, {';', 6397}, {';', 6398}, {'u', 6399}, {';', 6400},
+    {';', 6401}, {';', 6402}, {';', 6403}, {';', 6404}, {'m', 6405}, {'v', 6406}, {'d', 6407}, {'a', 6408},
+    {';', 6409}, {'a', 6410}, {'d', 6411}, {'n', 6412}, {';', 6413}, {'r', 6414}, {'i', 6415}, {';', 6416},
+    {'q', 6417}, {';', 6418}, {';', 6419}, {'m', 6420}, {'x', 6421}, {'t', 6422}, {';', 6423}, {';', 6424},
+    {';', 6425}, {'l', 6426}, {'r', 6427}, {';', 6428}, {'p', 6429}, {'a', 6430}, {';', 6431}, {';', 6432},
+    {';', 6433}, {';', 6434}, {'m', 6435}, {'q', 6436}, {'e', 6437}, {'e', 6438}, {';', 6439}, {'r', 6440},
+    {'n', 6441}, {';', 6442}, {';', 6443}, {';', 6444}, {'w', 6445}, {';', 6446}, {'r', 6447}, {'q', 6448},
+    {'v', 6449}, {';', 6450}, {'d', 6451}, {'a', 6452}, {';', 6453}, {'o', 6454}, {';', 6455}, {';', 6456},
+    {';', 6457}, {';', 6458}, {'o', 6459}, {'u', 6460}, {'s', 6461}, {'a', 6462}, {'b', 6463}, {'r', 6464},
+    {'w', 6465}, {'r', 6466}, {'o', 6467}, {';', 6468}, {';', 6469}, {';', 6470}, {'e', 6471}, {'r', 6472},
+    {';', 6473}, {';', 6474}, {';', 6475}, {';', 6476}, {';', 6477}, {';', 6478}, {'r', 6479}, {';', 6480},
+    {'e', 6481}, {';', 6482}, {';', 6483}, {';', 6484}, {';', 6485}, {'n', 6486}, {';', 6487}, {'n', 6488},
+    {'t', 6489}, {';', 6490}, {';', 6491}, {'D', 6492}, {'s', 6493}, {'a', 6494}, {'n', 6495}, {'g', 6496},
+    {';', 6497}, {';', 6498}, {';', 6499}, {';', 6500}, {'n', 6501}, {';', 6502}, {';', 6503}, {';', 6504},
+    {';', 6505}, {';', 6506}, {';', 6507}, {';', 6508}, {';', 6509}, {';', 6510}, {';', 6511}, {';', 6512},
+    {';', 6513}, {';', 6514}, {';', 6515}, {';', 6516}, {';', 6517}, {';', 6518}, {';', 6519}, {'n', 6520},
+    {';', 6521}, {'o', 6522}, {';', 6523}, {'o', 6524}, {';', 6525}, {'t', 6526}, {'r', 6527}, {';', 6528},
+    {';', 6529}, {'e', 6530}, {'l', 6531}, {'s', 6532}, {';', 6533}, {'e', 6534}, {';', 6535}, {';', 6536},
+    {';', 6537}, {'r', 6538}, {';', 6539}, {'u', 6540}, {';', 6541}, {';', 6542}, {'o', 6543}, {'o', 6544},
+    {';', 6545}, {'f', 6546}, {'g', 6547}, {';', 6548}, {';', 6549}, {';', 6550}, {';', 6551}, {';', 6552},
+    {';', 6553}, {';', 6554}, {';', 6555}, {';', 6556}, {'n', 6557}, {'r', 6558}, {';', 6559}, {'i', 6560},
+    {';', 6561}, {';', 6562}, {'r', 6563}, {'a', 6564}, {'h', 6565}, {'d', 6566}, {';', 6567}, {'t', 6568},
+    {';', 6569}, {';', 6570}, {';', 6571}, {';', 6572}, {';', 6573}, {';', 6574}, {';', 6575}, {';', 6576},
+    {'y', 6577}, {';', 6578}, {';', 6579}, {';', 6580}, {'s', 6581}, {';', 6582}, {';', 6583}, {';', 6584},
+    {';', 6585}, {'m', 6586}, {';', 6587}, {';', 6588}, {';', 6589}, {';', 6590}, {'d', 6591}, {'u', 6592},
+    {';', 6593}, {';', 6594}, {';', 6595}, {'r', 6596}, {'a', 6597}, {'r', 6598}, {'r', 6599}, {'f', 6600},
+    {'g', 6601}, {'r', 6602}, {'n', 6603}, {';', 6604}, {'o', 6605}, {';', 6606}, {'p', 6607}, {'t', 6608},
+    {'g', 6609}, {'q', 6610}, {'r', 6611}, {'m', 6612}, {';', 6613}, {';', 6614}, {';', 6615}, {'e', 6616},
+    {';', 6617}, {';', 6618}, {';', 6619}, {'a', 6620}, {'o', 6621}, {'f', 6622}, {'p', 6623}, {'g', 6624},
+    {'r', 6625}, {';', 6626}, {'s', 6627}, {';', 6628}, {';', 6629}, {'e', 6630}, {';', 6631}, {'e', 6632},
+    {';', 6633}, {';', 6634}, {';', 6635}, {';', 6636}, {';', 6637}, {';', 6638}, {';', 6639}, {'t', 6640},
+    {';', 6641}, {'a', 6642}, {'r', 6643}, {'e', 6644}, {'e', 6645}, {';', 6646}, {'d', 6647}, {'l', 6648},
+    {'u', 6649}, {';', 6650}, {';', 6651}, {'e', 6652}, {';', 6653}, {';', 6654}, {';', 6655}, {';', 6656},
+    {';', 6657}, {'u', 6658}, {';', 6659}, {';', 6660}, {';', 6661}, {'a', 6662}, {'r', 6663}, {'i', 6664},
+    {'a', 6665}, {';', 6666}, {';', 6667}, {';', 6668}, {'x', 6669}, {'l', 6670}, {';', 6671}, {';', 6672},
+    {';', 6673}, {'o', 6674}, {';', 6675}, {'w', 6676}, {';', 6677}, {';', 6678}, {';', 6679}, {'s', 6680},
+    {'a', 6681}, {'r', 6682}, {'i', 6683}, {'a', 6684}, {';', 6685}, {';', 6686}, {'o', 6687}, {'a', 6688},
+    {'b', 6689}, {'c', 6690}, {'a', 6691}, {'b', 6692}, {'c', 6693}, {'l', 6694}, {';', 6695}, {'t', 6696},
+    {';', 6697}, {'q', 6698}, {';', 6699}, {';', 6700}, {'a', 6701}, {';', 6702}, {';', 6703}, {'m', 6704},
+    {'p', 6705}, {';', 6706}, {'e', 6707}, {'e', 6708}, {'t', 6709}, {'q', 6710}, {'t', 6711}, {';', 6712},
+    {'g', 6713}, {';', 6714}, {';', 6715}, {';', 6716}, {';', 6717}, {'n', 6718}, {';', 6719}, {'e', 6720},
+    {';', 6721}, {'e', 6722}, {';', 6723}, {'w', 6724}, {';', 6725}, {';', 6726}, {';', 6727}, {';', 6728},
+    {';', 6729}, {'s', 6730}, {'n', 6731}, {';', 6732}, {'f', 6733}, {';', 6734}, {'e', 6735}, {';', 6736},
+    {';', 6737}, {';', 6738}, {'a', 6739}, {'e', 6740}, {';', 6741}, {';', 6742}, {';', 6743}, {';', 6744},
+    {'k', 6745}, {';', 6746}, {'o', 6747}, {';', 6748}, {'h', 6749}, {';', 6750}, {'i', 6751}, {'r', 6752},
+    {';', 6753}, {';', 6754}, {';', 6755}, {'m', 6756}, {'o', 6757}, {'n', 6758}, {'p', 6759}, {'r', 6760},
+    {';', 6761}, {'p', 6762}, {'q', 6763}, {'i', 6764}, {'m', 6765}, {';', 6766}, {';', 6767}, {'a', 6768},
+    {'n', 6769}, {'r', 6770}, {';', 6771}, {';', 6772}, {';', 6773}, {';', 6774}, {'n', 6775}, {'t', 6776},
+    {'q', 6777}, {';', 6778}, {';', 6779}, {'y', 6780}, {';', 6781}, {';', 6782}, {'s', 6783}, {';', 6784},
+    {';', 6785}, {';', 6786}, {';', 6787}, {'m', 6788}, {';', 6789}, {';', 6790}, {'a', 6791}, {';', 6792},
+    {';', 6793}, {'d', 6794}, {'u', 6795}, {';', 6796}, {';', 6797}, {'r', 6798}, {';', 6799}, {'e', 6800},
+    {'r', 6801}, {';', 6802}, {';', 6803}, {';', 6804}, {'r', 6805}, {'a', 6806}, {'e', 6807}, {'i', 6808},
+    {'q', 6809}, {'h', 6810}, {'d', 6811}, {';', 6812}, {'a', 6813}, {';', 6814}, {'s', 6815}, {';', 6816},
+    {'n', 6817}, {';', 6818}, {';', 6819}, {';', 6820}, {';', 6821}, {'r', 6822}, {'r', 6823}, {';', 6824},
+    {';', 6825}, {';', 6826}, {';', 6827}, {'n', 6828}, {';', 6829}, {'w', 6830}, {';', 6831}, {'u', 6832},
+    {';', 6833}, {';', 6834}, {'i', 6835}, {'a', 6836}, {';', 6837}, {';', 6838}, {';', 6839}, {'s', 6840},
+    {'r', 6841}, {'e', 6842}, {';', 6843}, {'s', 6844}, {';', 6845}, {';', 6846}, {';', 6847}, {'u', 6848},
+    {';', 6849}, {';', 6850}, {';', 6851}, {'e', 6852}, {';', 6853}, {'e', 6854}, {';', 6855}, {';', 6856},
+    {';', 6857}, {';', 6858}, {';', 6859}, {'h', 6860}, {';', 6861}, {'t', 6862}, {'t', 6863}, {'s', 6864},
+    {'r', 6865}, {';', 6866}, {'e', 6867}, {'n', 6868}, {';', 6869}, {';', 6870}, {';', 6871}, {'p', 6872},
+    {'r', 6873}, {';', 6874}, {'p', 6875}, {'q', 6876}, {'i', 6877}, {'m', 6878}, {';', 6879}, {'b', 6880},
+    {'t', 6881}, {'l', 6882}, {'b', 6883}, {'r', 6884}, {'t', 6885}, {'s', 6886}, {';', 6887}, {'e', 6888},
+    {'n', 6889}, {';', 6890}, {';', 6891}, {';', 6892}, {';', 6893}, {'w', 6894}, {';', 6895}, {';', 6896},
+    {';', 6897}, {';', 6898}, {';', 6899}, {';', 6900}, {'o', 6901}, {'y', 6902}, {';', 6903}, {'p', 6904},
+    {'i', 6905}, {';', 6906}, {';', 6907}, {';', 6908}, {'a', 6909}, {';', 6910}, {';', 6911}, {';', 6912},
+    {'k', 6913}, {';', 6914}, {'l', 6915}, {';', 6916}, {'u', 6917}, {'s', 6918}, {'e', 6919}, {'u', 6920},
+    {';', 6921}, {'d', 6922}, {';', 6923}, {';', 6924}, {';', 6925}, {';', 6926}, {';', 6927}, {';', 6928},
+    {'e', 6929}, {';', 6930}, {'w', 6931}, {'a', 6932}, {'o', 6933}, {'n', 6934}, {'r', 6935}, {';', 6936},
+    {'e', 6937}, {';', 6938}, {';', 6939}, {'e', 6940}, {';', 6941}, {'i', 6942}, {'p', 6943}, {'h', 6944},
+    {';', 6945}, {'p', 6946}, {';', 6947}, {'m', 6948}, {'s', 6949}, {'s', 6950}, {'t', 6951}, {'a', 6952},
+    {';', 6953}, {';', 6954}, {';', 6955}, {';', 6956}, {';', 6957}, {';', 6958}, {';', 6959}, {'g', 6960},
+    {';', 6961}, {';', 6962}, {';', 6963}, {';', 6964}, {';', 6965}, {';', 6966}, {';', 6967}, {';', 6968},
+    {';', 6969}, {';', 6970}, {';', 6971}, {';', 6972}, {';', 6973}, {'r', 6974}, {'n', 6975}, {'s', 6976},
+    {';', 6977}, {'l', 6978}, {'D', 6979}, {';', 6980}, {';', 6981}, {';', 6982}, {'o', 6983}, {'o', 6984},
+    {'i', 6985}, {'l', 6986}, {'i', 6987}, {'s', 6988}, {'r', 6989}, {'n', 6990}, {'I', 6991}, {'c', 6992},
+    {'C', 6993}, {'d', 6994}, {'i', 6995}, {';', 6996}, {'n', 6997}, {'l', 6998}, {'o', 6999}, {'o', 7000},
+    {'e', 7001}, {'o', 7002}, {'i', 7003}, {'p', 7004}, {'e', 7005}, {'o', 7006}, {'v', 7007}, {'t', 7008},
+    {'h', 7009}, {';', 7010}, {'A', 7011}, {'o', 7012}, {';', 7013}, {'a', 7014}, {'r', 7015}, {';', 7016},
+    {'l', 7017}, {'r', 7018}, {'t', 7019}, {'m', 7020}, {'e', 7021}, {'t', 7022}, {'E', 7023}, {'F', 7024},
+    {'G', 7025}, {'L', 7026}, {'S', 7027}, {'T', 7028}, {'S', 7029}, {'t', 7030}, {'n', 7031}, {'a', 7032},
+    {'r', 7033}, {';', 7034}, {'l', 7035}, {'c', 7036}, {'l', 7037}, {'t', 7038}, {'l', 7039}, {'o', 7040},
+    {'l', 7041}, {'b', 7042}, {'n', 7043}, {'o', 7044}, {'h', 7045}, {';', 7046}, {'A', 7047}, {'V', 7048},
+    {'a', 7049}, {'o', 7050}, {'e', 7051}, {'e', 7052}, {'t', 7053}, {'o', 7054}, {'h', 7055}, {'a', 7056},
+    {'l', 7057}, {'a', 7058}, {'s', 7059}, {'n', 7060}, {'d', 7061}, {'r', 7062}, {'t', 7063}, {'h', 7064},
+    {'t', 7065}, {'h', 7066}, {'f', 7067}, {'g', 7068}, {'p', 7069}, {'r', 7070}, {'u', 7071}, {'e', 7072},
+    {'r', 7073}, {'e', 7074}, {';', 7075}, {';', 7076}, {'k', 7077}, {'r', 7078}, {'a', 7079}, {'l', 7080},
+    {'e', 7081}, {'l', 7082}, {'t', 7083}, {'t', 7084}, {'D', 7085}, {'E', 7086}, {'T', 7087}, {';', 7088},
+    {'E', 7089}, {'G', 7090}, {'L', 7091}, {'S', 7092}, {'T', 7093}, {'e', 7094}, {'e', 7095}, {'r', 7096},
+    {'t', 7097}, {'r', 7098}, {'e', 7099}, {'e', 7100}, {'r', 7101}, {'e', 7102}, {'i', 7103}, {';', 7104},
+    {'l', 7105}, {';', 7106}, {'c', 7107}, {'e', 7108}, {'D', 7109}, {'u', 7110}, {'e', 7111}, {'s', 7112},
+    {';', 7113}, {'i', 7114}, {'E', 7115}, {'U', 7116}, {'g', 7117}, {'r', 7118}, {'i', 7119}, {'u', 7120},
+    {'w', 7121}, {'o', 7122}, {'e', 7123}, {'i', 7124}, {'D', 7125}, {'T', 7126}, {'V', 7127}, {'c', 7128},
+    {'r', 7129}, {'p', 7130}, {'r', 7131}, {'a', 7132}, {'w', 7133}, {'f', 7134}, {'g', 7135}, {'A', 7136},
+    {'r', 7137}, {'n', 7138}, {'u', 7139}, {'n', 7140}, {'q', 7141}, {'s', 7142}, {'t', 7143}, {'t', 7144},
+    {'r', 7145}, {'a', 7146}, {'c', 7147}, {'u', 7148}, {'l', 7149}, {'l', 7150}, {'o', 7151}, {'r', 7152},
+    {'r', 7153}, {'a', 7154}, {'r', 7155}, {'u', 7156}, {';', 7157}, {'B', 7158}, {'D', 7159}, {'r', 7160},
+    {'i', 7161}, {'r', 7162}, {';', 7163}, {'r', 7164}, {'f', 7165}, {'g', 7166}, {';', 7167}, {'l', 7168},
+    {'n', 7169}, {'t', 7170}, {';', 7171}, {'e', 7172}, {'a', 7173}, {'b', 7174}, {'c', 7175}, {'d', 7176},
+    {'e', 7177}, {'f', 7178}, {'g', 7179}, {'h', 7180}, {';', 7181}, {'d', 7182}, {';', 7183}, {'q', 7184},
+    {';', 7185}, {'t', 7186}, {'g', 7187}, {'i', 7188}, {'m', 7189}, {';', 7190}, {'e', 7191}, {'e', 7192},
+    {'k', 7193}, {';', 7194}, {';', 7195}, {';', 7196}, {';', 7197}, {';', 7198}, {'s', 7199}, {'e', 7200},
+    {'p', 7201}, {';', 7202}, {'n', 7203}, {'s', 7204}, {'e', 7205}, {'z', 7206}, {'u', 7207}, {'i', 7208},
+    {';', 7209}, {'s', 7210}, {';', 7211}, {'s', 7212}, {'b', 7213}, {'p', 7214}, {';', 7215}, {';', 7216},
+    {'o', 7217}, {'r', 7218}, {'r', 7219}, {'R', 7220}, {'S', 7221}, {'a', 7222}, {'c', 7223}, {'d', 7224},
+    {'t', 7225}, {';', 7226}, {'t', 7227}, {';', 7228}, {'e', 7229}, {'e', 7230}, {';', 7231}, {';', 7232},
+    {';', 7233}, {';', 7234}, {'p', 7235}, {';', 7236}, {'p', 7237}, {'s', 7238}, {'e', 7239}, {'d', 7240},
+    {'r', 7241}, {'t', 7242}, {';', 7243}, {';', 7244}, {';', 7245}, {';', 7246}, {';', 7247}, {'s', 7248},
+    {';', 7249}, {'n', 7250}, {'t', 7251}, {'s', 7252}, {';', 7253}, {'r', 7254}, {'a', 7255}, {'o', 7256},
+    {'n', 7257}, {'p', 7258}, {'w', 7259}, {';', 7260}, {'r', 7261}, {'s', 7262}, {'t', 7263}, {';', 7264},
+    {';', 7265}, {'g', 7266}, {'l', 7267}, {';', 7268}, {'l', 7269}, {'t', 7270}, {'t', 7271}, {'d', 7272},
+    {'t', 7273}, {'t', 7274}, {';', 7275}, {'l', 7276}, {'x', 7277}, {';', 7278}, {'o', 7279}, {'s', 7280},
+    {'e', 7281}, {';', 7282}, {'q', 7283}, {';', 7284}, {'i', 7285}, {'w', 7286}, {'w', 7287}, {'t', 7288},
+    {'h', 7289}, {'e', 7290}, {'t', 7291}, {'e', 7292}, {'s', 7293}, {'l', 7294}, {'k', 7295}, {';', 7296},
+    {';', 7297}, {'v', 7298}, {';', 7299}, {';', 7300}, {';', 7301}, {';', 7302}, {';', 7303}, {'r', 7304},
+    {'o', 7305}, {'p', 7306}, {'t', 7307}, {'h', 7308}, {'e', 7309}, {'t', 7310}, {';', 7311}, {'r', 7312},
+    {'r', 7313}, {';', 7314}, {'t', 7315}, {'g', 7316}, {';', 7317}, {';', 7318}, {'r', 7319}, {'c', 7320},
+    {'x', 7321}, {'t', 7322}, {'s', 7323}, {'h', 7324}, {'o', 7325}, {';', 7326}, {';', 7327}, {'r', 7328},
+    {';', 7329}, {'r', 7330}, {';', 7331}, {'q', 7332}, {';', 7333}, {'o', 7334}, {'e', 7335}, {'p', 7336},
+    {'d', 7337}, {';', 7338}, {'p', 7339}, {'r', 7340}, {'g', 7341}, {'r', 7342}, {';', 7343}, {';', 7344},
+    {'s', 7345}, {'t', 7346}, {';', 7347}, {';', 7348}, {'n', 7349}, {'r', 7350}, {'g', 7351}, {'n', 7352},
+    {'t', 7353}, {';', 7354}, {';', 7355}, {';', 7356}, {';', 7357}, {';', 7358}, {';', 7359}, {'e', 7360},
+    {';', 7361}, {';', 7362}, {'r', 7363}, {'i', 7364}, {'a', 7365}, {';', 7366}, {';', 7367}, {';', 7368},
+    {'e', 7369}, {';', 7370}, {';', 7371}, {'e', 7372}, {'l', 7373}, {';', 7374}, {';', 7375}, {';', 7376},
+    {';', 7377}, {';', 7378}, {';', 7379}, {';', 7380}, {';', 7381}, {'s', 7382}, {'l', 7383}, {';', 7384},
+    {'r', 7385}, {';', 7386}, {'r', 7387}, {';', 7388}, {';', 7389}, {';', 7390}, {'t', 7391}, {'r', 7392},
+    {'l', 7393}, {'p', 7394}, {'q', 7395}, {'m', 7396}, {';', 7397}, {'r', 7398}, {'e', 7399}, {'f', 7400},
+    {'i', 7401}, {';', 7402}, {';', 7403}, {'v', 7404}, {';', 7405}, {';', 7406}, {'l', 7407}, {';', 7408},
+    {';', 7409}, {';', 7410}, {';', 7411}, {'t', 7412}, {'r', 7413}, {'r', 7414}, {'f', 7415}, {'g', 7416},
+    {'u', 7417}, {'r', 7418}, {'o', 7419}, {'c', 7420}, {';', 7421}, {'t', 7422}, {'i', 7423}, {';', 7424},
+    {'t', 7425}, {';', 7426}, {'s', 7427}, {'d', 7428}, {'r', 7429}, {';', 7430}, {';', 7431}, {'t', 7432},
+    {'l', 7433}, {'i', 7434}, {'t', 7435}, {'t', 7436}, {'t', 7437}, {';', 7438}, {';', 7439}, {';', 7440},
+    {';', 7441}, {'q', 7442}, {'e', 7443}, {'r', 7444}, {'l', 7445}, {'p', 7446}, {'q', 7447}, {'m', 7448},
+    {';', 7449}, {';', 7450}, {';', 7451}, {';', 7452}, {';', 7453}, {';', 7454}, {';', 7455}, {';', 7456},
+    {'q', 7457}, {'e', 7458}, {';', 7459}, {'r', 7460}, {'m', 7461}, {'p', 7462}, {'m', 7463}, {'r', 7464},
+    {';', 7465}, {'e', 7466}, {'s', 7467}, {';', 7468}, {';', 7469}, {'m', 7470}, {'l', 7471}, {'r', 7472},
+    {'r', 7473}, {';', 7474}, {'r', 7475}, {'o', 7476}, {';', 7477}, {'o', 7478}, {'r', 7479}, {';', 7480},
+    {'l', 7481}, {'a', 7482}, {'i', 7483}, {'t', 7484}, {'a', 7485}, {'e', 7486}, {'e', 7487}, {'a', 7488},
+    {'n', 7489}, {';', 7490}, {';', 7491}, {'c', 7492}, {'h', 7493}, {'i', 7494}, {'i', 7495}, {'t', 7496},
+    {'t', 7497}, {'n', 7498}, {'u', 7499}, {'m', 7500}, {'e', 7501}, {'l', 7502}, {'t', 7503}, {'n', 7504},
+    {'t', 7505}, {'l', 7506}, {';', 7507}, {'c', 7508}, {'t', 7509}, {';', 7510}, {'n', 7511}, {'t', 7512},
+    {'w', 7513}, {'f', 7514}, {'n', 7515}, {'g', 7516}, {'A', 7517}, {'D', 7518}, {'r', 7519}, {'w', 7520},
+    {'e', 7521}, {'R', 7522}, {'T', 7523}, {'V', 7524}, {'t', 7525}, {'r', 7526}, {'w', 7527}, {'l', 7528},
+    {'y', 7529}, {'d', 7530}, {'i', 7531}, {'i', 7532}, {'a', 7533}, {'r', 7534}, {'r', 7535}, {'q', 7536},
+    {'u', 7537}, {'r', 7538}, {'e', 7539}, {'l', 7540}, {'i', 7541}, {'p', 7542}, {'a', 7543}, {'H', 7544},
+    {'l', 7545}, {'y', 7546}, {';', 7547}, {'t', 7548}, {'e', 7549}, {'r', 7550}, {'e', 7551}, {'w', 7552},
+    {'i', 7553}, {'l', 7554}, {'T', 7555}, {'V', 7556}, {'r', 7557}, {'t', 7558}, {'r', 7559}, {'e', 7560},
+    {'n', 7561}, {'w', 7562}, {'e', 7563}, {'c', 7564}, {'o', 7565}, {'w', 7566}, {'t', 7567}, {'l', 7568},
+    {'E', 7569}, {'t', 7570}, {';', 7571}, {'t', 7572}, {'e', 7573}, {'o', 7574}, {'A', 7575}, {'R', 7576},
+    {'t', 7577}, {'a', 7578}, {'r', 7579}, {'t', 7580}, {'t', 7581}, {'h', 7582}, {'a', 7583}, {'f', 7584},
+    {'s', 7585}, {'M', 7586}, {'T', 7587}, {'V', 7588}, {'e', 7589}, {'s', 7590}, {'i', 7591}, {'u', 7592},
+    {'p', 7593}, {'e', 7594}, {'n', 7595}, {';', 7596}, {'T', 7597}, {'s', 7598}, {'e', 7599}, {'o', 7600},
+    {'q', 7601}, {'r', 7602}, {'q', 7603}, {'r', 7604}, {'e', 7605}, {'l', 7606}, {'i', 7607}, {'d', 7608},
+    {'d', 7609}, {'s', 7610}, {'T', 7611}, {'e', 7612}, {'t', 7613}, {'e', 7614}, {'s', 7615}, {';', 7616},
+    {'E', 7617}, {'F', 7618}, {'T', 7619}, {'c', 7620}, {'y', 7621}, {'e', 7622}, {'k', 7623}, {'n', 7624},
+    {';', 7625}, {'s', 7626}, {'p', 7627}, {';', 7628}, {'E', 7629}, {'S', 7630}, {'T', 7631}, {'o', 7632},
+    {'l', 7633}, {'q', 7634}, {'p', 7635}, {'l', 7636}, {'o', 7637}, {'l', 7638}, {'b', 7639}, {'n', 7640},
+    {'o', 7641}, {';', 7642}, {'A', 7643}, {'V', 7644}, {'a', 7645}, {'o', 7646}, {'e', 7647}, {'e', 7648},
+    {'t', 7649}, {'o', 7650}, {'l', 7651}, {'r', 7652}, {'y', 7653}, {'n', 7654}, {'t', 7655}, {'h', 7656},
+    {'r', 7657}, {'c', 7658}, {'t', 7659}, {'b', 7660}, {'p', 7661}, {'i', 7662}, {'u', 7663}, {';', 7664},
+    {'E', 7665}, {'S', 7666}, {'T', 7667}, {';', 7668}, {';', 7669}, {'E', 7670}, {'e', 7671}, {'c', 7672},
+    {'e', 7673}, {'a', 7674}, {'l', 7675}, {'d', 7676}, {'t', 7677}, {';', 7678}, {';', 7679}, {'c', 7680},
+    {'e', 7681}, {'s', 7682}, {'a', 7683}, {'o', 7684}, {'r', 7685}, {'b', 7686}, {'o', 7687}, {'r', 7688},
+    {'t', 7689}, {'h', 7690}, {'B', 7691}, {'L', 7692}, {'S', 7693}, {'T', 7694}, {'S', 7695}, {'h', 7696},
+    {';', 7697}, {';', 7698}, {';', 7699}, {';', 7700}, {';', 7701}, {';', 7702}, {';', 7703}, {';', 7704},
+    {';', 7705}, {';', 7706}, {';', 7707}, {';', 7708}, {';', 7709}, {'l', 7710}, {'e', 7711}, {'q', 7712},
+    {';', 7713}, {';', 7714}, {';', 7715}, {'s', 7716}, {';', 7717}, {'g', 7718}, {';', 7719}, {';', 7720},
+    {'e', 7721}, {'a', 7722}, {'a', 7723}, {';', 7724}, {';', 7725}, {';', 7726}, {';', 7727}, {'t', 7728},
+    {'k', 7729}, {'r', 7730}, {';', 7731}, {';', 7732}, {'s', 7733}, {'i', 7734}, {'a', 7735}, {';', 7736},
+    {';', 7737}, {'n', 7738}, {'s', 7739}, {';', 7740}, {'r', 7741}, {'u', 7742}, {';', 7743}, {'g', 7744},
+    {'o', 7745}, {';', 7746}, {'u', 7747}, {'t', 7748}, {';', 7749}, {';', 7750}, {'e', 7751}, {'r', 7752},
+    {'w', 7753}, {'a', 7754}, {'o', 7755}, {';', 7756}, {';', 7757}, {';', 7758}, {';', 7759}, {'t', 7760},
+    {'e', 7761}, {';', 7762}, {'i', 7763}, {'i', 7764}, {'o', 7765}, {';', 7766}, {';', 7767}, {';', 7768},
+    {';', 7769}, {'x', 7770}, {'s', 7771}, {'s', 7772}, {'q', 7773}, {'t', 7774}, {';', 7775}, {';', 7776},
+    {'a', 7777}, {'t', 7778}, {';', 7779}, {';', 7780}, {';', 7781}, {';', 7782}, {';', 7783}, {';', 7784},
+    {';', 7785}, {';', 7786}, {'w', 7787}, {'o', 7788}, {'a', 7789}, {'t', 7790}, {'e', 7791}, {';', 7792},
+    {';', 7793}, {'o', 7794}, {'r', 7795}, {'t', 7796}, {';', 7797}, {'h', 7798}, {';', 7799}, {'a', 7800},
+    {'r', 7801}, {'t', 7802}, {'t', 7803}, {'w', 7804}, {';', 7805}, {';', 7806}, {'q', 7807}, {'w', 7808},
+    {'f', 7809}, {';', 7810}, {'a', 7811}, {';', 7812}, {'o', 7813}, {'h', 7814}, {'r', 7815}, {';', 7816},
+    {';', 7817}, {'t', 7818}, {'o', 7819}, {'h', 7820}, {'t', 7821}, {';', 7822}, {'l', 7823}, {'r', 7824},
+    {'d', 7825}, {'r', 7826}, {'q', 7827}, {'q', 7828}, {'e', 7829}, {';', 7830}, {';', 7831}, {'k', 7832},
+    {';', 7833}, {';', 7834}, {'o', 7835}, {'y', 7836}, {'r', 7837}, {';', 7838}, {';', 7839}, {';', 7840},
+    {';', 7841}, {';', 7842}, {'o', 7843}, {';', 7844}, {'s', 7845}, {';', 7846}, {'o', 7847}, {'p', 7848},
+    {'t', 7849}, {'h', 7850}, {'i', 7851}, {'e', 7852}, {'t', 7853}, {'h', 7854}, {';', 7855}, {';', 7856},
+    {';', 7857}, {';', 7858}, {';', 7859}, {'a', 7860}, {'m', 7861}, {';', 7862}, {'t', 7863}, {';', 7864},
+    {'e', 7865}, {';', 7866}, {'e', 7867}, {'e', 7868}, {'p', 7869}, {';', 7870}, {'q', 7871}, {'q', 7872},
+    {'o', 7873}, {'y', 7874}, {'r', 7875}, {';', 7876}, {';', 7877}, {';', 7878}, {'q', 7879}, {'q', 7880},
+    {'e', 7881}, {';', 7882}, {'r', 7883}, {';', 7884}, {';', 7885}, {';', 7886}, {'d', 7887}, {'l', 7888},
+    {'q', 7889}, {'r', 7890}, {';', 7891}, {';', 7892}, {'e', 7893}, {'i', 7894}, {';', 7895}, {'r', 7896},
+    {'n', 7897}, {'w', 7898}, {';', 7899}, {'o', 7900}, {';', 7901}, {'n', 7902}, {'o', 7903}, {';', 7904},
+    {'t', 7905}, {'t', 7906}, {';', 7907}, {'g', 7908}, {'t', 7909}, {';', 7910}, {'s', 7911}, {'f', 7912},
+    {';', 7913}, {';', 7914}, {'u', 7915}, {'s', 7916}, {'e', 7917}, {'C', 7918}, {'y', 7919}, {';', 7920},
+    {'t', 7921}, {';', 7922}, {'o', 7923}, {'a', 7924}, {'i', 7925}, {'t', 7926}, {';', 7927}, {'n', 7928},
+    {'t', 7929}, {'g', 7930}, {'h', 7931}, {'r', 7932}, {'o', 7933}, {'t', 7934}, {';', 7935}, {'B', 7936},
+    {'U', 7937}, {';', 7938}, {'i', 7939}, {'e', 7940}, {'e', 7941}, {'T', 7942}, {'V', 7943}, {'r', 7944},
+    {';', 7945}, {'l', 7946}, {'S', 7947}, {'e', 7948}, {'u', 7949}, {'a', 7950}, {'l', 7951}, {'y', 7952},
+    {'f', 7953}, {'u', 7954}, {'l', 7955}, {'e', 7956}, {'s', 7957}, {'a', 7958}, {'l', 7959}, {'a', 7960},
+    {'l', 7961}, {'u', 7962}, {';', 7963}, {'I', 7964}, {'i', 7965}, {'C', 7966}, {'T', 7967}, {'f', 7968},
+    {'B', 7969}, {';', 7970}, {'B', 7971}, {'R', 7972}, {'n', 7973}, {'e', 7974}, {'e', 7975}, {'e', 7976},
+    {';', 7977}, {'A', 7978}, {'V', 7979}, {'r', 7980}, {'c', 7981}, {'g', 7982}, {'n', 7983}, {'V', 7984},
+    {'t', 7985}, {'r', 7986}, {';', 7987}, {'a', 7988}, {'G', 7989}, {'q', 7990}, {'e', 7991}, {'E', 7992},
+    {';', 7993}, {'w', 7994}, {'r', 7995}, {'i', 7996}, {'A', 7997}, {'r', 7998}, {'i', 7999}, {'a', 8000},
+    {'A', 8001}, {'t', 8002}, {'c', 8003}, {';', 8004}, {';', 8005}, {'e', 8006}, {'h', 8007}, {'e', 8008},
+    {'a', 8009}, {'s', 8010}, {'n', 8011}, {'e', 8012}, {';', 8013}, {'V', 8014}, {'t', 8015}, {'i', 8016},
+    {';', 8017}, {'r', 8018}, {'w', 8019}, {'u', 8020}, {'i', 8021}, {'u', 8022}, {'e', 8023}, {'s', 8024},
+    {'a', 8025}, {'l', 8026}, {'G', 8027}, {'L', 8028}, {'e', 8029}, {'e', 8030}, {'r', 8031}, {'S', 8032},
+    {';', 8033}, {'E', 8034}, {'d', 8035}, {'e', 8036}, {'q', 8037}, {'u', 8038}, {'i', 8039}, {'a', 8040},
+    {'D', 8041}, {'Q', 8042}, {';', 8043}, {'e', 8044}, {'t', 8045}, {';', 8046}, {'l', 8047}, {'q', 8048},
+    {'l', 8049}, {'i', 8050}, {'n', 8051}, {'e', 8052}, {'u', 8053}, {'E', 8054}, {'e', 8055}, {'w', 8056},
+    {'i', 8057}, {'l', 8058}, {'T', 8059}, {'V', 8060}, {'r', 8061}, {'r', 8062}, {'e', 8063}, {'n', 8064},
+    {'w', 8065}, {'e', 8066}, {'c', 8067}, {'o', 8068}, {'w', 8069}, {'i', 8070}, {'o', 8071}, {'e', 8072},
+    {'A', 8073}, {'A', 8074}, {'t', 8075}, {'r', 8076}, {'l', 8077}, {'e', 8078}, {'s', 8079}, {'e', 8080},
+    {'o', 8081}, {'a', 8082}, {'q', 8083}, {'l', 8084}, {'i', 8085}, {'q', 8086}, {';', 8087}, {'e', 8088},
+    {';', 8089}, {'l', 8090}, {'E', 8091}, {'e', 8092}, {';', 8093}, {'e', 8094}, {'k', 8095}, {'n', 8096},
+    {';', 8097}, {'r', 8098}, {'w', 8099}, {'o', 8100}, {'r', 8101}, {'w', 8102}, {'o', 8103}, {'A', 8104},
+    {'t', 8105}, {'a', 8106}, {'i', 8107}, {'e', 8108}, {'i', 8109}, {'p', 8110}, {'S', 8111}, {'o', 8112},
+    {';', 8113}, {';', 8114}, {';', 8115}, {'l', 8116}, {'n', 8117}, {'r', 8118}, {'n', 8119}, {';', 8120},
+    {';', 8121}, {'o', 8122}, {'t', 8123}, {'r', 8124}, {'s', 8125}, {'t', 8126}, {';', 8127}, {'e', 8128},
+    {'c', 8129}, {'e', 8130}, {'w', 8131}, {'i', 8132}, {'i', 8133}, {';', 8134}, {'w', 8135}, {';', 8136},
+    {'r', 8137}, {'o', 8138}, {'r', 8139}, {'s', 8140}, {'o', 8141}, {'a', 8142}, {'t', 8143}, {';', 8144},
+    {';', 8145}, {'s', 8146}, {';', 8147}, {';', 8148}, {'r', 8149}, {'a', 8150}, {';', 8151}, {'t', 8152},
+    {'o', 8153}, {'r', 8154}, {'a', 8155}, {'h', 8156}, {'s', 8157}, {'t', 8158}, {'x', 8159}, {';', 8160},
+    {'r', 8161}, {'e', 8162}, {'r', 8163}, {'i', 8164}, {'o', 8165}, {'a', 8166}, {'l', 8167}, {'r', 8168},
+    {';', 8169}, {'n', 8170}, {'t', 8171}, {'n', 8172}, {'w', 8173}, {'t', 8174}, {'o', 8175}, {';', 8176},
+    {'w', 8177}, {'t', 8178}, {';', 8179}, {';', 8180}, {'o', 8181}, {';', 8182}, {'a', 8183}, {';', 8184},
+    {'q', 8185}, {';', 8186}, {'q', 8187}, {'l', 8188}, {'r', 8189}, {';', 8190}, {'x', 8191}, {'e', 8192},
+    {'o', 8193}, {'n', 8194}, {';', 8195}, {'w', 8196}, {'o', 8197}, {'a', 8198}, {'h', 8199}, {'t', 8200},
+    {'g', 8201}, {'e', 8202}, {'s', 8203}, {'e', 8204}, {'l', 8205}, {'i', 8206}, {';', 8207}, {'q', 8208},
+    {'q', 8209}, {'p', 8210}, {'h', 8211}, {';', 8212}, {';', 8213}, {'q', 8214}, {'x', 8215}, {'e', 8216},
+    {'o', 8217}, {';', 8218}, {';', 8219}, {'q', 8220}, {';', 8221}, {'o', 8222}, {'o', 8223}, {'e', 8224},
+    {';', 8225}, {'i', 8226}, {'f', 8227}, {'g', 8228}, {'o', 8229}, {'l', 8230}, {'r', 8231}, {'s', 8232},
+    {'n', 8233}, {'g', 8234}, {';', 8235}, {'n', 8236}, {'n', 8237}, {'l', 8238}, {'i', 8239}, {';', 8240},
+    {'f', 8241}, {'s', 8242}, {';', 8243}, {'s', 8244}, {'o', 8245}, {'D', 8246}, {'Q', 8247}, {'e', 8248},
+    {'c', 8249}, {'l', 8250}, {'a', 8251}, {'o', 8252}, {'A', 8253}, {'A', 8254}, {'R', 8255}, {'T', 8256},
+    {'L', 8257}, {'R', 8258}, {'t', 8259}, {'r', 8260}, {'w', 8261}, {'i', 8262}, {'a', 8263}, {'p', 8264},
+    {'g', 8265}, {'e', 8266}, {'c', 8267}, {'e', 8268}, {'e', 8269}, {'o', 8270}, {'S', 8271}, {'m', 8272},
+    {';', 8273}, {'m', 8274}, {'l', 8275}, {'l', 8276}, {'S', 8277}, {';', 8278}, {'a', 8279}, {'l', 8280},
+    {'a', 8281}, {'s', 8282}, {'n', 8283}, {'d', 8284}, {'c', 8285}, {'L', 8286}, {'m', 8287}, {';', 8288},
+    {'o', 8289}, {'o', 8290}, {'i', 8291}, {';', 8292}, {'r', 8293}, {'a', 8294}, {'i', 8295}, {'g', 8296},
+    {'B', 8297}, {'e', 8298}, {'c', 8299}, {'r', 8300}, {'e', 8301}, {'o', 8302}, {'t', 8303}, {'l', 8304},
+    {'V', 8305}, {'e', 8306}, {'o', 8307}, {';', 8308}, {'B', 8309}, {'r', 8310}, {'r', 8311}, {'u', 8312},
+    {'r', 8313}, {'q', 8314}, {';', 8315}, {'r', 8316}, {'g', 8317}, {'r', 8318}, {'r', 8319}, {'g', 8320},
+    {'r', 8321}, {'r', 8322}, {'A', 8323}, {'e', 8324}, {'d', 8325}, {'i', 8326}, {'r', 8327}, {'t', 8328},
+    {'L', 8329}, {'g', 8330}, {'n', 8331}, {'e', 8332}, {';', 8333}, {'l', 8334}, {';', 8335}, {'E', 8336},
+    {'F', 8337}, {'G', 8338}, {'L', 8339}, {'S', 8340}, {'T', 8341}, {'n', 8342}, {'a', 8343}, {'a', 8344},
+    {'a', 8345}, {'a', 8346}, {'s', 8347}, {'n', 8348}, {'d', 8349}, {'r', 8350}, {'e', 8351}, {'s', 8352},
+    {'E', 8353}, {'i', 8354}, {'u', 8355}, {'q', 8356}, {'s', 8357}, {'t', 8358}, {'u', 8359}, {'l', 8360},
+    {'l', 8361}, {'l', 8362}, {'o', 8363}, {'u', 8364}, {'t', 8365}, {'h', 8366}, {'a', 8367}, {'u', 8368},
+    {'a', 8369}, {'l', 8370}, {';', 8371}, {'a', 8372}, {'m', 8373}, {'i', 8374}, {'q', 8375}, {'B', 8376},
+    {';', 8377}, {'B', 8378}, {'L', 8379}, {'n', 8380}, {'e', 8381}, {'e', 8382}, {'e', 8383}, {';', 8384},
+    {'r', 8385}, {'c', 8386}, {'g', 8387}, {'n', 8388}, {'V', 8389}, {'t', 8390}, {'r', 8391}, {';', 8392},
+    {'e', 8393}, {'w', 8394}, {'d', 8395}, {'r', 8396}, {'r', 8397}, {'A', 8398}, {'o', 8399}, {'e', 8400},
+    {'r', 8401}, {'e', 8402}, {'r', 8403}, {'n', 8404}, {'l', 8405}, {'u', 8406}, {'a', 8407}, {'l', 8408},
+    {'u', 8409}, {';', 8410}, {';', 8411}, {'q', 8412}, {';', 8413}, {';', 8414}, {'e', 8415}, {'t', 8416},
+    {';', 8417}, {'n', 8418}, {'w', 8419}, {'i', 8420}, {';', 8421}, {'w', 8422}, {'r', 8423}, {'A', 8424},
+    {'r', 8425}, {'n', 8426}, {'p', 8427}, {'l', 8428}, {'a', 8429}, {'p', 8430}, {'n', 8431}, {'e', 8432},
+    {'g', 8433}, {'e', 8434}, {'g', 8435}, {'w', 8436}, {';', 8437}, {'c', 8438}, {'h', 8439}, {';', 8440},
+    {'c', 8441}, {'c', 8442}, {';', 8443}, {'l', 8444}, {'r', 8445}, {'t', 8446}, {'m', 8447}, {'e', 8448},
+    {'r', 8449}, {'n', 8450}, {';', 8451}, {'s', 8452}, {'n', 8453}, {'l', 8454}, {'s', 8455}, {';', 8456},
+    {'r', 8457}, {'r', 8458}, {'a', 8459}, {'n', 8460}, {'r', 8461}, {'r', 8462}, {'a', 8463}, {'q', 8464},
+    {'i', 8465}, {';', 8466}, {';', 8467}, {';', 8468}, {'r', 8469}, {'g', 8470}, {';', 8471}, {'r', 8472},
+    {'e', 8473}, {'i', 8474}, {';', 8475}, {';', 8476}, {'g', 8477}, {';', 8478}, {'a', 8479}, {'w', 8480},
+    {';', 8481}, {'a', 8482}, {'w', 8483}, {'l', 8484}, {';', 8485}, {';', 8486}, {'e', 8487}, {'i', 8488},
+    {';', 8489}, {'q', 8490}, {'x', 8491}, {'s', 8492}, {';', 8493}, {'t', 8494}, {'o', 8495}, {'r', 8496},
+    {'a', 8497}, {'a', 8498}, {'a', 8499}, {'t', 8500}, {'e', 8501}, {';', 8502}, {'l', 8503}, {'n', 8504},
+    {';', 8505}, {';', 8506}, {'s', 8507}, {'i', 8508}, {';', 8509}, {';', 8510}, {'q', 8511}, {'x', 8512},
+    {';', 8513}, {'x', 8514}, {'w', 8515}, {'f', 8516}, {'g', 8517}, {'t', 8518}, {'h', 8519}, {'w', 8520},
+    {'e', 8521}, {'i', 8522}, {';', 8523}, {';', 8524}, {';', 8525}, {'e', 8526}, {'e', 8527}, {'e', 8528},
+    {'o', 8529}, {'e', 8530}, {';', 8531}, {';', 8532}, {'n', 8533}, {'o', 8534}, {'u', 8535}, {'g', 8536},
+    {'k', 8537}, {'A', 8538}, {'D', 8539}, {'G', 8540}, {'T', 8541}, {'l', 8542}, {'u', 8543}, {'r', 8544},
+    {'r', 8545}, {'i', 8546}, {'e', 8547}, {'e', 8548}, {'i', 8549}, {'A', 8550}, {'T', 8551}, {'o', 8552},
+    {'n', 8553}, {'c', 8554}, {'r', 8555}, {'A', 8556}, {'h', 8557}, {'V', 8558}, {'t', 8559}, {'e', 8560},
+    {'c', 8561}, {'w', 8562}, {'q', 8563}, {'a', 8564}, {';', 8565}, {'E', 8566}, {'S', 8567}, {'m', 8568},
+    {'l', 8569}, {'E', 8570}, {'t', 8571}, {';', 8572}, {'t', 8573}, {'e', 8574}, {'e', 8575}, {'i', 8576},
+    {'p', 8577}, {'n', 8578}, {'m', 8579}, {'m', 8580}, {'a', 8581}, {'r', 8582}, {'g', 8583}, {';', 8584},
+    {'r', 8585}, {'V', 8586}, {'t', 8587}, {'r', 8588}, {'c', 8589}, {'w', 8590}, {'o', 8591}, {'e', 8592},
+    {'e', 8593}, {'c', 8594}, {'r', 8595}, {'a', 8596}, {'r', 8597}, {'e', 8598}, {'a', 8599}, {';', 8600},
+    {'u', 8601}, {'o', 8602}, {'h', 8603}, {'r', 8604}, {'o', 8605}, {'h', 8606}, {'r', 8607}, {'r', 8608},
+    {'r', 8609}, {';', 8610}, {'i', 8611}, {'c', 8612}, {'n', 8613}, {'y', 8614}, {'e', 8615}, {'e', 8616},
+    {'S', 8617}, {'t', 8618}, {'r', 8619}, {'d', 8620}, {'q', 8621}, {'u', 8622}, {'r', 8623}, {'e', 8624},
+    {'l', 8625}, {'i', 8626}, {'H', 8627}, {'l', 8628}, {'n', 8629}, {'l', 8630}, {'t', 8631}, {';', 8632},
+    {'t', 8633}, {'e', 8634}, {'e', 8635}, {'s', 8636}, {';', 8637}, {'E', 8638}, {'S', 8639}, {'l', 8640},
+    {'a', 8641}, {'b', 8642}, {'p', 8643}, {'u', 8644}, {';', 8645}, {'E', 8646}, {'S', 8647}, {'T', 8648},
+    {';', 8649}, {'E', 8650}, {'a', 8651}, {'l', 8652}, {'d', 8653}, {'B', 8654}, {'u', 8655}, {'o', 8656},
+    {';', 8657}, {'e', 8658}, {'n', 8659}, {'a', 8660}, {'n', 8661}, {'d', 8662}, {'l', 8663}, {'e', 8664},
+    {'l', 8665}, {'u', 8666}, {'r', 8667}, {'a', 8668}, {'e', 8669}, {'g', 8670}, {'B', 8671}, {'e', 8672},
+    {'c', 8673}, {'o', 8674}, {'t', 8675}, {'l', 8676}, {'V', 8677}, {'e', 8678}, {'o', 8679}, {';', 8680},
+    {'B', 8681}, {'s', 8682}, {';', 8683}, {';', 8684}, {'r', 8685}, {'r', 8686}, {'r', 8687}, {'w', 8688},
+    {';', 8689}, {'s', 8690}, {'t', 8691}, {'s', 8692}, {';', 8693}, {';', 8694}, {'a', 8695}, {'n', 8696},
+    {'d', 8697}, {'a', 8698}, {'u', 8699}, {'t', 8700}, {'h', 8701}, {'A', 8702}, {';', 8703}, {'u', 8704},
+    {';', 8705}, {'r', 8706}, {'r', 8707}, {';', 8708}, {'e', 8709}, {'a', 8710}, {'d', 8711}, {'c', 8712},
+    {'a', 8713}, {';', 8714}, {'d', 8715}, {'u', 8716}, {'e', 8717}, {';', 8718}, {'l', 8719}, {'l', 8720},
+    {'r', 8721}, {';', 8722}, {';', 8723}, {';', 8724}, {';', 8725}, {'e', 8726}, {'i', 8727}, {';', 8728},
+    {'e', 8729}, {'d', 8730}, {'o', 8731}, {'l', 8732}, {'r', 8733}, {';', 8734}, {';', 8735}, {'e', 8736},
+    {'e', 8737}, {'o', 8738}, {'r', 8739}, {'i', 8740}, {'d', 8741}, {'u', 8742}, {'o', 8743}, {'r', 8744},
+    {'r', 8745}, {'u', 8746}, {'m', 8747}, {'o', 8748}, {'h', 8749}, {'r', 8750}, {'f', 8751}, {'g', 8752},
+    {'l', 8753}, {'r', 8754}, {';', 8755}, {'r', 8756}, {';', 8757}, {'l', 8758}, {'f', 8759}, {'g', 8760},
+    {';', 8761}, {';', 8762}, {';', 8763}, {'a', 8764}, {'n', 8765}, {'r', 8766}, {'r', 8767}, {'r', 8768},
+    {'r', 8769}, {'i', 8770}, {'q', 8771}, {'e', 8772}, {'u', 8773}, {'i', 8774}, {';', 8775}, {';', 8776},
+    {';', 8777}, {';', 8778}, {'n', 8779}, {'t', 8780}, {'h', 8781}, {'a', 8782}, {'t', 8783}, {';', 8784},
+    {'f', 8785}, {'g', 8786}, {'q', 8787}, {'q', 8788}, {'l', 8789}, {'r', 8790}, {'n', 8791}, {'r', 8792},
+    {'t', 8793}, {'u', 8794}, {'o', 8795}, {'r', 8796}, {'w', 8797}, {'c', 8798}, {'o', 8799}, {'r', 8800},
+    {'i', 8801}, {'D', 8802}, {'r', 8803}, {'r', 8804}, {'r', 8805}, {'g', 8806}, {'e', 8807}, {'f', 8808},
+    {'g', 8809}, {'r', 8810}, {'e', 8811}, {'w', 8812}, {'A', 8813}, {'a', 8814}, {';', 8815}, {'r', 8816},
+    {'t', 8817}, {'e', 8818}, {'o', 8819}, {'V', 8820}, {'t', 8821}, {';', 8822}, {'u', 8823}, {'l', 8824},
+    {';', 8825}, {'q', 8826}, {'a', 8827}, {';', 8828}, {'L', 8829}, {'q', 8830}, {'e', 8831}, {'E', 8832},
+    {';', 8833}, {';', 8834}, {'n', 8835}, {';', 8836}, {';', 8837}, {'m', 8838}, {'e', 8839}, {'c', 8840},
+    {';', 8841}, {'h', 8842}, {'a', 8843}, {'e', 8844}, {'o', 8845}, {'o', 8846}, {'t', 8847}, {';', 8848},
+    {'r', 8849}, {';', 8850}, {'B', 8851}, {'E', 8852}, {'c', 8853}, {'t', 8854}, {';', 8855}, {'B', 8856},
+    {'r', 8857}, {'o', 8858}, {'a', 8859}, {'l', 8860}, {'a', 8861}, {'w', 8862}, {'t', 8863}, {'o', 8864},
+    {'w', 8865}, {'t', 8866}, {'o', 8867}, {'o', 8868}, {'r', 8869}, {'u', 8870}, {'k', 8871}, {'S', 8872},
+    {'T', 8873}, {'r', 8874}, {'s', 8875}, {'p', 8876}, {';', 8877}, {'t', 8878}, {'e', 8879}, {'u', 8880},
+    {'l', 8881}, {'e', 8882}, {'s', 8883}, {'a', 8884}, {'l', 8885}, {'u', 8886}, {';', 8887}, {'g', 8888},
+    {';', 8889}, {'e', 8890}, {'E', 8891}, {';', 8892}, {'a', 8893}, {'s', 8894}, {'q', 8895}, {'l', 8896},
+    {'e', 8897}, {'n', 8898}, {'s', 8899}, {'e', 8900}, {'a', 8901}, {'q', 8902}, {'l', 8903}, {'i', 8904},
+    {'q', 8905}, {'l', 8906}, {'E', 8907}, {'e', 8908}, {'a', 8909}, {'b', 8910}, {'t', 8911}, {'s', 8912},
+    {'e', 8913}, {'l', 8914}, {'t', 8915}, {'e', 8916}, {';', 8917}, {'n', 8918}, {'i', 8919}, {'i', 8920},
+    {'a', 8921}, {'r', 8922}, {'f', 8923}, {';', 8924}, {'r', 8925}, {'V', 8926}, {'t', 8927}, {'w', 8928},
+    {'o', 8929}, {'e', 8930}, {'e', 8931}, {'c', 8932}, {'r', 8933}, {'a', 8934}, {';', 8935}, {'o', 8936},
+    {'o', 8937}, {'r', 8938}, {';', 8939}, {'e', 8940}, {';', 8941}, {'E', 8942}, {'e', 8943}, {'l', 8944},
+    {'t', 8945}, {'e', 8946}, {'l', 8947}, {'a', 8948}, {';', 8949}, {'e', 8950}, {'r', 8951}, {'m', 8952},
+    {'o', 8953}, {'r', 8954}, {';', 8955}, {'r', 8956}, {'e', 8957}, {'e', 8958}, {'c', 8959}, {'o', 8960},
+    {'p', 8961}, {';', 8962}, {'e', 8963}, {'e', 8964}, {'i', 8965}, {'f', 8966}, {'g', 8967}, {'s', 8968},
+    {'g', 8969}, {'w', 8970}, {'e', 8971}, {'i', 8972}, {';', 8973}, {'q', 8974}, {'w', 8975}, {'o', 8976},
+    {'l', 8977}, {'o', 8978}, {'p', 8979}, {'w', 8980}, {'o', 8981}, {'p', 8982}, {'i', 8983}, {'e', 8984},
+    {'w', 8985}, {'t', 8986}, {'o', 8987}, {'t', 8988}, {'h', 8989}, {'e', 8990}, {'r', 8991}, {'r', 8992},
+    {'e', 8993}, {'t', 8994}, {'h', 8995}, {'i', 8996}, {'d', 8997}, {'u', 8998}, {'o', 8999}, {'p', 9000},
+    {'r', 9001}, {'r', 9002}, {'m', 9003}, {';', 9004}, {'l', 9005}, {'s', 9006}, {'l', 9007}, {';', 9008},
+    {';', 9009}, {'e', 9010}, {'t', 9011}, {'r', 9012}, {'a', 9013}, {'t', 9014}, {'h', 9015}, {';', 9016},
+    {'q', 9017}, {';', 9018}, {'q', 9019}, {'e', 9020}, {'i', 9021}, {';', 9022}, {'e', 9023}, {'o', 9024},
+    {'b', 9025}, {'t', 9026}, {'a', 9027}, {'i', 9028}, {'u', 9029}, {'t', 9030}, {'u', 9031}, {'a', 9032},
+    {'l', 9033}, {';', 9034}, {'I', 9035}, {'o', 9036}, {'o', 9037}, {'h', 9038}, {';', 9039}, {'t', 9040},
+    {'h', 9041}, {'r', 9042}, {'e', 9043}, {';', 9044}, {'r', 9045}, {'l', 9046}, {'r', 9047}, {'V', 9048},
+    {'c', 9049}, {'r', 9050}, {'e', 9051}, {'o', 9052}, {'a', 9053}, {'l', 9054}, {'u', 9055}, {'l', 9056},
+    {'e', 9057}, {'u', 9058}, {'r', 9059}, {'q', 9060}, {'e', 9061}, {'a', 9062}, {'s', 9063}, {'k', 9064},
+    {'t', 9065}, {'c', 9066}, {'c', 9067}, {'r', 9068}, {'w', 9069}, {'o', 9070}, {';', 9071}, {'a', 9072},
+    {'q', 9073}, {'t', 9074}, {'o', 9075}, {'a', 9076}, {';', 9077}, {'w', 9078}, {'t', 9079}, {';', 9080},
+    {'l', 9081}, {';', 9082}, {'A', 9083}, {'w', 9084}, {';', 9085}, {'a', 9086}, {'w', 9087}, {'w', 9088},
+    {'o', 9089}, {'m', 9090}, {'S', 9091}, {'p', 9092}, {'h', 9093}, {'G', 9094}, {'s', 9095}, {'a', 9096},
+    {'i', 9097}, {';', 9098}, {'a', 9099}, {'l', 9100}, {'a', 9101}, {'s', 9102}, {'n', 9103}, {'d', 9104},
+    {'m', 9105}, {'l', 9106}, {'r', 9107}, {'q', 9108}, {'t', 9109}, {'L', 9110}, {'u', 9111}, {'a', 9112},
+    {'m', 9113}, {'g', 9114}, {'e', 9115}, {'r', 9116}, {'l', 9117}, {'u', 9118}, {'a', 9119}, {'l', 9120},
+    {'u', 9121}, {';', 9122}, {'q', 9123}, {';', 9124}, {'r', 9125}, {'l', 9126}, {'e', 9127}, {'i', 9128},
+    {';', 9129}, {';', 9130}, {'E', 9131}, {';', 9132}, {'t', 9133}, {'b', 9134}, {'l', 9135}, {'c', 9136},
+    {';', 9137}, {'t', 9138}, {'a', 9139}, {'e', 9140}, {'o', 9141}, {';', 9142}, {'r', 9143}, {';', 9144},
+    {'B', 9145}, {'E', 9146}, {'c', 9147}, {'t', 9148}, {';', 9149}, {'B', 9150}, {'r', 9151}, {'w', 9152},
+    {'w', 9153}, {'o', 9154}, {'c', 9155}, {'q', 9156}, {'t', 9157}, {';', 9158}, {'E', 9159}, {';', 9160},
+    {';', 9161}, {'l', 9162}, {'s', 9163}, {'r', 9164}, {';', 9165}, {'w', 9166}, {'o', 9167}, {'a', 9168},
+    {';', 9169}, {';', 9170}, {'e', 9171}, {'w', 9172}, {';', 9173}, {';', 9174}, {'d', 9175}, {'l', 9176},
+    {'r', 9177}, {'f', 9178}, {'g', 9179}, {'t', 9180}, {'h', 9181}, {';', 9182}, {'e', 9183}, {'s', 9184},
+    {'f', 9185}, {'g', 9186}, {';', 9187}, {';', 9188}, {'w', 9189}, {';', 9190}, {'w', 9191}, {';', 9192},
+    {'s', 9193}, {'w', 9194}, {'o', 9195}, {'g', 9196}, {'s', 9197}, {';', 9198}, {'a', 9199}, {'w', 9200},
+    {';', 9201}, {'t', 9202}, {';', 9203}, {'o', 9204}, {'o', 9205}, {'l', 9206}, {';', 9207}, {'e', 9208},
+    {'t', 9209}, {'l', 9210}, {'o', 9211}, {'p', 9212}, {'w', 9213}, {'o', 9214}, {'o', 9215}, {'o', 9216},
+    {'e', 9217}, {';', 9218}, {';', 9219}, {'o', 9220}, {'q', 9221}, {';', 9222}, {'e', 9223}, {'r', 9224},
+    {'r', 9225}, {';', 9226}, {'t', 9227}, {';', 9228}, {';', 9229}, {'f', 9230}, {'g', 9231}, {'n', 9232},
+    {'u', 9233}, {'l', 9234}, {'e', 9235}, {'l', 9236}, {'s', 9237}, {'t', 9238}, {';', 9239}, {'b', 9240},
+    {'v', 9241}, {'d', 9242}, {'n', 9243}, {'w', 9244}, {'w', 9245}, {'t', 9246}, {'A', 9247}, {'R', 9248},
+    {'t', 9249}, {'o', 9250}, {';', 9251}, {'r', 9252}, {'B', 9253}, {'o', 9254}, {'e', 9255}, {'t', 9256},
+    {';', 9257}, {'B', 9258}, {'c', 9259}, {'r', 9260}, {'r', 9261}, {'S', 9262}, {'a', 9263}, {'l', 9264},
+    {'s', 9265}, {'a', 9266}, {';', 9267}, {'u', 9268}, {';', 9269}, {';', 9270}, {';', 9271}, {'e', 9272},
+    {'A', 9273}, {'k', 9274}, {'t', 9275}, {';', 9276}, {'B', 9277}, {';', 9278}, {'r', 9279}, {'r', 9280},
+    {'u', 9281}, {'o', 9282}, {'r', 9283}, {'r', 9284}, {';', 9285}, {'e', 9286}, {';', 9287}, {'r', 9288},
+    {';', 9289}, {'r', 9290}, {';', 9291}, {';', 9292}, {'w', 9293}, {'S', 9294}, {'p', 9295}, {'a', 9296},
+    {'i', 9297}, {'r', 9298}, {';', 9299}, {'c', 9300}, {'c', 9301}, {'l', 9302}, {'E', 9303}, {'t', 9304},
+    {';', 9305}, {'t', 9306}, {'e', 9307}, {'p', 9308}, {'e', 9309}, {';', 9310}, {'u', 9311}, {'e', 9312},
+    {'e', 9313}, {'a', 9314}, {'n', 9315}, {'e', 9316}, {'l', 9317}, {'t', 9318}, {'s', 9319}, {';', 9320},
+    {'a', 9321}, {'n', 9322}, {'d', 9323}, {'a', 9324}, {'u', 9325}, {';', 9326}, {'e', 9327}, {';', 9328},
+    {'s', 9329}, {'q', 9330}, {';', 9331}, {'r', 9332}, {'i', 9333}, {'k', 9334}, {'A', 9335}, {'c', 9336},
+    {'c', 9337}, {'r', 9338}, {';', 9339}, {'a', 9340}, {'q', 9341}, {'t', 9342}, {'o', 9343}, {'a', 9344},
+    {';', 9345}, {';', 9346}, {';', 9347}, {'w', 9348}, {'t', 9349}, {'u', 9350}, {';', 9351}, {'E', 9352},
+    {'q', 9353}, {';', 9354}, {'i', 9355}, {'o', 9356}, {';', 9357}, {'w', 9358}, {'t', 9359}, {';', 9360},
+    {'n', 9361}, {'o', 9362}, {'e', 9363}, {'i', 9364}, {'t', 9365}, {'h', 9366}, {';', 9367}, {'t', 9368},
+    {';', 9369}, {';', 9370}, {'t', 9371}, {'h', 9372}, {';', 9373}, {'n', 9374}, {';', 9375}, {';', 9376},
+    {'s', 9377}, {'o', 9378}, {'a', 9379}, {';', 9380}, {'r', 9381}, {';', 9382}, {';', 9383}, {'w', 9384},
+    {'w', 9385}, {';', 9386}, {'q', 9387}, {';', 9388}, {'e', 9389}, {';', 9390}, {'w', 9391}, {';', 9392},
+    {'s', 9393}, {'o', 9394}, {'w', 9395}, {'w', 9396}, {'s', 9397}, {'n', 9398}, {';', 9399}, {'q', 9400},
+    {'o', 9401}, {'r', 9402}, {';', 9403}, {'t', 9404}, {'h', 9405}, {'t', 9406}, {'r', 9407}, {'e', 9408},
+    {';', 9409}, {';', 9410}, {'e', 9411}, {'e', 9412}, {'l', 9413}, {'e', 9414}, {'e', 9415}, {'t', 9416},
+    {';', 9417}, {';', 9418}, {'A', 9419}, {'r', 9420}, {'i', 9421}, {'A', 9422}, {'w', 9423}, {'o', 9424},
+    {'a', 9425}, {'w', 9426}, {'c', 9427}, {'o', 9428}, {'a', 9429}, {'t', 9430}, {';', 9431}, {'B', 9432},
+    {'e', 9433}, {'q', 9434}, {'r', 9435}, {'S', 9436}, {'s', 9437}, {'l', 9438}, {'a', 9439}, {'t', 9440},
+    {'r', 9441}, {'e', 9442}, {'o', 9443}, {'a', 9444}, {';', 9445}, {';', 9446}, {'a', 9447}, {'r', 9448},
+    {';', 9449}, {';', 9450}, {'r', 9451}, {'r', 9452}, {'r', 9453}, {';', 9454}, {'p', 9455}, {'a', 9456},
+    {'c', 9457}, {'n', 9458}, {'e', 9459}, {'e', 9460}, {'a', 9461}, {';', 9462}, {'q', 9463}, {'e', 9464},
+    {'E', 9465}, {';', 9466}, {';', 9467}, {';', 9468}, {'B', 9469}, {'E', 9470}, {'a', 9471}, {'r', 9472},
+    {'s', 9473}, {'l', 9474}, {'t', 9475}, {'n', 9476}, {'e', 9477}, {';', 9478}, {'E', 9479}, {'e', 9480},
+    {'l', 9481}, {'t', 9482}, {'e', 9483}, {'l', 9484}, {'a', 9485}, {'Q', 9486}, {';', 9487}, {'u', 9488},
+    {'i', 9489}, {'b', 9490}, {'e', 9491}, {'r', 9492}, {'k', 9493}, {'t', 9494}, {';', 9495}, {'B', 9496},
+    {'r', 9497}, {'u', 9498}, {'o', 9499}, {'r', 9500}, {'r', 9501}, {';', 9502}, {'i', 9503}, {'a', 9504},
+    {'q', 9505}, {'u', 9506}, {'s', 9507}, {'w', 9508}, {';', 9509}, {'o', 9510}, {';', 9511}, {'w', 9512},
+    {'f', 9513}, {'g', 9514}, {';', 9515}, {'t', 9516}, {';', 9517}, {';', 9518}, {'t', 9519}, {';', 9520},
+    {';', 9521}, {'n', 9522}, {'r', 9523}, {'r', 9524}, {';', 9525}, {';', 9526}, {';', 9527}, {'q', 9528},
+    {'n', 9529}, {';', 9530}, {'n', 9531}, {'s', 9532}, {';', 9533}, {';', 9534}, {';', 9535}, {';', 9536},
+    {'w', 9537}, {'o', 9538}, {';', 9539}, {'t', 9540}, {'i', 9541}, {'I', 9542}, {'Q', 9543}, {'C', 9544},
+    {';', 9545}, {'e', 9546}, {';', 9547}, {';', 9548}, {'e', 9549}, {'r', 9550}, {'r', 9551}, {'g', 9552},
+    {'r', 9553}, {';', 9554}, {'w', 9555}, {'r', 9556}, {';', 9557}, {'t', 9558}, {'r', 9559}, {'r', 9560},
+    {'o', 9561}, {'a', 9562}, {';', 9563}, {'u', 9564}, {'e', 9565}, {'q', 9566}, {';', 9567}, {';', 9568},
+    {'l', 9569}, {';', 9570}, {'r', 9571}, {'t', 9572}, {'r', 9573}, {'r', 9574}, {'l', 9575}, {';', 9576},
+    {';', 9577}, {'o', 9578}, {'o', 9579}, {'a', 9580}, {'c', 9581}, {'e', 9582}, {'S', 9583}, {'a', 9584},
+    {';', 9585}, {'l', 9586}, {'u', 9587}, {'r', 9588}, {'q', 9589}, {'a', 9590}, {'q', 9591}, {'l', 9592},
+    {'G', 9593}, {'s', 9594}, {';', 9595}, {'E', 9596}, {'t', 9597}, {';', 9598}, {'B', 9599}, {'E', 9600},
+    {'q', 9601}, {'t', 9602}, {';', 9603}, {'E', 9604}, {';', 9605}, {';', 9606}, {'l', 9607}, {'u', 9608},
+    {'a', 9609}, {'u', 9610}, {'r', 9611}, {'t', 9612}, {'r', 9613}, {'e', 9614}, {'o', 9615}, {'a', 9616},
+    {';', 9617}, {'a', 9618}, {'r', 9619}, {';', 9620}, {';', 9621}, {'o', 9622}, {'l', 9623}, {'u', 9624},
+    {'a', 9625}, {';', 9626}, {';', 9627}, {'r', 9628}, {'n', 9629}, {'t', 9630}, {'h', 9631}, {';', 9632},
+    {';', 9633}, {'s', 9634}, {'r', 9635}, {'o', 9636}, {';', 9637}, {';', 9638}, {'s', 9639}, {';', 9640},
+    {';', 9641}, {'w', 9642}, {';', 9643}, {'a', 9644}, {'n', 9645}, {'u', 9646}, {'o', 9647}, {'A', 9648},
+    {'g', 9649}, {'r', 9650}, {'o', 9651}, {'h', 9652}, {'r', 9653}, {';', 9654}, {';', 9655}, {'o', 9656},
+    {';', 9657}, {';', 9658}, {'r', 9659}, {'r', 9660}, {'a', 9661}, {';', 9662}, {'u', 9663}, {';', 9664},
+    {'o', 9665}, {';', 9666}, {';', 9667}, {';', 9668}, {';', 9669}, {'w', 9670}, {'w', 9671}, {'c', 9672},
+    {'e', 9673}, {';', 9674}, {'p', 9675}, {'t', 9676}, {'B', 9677}, {'a', 9678}, {';', 9679}, {'u', 9680},
+    {'r', 9681}, {'u', 9682}, {';', 9683}, {'r', 9684}, {';', 9685}, {'q', 9686}, {';', 9687}, {'a', 9688},
+    {'q', 9689}, {'u', 9690}, {';', 9691}, {'E', 9692}, {'q', 9693}, {';', 9694}, {'o', 9695}, {'l', 9696},
+    {'m', 9697}, {'i', 9698}, {';', 9699}, {'o', 9700}, {'t', 9701}, {'r', 9702}, {'r', 9703}, {'l', 9704},
+    {';', 9705}, {'n', 9706}, {';', 9707}, {'a', 9708}, {'l', 9709}, {';', 9710}, {';', 9711}, {';', 9712},
+    {'t', 9713}, {';', 9714}, {'o', 9715}, {'w', 9716}, {';', 9717}, {';', 9718}, {'l', 9719}, {'t', 9720},
+    {'o', 9721}, {'n', 9722}, {'c', 9723}, {'r', 9724}, {'o', 9725}, {'w', 9726}, {'t', 9727}, {'o', 9728},
+    {'r', 9729}, {';', 9730}, {';', 9731}, {'r', 9732}, {'a', 9733}, {'w', 9734}, {';', 9735}, {';', 9736},
+    {'e', 9737}, {';', 9738}, {'a', 9739}, {'e', 9740}, {'a', 9741}, {'l', 9742}, {'a', 9743}, {';', 9744},
+    {'a', 9745}, {'e', 9746}, {'u', 9747}, {'r', 9748}, {'u', 9749}, {'a', 9750}, {'q', 9751}, {'u', 9752},
+    {'t', 9753}, {';', 9754}, {';', 9755}, {'u', 9756}, {'w', 9757}, {';', 9758}, {';', 9759}, {';', 9760},
+    {';', 9761}, {';', 9762}, {'l', 9763}, {';', 9764}, {';', 9765}, {'w', 9766}, {';', 9767}, {'D', 9768},
+    {'e', 9769}, {'t', 9770}, {'t', 9771}, {'u', 9772}, {'a', 9773}, {'w', 9774}, {';', 9775}, {'A', 9776},
+    {'w', 9777}, {';', 9778}, {'e', 9779}, {'r', 9780}, {';', 9781}, {';', 9782}, {'c', 9783}, {'r', 9784},
+    {'r', 9785}, {';', 9786}, {'l', 9787}, {'l', 9788}, {'a', 9789}, {'a', 9790}, {';', 9791}, {'a', 9792},
+    {'l', 9793}, {'u', 9794}, {'a', 9795}, {'e', 9796}, {'m', 9797}, {';', 9798}, {';', 9799}, {';', 9800},
+    {';', 9801}, {'g', 9802}, {'e', 9803}, {'o', 9804}, {'t', 9805}, {'l', 9806}, {';', 9807}, {'r', 9808},
+    {';', 9809}, {';', 9810}, {'e', 9811}, {'e', 9812}, {';', 9813}, {';', 9814}, {';', 9815}, {';', 9816},
+    {'t', 9817}, {'l', 9818}, {'l', 9819}, {';', 9820}, {'a', 9821}, {'l', 9822}, {';', 9823}, {';', 9824},
+    {'r', 9825}, {';', 9826}, {'u', 9827}, {'e', 9828}, {';', 9829}, {'r', 9830}, {';', 9831}, {';', 9832},
+    {'e', 9833}, {';', 9834}, {';', 9835}, {'l', 9836}, {';', 9837}, {'a', 9838}, {'r', 9839}, {';', 9840},
+    {'o', 9841}, {'r', 9842}, {';', 9843}, {'l', 9844}, {'I', 9845}, {'w', 9846}, {';', 9847}, {';', 9848},
+    {'n', 9849}, {';', 9850}, {'t', 9851}, {'e', 9852}, {'g', 9853}, {'r', 9854}, {'a', 9855}, {'l', 9856},
+    {';', 9857},
+};
+
+inline constexpr std::string_view VALUES[1511] = {
+    "\303\206"sv,
+    "&"sv,
+    "'"sv,
+    "\303\201"sv,
+    "\304\202"sv,
+    "\303\202"sv,
+    "\320\220"sv,
+    "\360\235\224\204"sv,
+    "\303\200"sv,
+    "\316\221"sv,
+    "\304\200"sv,
+    "\342\251\223"sv,
+    "\304\204"sv,
+    "\360\235\224\270"sv,
+    "\342\201\241"sv,
+    "\303\205"sv,
+    "\360\235\222\234"sv,
+    "\342\211\224"sv,
+    "\303\203"sv,
+    "\303\204"sv,
+    "\342\210\226"sv,
+    "\342\253\247"sv,
+    "\342\214\206"sv,
+    "\320\221"sv,
+    "\342\210\265"sv,
+    "\342\204\254"sv,
+    "\316\222"sv,
+    "\360\235\224\205"sv,
+    "\360\235\224\271"sv,
+    "\313\230"sv,
+    "\342\211\216"sv,
+    "\320\247"sv,
+    "\302\251"sv,
+    "\304\206"sv,
+    "\342\213\222"sv,
+    "\342\205\205"sv,
+    "\342\204\255"sv,
+    "\304\214"sv,
+    "\303\207"sv,
+    "\304\210"sv,
+    "\342\210\260"sv,
+    "\304\212"sv,
+    "\302\270"sv,
+    "\302\267"sv,
+    "\316\247"sv,
+    "\342\212\231"sv,
+    "\342\212\226"sv,
+    "\342\212\225"sv,
+    "\342\212\227"sv,
+    "\342\210\262"sv,
+    "\342\200\235"sv,
+    "\342\200\231"sv,
+    "\342\210\267"sv,
+    "\342\251\264"sv,
+    "\342\211\241"sv,
+    "\342\210\257"sv,
+    "\342\210\256"sv,
+    "\342\204\202"sv,
+    "\342\210\220"sv,
+    "\342\210\263"sv,
+    "\342\250\257"sv,
+    "\360\235\222\236"sv,
+    "\342\213\223"sv,
+    "\342\211\215"sv,
+    "\342\244\221"sv,
+    "\320\202"sv,
+    "\320\205"sv,
+    "\320\217"sv,
+    "\342\200\241"sv,
+    "\342\206\241"sv,
+    "\342\253\244"sv,
+    "\304\216"sv,
+    "\320\224"sv,
+    "\342\210\207"sv,
+    "\316\224"sv,
+    "\360\235\224\207"sv,
+    "\302\264"sv,
+    "\313\231"sv,
+    "\313\235"sv,
+    "`"sv,
+    "\313\234"sv,
+    "\342\213\204"sv,
+    "\342\205\206"sv,
+    "\360\235\224\273"sv,
+    "\302\250"sv,
+    "\342\203\234"sv,
+    "\342\211\220"sv,
+    "\342\207\223"sv,
+    "\342\207\220"sv,
+    "\342\207\224"sv,
+    "\342\237\270"sv,
+    "\342\237\272"sv,
+    "\342\237\271"sv,
+    "\342\207\222"sv,
+    "\342\212\250"sv,
+    "\342\207\221"sv,
+    "\342\207\225"sv,
+    "\342\210\245"sv,
+    "\342\206\223"sv,
+    "\342\244\223"sv,
+    "\342\207\265"sv,
+    "\314\221"sv,
+    "\342\245\220"sv,
+    "\342\245\236"sv,
+    "\342\206\275"sv,
+    "\342\245\226"sv,
+    "\342\245\237"sv,
+    "\342\207\201"sv,
+    "\342\245\227"sv,
+    "\342\212\244"sv,
+    "\342\206\247"sv,
+    "\360\235\222\237"sv,
+    "\304\220"sv,
+    "\305\212"sv,
+    "\303\220"sv,
+    "\303\211"sv,
+    "\304\232"sv,
+    "\303\212"sv,
+    "\320\255"sv,
+    "\304\226"sv,
+    "\360\235\224\210"sv,
+    "\303\210"sv,
+    "\342\210\210"sv,
+    "\304\222"sv,
+    "\342\227\273"sv,
+    "\342\226\253"sv,
+    "\304\230"sv,
+    "\360\235\224\274"sv,
+    "\316\225"sv,
+    "\342\251\265"sv,
+    "\342\211\202"sv,
+    "\342\207\214"sv,
+    "\342\204\260"sv,
+    "\342\251\263"sv,
+    "\316\227"sv,
+    "\303\213"sv,
+    "\342\210\203"sv,
+    "\342\205\207"sv,
+    "\320\244"sv,
+    "\360\235\224\211"sv,
+    "\342\227\274"sv,
+    "\342\226\252"sv,
+    "\360\235\224\275"sv,
+    "\342\210\200"sv,
+    "\342\204\261"sv,
+    "\320\203"sv,
+    ">"sv,
+    "\316\223"sv,
+    "\317\234"sv,
+    "\304\236"sv,
+    "\304\242"sv,
+    "\304\234"sv,
+    "\320\223"sv,
+    "\304\240"sv,
+    "\360\235\224\212"sv,
+    "\342\213\231"sv,
+    "\360\235\224\276"sv,
+    "\342\211\245"sv,
+    "\342\213\233"sv,
+    "\342\211\247"sv,
+    "\342\252\242"sv,
+    "\342\211\267"sv,
+    "\342\251\276"sv,
+    "\342\211\263"sv,
+    "\360\235\222\242"sv,
+    "\342\211\253"sv,
+    "\320\252"sv,
+    "\313\207"sv,
+    "^"sv,
+    "\304\244"sv,
+    "\342\204\214"sv,
+    "\342\204\213"sv,
+    "\342\204\215"sv,
+    "\342\224\200"sv,
+    "\304\246"sv,
+    "\342\211\217"sv,
+    "\320\225"sv,
+    "\304\262"sv,
+    "\320\201"sv,
+    "\303\215"sv,
+    "\303\216"sv,
+    "\320\230"sv,
+    "\304\260"sv,
+    "\342\204\221"sv,
+    "\303\214"sv,
+    "\304\252"sv,
+    "\342\205\210"sv,
+    "\342\210\254"sv,
+    "\342\210\253"sv,
+    "\342\213\202"sv,
+    "\342\201\243"sv,
+    "\342\201\242"sv,
+    "\304\256"sv,
+    "\360\235\225\200"sv,
+    "\316\231"sv,
+    "\342\204\220"sv,
+    "\304\250"sv,
+    "\320\206"sv,
+    "\303\217"sv,
+    "\304\264"sv,
+    "\320\231"sv,
+    "\360\235\224\215"sv,
+    "\360\235\225\201"sv,
+    "\360\235\222\245"sv,
+    "\320\210"sv,
+    "\320\204"sv,
+    "\320\245"sv,
+    "\320\214"sv,
+    "\316\232"sv,
+    "\304\266"sv,
+    "\320\232"sv,
+    "\360\235\224\216"sv,
+    "\360\235\225\202"sv,
+    "\360\235\222\246"sv,
+    "\320\211"sv,
+    "<"sv,
+    "\304\271"sv,
+    "\316\233"sv,
+    "\342\237\252"sv,
+    "\342\204\222"sv,
+    "\342\206\236"sv,
+    "\304\275"sv,
+    "\304\273"sv,
+    "\320\233"sv,
+    "\342\237\250"sv,
+    "\342\206\220"sv,
+    "\342\207\244"sv,
+    "\342\207\206"sv,
+    "\342\214\210"sv,
+    "\342\237\246"sv,
+    "\342\245\241"sv,
+    "\342\207\203"sv,
+    "\342\245\231"sv,
+    "\342\214\212"sv,
+    "\342\206\224"sv,
+    "\342\245\216"sv,
+    "\342\212\243"sv,
+    "\342\206\244"sv,
+    "\342\245\232"sv,
+    "\342\212\262"sv,
+    "\342\247\217"sv,
+    "\342\212\264"sv,
+    "\342\245\221"sv,
+    "\342\245\240"sv,
+    "\342\206\277"sv,
+    "\342\245\230"sv,
+    "\342\206\274"sv,
+    "\342\245\222"sv,
+    "\342\213\232"sv,
+    "\342\211\246"sv,
+    "\342\211\266"sv,
+    "\342\252\241"sv,
+    "\342\251\275"sv,
+    "\342\211\262"sv,
+    "\360\235\224\217"sv,
+    "\342\213\230"sv,
+    "\342\207\232"sv,
+    "\304\277"sv,
+    "\342\237\265"sv,
+    "\342\237\267"sv,
+    "\342\237\266"sv,
+    "\360\235\225\203"sv,
+    "\342\206\231"sv,
+    "\342\206\230"sv,
+    "\342\206\260"sv,
+    "\305\201"sv,
+    "\342\211\252"sv,
+    "\342\244\205"sv,
+    "\320\234"sv,
+    "\342\201\237"sv,
+    "\342\204\263"sv,
+    "\360\235\224\220"sv,
+    "\342\210\223"sv,
+    "\360\235\225\204"sv,
+    "\316\234"sv,
+    "\320\212"sv,
+    "\305\203"sv,
+    "\305\207"sv,
+    "\305\205"sv,
+    "\320\235"sv,
+    "\342\200\213"sv,
+    "\012"sv,
+    "\360\235\224\221"sv,
+    "\342\201\240"sv,
+    "\302\240"sv,
+    "\342\204\225"sv,
+    "\342\253\254"sv,
+    "\342\211\242"sv,
+    "\342\211\255"sv,
+    "\342\210\246"sv,
+    "\342\210\211"sv,
+    "\342\211\240"sv,
+    "\342\211\202\314\270"sv,
+    "\342\210\204"sv,
+    "\342\211\257"sv,
+    "\342\211\261"sv,
+    "\342\211\247\314\270"sv,
+    "\342\211\253\314\270"sv,
+    "\342\211\271"sv,
+    "\342\251\276\314\270"sv,
+    "\342\211\265"sv,
+    "\342\211\216\314\270"sv,
+    "\342\211\217\314\270"sv,
+    "\342\213\252"sv,
+    "\342\247\217\314\270"sv,
+    "\342\213\254"sv,
+    "\342\211\256"sv,
+    "\342\211\260"sv,
+    "\342\211\270"sv,
+    "\342\211\252\314\270"sv,
+    "\342\251\275\314\270"sv,
+    "\342\211\264"sv,
+    "\342\252\242\314\270"sv,
+    "\342\252\241\314\270"sv,
+    "\342\212\200"sv,
+    "\342\252\257\314\270"sv,
+    "\342\213\240"sv,
+    "\342\210\214"sv,
+    "\342\213\253"sv,
+    "\342\247\220\314\270"sv,
+    "\342\213\255"sv,
+    "\342\212\217\314\270"sv,
+    "\342\213\242"sv,
+    "\342\212\220\314\270"sv,
+    "\342\213\243"sv,
+    "\342\212\202\342\203\222"sv,
+    "\342\212\210"sv,
+    "\342\212\201"sv,
+    "\342\252\260\314\270"sv,
+    "\342\213\241"sv,
+    "\342\211\277\314\270"sv,
+    "\342\212\203\342\203\222"sv,
+    "\342\212\211"sv,
+    "\342\211\201"sv,
+    "\342\211\204"sv,
+    "\342\211\207"sv,
+    "\342\211\211"sv,
+    "\342\210\244"sv,
+    "\360\235\222\251"sv,
+    "\303\221"sv,
+    "\316\235"sv,
+    "\305\222"sv,
+    "\303\223"sv,
+    "\303\224"sv,
+    "\320\236"sv,
+    "\305\220"sv,
+    "\360\235\224\222"sv,
+    "\303\222"sv,
+    "\305\214"sv,
+    "\316\251"sv,
+    "\316\237"sv,
+    "\360\235\225\206"sv,
+    "\342\200\234"sv,
+    "\342\200\230"sv,
+    "\342\251\224"sv,
+    "\360\235\222\252"sv,
+    "\303\230"sv,
+    "\303\225"sv,
+    "\342\250\267"sv,
+    "\303\226"sv,
+    "\342\200\276"sv,
+    "\342\217\236"sv,
+    "\342\216\264"sv,
+    "\342\217\234"sv,
+    "\342\210\202"sv,
+    "\320\237"sv,
+    "\360\235\224\223"sv,
+    "\316\246"sv,
+    "\316\240"sv,
+    "\302\261"sv,
+    "\342\204\231"sv,
+    "\342\252\273"sv,
+    "\342\211\272"sv,
+    "\342\252\257"sv,
+    "\342\211\274"sv,
+    "\342\211\276"sv,
+    "\342\200\263"sv,
+    "\342\210\217"sv,
+    "\342\210\235"sv,
+    "\360\235\222\253"sv,
+    "\316\250"sv,
+    "\042"sv,
+    "\360\235\224\224"sv,
+    "\342\204\232"sv,
+    "\360\235\222\254"sv,
+    "\342\244\220"sv,
+    "\302\256"sv,
+    "\305\224"sv,
+    "\342\237\253"sv,
+    "\342\206\240"sv,
+    "\342\244\226"sv,
+    "\305\230"sv,
+    "\305\226"sv,
+    "\320\240"sv,
+    "\342\204\234"sv,
+    "\342\210\213"sv,
+    "\342\207\213"sv,
+    "\342\245\257"sv,
+    "\316\241"sv,
+    "\342\237\251"sv,
+    "\342\206\222"sv,
+    "\342\207\245"sv,
+    "\342\207\204"sv,
+    "\342\214\211"sv,
+    "\342\237\247"sv,
+    "\342\245\235"sv,
+    "\342\207\202"sv,
+    "\342\245\225"sv,
+    "\342\214\213"sv,
+    "\342\212\242"sv,
+    "\342\206\246"sv,
+    "\342\245\233"sv,
+    "\342\212\263"sv,
+    "\342\247\220"sv,
+    "\342\212\265"sv,
+    "\342\245\217"sv,
+    "\342\245\234"sv,
+    "\342\206\276"sv,
+    "\342\245\224"sv,
+    "\342\207\200"sv,
+    "\342\245\223"sv,
+    "\342\204\235"sv,
+    "\342\245\260"sv,
+    "\342\207\233"sv,
+    "\342\204\233"sv,
+    "\342\206\261"sv,
+    "\342\247\264"sv,
+    "\320\251"sv,
+    "\320\250"sv,
+    "\320\254"sv,
+    "\305\232"sv,
+    "\342\252\274"sv,
+    "\305\240"sv,
+    "\305\236"sv,
+    "\305\234"sv,
+    "\320\241"sv,
+    "\360\235\224\226"sv,
+    "\342\206\221"sv,
+    "\316\243"sv,
+    "\342\210\230"sv,
+    "\360\235\225\212"sv,
+    "\342\210\232"sv,
+    "\342\226\241"sv,
+    "\342\212\223"sv,
+    "\342\212\217"sv,
+    "\342\212\221"sv,
+    "\342\212\220"sv,
+    "\342\212\222"sv,
+    "\342\212\224"sv,
+    "\360\235\222\256"sv,
+    "\342\213\206"sv,
+    "\342\213\220"sv,
+    "\342\212\206"sv,
+    "\342\211\273"sv,
+    "\342\252\260"sv,
+    "\342\211\275"sv,
+    "\342\211\277"sv,
+    "\342\210\221"sv,
+    "\342\213\221"sv,
+    "\342\212\203"sv,
+    "\342\212\207"sv,
+    "\303\236"sv,
+    "\342\204\242"sv,
+    "\320\213"sv,
+    "\320\246"sv,
+    "\011"sv,
+    "\316\244"sv,
+    "\305\244"sv,
+    "\305\242"sv,
+    "\320\242"sv,
+    "\360\235\224\227"sv,
+    "\342\210\264"sv,
+    "\316\230"sv,
+    "\342\201\237\342\200\212"sv,
+    "\342\200\211"sv,
+    "\342\210\274"sv,
+    "\342\211\203"sv,
+    "\342\211\205"sv,
+    "\342\211\210"sv,
+    "\360\235\225\213"sv,
+    "\342\203\233"sv,
+    "\360\235\222\257"sv,
+    "\305\246"sv,
+    "\303\232"sv,
+    "\342\206\237"sv,
+    "\342\245\211"sv,
+    "\320\216"sv,
+    "\305\254"sv,
+    "\303\233"sv,
+    "\320\243"sv,
+    "\305\260"sv,
+    "\360\235\224\230"sv,
+    "\303\231"sv,
+    "\305\252"sv,
+    "_"sv,
+    "\342\217\237"sv,
+    "\342\216\265"sv,
+    "\342\217\235"sv,
+    "\342\213\203"sv,
+    "\342\212\216"sv,
+    "\305\262"sv,
+    "\360\235\225\214"sv,
+    "\342\244\222"sv,
+    "\342\207\205"sv,
+    "\342\206\225"sv,
+    "\342\245\256"sv,
+    "\342\212\245"sv,
+    "\342\206\245"sv,
+    "\342\206\226"sv,
+    "\342\206\227"sv,
+    "\317\222"sv,
+    "\316\245"sv,
+    "\305\256"sv,
+    "\360\235\222\260"sv,
+    "\305\250"sv,
+    "\303\234"sv,
+    "\342\212\253"sv,
+    "\342\253\253"sv,
+    "\320\222"sv,
+    "\342\212\251"sv,
+    "\342\253\246"sv,
+    "\342\213\201"sv,
+    "\342\200\226"sv,
+    "\342\210\243"sv,
+    "|"sv,
+    "\342\235\230"sv,
+    "\342\211\200"sv,
+    "\342\200\212"sv,
+    "\360\235\224\231"sv,
+    "\360\235\225\215"sv,
+    "\360\235\222\261"sv,
+    "\342\212\252"sv,
+    "\305\264"sv,
+    "\342\213\200"sv,
+    "\360\235\224\232"sv,
+    "\360\235\225\216"sv,
+    "\360\235\222\262"sv,
+    "\360\235\224\233"sv,
+    "\316\236"sv,
+    "\360\235\225\217"sv,
+    "\360\235\222\263"sv,
+    "\320\257"sv,
+    "\320\207"sv,
+    "\320\256"sv,
+    "\303\235"sv,
+    "\305\266"sv,
+    "\320\253"sv,
+    "\360\235\224\234"sv,
+    "\360\235\225\220"sv,
+    "\360\235\222\264"sv,
+    "\305\270"sv,
+    "\320\226"sv,
+    "\305\271"sv,
+    "\305\275"sv,
+    "\320\227"sv,
+    "\305\273"sv,
+    "\316\226"sv,
+    "\342\204\250"sv,
+    "\342\204\244"sv,
+    "\360\235\222\265"sv,
+    "\303\241"sv,
+    "\304\203"sv,
+    "\342\210\276"sv,
+    "\342\210\276\314\263"sv,
+    "\342\210\277"sv,
+    "\303\242"sv,
+    "\320\260"sv,
+    "\303\246"sv,
+    "\360\235\224\236"sv,
+    "\303\240"sv,
+    "\342\204\265"sv,
+    "\316\261"sv,
+    "\304\201"sv,
+    "\342\250\277"sv,
+    "\342\210\247"sv,
+    "\342\251\225"sv,
+    "\342\251\234"sv,
+    "\342\251\230"sv,
+    "\342\251\232"sv,
+    "\342\210\240"sv,
+    "\342\246\244"sv,
+    "\342\210\241"sv,
+    "\342\246\250"sv,
+    "\342\246\251"sv,
+    "\342\246\252"sv,
+    "\342\246\253"sv,
+    "\342\246\254"sv,
+    "\342\246\255"sv,
+    "\342\246\256"sv,
+    "\342\246\257"sv,
+    "\342\210\237"sv,
+    "\342\212\276"sv,
+    "\342\246\235"sv,
+    "\342\210\242"sv,
+    "\342\215\274"sv,
+    "\304\205"sv,
+    "\360\235\225\222"sv,
+    "\342\251\260"sv,
+    "\342\251\257"sv,
+    "\342\211\212"sv,
+    "\342\211\213"sv,
+    "\303\245"sv,
+    "\360\235\222\266"sv,
+    "*"sv,
+    "\303\243"sv,
+    "\303\244"sv,
+    "\342\250\221"sv,
+    "\342\253\255"sv,
+    "\342\211\214"sv,
+    "\317\266"sv,
+    "\342\200\265"sv,
+    "\342\210\275"sv,
+    "\342\213\215"sv,
+    "\342\212\275"sv,
+    "\342\214\205"sv,
+    "\342\216\266"sv,
+    "\320\261"sv,
+    "\342\200\236"sv,
+    "\342\246\260"sv,
+    "\316\262"sv,
+    "\342\204\266"sv,
+    "\342\211\254"sv,
+    "\360\235\224\237"sv,
+    "\342\227\257"sv,
+    "\342\250\200"sv,
+    "\342\250\201"sv,
+    "\342\250\202"sv,
+    "\342\250\206"sv,
+    "\342\230\205"sv,
+    "\342\226\275"sv,
+    "\342\226\263"sv,
+    "\342\250\204"sv,
+    "\342\244\215"sv,
+    "\342\247\253"sv,
+    "\342\226\264"sv,
+    "\342\226\276"sv,
+    "\342\227\202"sv,
+    "\342\226\270"sv,
+    "\342\220\243"sv,
+    "\342\226\222"sv,
+    "\342\226\221"sv,
+    "\342\226\223"sv,
+    "\342\226\210"sv,
+    "=\342\203\245"sv,
+    "\342\211\241\342\203\245"sv,
+    "\342\214\220"sv,
+    "\360\235\225\223"sv,
+    "\342\213\210"sv,
+    "\342\225\227"sv,
+    "\342\225\224"sv,
+    "\342\225\226"sv,
+    "\342\225\223"sv,
+    "\342\225\220"sv,
+    "\342\225\246"sv,
+    "\342\225\251"sv,
+    "\342\225\244"sv,
+    "\342\225\247"sv,
+    "\342\225\235"sv,
+    "\342\225\232"sv,
+    "\342\225\234"sv,
+    "\342\225\231"sv,
+    "\342\225\221"sv,
+    "\342\225\254"sv,
+    "\342\225\243"sv,
+    "\342\225\240"sv,
+    "\342\225\253"sv,
+    "\342\225\242"sv,
+    "\342\225\237"sv,
+    "\342\247\211"sv,
+    "\342\225\225"sv,
+    "\342\225\222"sv,
+    "\342\224\220"sv,
+    "\342\224\214"sv,
+    "\342\225\245"sv,
+    "\342\225\250"sv,
+    "\342\224\254"sv,
+    "\342\224\264"sv,
+    "\342\212\237"sv,
+    "\342\212\236"sv,
+    "\342\212\240"sv,
+    "\342\225\233"sv,
+    "\342\225\230"sv,
+    "\342\224\230"sv,
+    "\342\224\224"sv,
+    "\342\224\202"sv,
+    "\342\225\252"sv,
+    "\342\225\241"sv,
+    "\342\225\236"sv,
+    "\342\224\274"sv,
+    "\342\224\244"sv,
+    "\342\224\234"sv,
+    "\302\246"sv,
+    "\360\235\222\267"sv,
+    "\342\201\217"sv,
+    "\134"sv,
+    "\342\247\205"sv,
+    "\342\237\210"sv,
+    "\342\200\242"sv,
+    "\342\252\256"sv,
+    "\304\207"sv,
+    "\342\210\251"sv,
+    "\342\251\204"sv,
+    "\342\251\211"sv,
+    "\342\251\213"sv,
+    "\342\251\207"sv,
+    "\342\251\200"sv,
+    "\342\210\251\357\270\200"sv,
+    "\342\201\201"sv,
+    "\342\251\215"sv,
+    "\304\215"sv,
+    "\303\247"sv,
+    "\304\211"sv,
+    "\342\251\214"sv,
+    "\342\251\220"sv,
+    "\304\213"sv,
+    "\342\246\262"sv,
+    "\302\242"sv,
+    "\360\235\224\240"sv,
+    "\321\207"sv,
+    "\342\234\223"sv,
+    "\317\207"sv,
+    "\342\227\213"sv,
+    "\342\247\203"sv,
+    "\313\206"sv,
+    "\342\211\227"sv,
+    "\342\206\272"sv,
+    "\342\206\273"sv,
+    "\342\223\210"sv,
+    "\342\212\233"sv,
+    "\342\212\232"sv,
+    "\342\212\235"sv,
+    "\342\250\220"sv,
+    "\342\253\257"sv,
+    "\342\247\202"sv,
+    "\342\231\243"sv,
+    ":"sv,
+    ","sv,
+    "@"sv,
+    "\342\210\201"sv,
+    "\342\251\255"sv,
+    "\360\235\225\224"sv,
+    "\342\204\227"sv,
+    "\342\206\265"sv,
+    "\342\234\227"sv,
+    "\360\235\222\270"sv,
+    "\342\253\217"sv,
+    "\342\253\221"sv,
+    "\342\253\220"sv,
+    "\342\253\222"sv,
+    "\342\213\257"sv,
+    "\342\244\270"sv,
+    "\342\244\265"sv,
+    "\342\213\236"sv,
+    "\342\213\237"sv,
+    "\342\206\266"sv,
+    "\342\244\275"sv,
+    "\342\210\252"sv,
+    "\342\251\210"sv,
+    "\342\251\206"sv,
+    "\342\251\212"sv,
+    "\342\212\215"sv,
+    "\342\251\205"sv,
+    "\342\210\252\357\270\200"sv,
+    "\342\206\267"sv,
+    "\342\244\274"sv,
+    "\342\213\216"sv,
+    "\342\213\217"sv,
+    "\302\244"sv,
+    "\342\210\261"sv,
+    "\342\214\255"sv,
+    "\342\245\245"sv,
+    "\342\200\240"sv,
+    "\342\204\270"sv,
+    "\342\200\220"sv,
+    "\342\244\217"sv,
+    "\304\217"sv,
+    "\320\264"sv,
+    "\342\207\212"sv,
+    "\342\251\267"sv,
+    "\302\260"sv,
+    "\316\264"sv,
+    "\342\246\261"sv,
+    "\342\245\277"sv,
+    "\360\235\224\241"sv,
+    "\342\231\246"sv,
+    "\317\235"sv,
+    "\342\213\262"sv,
+    "\303\267"sv,
+    "\342\213\207"sv,
+    "\321\222"sv,
+    "\342\214\236"sv,
+    "\342\214\215"sv,
+    "$"sv,
+    "\360\235\225\225"sv,
+    "\342\211\221"sv,
+    "\342\210\270"sv,
+    "\342\210\224"sv,
+    "\342\212\241"sv,
+    "\342\214\237"sv,
+    "\342\214\214"sv,
+    "\360\235\222\271"sv,
+    "\321\225"sv,
+    "\342\247\266"sv,
+    "\304\221"sv,
+    "\342\213\261"sv,
+    "\342\226\277"sv,
+    "\342\246\246"sv,
+    "\321\237"sv,
+    "\342\237\277"sv,
+    "\303\251"sv,
+    "\342\251\256"sv,
+    "\304\233"sv,
+    "\342\211\226"sv,
+    "\303\252"sv,
+    "\342\211\225"sv,
+    "\321\215"sv,
+    "\304\227"sv,
+    "\342\211\222"sv,
+    "\360\235\224\242"sv,
+    "\342\252\232"sv,
+    "\303\250"sv,
+    "\342\252\226"sv,
+    "\342\252\230"sv,
+    "\342\252\231"sv,
+    "\342\217\247"sv,
+    "\342\204\223"sv,
+    "\342\252\225"sv,
+    "\342\252\227"sv,
+    "\304\223"sv,
+    "\342\210\205"sv,
+    "\342\200\204"sv,
+    "\342\200\205"sv,
+    "\342\200\203"sv,
+    "\305\213"sv,
+    "\342\200\202"sv,
+    "\304\231"sv,
+    "\360\235\225\226"sv,
+    "\342\213\225"sv,
+    "\342\247\243"sv,
+    "\342\251\261"sv,
+    "\316\265"sv,
+    "\317\265"sv,
+    "="sv,
+    "\342\211\237"sv,
+    "\342\251\270"sv,
+    "\342\247\245"sv,
+    "\342\211\223"sv,
+    "\342\245\261"sv,
+    "\342\204\257"sv,
+    "\316\267"sv,
+    "\303\260"sv,
+    "\303\253"sv,
+    "\342\202\254"sv,
+    "!"sv,
+    "\321\204"sv,
+    "\342\231\200"sv,
+    "\357\254\203"sv,
+    "\357\254\200"sv,
+    "\357\254\204"sv,
+    "\360\235\224\243"sv,
+    "\357\254\201"sv,
+    "fj"sv,
+    "\342\231\255"sv,
+    "\357\254\202"sv,
+    "\342\226\261"sv,
+    "\306\222"sv,
+    "\360\235\225\227"sv,
+    "\342\213\224"sv,
+    "\342\253\231"sv,
+    "\342\250\215"sv,
+    "\302\275"sv,
+    "\342\205\223"sv,
+    "\302\274"sv,
+    "\342\205\225"sv,
+    "\342\205\231"sv,
+    "\342\205\233"sv,
+    "\342\205\224"sv,
+    "\342\205\226"sv,
+    "\302\276"sv,
+    "\342\205\227"sv,
+    "\342\205\234"sv,
+    "\342\205\230"sv,
+    "\342\205\232"sv,
+    "\342\205\235"sv,
+    "\342\205\236"sv,
+    "\342\201\204"sv,
+    "\342\214\242"sv,
+    "\360\235\222\273"sv,
+    "\342\252\214"sv,
+    "\307\265"sv,
+    "\316\263"sv,
+    "\342\252\206"sv,
+    "\304\237"sv,
+    "\304\235"sv,
+    "\320\263"sv,
+    "\304\241"sv,
+    "\342\252\251"sv,
+    "\342\252\200"sv,
+    "\342\252\202"sv,
+    "\342\252\204"sv,
+    "\342\213\233\357\270\200"sv,
+    "\342\252\224"sv,
+    "\360\235\224\244"sv,
+    "\342\204\267"sv,
+    "\321\223"sv,
+    "\342\252\222"sv,
+    "\342\252\245"sv,
+    "\342\252\244"sv,
+    "\342\211\251"sv,
+    "\342\252\212"sv,
+    "\342\252\210"sv,
+    "\342\213\247"sv,
+    "\360\235\225\230"sv,
+    "\342\204\212"sv,
+    "\342\252\216"sv,
+    "\342\252\220"sv,
+    "\342\252\247"sv,
+    "\342\251\272"sv,
+    "\342\213\227"sv,
+    "\342\246\225"sv,
+    "\342\251\274"sv,
+    "\342\245\270"sv,
+    "\342\211\251\357\270\200"sv,
+    "\321\212"sv,
+    "\342\245\210"sv,
+    "\342\206\255"sv,
+    "\342\204\217"sv,
+    "\304\245"sv,
+    "\342\231\245"sv,
+    "\342\200\246"sv,
+    "\342\212\271"sv,
+    "\360\235\224\245"sv,
+    "\342\244\245"sv,
+    "\342\244\246"sv,
+    "\342\207\277"sv,
+    "\342\210\273"sv,
+    "\342\206\251"sv,
+    "\342\206\252"sv,
+    "\360\235\225\231"sv,
+    "\342\200\225"sv,
+    "\360\235\222\275"sv,
+    "\304\247"sv,
+    "\342\201\203"sv,
+    "\303\255"sv,
+    "\303\256"sv,
+    "\320\270"sv,
+    "\320\265"sv,
+    "\302\241"sv,
+    "\360\235\224\246"sv,
+    "\303\254"sv,
+    "\342\250\214"sv,
+    "\342\210\255"sv,
+    "\342\247\234"sv,
+    "\342\204\251"sv,
+    "\304\263"sv,
+    "\304\253"sv,
+    "\304\261"sv,
+    "\342\212\267"sv,
+    "\306\265"sv,
+    "\342\204\205"sv,
+    "\342\210\236"sv,
+    "\342\247\235"sv,
+    "\342\212\272"sv,
+    "\342\250\227"sv,
+    "\342\250\274"sv,
+    "\321\221"sv,
+    "\304\257"sv,
+    "\360\235\225\232"sv,
+    "\316\271"sv,
+    "\302\277"sv,
+    "\360\235\222\276"sv,
+    "\342\213\271"sv,
+    "\342\213\265"sv,
+    "\342\213\264"sv,
+    "\342\213\263"sv,
+    "\304\251"sv,
+    "\321\226"sv,
+    "\303\257"sv,
+    "\304\265"sv,
+    "\320\271"sv,
+    "\360\235\224\247"sv,
+    "\310\267"sv,
+    "\360\235\225\233"sv,
+    "\360\235\222\277"sv,
+    "\321\230"sv,
+    "\321\224"sv,
+    "\316\272"sv,
+    "\317\260"sv,
+    "\304\267"sv,
+    "\320\272"sv,
+    "\360\235\224\250"sv,
+    "\304\270"sv,
+    "\321\205"sv,
+    "\321\234"sv,
+    "\360\235\225\234"sv,
+    "\360\235\223\200"sv,
+    "\342\244\233"sv,
+    "\342\244\216"sv,
+    "\342\252\213"sv,
+    "\342\245\242"sv,
+    "\304\272"sv,
+    "\342\246\264"sv,
+    "\316\273"sv,
+    "\342\246\221"sv,
+    "\342\252\205"sv,
+    "\302\253"sv,
+    "\342\244\237"sv,
+    "\342\244\235"sv,
+    "\342\206\253"sv,
+    "\342\244\271"sv,
+    "\342\245\263"sv,
+    "\342\206\242"sv,
+    "\342\252\253"sv,
+    "\342\244\231"sv,
+    "\342\252\255"sv,
+    "\342\252\255\357\270\200"sv,
+    "\342\244\214"sv,
+    "\342\235\262"sv,
+    "{"sv,
+    "["sv,
+    "\342\246\213"sv,
+    "\342\246\217"sv,
+    "\342\246\215"sv,
+    "\304\276"sv,
+    "\304\274"sv,
+    "\320\273"sv,
+    "\342\244\266"sv,
+    "\342\245\247"sv,
+    "\342\245\213"sv,
+    "\342\206\262"sv,
+    "\342\211\244"sv,
+    "\342\207\207"sv,
+    "\342\213\213"sv,
+    "\342\252\250"sv,
+    "\342\251\277"sv,
+    "\342\252\201"sv,
+    "\342\252\203"sv,
+    "\342\213\232\357\270\200"sv,
+    "\342\252\223"sv,
+    "\342\213\226"sv,
+    "\342\245\274"sv,
+    "\360\235\224\251"sv,
+    "\342\252\221"sv,
+    "\342\245\252"sv,
+    "\342\226\204"sv,
+    "\321\231"sv,
+    "\342\245\253"sv,
+    "\342\227\272"sv,
+    "\305\200"sv,
+    "\342\216\260"sv,
+    "\342\211\250"sv,
+    "\342\252\211"sv,
+    "\342\252\207"sv,
+    "\342\213\246"sv,
+    "\342\237\254"sv,
+    "\342\207\275"sv,
+    "\342\237\274"sv,
+    "\342\206\254"sv,
+    "\342\246\205"sv,
+    "\360\235\225\235"sv,
+    "\342\250\255"sv,
+    "\342\250\264"sv,
+    "\342\210\227"sv,
+    "\342\227\212"sv,
+    "("sv,
+    "\342\246\223"sv,
+    "\342\245\255"sv,
+    "\342\200\216"sv,
+    "\342\212\277"sv,
+    "\342\200\271"sv,
+    "\360\235\223\201"sv,
+    "\342\252\215"sv,
+    "\342\252\217"sv,
+    "\342\200\232"sv,
+    "\305\202"sv,
+    "\342\252\246"sv,
+    "\342\251\271"sv,
+    "\342\213\211"sv,
+    "\342\245\266"sv,
+    "\342\251\273"sv,
+    "\342\246\226"sv,
+    "\342\227\203"sv,
+    "\342\245\212"sv,
+    "\342\245\246"sv,
+    "\342\211\250\357\270\200"sv,
+    "\342\210\272"sv,
+    "\302\257"sv,
+    "\342\231\202"sv,
+    "\342\234\240"sv,
+    "\342\226\256"sv,
+    "\342\250\251"sv,
+    "\320\274"sv,
+    "\342\200\224"sv,
+    "\360\235\224\252"sv,
+    "\342\204\247"sv,
+    "\302\265"sv,
+    "\342\253\260"sv,
+    "\342\210\222"sv,
+    "\342\250\252"sv,
+    "\342\253\233"sv,
+    "\342\212\247"sv,
+    "\360\235\225\236"sv,
+    "\360\235\223\202"sv,
+    "\316\274"sv,
+    "\342\212\270"sv,
+    "\342\213\231\314\270"sv,
+    "\342\211\253\342\203\222"sv,
+    "\342\207\215"sv,
+    "\342\207\216"sv,
+    "\342\213\230\314\270"sv,
+    "\342\211\252\342\203\222"sv,
+    "\342\207\217"sv,
+    "\342\212\257"sv,
+    "\342\212\256"sv,
+    "\305\204"sv,
+    "\342\210\240\342\203\222"sv,
+    "\342\251\260\314\270"sv,
+    "\342\211\213\314\270"sv,
+    "\305\211"sv,
+    "\342\231\256"sv,
+    "\342\251\203"sv,
+    "\305\210"sv,
+    "\305\206"sv,
+    "\342\251\255\314\270"sv,
+    "\342\251\202"sv,
+    "\320\275"sv,
+    "\342\200\223"sv,
+    "\342\207\227"sv,
+    "\342\244\244"sv,
+    "\342\211\220\314\270"sv,
+    "\342\244\250"sv,
+    "\360\235\224\253"sv,
+    "\342\206\256"sv,
+    "\342\253\262"sv,
+    "\342\213\274"sv,
+    "\342\213\272"sv,
+    "\321\232"sv,
+    "\342\211\246\314\270"sv,
+    "\342\206\232"sv,
+    "\342\200\245"sv,
+    "\360\235\225\237"sv,
+    "\302\254"sv,
+    "\342\213\271\314\270"sv,
+    "\342\213\265\314\270"sv,
+    "\342\213\267"sv,
+    "\342\213\266"sv,
+    "\342\213\276"sv,
+    "\342\213\275"sv,
+    "\342\253\275\342\203\245"sv,
+    "\342\210\202\314\270"sv,
+    "\342\250\224"sv,
+    "\342\206\233"sv,
+    "\342\244\263\314\270"sv,
+    "\342\206\235\314\270"sv,
+    "\360\235\223\203"sv,
+    "\342\212\204"sv,
+    "\342\253\205\314\270"sv,
+    "\342\212\205"sv,
+    "\342\253\206\314\270"sv,
+    "\303\261"sv,
+    "\316\275"sv,
+    "#"sv,
+    "\342\204\226"sv,
+    "\342\200\207"sv,
+    "\342\212\255"sv,
+    "\342\244\204"sv,
+    "\342\211\215\342\203\222"sv,
+    "\342\212\254"sv,
+    "\342\211\245\342\203\222"sv,
+    ">\342\203\222"sv,
+    "\342\247\236"sv,
+    "\342\244\202"sv,
+    "\342\211\244\342\203\222"sv,
+    "<\342\203\222"sv,
+    "\342\212\264\342\203\222"sv,
+    "\342\244\203"sv,
+    "\342\212\265\342\203\222"sv,
+    "\342\210\274\342\203\222"sv,
+    "\342\207\226"sv,
+    "\342\244\243"sv,
+    "\342\244\247"sv,
+    "\303\263"sv,
+    "\303\264"sv,
+    "\320\276"sv,
+    "\305\221"sv,
+    "\342\250\270"sv,
+    "\342\246\274"sv,
+    "\305\223"sv,
+    "\342\246\277"sv,
+    "\360\235\224\254"sv,
+    "\313\233"sv,
+    "\303\262"sv,
+    "\342\247\201"sv,
+    "\342\246\265"sv,
+    "\342\246\276"sv,
+    "\342\246\273"sv,
+    "\342\247\200"sv,
+    "\305\215"sv,
+    "\317\211"sv,
+    "\316\277"sv,
+    "\342\246\266"sv,
+    "\360\235\225\240"sv,
+    "\342\246\267"sv,
+    "\342\246\271"sv,
+    "\342\210\250"sv,
+    "\342\251\235"sv,
+    "\342\204\264"sv,
+    "\302\252"sv,
+    "\302\272"sv,
+    "\342\212\266"sv,
+    "\342\251\226"sv,
+    "\342\251\227"sv,
+    "\342\251\233"sv,
+    "\303\270"sv,
+    "\342\212\230"sv,
+    "\303\265"sv,
+    "\342\250\266"sv,
+    "\303\266"sv,
+    "\342\214\275"sv,
+    "\302\266"sv,
+    "\342\253\263"sv,
+    "\342\253\275"sv,
+    "\320\277"sv,
+    "%"sv,
+    "."sv,
+    "\342\200\260"sv,
+    "\342\200\261"sv,
+    "\360\235\224\255"sv,
+    "\317\206"sv,
+    "\317\225"sv,
+    "\342\230\216"sv,
+    "\317\200"sv,
+    "\317\226"sv,
+    "\342\204\216"sv,
+    "+"sv,
+    "\342\250\243"sv,
+    "\342\250\242"sv,
+    "\342\250\245"sv,
+    "\342\251\262"sv,
+    "\342\250\246"sv,
+    "\342\250\247"sv,
+    "\342\250\225"sv,
+    "\360\235\225\241"sv,
+    "\302\243"sv,
+    "\342\252\263"sv,
+    "\342\252\267"sv,
+    "\342\252\271"sv,
+    "\342\252\265"sv,
+    "\342\213\250"sv,
+    "\342\200\262"sv,
+    "\342\214\256"sv,
+    "\342\214\222"sv,
+    "\342\214\223"sv,
+    "\342\212\260"sv,
+    "\360\235\223\205"sv,
+    "\317\210"sv,
+    "\342\200\210"sv,
+    "\360\235\224\256"sv,
+    "\360\235\225\242"sv,
+    "\342\201\227"sv,
+    "\360\235\223\206"sv,
+    "\342\250\226"sv,
+    "?"sv,
+    "\342\244\234"sv,
+    "\342\245\244"sv,
+    "\342\210\275\314\261"sv,
+    "\305\225"sv,
+    "\342\246\263"sv,
+    "\342\246\222"sv,
+    "\342\246\245"sv,
+    "\302\273"sv,
+    "\342\245\265"sv,
+    "\342\244\240"sv,
+    "\342\244\263"sv,
+    "\342\244\236"sv,
+    "\342\245\205"sv,
+    "\342\245\264"sv,
+    "\342\206\243"sv,
+    "\342\206\235"sv,
+    "\342\244\232"sv,
+    "\342\210\266"sv,
+    "\342\235\263"sv,
+    "}"sv,
+    "]"sv,
+    "\342\246\214"sv,
+    "\342\246\216"sv,
+    "\342\246\220"sv,
+    "\305\231"sv,
+    "\305\227"sv,
+    "\321\200"sv,
+    "\342\244\267"sv,
+    "\342\245\251"sv,
+    "\342\206\263"sv,
+    "\342\226\255"sv,
+    "\342\245\275"sv,
+    "\360\235\224\257"sv,
+    "\342\245\254"sv,
+    "\317\201"sv,
+    "\317\261"sv,
+    "\342\207\211"sv,
+    "\342\213\214"sv,
+    "\313\232"sv,
+    "\342\200\217"sv,
+    "\342\216\261"sv,
+    "\342\253\256"sv,
+    "\342\237\255"sv,
+    "\342\207\276"sv,
+    "\342\246\206"sv,
+    "\360\235\225\243"sv,
+    "\342\250\256"sv,
+    "\342\250\265"sv,
+    ")"sv,
+    "\342\246\224"sv,
+    "\342\250\222"sv,
+    "\342\200\272"sv,
+    "\360\235\223\207"sv,
+    "\342\213\212"sv,
+    "\342\226\271"sv,
+    "\342\247\216"sv,
+    "\342\245\250"sv,
+    "\342\204\236"sv,
+    "\305\233"sv,
+    "\342\252\264"sv,
+    "\342\252\270"sv,
+    "\305\241"sv,
+    "\305\237"sv,
+    "\305\235"sv,
+    "\342\252\266"sv,
+    "\342\252\272"sv,
+    "\342\213\251"sv,
+    "\342\250\223"sv,
+    "\321\201"sv,
+    "\342\213\205"sv,
+    "\342\251\246"sv,
+    "\342\207\230"sv,
+    "\302\247"sv,
+    ";"sv,
+    "\342\244\251"sv,
+    "\342\234\266"sv,
+    "\360\235\224\260"sv,
+    "\342\231\257"sv,
+    "\321\211"sv,
+    "\321\210"sv,
+    "\302\255"sv,
+    "\317\203"sv,
+    "\317\202"sv,
+    "\342\251\252"sv,
+    "\342\252\236"sv,
+    "\342\252\240"sv,
+    "\342\252\235"sv,
+    "\342\252\237"sv,
+    "\342\211\206"sv,
+    "\342\250\244"sv,
+    "\342\245\262"sv,
+    "\342\250\263"sv,
+    "\342\247\244"sv,
+    "\342\214\243"sv,
+    "\342\252\252"sv,
+    "\342\252\254"sv,
+    "\342\252\254\357\270\200"sv,
+    "\321\214"sv,
+    "/"sv,
+    "\342\247\204"sv,
+    "\342\214\277"sv,
+    "\360\235\225\244"sv,
+    "\342\231\240"sv,
+    "\342\212\223\357\270\200"sv,
+    "\342\212\224\357\270\200"sv,
+    "\360\235\223\210"sv,
+    "\342\230\206"sv,
+    "\342\212\202"sv,
+    "\342\253\205"sv,
+    "\342\252\275"sv,
+    "\342\253\203"sv,
+    "\342\253\201"sv,
+    "\342\253\213"sv,
+    "\342\212\212"sv,
+    "\342\252\277"sv,
+    "\342\245\271"sv,
+    "\342\253\207"sv,
+    "\342\253\225"sv,
+    "\342\253\223"sv,
+    "\342\231\252"sv,
+    "\302\271"sv,
+    "\302\262"sv,
+    "\302\263"sv,
+    "\342\253\206"sv,
+    "\342\252\276"sv,
+    "\342\253\230"sv,
+    "\342\253\204"sv,
+    "\342\237\211"sv,
+    "\342\253\227"sv,
+    "\342\245\273"sv,
+    "\342\253\202"sv,
+    "\342\253\214"sv,
+    "\342\212\213"sv,
+    "\342\253\200"sv,
+    "\342\253\210"sv,
+    "\342\253\224"sv,
+    "\342\253\226"sv,
+    "\342\207\231"sv,
+    "\342\244\252"sv,
+    "\303\237"sv,
+    "\342\214\226"sv,
+    "\317\204"sv,
+    "\305\245"sv,
+    "\305\243"sv,
+    "\321\202"sv,
+    "\342\214\225"sv,
+    "\360\235\224\261"sv,
+    "\316\270"sv,
+    "\317\221"sv,
+    "\303\276"sv,
+    "\303\227"sv,
+    "\342\250\261"sv,
+    "\342\250\260"sv,
+    "\342\214\266"sv,
+    "\342\253\261"sv,
+    "\360\235\225\245"sv,
+    "\342\253\232"sv,
+    "\342\200\264"sv,
+    "\342\226\265"sv,
+    "\342\211\234"sv,
+    "\342\227\254"sv,
+    "\342\250\272"sv,
+    "\342\250\271"sv,
+    "\342\247\215"sv,
+    "\342\250\273"sv,
+    "\342\217\242"sv,
+    "\360\235\223\211"sv,
+    "\321\206"sv,
+    "\321\233"sv,
+    "\305\247"sv,
+    "\342\245\243"sv,
+    "\303\272"sv,
+    "\321\236"sv,
+    "\305\255"sv,
+    "\303\273"sv,
+    "\321\203"sv,
+    "\305\261"sv,
+    "\342\245\276"sv,
+    "\360\235\224\262"sv,
+    "\303\271"sv,
+    "\342\226\200"sv,
+    "\342\214\234"sv,
+    "\342\214\217"sv,
+    "\342\227\270"sv,
+    "\305\253"sv,
+    "\305\263"sv,
+    "\360\235\225\246"sv,
+    "\317\205"sv,
+    "\342\207\210"sv,
+    "\342\214\235"sv,
+    "\342\214\216"sv,
+    "\305\257"sv,
+    "\342\227\271"sv,
+    "\360\235\223\212"sv,
+    "\342\213\260"sv,
+    "\305\251"sv,
+    "\303\274"sv,
+    "\342\246\247"sv,
+    "\342\253\250"sv,
+    "\342\253\251"sv,
+    "\342\246\234"sv,
+    "\342\212\212\357\270\200"sv,
+    "\342\253\213\357\270\200"sv,
+    "\342\212\213\357\270\200"sv,
+    "\342\253\214\357\270\200"sv,
+    "\320\262"sv,
+    "\342\212\273"sv,
+    "\342\211\232"sv,
+    "\342\213\256"sv,
+    "\360\235\224\263"sv,
+    "\360\235\225\247"sv,
+    "\360\235\223\213"sv,
+    "\342\246\232"sv,
+    "\305\265"sv,
+    "\342\251\237"sv,
+    "\342\211\231"sv,
+    "\342\204\230"sv,
+    "\360\235\224\264"sv,
+    "\360\235\225\250"sv,
+    "\360\235\223\214"sv,
+    "\360\235\224\265"sv,
+    "\316\276"sv,
+    "\342\213\273"sv,
+    "\360\235\225\251"sv,
+    "\360\235\223\215"sv,
+    "\303\275"sv,
+    "\321\217"sv,
+    "\305\267"sv,
+    "\321\213"sv,
+    "\302\245"sv,
+    "\360\235\224\266"sv,
+    "\321\227"sv,
+    "\360\235\225\252"sv,
+    "\360\235\223\216"sv,
+    "\321\216"sv,
+    "\303\277"sv,
+    "\305\272"sv,
+    "\305\276"sv,
+    "\320\267"sv,
+    "\305\274"sv,
+    "\316\266"sv,
+    "\360\235\224\267"sv,
+    "\320\266"sv,
+    "\342\207\235"sv,
+    "\360\235\225\253"sv,
+    "\360\235\223\217"sv,
+    "\342\200\215"sv,
+    "\342\200\214"sv,
+};
+
+}  // namespace html_entities
@@ -1,54 +1,240 @@
 #include "htmldecode.h"
+#include "html_entities.h"
 
-std::string HtmlDecode(std::string_view str) {
-    const static int MAX_MNEMONIC_SIZE = 4;
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+namespace {
+
+constexpr size_t STREAM_CHUNK_SIZE = 64 * 1024;
+
+constexpr uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+constexpr uint32_t MAX_CODE_POINT = 0x10FFFF;
+
+// Коды 0x80-0x9F браузеры считают символами Windows-1252, 0 - позиции, оставленные как есть
+constexpr uint16_t WINDOWS_1252[32] = {
+    0x20AC, 0, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0, 0x017D, 0,
+    0, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0, 0x017E, 0x0178,
+};
+
+int HexDigit(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+bool IsDecimalDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Следующий узел trie по символу c или 0, если такого перехода нет (в корень переходов не бывает)
+uint16_t NextNode(uint16_t node, char c) {
+    const html_entities::Node& from = html_entities::NODES[node];
+    const html_entities::Edge* first = html_entities::EDGES + from.first_edge;
+    const html_entities::Edge* last = first + from.edge_count;
+    const auto edge = std::lower_bound(first, last, c, [](const html_entities::Edge& edge, char c) {
+        return edge.label < c;
+    });
+    return edge != last && edge->label == c ? edge->child : 0;
+}
 
+void AppendUtf8(uint32_t code, std::string& out) {
+    if (code == 0 || code > MAX_CODE_POINT || (code >= 0xD800 && code <= 0xDFFF)) {
+        code = REPLACEMENT_CHARACTER;
+    } else if (code >= 0x80 && code <= 0x9F && WINDOWS_1252[code - 0x80] != 0) {
+        code = WINDOWS_1252[code - 0x80];
+    }
+
+    if (code < 0x80) {
+        out.push_back(static_cast<char>(code));
+    } else if (code < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else if (code < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+}
+
+}  // namespace
+
+std::string HtmlDecode(std::string_view str) {
     std::string result;
     result.reserve(str.size());
 
-    std::string buffer;
-    buffer.reserve(MAX_MNEMONIC_SIZE);
+    HtmlDecoder decoder;
+    decoder.Decode(str, result);
+    decoder.Finish(result);
+    return result;
+}
 
-    bool possible_mnemonic = false;
+void HtmlDecode(std::istream& input, std::ostream& output) {
+    std::string chunk(STREAM_CHUNK_SIZE, '\0');
+    std::string result;
+    result.reserve(STREAM_CHUNK_SIZE);
 
-    for (int i = 0; i < str.size(); ++i) {
-        if (str[i] != '&' && !possible_mnemonic) {
-            result.push_back(str[i]);
-            continue;
-        } else if (str[i] == '&' && possible_mnemonic) {
-            result.push_back('&');
-            if (!buffer.empty()) {
-                result.append(buffer);
-                buffer.clear();
+    HtmlDecoder decoder;
+    while (input.read(chunk.data(), chunk.size()) || input.gcount() > 0) {
+        result.clear();
+        decoder.Decode(std::string_view(chunk.data(), input.gcount()), result);
+        output.write(result.data(), result.size());
+    }
+    result.clear();
+    decoder.Finish(result);
+    output.write(result.data(), result.size());
+}
+
+void HtmlDecoder::Decode(std::string_view chunk, std::string& out) {
+    const char* pos = chunk.data();
+    const char* const end = pos + chunk.size();
+
+    while (pos != end) {
+        if (state_ == State::TEXT) {
+            // Текст между мнемониками копируется целиком
+            const char* amp = static_cast<const char*>(std::memchr(pos, '&', end - pos));
+            if (amp == nullptr) {
+                out.append(pos, end);
+                return;
             }
-            continue;
-        } else if (str[i] == '&') {
-            possible_mnemonic = true;
+            out.append(pos, amp);
+            pos = amp + 1;
+            state_ = State::NAME;
             continue;
         }
+        if (Consume(*pos, out)) {
+            ++pos;
+        }
+    }
+}
+
+void HtmlDecoder::Finish(std::string& out) {
+    switch (state_) {
+        case State::TEXT:
+            break;
+        case State::NAME:
+            FinishName(out);
+            break;
+        case State::NUMBER_SIGN:
+        case State::HEX_MARK:
+            FinishRaw(out);
+            break;
+        case State::DECIMAL:
+        case State::HEX:
+            FinishNumber(out);
+            break;
+    }
+}
+
+bool HtmlDecoder::Consume(char c, std::string& out) {
+    switch (state_) {
+        case State::TEXT:
+            return false;
 
-        buffer.push_back(str[i]);
-        if (buffer.size() <= MAX_MNEMONIC_SIZE) {
-            //buffer.push_back(str[i]);
-            if (HTML_MNEMONICS.contains(buffer)) {
-                result.append(HTML_MNEMONICS.at(buffer));
-                possible_mnemonic = false;
-                buffer.clear();
-                if (i < str.size() - 1 && str[i + 1] == ';') 
-                    ++i;
-            }
-        } else {
-            result.push_back('&');
-            result.append(buffer);
-            buffer.clear();
-            possible_mnemonic = false;
+        case State::NAME: {
+            if (c == '#' && pending_.empty()) {
+                pending_.push_back(c);
+                state_ = State::NUMBER_SIGN;
+                return true;
+            }
+            const uint16_t next = NextNode(node_, c);
+            if (next == 0) {
+                FinishName(out);
+                return false;
+            }
+            node_ = next;
+            pending_.push_back(c);
+            if (html_entities::NODES[node_].value >= 0) {
+                match_value_ = html_entities::NODES[node_].value;
+                match_length_ = pending_.size();
+            }
+            // Из листа идти некуда, а в нём всегда заканчивается имя
+            if (html_entities::NODES[node_].edge_count == 0) {
+                FinishName(out);
+            }
+            return true;
+        }
+
+        case State::NUMBER_SIGN:
+            if (c == 'x' || c == 'X') {
+                pending_.push_back(c);
+                state_ = State::HEX_MARK;
+                return true;
+            }
+            if (IsDecimalDigit(c)) {
+                code_ = c - '0';
+                state_ = State::DECIMAL;
+                return true;
+            }
+            FinishRaw(out);
+            return false;
+
+        case State::HEX_MARK:
+            if (HexDigit(c) >= 0) {
+                code_ = HexDigit(c);
+                state_ = State::HEX;
+                return true;
+            }
+            FinishRaw(out);
+            return false;
+
+        case State::DECIMAL:
+        case State::HEX: {
+            const int digit = state_ == State::HEX ? HexDigit(c) : (IsDecimalDigit(c) ? c - '0' : -1);
+            if (digit >= 0) {
+                // Дальше границы Unicode считать незачем, число всё равно будет заменено
+                code_ = std::min(code_ * (state_ == State::HEX ? 16 : 10) + digit, MAX_CODE_POINT + 1);
+                return true;
+            }
+            FinishNumber(out);
+            return c == ';';
         }
     }
+    return false;
+}
+
+void HtmlDecoder::FinishName(std::string& out) {
+    if (match_value_ >= 0) {
+        out.append(html_entities::VALUES[match_value_]);
+        // Символы после самого длинного найденного имени - обычный текст
+        out.append(pending_, match_length_);
+    } else {
+        out.push_back('&');
+        out.append(pending_);
+    }
+    pending_.clear();
+    node_ = 0;
+    match_value_ = -1;
+    match_length_ = 0;
+    state_ = State::TEXT;
+}
 
-    if (!buffer.empty())
-        result.append(buffer);
-    else if (buffer.empty() && possible_mnemonic)
-        result.push_back('&');
+void HtmlDecoder::FinishNumber(std::string& out) {
+    AppendUtf8(code_, out);
+    pending_.clear();
+    code_ = 0;
+    state_ = State::TEXT;
+}
 
-    return result;
+void HtmlDecoder::FinishRaw(std::string& out) {
+    out.push_back('&');
+    out.append(pending_);
+    pending_.clear();
+    state_ = State::TEXT;
 }
@@ -1,39 +1,76 @@
 #pragma once
 
+#include <cstdint>
+#include <iosfwd>
 #include <string>
-#include <unordered_map>
-
-const static std::unordered_map<std::string, std::string> HTML_MNEMONICS {
-    {"lt", "<"},
-    {"LT", "<"},
-
-    {"gt", ">"},
-    {"GT", ">"},
-
-    {"amp", "&"},
-    {"AMP", "&"},
-
-    {"apos", "\'"},
-    {"APOS", "\'"},
-
-    {"quot", "\""},
-    {"QUOT", "\""},
-};
+#include <string_view>
 
 /*
- * Декодирует основные HTML-мнемоники:
- * - &lt - <
- * - &gt - >
- * - &amp - &
- * - &pos - '
- * - &quot - "
+ * Декодирует HTML-мнемоники:
+ * - именованные из полного набора HTML5: &lt; - <, &amp; - &, &nbsp; - неразрывный пробел, &NotEqualTilde; - ≂̸ и т.д.
+ * - десятичные и шестнадцатеричные: &#39; и &#x27; - '
  *
- * Мнемоника может быть записана целиком либо строчными, либо заглавными буквами:
+ * Имена чувствительны к регистру, как в HTML5:
  * - &lt и &LT декодируются как <
- * - &Lt и &lT не мнемоники
+ * - &Lt и &lT не мнемоники (&Lt; в HTML5 - это ≪)
+ * Помимо набора HTML5 по-прежнему понимаются &apos, &APOS и &APOS;.
  *
- * После мнемоники может стоять опциональный символ ;
+ * Символ ; после имени обязателен только там, где его требует HTML5. Для старых мнемоник
+ * (lt, gt, amp, quot, nbsp, copy, ...) он опционален, из нескольких подходящих имён берётся самое длинное:
  * - M&amp;M&APOSs декодируется в M&M's
  * - &amp;lt; декодируется в &lt;
+ * - &notit; декодируется в ¬it;
+ *
+ * Числовые мнемоники декодируются в UTF-8, ; после цифр опционален. Ноль, суррогаты и числа больше U+10FFFF
+ * заменяются на U+FFFD, коды 0x80-0x9F - на символы Windows-1252, как это делают браузеры.
+ * Незаконченные мнемоники (&am, &#, &#x) остаются как есть.
+ */
+std::string HtmlDecode(std::string_view str);
+
+/*
+ * Декодирует поток по кускам фиксированного размера, не читая его в память целиком
  */
-std::string HtmlDecode(std::string_view str);
\ No newline at end of file
+void HtmlDecode(std::istream& input, std::ostream& output);
+
+/*
+ * Потоковый декодер: текст подаётся кусками, мнемоника может начаться в одном куске и закончиться в другом.
+ * Между вызовами хранится только начатая мнемоника, не длиннее самого длинного имени HTML5.
+ *
+ *     HtmlDecoder decoder;
+ *     std::string out;
+ *     decoder.Decode("M&am"sv, out);   // out == "M"
+ *     decoder.Decode("p;M"sv, out);    // out == "M&M"
+ *     decoder.Finish(out);
+ */
+class HtmlDecoder {
+public:
+    // Дописывает в out декодированный кусок. Начатая в конце куска мнемоника остаётся до следующего вызова
+    void Decode(std::string_view chunk, std::string& out);
+
+    // Дописывает в out начатую мнемонику так, как если бы текст на ней закончился
+    void Finish(std::string& out);
+
+private:
+    enum class State {
+        TEXT,
+        NAME,         // после & идёт имя
+        NUMBER_SIGN,  // &#
+        HEX_MARK,     // &#x
+        DECIMAL,      // &#1
+        HEX,          // &#x1
+    };
+
+    // Возвращает false, если символ не относится к мнемонике и его надо обработать как текст
+    bool Consume(char c, std::string& out);
+    void FinishName(std::string& out);
+    void FinishNumber(std::string& out);
+    void FinishRaw(std::string& out);
+
+    State state_ = State::TEXT;
+    // Прочитанные после & символы имени или # и x числовой мнемоники
+    std::string pending_;
+    uint16_t node_ = 0;
+    int match_value_ = -1;
+    size_t match_length_ = 0;
+    uint32_t code_ = 0;
+};
@@ -3,7 +3,7 @@
 #include <iostream>
 
 int main() {
-    std::string str;
-    std::getline(std::cin, str);
-    std::cout << HtmlDecode(str) << std::endl;
-}
\ No newline at end of file
+    // Вход декодируется по кускам, так что размер документа не ограничен памятью
+    std::ios::sync_with_stdio(false);
+    HtmlDecode(std::cin, std::cout);
+}
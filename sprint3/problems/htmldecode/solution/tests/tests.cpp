@@ -1,5 +1,8 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <random>
+#include <sstream>
+
 #include "../src/htmldecode.h"
 
 using namespace std::literals;
@@ -49,4 +52,100 @@ TEST_CASE("Text with wrong mnemonics", "[HtmlDecode]") {
     CHECK(HtmlDecode("&&&gT&lt;"sv) == "&&&gT<"s);
 }
 
-// Напишите недостающие тесты самостоятельно
+TEST_CASE("Text with HTML5 named mnemonics", "[HtmlDecode]") {
+    CHECK(HtmlDecode("a&nbsp;b"sv) == "a b"s);
+    CHECK(HtmlDecode("&copy 2023"sv) == "© 2023"s);
+    CHECK(HtmlDecode("&Lt;&lT;"sv) == "≪&lT;"s);
+    CHECK(HtmlDecode("&CounterClockwiseContourIntegral;"sv) == "∳"s);
+    CHECK(HtmlDecode("&NotEqualTilde;"sv) == "≂̸"s);
+    CHECK(HtmlDecode("&fjlig;"sv) == "fj"s);
+}
+
+TEST_CASE("Semicolon is required by names outside the legacy set", "[HtmlDecode]") {
+    CHECK(HtmlDecode("&hellip"sv) == "&hellip"s);
+    CHECK(HtmlDecode("&hellip;"sv) == "…"s);
+    CHECK(HtmlDecode("&notit;"sv) == "¬it;"s);
+    CHECK(HtmlDecode("&notin;"sv) == "∉"s);
+    CHECK(HtmlDecode("&unknown;"sv) == "&unknown;"s);
+}
+
+TEST_CASE("Text with numeric mnemonics", "[HtmlDecode]") {
+    CHECK(HtmlDecode("&#39;&#x27;&#X27;"sv) == "'''"s);
+    CHECK(HtmlDecode("&#65&#x42z"sv) == "ABz"s);
+    CHECK(HtmlDecode("&#0000000000000000000065;"sv) == "A"s);
+    CHECK(HtmlDecode("&#x1F600;"sv) == "\U0001F600"s);
+    CHECK(HtmlDecode("&#1046;"sv) == "Ж"s);
+}
+
+TEST_CASE("Text with wrong numeric mnemonics", "[HtmlDecode]") {
+    CHECK(HtmlDecode("&#;&#x;&#xg&#"sv) == "&#;&#x;&#xg&#"s);
+    CHECK(HtmlDecode("&#0;"sv) == "�"s);
+    CHECK(HtmlDecode("&#xD800;"sv) == "�"s);
+    CHECK(HtmlDecode("&#x110000;"sv) == "�"s);
+    CHECK(HtmlDecode("&#99999999999999999999;"sv) == "�"s);
+    CHECK(HtmlDecode("&#x80;&#x81;"sv) == "€\u0081"s);
+}
+
+TEST_CASE("Chunked input is decoded as a whole", "[HtmlDecoder]") {
+    const std::string text = "M&amp;M&APOSs &#x1F600; &notit; &notin; &#65&&am&gt&CounterClockwiseContourIntegral;&#"s;
+    const std::string expected = HtmlDecode(text);
+
+    SECTION("Every split into two chunks") {
+        for (size_t split = 0; split <= text.size(); ++split) {
+            HtmlDecoder decoder;
+            std::string result;
+            decoder.Decode(std::string_view(text).substr(0, split), result);
+            decoder.Decode(std::string_view(text).substr(split), result);
+            decoder.Finish(result);
+            CHECK(result == expected);
+        }
+    }
+
+    SECTION("One character per chunk") {
+        HtmlDecoder decoder;
+        std::string result;
+        for (char c : text) {
+            decoder.Decode(std::string_view(&c, 1), result);
+        }
+        decoder.Finish(result);
+        CHECK(result == expected);
+    }
+
+    SECTION("Random chunks") {
+        std::mt19937 generator(42);
+        for (int i = 0; i < 100; ++i) {
+            HtmlDecoder decoder;
+            std::string result;
+            for (size_t pos = 0; pos < text.size();) {
+                const size_t size = std::uniform_int_distribution<size_t>(0, 8)(generator);
+                decoder.Decode(std::string_view(text).substr(pos, size), result);
+                pos += size;
+            }
+            decoder.Finish(result);
+            CHECK(result == expected);
+        }
+    }
+
+    SECTION("Decoder only keeps the unfinished mnemonic") {
+        HtmlDecoder decoder;
+        std::string result;
+        decoder.Decode("M&am"sv, result);
+        CHECK(result == "M"s);
+        decoder.Decode("p;M&"sv, result);
+        CHECK(result == "M&M"s);
+        decoder.Finish(result);
+        CHECK(result == "M&M&"s);
+    }
+}
+
+TEST_CASE("Streams are decoded", "[HtmlDecode]") {
+    std::string text;
+    for (int i = 0; i < 20000; ++i) {
+        text += "Johnson&amp;Johnson &#x41;&lt"s;
+    }
+    std::istringstream input(text);
+    std::ostringstream output;
+    HtmlDecode(input, output);
+    CHECK(output.str() == HtmlDecode(text));
+    CHECK(output.str().size() == 20000 * "Johnson&Johnson A<"s.size());
+}
@@ -0,0 +1,119 @@
+"""Generates src/html_entities.h, the trie of HTML5 named character references.
+
+The entity list is taken from the Python standard library (html.entities.html5),
+which mirrors https://html.spec.whatwg.org/entities.json:
+
+    python3 tools/gen_html_entities.py > src/html_entities.h
+
+Names are stored with the trailing ';' when the standard requires it, so the
+decoder finds the longest matching name while walking the trie, as the HTML5
+tokenizer does.
+"""
+
+import html.entities
+
+# Historical uppercase forms that HtmlDecode has always accepted, although
+# HTML5 knows only &apos;
+EXTRA_ENTITIES = {
+    'apos': "'",
+    'APOS': "'",
+    'APOS;': "'",
+}
+
+
+def make_trie(entities):
+    # node: [children dict, value index]
+    root = [{}, -1]
+    values = []
+    value_index = {}
+    for name, value in sorted(entities.items()):
+        node = root
+        for char in name:
+            node = node[0].setdefault(char, [{}, -1])
+        if value not in value_index:
+            value_index[value] = len(values)
+            values.append(value)
+        node[1] = value_index[value]
+
+    # Breadth-first numbering keeps the edges of every node contiguous
+    nodes = [root]
+    edges = []
+    flat_nodes = []
+    i = 0
+    while i < len(nodes):
+        node = nodes[i]
+        first_edge = len(edges)
+        for char in sorted(node[0]):
+            edges.append((char, len(nodes)))
+            nodes.append(node[0][char])
+        flat_nodes.append((first_edge, len(node[0]), node[1]))
+        i += 1
+    return flat_nodes, edges, values
+
+
+def cpp_string(value):
+    result = ''
+    for byte in value.encode('utf-8'):
+        char = chr(byte)
+        if char in '"\\' or not 0x20 <= byte < 0x7f:
+            # Octal escapes have a fixed length, unlike \x
+            result += f'\\{byte:03o}'
+        else:
+            result += char
+    return f'"{result}"sv'
+
+
+def print_rows(items, per_row=8):
+    for i in range(0, len(items), per_row):
+        print('    ' + ' '.join(items[i:i + per_row]))
+
+
+def main():
+    entities = dict(html.entities.html5)
+    entities.update(EXTRA_ENTITIES)
+    nodes, edges, values = make_trie(entities)
+    max_name = max(len(name) for name in entities)
+    assert len(nodes) < 2 ** 16 and max(count for _, count, _ in nodes) < 2 ** 8
+
+    print('#pragma once')
+    print('// Сгенерировано tools/gen_html_entities.py, не редактировать вручную')
+    print()
+    print('#include <cstddef>')
+    print('#include <cstdint>')
+    print('#include <string_view>')
+    print()
+    print('namespace html_entities {')
+    print()
+    print('using namespace std::literals;')
+    print()
+    print('struct Node {')
+    print('    uint16_t first_edge;')
+    print('    uint8_t edge_count;')
+    print('    int16_t value;  // индекс в VALUES или -1, если имя здесь не заканчивается')
+    print('};')
+    print()
+    print('struct Edge {')
+    print('    char label;')
+    print('    uint16_t child;')
+    print('};')
+    print()
+    print(f'inline constexpr size_t MAX_NAME_LENGTH = {max_name};')
+    print()
+    print(f'inline constexpr Node NODES[{len(nodes)}] = {{')
+    print_rows([f'{{{first_edge}, {edge_count}, {value}}},' for first_edge, edge_count, value in nodes])
+    print('};')
+    print()
+    print(f'inline constexpr Edge EDGES[{len(edges)}] = {{')
+    print_rows([f"{{'{label}', {child}}}," for label, child in edges])
+    print('};')
+    print()
+    print(f'inline constexpr std::string_view VALUES[{len(values)}] = {{')
+    for value in values:
+        print(f'    {cpp_string(value)},')
+    print('};')
+    print()
+    print('}  // namespace html_entities')
+
+
+if __name__ == '__main__':
+    main()
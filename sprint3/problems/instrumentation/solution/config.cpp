@@ -7,7 +7,7 @@
 
 #undef DEBUG
 
-Config * ReadConfig (char * file)
+Config * ReadConfig (const char * file)
 {
 	FILE * in;
 	Config * retval = (Config *) malloc (sizeof(Config));
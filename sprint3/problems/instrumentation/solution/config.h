@@ -7,6 +7,6 @@ struct Config {
 	int max_edgecount; 
 };
 
-Config * ReadConfig (char * file);
+Config * ReadConfig (const char * file);
 
 #endif
@@ -14,17 +14,12 @@ struct findtreshold_arg
 void CountEdges (void * content, void * arg)
 {
         findtreshold_arg * args = (findtreshold_arg *) arg;
-        // TODO wat als edge->next != null? Juist!
         AnnotatedEdge * current = (AnnotatedEdge *)content;
-        while (current != NULL)
-        {
-                if (current->n_taken > args->current_treshold)
-                        args->n_edges++;
-                current = current->next;
-        }
+        if (current->n_taken > args->current_treshold)
+                args->n_edges++;
 }
 
-int FindTreshold(BinaryTree * tree_root, int max_edgecount)
+int FindTreshold(EdgeCountTbl * edges, int max_edgecount)
 {
 	static findtreshold_arg * args = (findtreshold_arg*) malloc (sizeof(findtreshold_arg));
 	args->n_edges=-1;
@@ -39,7 +34,7 @@ int FindTreshold(BinaryTree * tree_root, int max_edgecount)
 		//AnnotatedEdge * current_edge = start_edge;
 		args->n_edges = 0;
 
-		tree_root->walk(CountEdges, args);
+		edges->walk(CountEdges, args);
 
 #ifdef DEBUG
 		fprintf(stderr, "  With treshold %d, found %d edges.\n", current_treshold, edges);
@@ -84,19 +79,15 @@ void PrintEdge (void * content, void * arg)
         printedge_arg * args = (printedge_arg*) arg;
         AnnotatedEdge * current = (AnnotatedEdge *)content;
 
-        while (current != NULL)
+        if (current->n_taken > args->min_edgewidth)
         {
-                if (current->n_taken > args->min_edgewidth)
-                {
-                        printf("\"%s\" -> \"%s\"[label=%d,color=\"0,0,%f\"];\n", 
-                                        current->from->name,
-                                        current->to->name,
-                                        current->n_taken, 
-					1.0-current->n_taken/60.0);
-                         current->from->used = true;
-                         current->to->used = true;
-                }
-                current = current->next;
+                printf("\"%s\" -> \"%s\"[label=%d,color=\"0,0,%f\"];\n", 
+                                current->from->name,
+                                current->to->name,
+                                current->n_taken, 
+				1.0-current->n_taken/60.0);
+                 current->from->used = true;
+                 current->to->used = true;
         }
 }
 
@@ -116,13 +107,13 @@ void GenerateDot (FILE * dest, AnnotatedGraph * g, NodeHashTbl * nodehash, Confi
 
 	if (config->min_edgewidth < 0)
 	{
-		args->min_edgewidth = FindTreshold(g->edgetree, config->max_edgecount);
+		args->min_edgewidth = FindTreshold(g->edges, config->max_edgecount);
 		fprintf(stderr, "  Chose treshold: %d\n", args->min_edgewidth);
 	} else {
 		args->min_edgewidth = config->min_edgewidth;
 	}
 
-	g->edgetree->walk (PrintEdge, args);
+	g->edges->walk (PrintEdge, args);
 	nodehash->walk (PrintNode, dest);
 
 	/* TODO walk nodes */
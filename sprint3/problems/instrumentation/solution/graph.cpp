@@ -3,111 +3,191 @@
 #include <assert.h>
 #include "graph.h"
 
+/* the table is grown at this load, in percents */
+#define MAX_LOAD 70
+
 void NodeHashTbl::walk (void (*func)(void *, void*), void* arg)
 {
-	for (int x=0; x<size; x++)
+	for (size_t x=0; x<nodes.size(); x++)
 	{
-		if (table[x] != NULL)
-		{
-			table[x]->walk(func, arg);
-		}
+		func (nodes[x], arg);
 	}
 }
 
-void HashNode::walk (void (*func)(void *, void *), void * arg)
-{
-	func (node, arg);
-	if (next != NULL)
-		next->walk(func, arg);
-}
-
-unsigned int NodeHashTbl::HashString (const char * str)
+/* FNV-1a */
+uint64_t NodeHashTbl::HashString (const char * str, size_t length)
 {
-        unsigned int retval = 0;
-        int length = strlen(str);
-
-        unsigned int top5bits = 0xf8000000;
-        unsigned int carry = 0;
-
-        const int kleftmove=5;
-        const int krightmove=27;
-
-        for (int i=0; i<length; i++)
+        uint64_t retval = 14695981039346656037ull;
+        for (size_t i=0; i<length; i++)
         {
-                carry = retval & top5bits;
-                carry = carry >> krightmove;
-                retval = retval << kleftmove;
-                retval ^= carry;
-                retval ^= str[i];
+                retval ^= (unsigned char) str[i];
+                retval *= 1099511628211ull;
         }
         return retval;
 }
 
 NodeHashTbl::NodeHashTbl(int n_size)
 {
-        size = n_size;
-        table = (HashNode **) malloc (sizeof(HashNode*)*size); 
-        for (int i=0; i<size; i++)
+        size_t capacity = 16;
+        while (capacity * MAX_LOAD < (size_t) n_size * 100)
+                capacity *= 2;
+        table.assign(capacity, Slot{0, NULL});
+        mask = capacity - 1;
+}
+
+void NodeHashTbl::grow()
+{
+        std::vector<Slot> old_table;
+        old_table.swap(table);
+        table.assign(old_table.size() * 2, Slot{0, NULL});
+        mask = table.size() - 1;
+        for (size_t i=0; i<old_table.size(); i++)
         {
-                table[i] = NULL;
+                if (old_table[i].node == NULL)
+                        continue;
+                size_t x = old_table[i].hash & mask;
+                while (table[x].node != NULL)
+                        x = (x + 1) & mask;
+                table[x] = old_table[i];
         }
 }
 
 void NodeHashTbl::add(char * key, Node * content)
 {
-        //assert (strcmp (key, content->name) == 0);
+        assert (strcmp (key, content->name) == 0);
 
-        int hkey = HashString (key) % size;
-        table[hkey] = new HashNode(key, content, table[hkey]);
+        if ((nodes.size() + 1) * 100 > table.size() * MAX_LOAD)
+                grow();
+
+        uint64_t hash = HashString (key, strlen(key));
+        size_t x = hash & mask;
+        while (table[x].node != NULL)
+                x = (x + 1) & mask;
+        table[x] = Slot{hash, content};
+        nodes.push_back(content);
 }
 
-Node * NodeHashTbl::get(char * key)
+Node * NodeHashTbl::get(const char * key)
 {
-        HashNode * current_node = table[HashString (key) % size];
-        while (current_node != NULL)
+        return get (key, strlen(key));
+}
+
+Node * NodeHashTbl::get(const char * key, size_t length)
+{
+        uint64_t hash = HashString (key, length);
+        for (size_t x = hash & mask; table[x].node != NULL; x = (x + 1) & mask)
         {
-                if (strcmp(current_node->key, key) == 0)
+                const char * name = table[x].node->name;
+                if ((table[x].hash == hash)
+                        && (strncmp(name, key, length) == 0)
+                        && (name[length] == '\0'))
                 {
-                        //assert (strcmp (key, current_node->node->name) == 0);
-
-                        return current_node->node;
+                        return table[x].node;
                 }
-                current_node=current_node->next;
         }
         return NULL;
 }
 
-Node * newNode (char * name)
+EdgeCountTbl::EdgeCountTbl(int n_size)
+{
+        size_t capacity = 16;
+        shift = 60;
+        while (capacity * MAX_LOAD < (size_t) n_size * 100)
+        {
+                capacity *= 2;
+                shift--;
+        }
+        table.assign(capacity, Slot{0, EMPTY});
+        mask = capacity - 1;
+}
+
+/* returns the slot of the key, or the empty slot where it goes */
+size_t EdgeCountTbl::find(uint64_t key) const
+{
+        // Fibonacci hashing, the high bits of the product are mixed from all bits of the ids
+        size_t x = (key * 11400714819323198485ull) >> shift;
+        while ((table[x].index != EMPTY) && (table[x].key != key))
+                x = (x + 1) & mask;
+        return x;
+}
+
+void EdgeCountTbl::grow()
+{
+        table.assign(table.size() * 2, Slot{0, EMPTY});
+        mask = table.size() - 1;
+        shift--;
+        for (size_t i=0; i<edges.size(); i++)
+        {
+                uint64_t key = EdgeKey (edges[i].from, edges[i].to);
+                table[find(key)] = Slot{key, (uint32_t) i};
+        }
+}
+
+void EdgeCountTbl::add(Node * from, Node * to, int n)
+{
+        uint64_t key = EdgeKey (from, to);
+        size_t x = find (key);
+        if (table[x].index != EMPTY)
+        {
+                edges[table[x].index].n_taken += n;
+                return;
+        }
+
+        table[x] = Slot{key, (uint32_t) edges.size()};
+        edges.push_back(AnnotatedEdge{from, to, n});
+        if (edges.size() * 100 > table.size() * MAX_LOAD)
+                grow();
+}
+
+AnnotatedEdge * EdgeCountTbl::get(Node * from, Node * to)
+{
+        size_t x = find (EdgeKey (from, to));
+        return table[x].index == EMPTY ? NULL : &edges[table[x].index];
+}
+
+void EdgeCountTbl::walk (void (*func)(void *, void*), void* arg)
+{
+	for (size_t x=0; x<edges.size(); x++)
+	{
+		func (&edges[x], arg);
+	}
+}
+
+Node * newNode (std::string_view name, int id)
 {
 	Node * retval = (Node *) malloc (sizeof(Node));
-	retval->name = strdup(name);
+	retval->name = (char *) malloc (name.size() + 1);
+	memcpy (retval->name, name.data(), name.size());
+	retval->name[name.size()] = '\0';
 	retval->start = 0;
 	retval->end = 0;
 	retval->used = false;
+	retval->id = id;
 	return retval;
 }
 
 /* remove bad characters from names, should move somewhere else probably */
-void FixName (char * name)
+std::string_view FixName (std::string_view name)
 {
 	// Node names may not end with '\' or '/'
-	while ((name[strlen(name)-1] == '\\')
-		|| (name[strlen(name)-1] == '/'))
+	while (!name.empty() && ((name.back() == '\\') || (name.back() == '/')))
 	{
-		name[strlen(name)-1] = '\0';
+		name.remove_suffix(1);
 	}
+	return name;
 }
 
-Node * getNode (char * name, NodeHashTbl * nodehash)
+Node * getNode (std::string_view name, NodeHashTbl * nodehash)
 {
-        FixName(name);
+        name = FixName(name);
 
-        Node * retval = nodehash->get(name);
+        Node * retval = nodehash->get(name.data(), name.size());
 
         if (retval == NULL)
         {
-                retval = newNode(name);
-                nodehash->add(strdup(name), retval);
+                retval = newNode(name, nodehash->count());
+                // the node owns the name, it is the key as well
+                nodehash->add(retval->name, retval);
         }
 
         return retval;
@@ -121,6 +201,7 @@ GraphListNode * newGraphListNode (GraphListNode * next, Node * start)
 	new_graph->name = "";
 	new_graph->start = start;
 	new_graph->edges = NULL;
+	new_graph->last_edge = NULL;
 
 	GraphListNode * retval = (GraphListNode *) malloc (sizeof(GraphListNode));
 	retval->next = next;
@@ -131,23 +212,6 @@ GraphListNode * newGraphListNode (GraphListNode * next, Node * start)
 	return retval;
 }
 
-/* 
- * merges the strings in order to get a unique key identifying
- * this pair, using which the binary tree will be sorted.
- *
- * would be better to alternate characters from str1 and str2
- * instead of just concatenating the strings 
- */
-int MergeStrings (const char * str1, const char * str2)
-{
-        int retval = 0;
-        while (*str1 != '\0')
-                retval += *str1++;
-        while (*str2 != '\0')
-                retval += *str2++;
-        return retval;
-}
-
 Edge * newEdge (Node * from, Node * to, Edge * next = NULL)
 {
 	Edge * retval = (Edge *) malloc (sizeof(Edge));
@@ -158,125 +222,24 @@ Edge * newEdge (Node * from, Node * to, Edge * next = NULL)
 	retval->from = from;
 	retval->to = to;
 	retval->next = next;
-	retval->key = MergeStrings(from->name, to->name);
 
 	return retval;
 }
 
 void addEdge (Graph * g, Node * from, Node * to)
 {
-	Edge * current_edge = g->edges;
-
-	if (current_edge == NULL)
-	{
-		g->edges = newEdge(from, to);
-		return;
-	}
-
-	while (current_edge->next != NULL)
-	{
-		current_edge = current_edge->next;
-	}
-
-	current_edge->next = newEdge(from, to);
-}
-
-AnnotatedEdge * newAnnotatedEdge (Edge * e, AnnotatedEdge * next = NULL)
-{
-	AnnotatedEdge * retval = (AnnotatedEdge *) malloc (sizeof(AnnotatedEdge));
-	retval->from = e->from;
-	retval->to = e->to;
-	retval->next = next;
-	retval->n_taken = 1;
-
-	return retval;
-}
+	Edge * edge = newEdge(from, to);
 
-// Returns 0 if equal names
-bool CompareNodes (Node * a, Node * b)
-{
-	assert (a->name != NULL);
-	assert (b->name != NULL);
-	return strcmp (a->name, b->name);
-}
-
-// Returns 0 if equal
-bool CompareEdges (Edge * a, AnnotatedEdge * b)
-{
-	return (CompareNodes (a->from, b->from) 
-			|| CompareNodes (a->to, b->to));
-}
-
-/* 
- * Looks for the AnnotatedEdge in the tree corresponding
- * to the Edge provided 
- */
-AnnotatedEdge * GetEdgeFromTree(BinaryTree * root, Edge * edge)
-{
-        AnnotatedEdge * temp;
-        if (! (temp = (AnnotatedEdge*)(root->get ((void*)&(edge->key)))))
-        {
-                return NULL;
-        }
-        while (temp != NULL)
-        {
-                if (CompareEdges(edge, temp) == 0)
-                        return temp;
-                temp = temp->next;
-        }
-        return NULL;
-}
-
-/*
- * convert an Edge to an AnnotatedEdge and
- * insert it in the tree
- */     
-void InsertEdgeInTree(BinaryTree * tree, Edge * edge)
-{
-#ifdef DEBUG
-        assert (GetEdgeFromTree(tree, edge) == NULL);
-#endif  
-        void * key = &(edge->key);
-        AnnotatedEdge * list;
-
-        if (list = (AnnotatedEdge*)tree->get(key))
-        {
-                list->next = newAnnotatedEdge(edge, list->next);
-        }
-        else
-        {
-                tree->put(key, (void *)newAnnotatedEdge(edge));
-        }
+	if (g->last_edge == NULL)
+		g->edges = edge;
+	else
+		g->last_edge->next = edge;
+	g->last_edge = edge;
 }
 
 void addAnnotatedEdge(AnnotatedGraph * g, Edge * edge)
 {
-	AnnotatedEdge * this_edge = NULL;
-	AnnotatedEdge * last_edge = NULL;
-	BinaryTree * tree = g->edgetree;
-
-        if (this_edge = GetEdgeFromTree(tree, edge))
-        {
-                this_edge->n_taken++;
-        }
-        else
-        {
-                InsertEdgeInTree(tree, edge);
-        }
-
-}
-
-int CompareKey(const void * leftp, const void * rightp)
-{
-        int left  = *(int*)leftp;
-        int right = *(int*)rightp;
-
-        if (left < right)
-                return -1;
-        else if (left > right)
-                return 1;
-        else
-                return 0;
+	g->edges->add(edge->from, edge->to);
 }
 
 AnnotatedGraph * summarize (GraphList g, Config * config)
@@ -284,7 +247,7 @@ AnnotatedGraph * summarize (GraphList g, Config * config)
 	AnnotatedGraph * retval = (AnnotatedGraph *) malloc (sizeof(AnnotatedGraph));
 	int count = 1;
 
-	retval->edgetree = new BinaryTree(CompareKey);
+	retval->edges = new EdgeCountTbl();
 
 	GraphListNode * current_graphlistnode = g;
 
@@ -315,3 +278,56 @@ AnnotatedGraph * summarize (GraphList g, Config * config)
 	}
 	return retval;
 }
+
+std::vector<Node *> mergeNodes (NodeHashTbl * nodehash, NodeHashTbl * part_nodes)
+{
+	std::vector<Node *> to_node (part_nodes->count());
+	for (int id = 0; id < part_nodes->count(); id++)
+	{
+		Node * node = part_nodes->node(id);
+		to_node[id] = getNode(node->name, nodehash);
+		to_node[id]->start += node->start;
+		to_node[id]->end += node->end;
+	}
+	return to_node;
+}
+
+void mergeEdges (AnnotatedGraph * into, AnnotatedGraph * part, const std::vector<Node *> & to_node)
+{
+	for (int i = 0; i < part->edges->count(); i++)
+	{
+		AnnotatedEdge * edge = part->edges->edge(i);
+		into->edges->add(to_node[edge->from->id], to_node[edge->to->id], edge->n_taken);
+	}
+}
+
+void freeGraphList (GraphList g)
+{
+	while (g != NULL)
+	{
+		Edge * edge = g->graph->edges;
+		while (edge != NULL)
+		{
+			Edge * next = edge->next;
+			free (edge);
+			edge = next;
+		}
+		free (g->graph);
+
+		GraphListNode * next = g->next;
+		free (g);
+		g = next;
+	}
+}
+
+void freeSummary (AnnotatedGraph * g, NodeHashTbl * nodehash)
+{
+	for (int id = 0; id < nodehash->count(); id++)
+	{
+		free (nodehash->node(id)->name);
+		free (nodehash->node(id));
+	}
+	delete nodehash;
+	delete g->edges;
+	free (g);
+}
@@ -2,8 +2,11 @@
 #define GRAPH_H
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string_view>
+#include <vector>
 #include "config.h"
-#include "binarytree.h"
 
 #define N_PAGES 50
 
@@ -13,6 +16,8 @@ struct Node
 	int start;
 	int end;
 	int used;
+	/* index of the node in the NodeHashTbl, the nodes of an edge are keyed by it */
+	int id;
 };
 
 struct NodeListNode
@@ -21,38 +26,37 @@ struct NodeListNode
 	NodeListNode * next;
 };
 
-class HashNode
-{
-public:
-        HashNode (char* n_key, Node* n_node, HashNode* n_next)
-        {
-                key = n_key;
-                node = n_node;
-                next = n_next;
-        }
-	void walk (void (*func)(void *, void *), void *);
-
-        char * key;
-        Node * node;
-        HashNode * next;
-};
-
+/*
+ * Interned node names. Open addressing with linear probing over a power of two
+ * table: a slot keeps the full hash, so a probe compares names only on a hash match.
+ * The nodes are also kept in the order they were added, walk() goes in that order.
+ */
 class NodeHashTbl
 {
 public:
         NodeHashTbl (int n_size);
-        ~NodeHashTbl ()
-        {
-                free (table);
-        }
 
+        /* key must be the name of the content, the node keeps the key alive */
         void add (char * key, Node * content);
-        Node * get (char * key);
-        int size;
-        HashNode ** table;
+        Node * get (const char * key);
+        Node * get (const char * key, size_t length);
+        int count () const { return nodes.size(); }
+        Node * node (int id) { return nodes[id]; }
 	void walk (void (*func)(void *, void *), void *);
 private:
-        unsigned int HashString (const char * str);
+        struct Slot
+        {
+                uint64_t hash;
+                Node * node; // NULL if the slot is empty
+        };
+
+        static uint64_t HashString (const char * str, size_t length);
+        void grow ();
+
+        std::vector<Slot> table;
+        std::vector<Node *> nodes;
+        size_t mask;
+
         NodeHashTbl();
         NodeHashTbl(const NodeHashTbl &);
 };
@@ -62,28 +66,66 @@ struct Edge
 	Node * from;
 	Node * to;
 	Edge * next;
-
-	int key;
 };
 
 struct AnnotatedEdge 
 {
 	Node * from;
 	Node * to;
-	AnnotatedEdge * next;
 	int n_taken;
 };
 
+/*
+ * Number of times every (from, to) pair is taken. A flat open addressing table maps
+ * the pair of node ids to an index in the dense array of edges, walk() goes over
+ * that array in the order the edges were first taken.
+ */
+class EdgeCountTbl
+{
+public:
+	EdgeCountTbl (int n_size = 1024);
+
+	/* adds n to the count of the edge, the edge is created if needed */
+	void add (Node * from, Node * to, int n = 1);
+	AnnotatedEdge * get (Node * from, Node * to);
+	int count () const { return edges.size(); }
+	AnnotatedEdge * edge (int index) { return &edges[index]; }
+	void walk (void (*func)(void *, void *), void *);
+
+private:
+	static const uint32_t EMPTY = UINT32_MAX;
+	struct Slot
+	{
+		uint64_t key;
+		uint32_t index; // EMPTY if the slot is empty
+	};
+
+	static uint64_t EdgeKey (Node * from, Node * to)
+	{
+		return ((uint64_t) (uint32_t) from->id << 32) | (uint32_t) to->id;
+	}
+	size_t find (uint64_t key) const;
+	void grow ();
+
+	std::vector<Slot> table;
+	std::vector<AnnotatedEdge> edges;
+	size_t mask;
+	int shift;
+
+	EdgeCountTbl(const EdgeCountTbl &);
+};
+
 struct Graph
 {
 	char * name;
 	Node * start;
 	Edge * edges;
+	Edge * last_edge; // edges are appended here
 };
 
 struct AnnotatedGraph 
 {
-	BinaryTree * edgetree;
+	EdgeCountTbl * edges;
 };
 
 struct GraphListNode
@@ -97,9 +139,10 @@ typedef struct NodeListNode * NodeList;
 
 /*
  * Takes the name of a node and returns the node with that name, or, if that node doesn't
- * exist, adds a node with that name to the global nodelist.
+ * exist, adds a node with that name to the global nodelist. Names are interned: the name
+ * is copied only for a new node, so the view may point into a reused buffer.
  */
-Node * getNode (char * name, NodeHashTbl * nodehash);
+Node * getNode (std::string_view name, NodeHashTbl * nodehash);
 
 /*
  * Creates a GraphListNode with an empty graph
@@ -117,4 +160,16 @@ void addAnnotatedEdge(AnnotatedGraph * g, Edge * edge);
 
 AnnotatedGraph * summarize (GraphList g, Config * config);
 
+/*
+ * Partial summaries are merged in two steps. The nodes of a part are added to nodehash
+ * in their order along with their start and end counts; the result maps the ids of
+ * part_nodes to the nodes of nodehash. Then the edge counts of the part are added.
+ */
+std::vector<Node *> mergeNodes (NodeHashTbl * nodehash, NodeHashTbl * part_nodes);
+void mergeEdges (AnnotatedGraph * into, AnnotatedGraph * part, const std::vector<Node *> & to_node);
+
+void freeGraphList (GraphList g);
+/* frees the summary and the nodes of the table as well */
+void freeSummary (AnnotatedGraph * g, NodeHashTbl * nodehash);
+
 #endif
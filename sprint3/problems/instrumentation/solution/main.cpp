@@ -6,16 +6,37 @@
 #include "readfile.h"
 #include "dotgen.h"
 #include "config.h"
+#include "readbench.h"
+#include "parallel.h"
+#include <thread>
 
 void printUsage()
 {
-	fprintf(stderr, "events2dot <eventsfile>\n");
+	fprintf(stderr, "events2dot [-j threads] <eventsfile>   sessions are summarized on all cores by default\n");
+	fprintf(stderr, "events2dot --benchmark <eventsfile>   prints the throughput of the readers\n");
 }
 
 int main (int argc, char ** argv)
 {
 	NodeHashTbl * nodehash = new NodeHashTbl (255);
-	GraphList g;
+	int n_threads = std::thread::hardware_concurrency();
+
+	if ((argc == 3) && (strcmp(argv[1], "--benchmark") == 0))
+	{
+		return BenchmarkReaders (argv[2], ReadConfig ("pathalizer.conf"));
+	}
+
+	if ((argc == 4) && (strcmp(argv[1], "-j") == 0))
+	{
+		n_threads = atoi(argv[2]);
+		if (n_threads < 1)
+		{
+			printUsage();
+			exit(EXIT_FAILURE);
+		}
+		argv += 2;
+		argc -= 2;
+	}
 
 	if ((argc != 2) 
 		|| (strcmp(argv[1], "--help") == 0)
@@ -30,9 +51,7 @@ int main (int argc, char ** argv)
 	Config * config;
 	config = ReadConfig ("pathalizer.conf");
 
-	g = getGraphFromFile(argv[1], nodehash, config);
-
-	AnnotatedGraph * ag = summarize(g, config);
+	AnnotatedGraph * ag = summarizeFile(argv[1], nodehash, config, n_threads);
 
 	GenerateDot (stdout, ag, nodehash, config);
 
@@ -0,0 +1,123 @@
+#include <string>
+#include <thread>
+#include <vector>
+#include "parallel.h"
+#include "readfile.h"
+
+#undef DEBUG
+
+/* parts smaller than this aren't worth a thread */
+#define MIN_PART_SIZE (1 << 20)
+
+struct Part
+{
+	uint64_t begin;
+	uint64_t end;
+	NodeHashTbl * nodes;
+	AnnotatedGraph * summary;
+};
+
+/*
+ * Returns the offset of the first session change after the line at or after the offset:
+ * the line there has another session than the line before it, so a part may start there.
+ */
+uint64_t FindSessionStart (char * file, uint64_t offset)
+{
+	EventReader reader (file);
+	if (!reader.ok() || !reader.seek(offset))
+	{
+		fprintf(stderr, "Error reading file with events ('%s'): %s\n", file, strerror(errno));
+		exit(EXIT_FAILURE);
+	}
+
+	Event event;
+	if (!reader.next(event))
+		return reader.fileSize();
+
+	std::string session (event.session);
+	while (reader.next(event))
+	{
+		if (event.session != session)
+			return reader.lineOffset();
+	}
+	return reader.fileSize();
+}
+
+void SummarizePart (char * file, Config * config, Part * part)
+{
+	EventReader reader (file);
+	if (!reader.ok() || !reader.seek(part->begin))
+	{
+		fprintf(stderr, "Error reading file with events ('%s'): %s\n", file, strerror(errno));
+		exit(EXIT_FAILURE);
+	}
+	reader.setLimit(part->end);
+
+	part->nodes = new NodeHashTbl (255);
+	GraphList graphs = getGraphFromReader (reader, file, part->nodes, config);
+	part->summary = summarize (graphs, config);
+	// only the counts are needed from here on
+	freeGraphList (graphs);
+}
+
+AnnotatedGraph * summarizeFile (char * file, NodeHashTbl * nodehash, Config * config, int n_threads)
+{
+	EventReader probe (file);
+	if (!probe.ok())
+	{
+		fprintf(stderr, "Error opening file with events ('%s'): %s\n", file, strerror(errno));
+		exit(EXIT_FAILURE);
+	}
+
+	uint64_t size = probe.fileSize();
+	if (n_threads > 1 && (uint64_t) n_threads * MIN_PART_SIZE > size)
+		n_threads = size / MIN_PART_SIZE + 1;
+	if (!probe.mapped() || n_threads <= 1)
+		return summarize (getGraphFromReader (probe, file, nodehash, config), config);
+
+	std::vector<Part> parts (n_threads);
+	for (int i = 0; i < n_threads; i++)
+	{
+		parts[i].begin = i == 0 ? 0 : FindSessionStart (file, size / n_threads * i);
+		// a long session may cover the nominal start of the next part, then the part is empty
+		if (i > 0 && parts[i].begin < parts[i - 1].begin)
+			parts[i].begin = parts[i - 1].begin;
+		if (i > 0)
+			parts[i - 1].end = parts[i].begin;
+	}
+	parts[n_threads - 1].end = size;
+
+	std::vector<std::thread> workers;
+	for (int i = 0; i < n_threads; i++)
+	{
+		workers.emplace_back(SummarizePart, file, config, &parts[i]);
+	}
+	for (size_t i = 0; i < workers.size(); i++)
+	{
+		workers[i].join();
+	}
+
+	/*
+	 * The nodes go in the order of the file. summarize() walks the sessions from
+	 * the last one, so the edges of the last part go first.
+	 */
+	std::vector<std::vector<Node *>> to_node (n_threads);
+	for (int i = 0; i < n_threads; i++)
+	{
+		to_node[i] = mergeNodes (nodehash, parts[i].nodes);
+	}
+	AnnotatedGraph * retval = (AnnotatedGraph *) malloc (sizeof(AnnotatedGraph));
+	retval->edges = new EdgeCountTbl();
+	for (int i = n_threads - 1; i >= 0; i--)
+	{
+		mergeEdges (retval, parts[i].summary, to_node[i]);
+		freeSummary (parts[i].summary, parts[i].nodes);
+	}
+
+#ifdef DEBUG
+	for (int i = 0; i < n_threads; i++)
+		fprintf(stderr, "Part %d: [%llu, %llu)\n", i, (unsigned long long) parts[i].begin, (unsigned long long) parts[i].end);
+#endif
+
+	return retval;
+}
@@ -0,0 +1,16 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "graph.h"
+#include "config.h"
+
+/*
+ * Reads the events file and summarizes its sessions on n_threads workers.
+ * The file is split at session changes, so every session is read by one worker;
+ * each worker summarizes its part into its own node and edge tables, and the parts
+ * are merged into nodehash in the order of the file. The result is the same as of
+ * summarize(getGraphFromFile(...)). Pipes are read on the calling thread.
+ */
+AnnotatedGraph * summarizeFile (char * file, NodeHashTbl * nodehash, Config * config, int n_threads);
+
+#endif
@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <sys/stat.h>
+#include "graph.h"
+#include "readfile.h"
+#include "readbench.h"
+#include "parallel.h"
+#include <thread>
+
+#define BUFSIZE 255
+#define BENCH_RUNS 3
+
+typedef uint64_t (*ReadFunc)(char * file, Config * config);
+
+/* the reader before the EventReader, kept to compare with */
+uint64_t ReadWithScanf (char * file, Config *)
+{
+	FILE * in = fopen (file, "r");
+	if (in == NULL)
+		return 0;
+
+	char buffer[BUFSIZE];
+	char session[BUFSIZE];
+	int timestamp;
+	char name[BUFSIZE];
+	uint64_t bytes = 0;
+	while (fgets (buffer, BUFSIZE, in))
+	{
+		bytes += strlen(buffer);
+		if (sscanf(buffer, "%s\t%d\t%s\n", session, &timestamp, name) != 3)
+			continue;
+	}
+	fclose (in);
+	return bytes;
+}
+
+uint64_t ScanEvents (char * file, bool allow_mmap)
+{
+	EventReader reader (file, EventReader::DEFAULT_WINDOW, allow_mmap);
+	Event event;
+	uint64_t checksum = 0;
+	while (reader.next (event))
+	{
+		checksum += event.session.size() + event.name.size();
+	}
+	// keeps the loop from being optimized out
+	if (checksum == 1)
+		fprintf(stderr, " ");
+	return reader.bytes();
+}
+
+uint64_t ReadWithMmap (char * file, Config *)
+{
+	return ScanEvents (file, true);
+}
+
+uint64_t ReadWithBlocks (char * file, Config *)
+{
+	return ScanEvents (file, false);
+}
+
+/* parsing, interning of the names and the session graphs */
+uint64_t ReadGraph (char * file, Config * config)
+{
+	struct stat st;
+	if (stat (file, &st) != 0)
+		return 0;
+	NodeHashTbl * nodehash = new NodeHashTbl (255);
+	// the graphs are leaked as in main(), the benchmark runs only a few times
+	getGraphFromFile (file, nodehash, config);
+	return st.st_size;
+}
+
+int bench_threads = 1;
+
+uint64_t SummarizeWithThreads (char * file, Config * config)
+{
+	struct stat st;
+	if (stat (file, &st) != 0)
+		return 0;
+	NodeHashTbl * nodehash = new NodeHashTbl (255);
+	freeSummary (summarizeFile (file, nodehash, config, bench_threads), nodehash);
+	return st.st_size;
+}
+
+void RunBenchmark (const char * title, ReadFunc func, char * file, Config * config)
+{
+	double best = 0;
+	for (int run = 0; run < BENCH_RUNS; run++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		uint64_t bytes = func (file, config);
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		double mb_per_second = bytes / elapsed.count() / (1 << 20);
+		if (mb_per_second > best)
+			best = mb_per_second;
+	}
+	printf("%-24s %10.1f MB/s\n", title, best);
+}
+
+int BenchmarkReaders (char * file, Config * config)
+{
+	// warms the page cache up
+	if (ReadWithBlocks (file, config) == 0)
+	{
+		fprintf(stderr, "Error reading file with events ('%s')\n", file);
+		return EXIT_FAILURE;
+	}
+
+	RunBenchmark ("fgets + sscanf", ReadWithScanf, file, config);
+	RunBenchmark ("EventReader, blocks", ReadWithBlocks, file, config);
+	RunBenchmark ("EventReader, mmap", ReadWithMmap, file, config);
+	RunBenchmark ("getGraphFromFile", ReadGraph, file, config);
+
+	int max_threads = std::thread::hardware_concurrency();
+	for (bench_threads = 1; ; bench_threads = std::min(2 * bench_threads, max_threads))
+	{
+		char title[64];
+		snprintf(title, sizeof(title), "summarizeFile, %d threads", bench_threads);
+		RunBenchmark (title, SummarizeWithThreads, file, config);
+		if (bench_threads >= max_threads)
+			break;
+	}
+	return EXIT_SUCCESS;
+}
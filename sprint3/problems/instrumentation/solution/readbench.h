@@ -0,0 +1,12 @@
+#ifndef READBENCH_H
+#define READBENCH_H
+
+#include "config.h"
+
+/*
+ * Reads the events file with every reader and prints the throughput in MB/s.
+ * The file is read once before measuring, so the numbers are for the page cache.
+ */
+int BenchmarkReaders (char * file, Config * config);
+
+#endif
@@ -1,29 +1,268 @@
 #include "readfile.h"
 
+#include <charconv>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #undef DEBUG
 
-GraphList getGraphFromFile (char * file, NodeHashTbl * nodehash, Config * config)
+EventReader::EventReader (const char * file, size_t window, bool allow_mmap)
+	: fd(-1), error(0), use_mmap(false), file_size(0), window_size(window)
+	, begin(NULL), end(NULL), pos(NULL), window_offset(0)
+	, block(NULL), block_capacity(0), eof(false)
+	, limit(UINT64_MAX), line_offset(0)
+	, consumed(0), n_malformed(0)
 {
-	FILE * in;
-	GraphListNode * current_graphlistnode = NULL;
+	fd = open (file, O_RDONLY);
+	if (fd < 0)
+		return;
+
+	struct stat st;
+	if (allow_mmap && (fstat (fd, &st) == 0) && S_ISREG(st.st_mode))
+	{
+		use_mmap = true;
+		file_size = st.st_size;
+		// the window is moved by whole pages, so it must hold more than one
+		long page = sysconf (_SC_PAGESIZE);
+		if (window_size < (size_t) 2 * page)
+			window_size = 2 * page;
+		window_size -= window_size % page;
+#ifdef POSIX_FADV_SEQUENTIAL
+		posix_fadvise (fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+	}
+}
+
+EventReader::~EventReader ()
+{
+	release();
+	free (block);
+	if (fd >= 0)
+		close (fd);
+}
+
+void EventReader::release ()
+{
+	if (use_mmap && begin != NULL)
+		munmap ((void *) begin, end - begin);
+	if (use_mmap)
+		begin = end = pos = NULL;
+}
+
+/* maps the window at window_offset, pos must be set by the caller */
+bool EventReader::mapWindow ()
+{
+	size_t length = window_size;
+	if (window_offset + length > file_size)
+		length = file_size - window_offset;
+
+	void * data = mmap (NULL, length, PROT_READ, MAP_PRIVATE, fd, window_offset);
+	if (data == MAP_FAILED)
+	{
+		error = errno;
+		return false;
+	}
+	madvise (data, length, MADV_SEQUENTIAL);
+	begin = (const char *) data;
+	end = begin + length;
+	return true;
+}
+
+bool EventReader::readBlock ()
+{
+	size_t tail = end - pos;
+	window_offset += pos - begin;
+	if (block == NULL || tail == block_capacity)
+	{
+		// the first block, or a line longer than the block
+		size_t capacity = block_capacity ? 2 * block_capacity : window_size;
+		char * grown = (char *) malloc (capacity);
+		if (grown == NULL)
+		{
+			error = ENOMEM;
+			return false;
+		}
+		if (tail)
+			memcpy (grown, pos, tail);
+		free (block);
+		block = grown;
+		block_capacity = capacity;
+	}
+	else if (tail)
+	{
+		memmove (block, pos, tail);
+	}
+
+	size_t filled = tail;
+	while (filled < block_capacity)
+	{
+		ssize_t n = read (fd, block + filled, block_capacity - filled);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0)
+		{
+			error = errno;
+			return false;
+		}
+		if (n == 0)
+		{
+			eof = true;
+			break;
+		}
+		filled += n;
+	}
+	begin = pos = block;
+	end = block + filled;
+	return true;
+}
+
+bool EventReader::refill ()
+{
+	if (!use_mmap)
+		return readBlock();
+
+	uint64_t line_start = window_offset + (pos - begin);
+	uint64_t new_offset = line_start - line_start % sysconf (_SC_PAGESIZE);
+	if (begin != NULL && new_offset == window_offset)
+	{
+		// the line doesn't fit in the window
+		window_size *= 2;
+	}
+	release();
+	window_offset = new_offset;
+	if (!mapWindow())
+		return false;
+	pos = begin + (line_start - window_offset);
+	return true;
+}
+
+bool EventReader::atEnd () const
+{
+	return use_mmap ? window_offset + (end - begin) == file_size : eof;
+}
+
+bool EventReader::seek (uint64_t offset)
+{
+	if (fd < 0 || error || !use_mmap)
+		return false;
 
-	in = fopen (file, "r");
+	release();
+	if (offset >= file_size)
+	{
+		window_offset = file_size;
+		return true;
+	}
+	if (offset == 0)
+	{
+		window_offset = 0;
+		return true;
+	}
+
+	// the line before the offset may end right before it, so the search starts one byte earlier
+	uint64_t skip_from = offset - 1;
+	window_offset = skip_from - skip_from % sysconf (_SC_PAGESIZE);
+	if (!mapWindow())
+		return false;
+	pos = begin + (skip_from - window_offset);
+
+	for (;;)
+	{
+		const char * line_end = (const char *) memchr (pos, '\n', end - pos);
+		if (line_end != NULL)
+		{
+			pos = line_end + 1;
+			return true;
+		}
+		if (atEnd())
+		{
+			pos = end;
+			return true;
+		}
+		if (!refill())
+			return false;
+	}
+}
+
+bool EventReader::next (Event & event)
+{
+	if (fd < 0 || error)
+		return false;
+
+	for (;;)
+	{
+		if (window_offset + (pos - begin) >= limit)
+			return false;
+
+		const char * line_end = pos < end ? (const char *) memchr (pos, '\n', end - pos) : NULL;
+		if (line_end == NULL)
+		{
+			if (!atEnd())
+			{
+				if (!refill())
+					return false;
+				continue;
+			}
+			if (pos == end)
+				return false;
+			line_end = end; // the last line without '\n'
+		}
+
+		std::string_view line (pos, line_end - pos);
+		line_offset = window_offset + (pos - begin);
+		consumed += line.size() + (line_end != end);
+		pos = line_end + (line_end != end);
+
+		if (!line.empty() && line.back() == '\r')
+			line.remove_suffix(1);
+		if (line.empty())
+			continue;
 
-	if (in == NULL)
+		size_t tab1 = line.find('\t');
+		size_t tab2 = tab1 == std::string_view::npos ? tab1 : line.find('\t', tab1 + 1);
+		if (tab2 == std::string_view::npos)
+		{
+			n_malformed++;
+			continue;
+		}
+		std::string_view name = line.substr(tab2 + 1);
+		name = name.substr(0, name.find('\t'));
+
+		const char * ts_begin = line.data() + tab1 + 1;
+		const char * ts_end = line.data() + tab2;
+		auto [ts_ptr, ec] = std::from_chars (ts_begin, ts_end, event.timestamp);
+		if (ec != std::errc() || ts_ptr != ts_end || tab1 == 0 || name.empty())
+		{
+			n_malformed++;
+			continue;
+		}
+
+		event.session = line.substr(0, tab1);
+		event.name = name;
+		return true;
+	}
+}
+
+GraphList getGraphFromFile (char * file, NodeHashTbl * nodehash, Config * config)
+{
+	EventReader reader (file);
+	if (!reader.ok())
 	{
-		char * error = "Error opening file with events ('";
-		char * errmsg = (char *) malloc (strlen(error) + strlen(file) + 2 + 1);
-		sprintf(errmsg, "%s%s')", error, file);
-		perror(errmsg);
-		exit(0);
-	};
-
-	char buffer[BUFSIZE];
-	char session[BUFSIZE];
-	int timestamp;
-	char name[BUFSIZE];
-
-	char * current_session = (char *) malloc (1); // so we can free it
+		fprintf(stderr, "Error opening file with events ('%s'): %s\n", file, strerror(errno));
+		exit(EXIT_FAILURE);
+	}
+
+	return getGraphFromReader (reader, file, nodehash, config);
+}
+
+GraphList getGraphFromReader (EventReader & reader, const char * file, NodeHashTbl * nodehash, Config * config)
+{
+	GraphListNode * current_graphlistnode = NULL;
+	Event event;
+	// views of the reader are moved with its window, so the session is copied
+	std::string current_session;
 	Node * last_node = NULL;
 	Node * current_node = NULL;
 
@@ -31,35 +270,42 @@ GraphList getGraphFromFile (char * file, NodeHashTbl * nodehash, Config * config
 	fprintf(stderr, "Ignoring refreshes: %d", config->ignore_refresh);
 #endif
 
-	// while (fscanf(in, "%s\t%d\t%s\n", &session, &timestamp, &name) > 0)
-	while (fgets (buffer, BUFSIZE, in))
+	while (reader.next (event))
 	{
-		if (!sscanf(buffer, "%s\t%d\t%s\n", &session, &timestamp, &name))
-			break;
-
 		last_node = current_node;
 
 #ifdef DEBUG
-		fprintf(stderr, "Session %s, node %s\n", session, name);
+		fprintf(stderr, "Session %.*s, node %.*s\n", (int) event.session.size(), event.session.data(),
+				(int) event.name.size(), event.name.data());
 #endif
-		current_node = getNode(name, nodehash);
+		current_node = getNode(event.name, nodehash);
 
-		if (strcmp(session, current_session) != 0)
+		if (current_graphlistnode == NULL || event.session != current_session)
 		{
-			free (current_session);
-			current_session = strdup(session);
+			current_session.assign(event.session);
 			// TODO maybe check for graphs without edges?
 			current_graphlistnode = newGraphListNode(current_graphlistnode, current_node);
 		}
 		else
 		{
+			// nodes are interned, so equal names are the same node
 			if ((!config->ignore_refresh) // if false, just add the edge
-					|| (strcmp(last_node->name, current_node->name) != 0))
+					|| (last_node != current_node))
 			{
 				addEdge(current_graphlistnode->graph, last_node, current_node);
 			}
 		}
 	}
 
+	if (reader.failed())
+	{
+		fprintf(stderr, "Error reading file with events ('%s'): %s\n", file, strerror(reader.lastError()));
+		exit(EXIT_FAILURE);
+	}
+	if (reader.malformed())
+	{
+		fprintf(stderr, "  Skipped %llu malformed lines\n", (unsigned long long) reader.malformed());
+	}
+
 	return current_graphlistnode;
 }
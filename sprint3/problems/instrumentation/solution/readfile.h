@@ -1,10 +1,96 @@
+#ifndef READFILE_H
+#define READFILE_H
+
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
+#include <stdint.h>
+#include <string_view>
 #include "graph.h"
 #include "config.h"
 
-#define BUFSIZE 255
+/* One line of the events file: "session\ttimestamp\tname" */
+struct Event
+{
+	std::string_view session;
+	long timestamp;
+	std::string_view name;
+};
+
+/*
+ * Reads the events file through a sliding mmap window, so files larger than
+ * RAM (and than the address space) are read with bounded memory. Lines are
+ * parsed in place: the views of an Event are valid until the next call of next().
+ * Files that can't be mapped (pipes) are read in large blocks instead.
+ */
+class EventReader
+{
+public:
+	static const size_t DEFAULT_WINDOW = 64 << 20;
+
+	EventReader (const char * file, size_t window = DEFAULT_WINDOW, bool allow_mmap = true);
+	~EventReader ();
+
+	/* false if the file can't be opened, errno is set then */
+	bool ok () const { return fd >= 0; }
+
+	/* Returns false at the end of the file or on a read error, see failed() */
+	bool next (Event & event);
+
+	/*
+	 * Moves to the first line starting at or after the offset. Only mapped files
+	 * can be read from the middle, so it returns false for pipes.
+	 */
+	bool seek (uint64_t offset);
+	/* next() stops before the line starting at this offset */
+	void setLimit (uint64_t offset) { limit = offset; }
+	/* file offset of the line of the last event */
+	uint64_t lineOffset () const { return line_offset; }
+	bool mapped () const { return use_mmap; }
+	uint64_t fileSize () const { return file_size; }
+
+	bool failed () const { return error != 0; }
+	int lastError () const { return error; }
+	uint64_t bytes () const { return consumed; }
+	/* Lines that don't have three fields, they are skipped */
+	uint64_t malformed () const { return n_malformed; }
+
+private:
+	bool atEnd () const;
+	bool refill ();
+	bool mapWindow ();
+	bool readBlock ();
+	void release ();
+
+	int fd;
+	int error;
+	bool use_mmap;
+	uint64_t file_size;
+	size_t window_size;
+
+	/* [begin, end) is the current window, pos is the next line in it */
+	const char * begin;
+	const char * end;
+	const char * pos;
+	/* file offset of begin, the window is mapped there (mmap) or the block is read from there */
+	uint64_t window_offset;
+	char * block;
+	size_t block_capacity;
+	bool eof;
+	uint64_t limit;
+	uint64_t line_offset;
+
+	uint64_t consumed;
+	uint64_t n_malformed;
+
+	EventReader (const EventReader &);
+	EventReader & operator= (const EventReader &);
+};
 
 GraphList getGraphFromFile (char * file, NodeHashTbl * nodelist, Config * config);
+
+/* Reads the session graphs of the events left in the reader, exits on errors like getGraphFromFile */
+GraphList getGraphFromReader (EventReader & reader, const char * file, NodeHashTbl * nodelist, Config * config);
+
+#endif
@@ -0,0 +1,87 @@
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "../src/url_decoder.h"
+
+using namespace std::literals;
+
+namespace {
+
+constexpr size_t INPUT_SIZE = 64 << 20;
+constexpr int RUNS = 5;
+
+// Прежний декодер: посимвольное добавление и sscanf на каждую escape-последовательность
+std::string SscanfDecode(std::string_view str) {
+    std::string ret;
+    int temp;
+    for (size_t i = 0; i < str.length(); ++i) {
+        if (str[i] == '+') {
+            ret += ' ';
+        } else if (str[i] == '%') {
+            sscanf(std::string(str.substr(i + 1, 2)).c_str(), "%x", &temp);
+            ret += static_cast<char>(temp);
+            i += 2;
+        } else {
+            ret += str[i];
+        }
+    }
+    return ret;
+}
+
+// Строка из символов URL, в которой каждый символ с вероятностью escape_share закодирован или заменён на '+'
+std::string MakeInput(double escape_share) {
+    static constexpr std::string_view SYMBOLS = "abcdefghijklmnopqrstuvwxyz0123456789/-_.~"sv;
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<size_t> symbol(0, SYMBOLS.size() - 1);
+    std::bernoulli_distribution escape(escape_share);
+    std::bernoulli_distribution plus(0.25);
+
+    std::string result;
+    result.reserve(INPUT_SIZE + 3);
+    while (result.size() < INPUT_SIZE) {
+        if (escape(engine)) {
+            result += plus(engine) ? "+"sv : "%D0"sv;
+        } else {
+            result += SYMBOLS[symbol(engine)];
+        }
+    }
+    return result;
+}
+
+template <typename Decoder>
+void Run(std::string_view title, std::string_view input, Decoder&& decode) {
+    double best = 0;
+    size_t checksum = 0;
+    for (int run = 0; run < RUNS; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        checksum += decode(input).size();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::max(best, input.size() / elapsed.count() / 1e9);
+    }
+    std::printf("%-28s %8.3f GB/s  (%zu)\n", std::string(title).c_str(), best, checksum / RUNS);
+}
+
+}  // namespace
+
+int main() {
+    for (const double share : {0.0, 0.01, 0.1, 0.5}) {
+        const auto input = MakeInput(share);
+        std::cout << "Escaped share "sv << share << ", "sv << (input.size() >> 20) << " MB"sv << std::endl;
+        Run("  url::Decode"sv, input, [](std::string_view str) {
+            return url::Decode(str, url::Plus::AS_SPACE);
+        });
+        // Буфер переиспользуется, поэтому без выделения памяти под результат
+        std::string out;
+        Run("  url::DecodeTo, same buffer"sv, input, [&out](std::string_view str) -> std::string_view {
+            out.clear();
+            url::DecodeTo(str, out, url::Plus::AS_SPACE);
+            return out;
+        });
+        Run("  sscanf"sv, input, SscanfDecode);
+    }
+    return EXIT_SUCCESS;
+}
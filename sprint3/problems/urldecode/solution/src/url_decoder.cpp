@@ -0,0 +1,99 @@
+#include "url_decoder.h"
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace url {
+
+namespace {
+
+constexpr std::array<int8_t, 256> MakeHexTable() {
+    std::array<int8_t, 256> table{};
+    for (auto& value : table) {
+        value = -1;
+    }
+    for (int c = '0'; c <= '9'; ++c) {
+        table[c] = static_cast<int8_t>(c - '0');
+    }
+    for (int c = 'a'; c <= 'f'; ++c) {
+        table[c] = static_cast<int8_t>(c - 'a' + 10);
+        table[c - 'a' + 'A'] = static_cast<int8_t>(c - 'a' + 10);
+    }
+    return table;
+}
+
+constexpr std::array<int8_t, 256> HEX = MakeHexTable();
+
+// Позиция первого '%' (и '+', если он декодируется) в [pos, size) или size
+size_t FindSpecial(const char* data, size_t pos, size_t size, Plus plus) {
+    const char second = plus == Plus::AS_SPACE ? '+' : '%';
+#if defined(__SSE2__)
+    const __m128i percents = _mm_set1_epi8('%');
+    const __m128i pluses = _mm_set1_epi8(second);
+    for (; pos + 16 <= size; pos += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        const __m128i found = _mm_or_si128(_mm_cmpeq_epi8(chunk, percents), _mm_cmpeq_epi8(chunk, pluses));
+        if (const int mask = _mm_movemask_epi8(found)) {
+            return pos + __builtin_ctz(static_cast<unsigned>(mask));
+        }
+    }
+#endif
+    for (; pos < size; ++pos) {
+        if (data[pos] == '%' || data[pos] == second) {
+            return pos;
+        }
+    }
+    return size;
+}
+
+}  // namespace
+
+bool DecodeTo(std::string_view str, std::string& out, Plus plus) {
+    // Декодированная строка не длиннее исходной
+    out.reserve(out.size() + str.size());
+
+    const char* data = str.data();
+    const size_t size = str.size();
+    size_t pos = 0;
+    while (pos < size) {
+        const size_t special = FindSpecial(data, pos, size, plus);
+        out.append(data + pos, special - pos);
+        if (special == size) {
+            break;
+        }
+
+        if (data[special] == '+') {
+            out.push_back(' ');
+            pos = special + 1;
+            continue;
+        }
+
+        if (size - special < 3) {
+            return false;
+        }
+        const int high = HEX[static_cast<unsigned char>(data[special + 1])];
+        const int low = HEX[static_cast<unsigned char>(data[special + 2])];
+        if ((high | low) < 0) {
+            return false;
+        }
+        out.push_back(static_cast<char>(high << 4 | low));
+        pos = special + 3;
+    }
+
+    return true;
+}
+
+std::string Decode(std::string_view str, Plus plus) {
+    std::string result;
+    if (!DecodeTo(str, result, plus)) {
+        throw std::invalid_argument("Invalid escape sequence in URL");
+    }
+    return result;
+}
+
+}  // namespace url
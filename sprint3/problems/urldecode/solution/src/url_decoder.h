@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace url {
+
+// Как декодировать '+': в query-строках это пробел, в пути URL — обычный символ
+enum class Plus {
+    KEEP,
+    AS_SPACE
+};
+
+// Декодирует escape-последовательности %XX строки str и дописывает результат в out.
+// Возвращает false, если последовательность обрезана или содержит не шестнадцатеричные цифры,
+// тогда содержимое out после исходного размера не определено.
+// Участки без '%' и '+' ищутся SIMD-сравнением по 16 байт и копируются целиком.
+bool DecodeTo(std::string_view str, std::string& out, Plus plus);
+
+// То же, но в случае ошибки выбрасывает std::invalid_argument
+std::string Decode(std::string_view str, Plus plus);
+
+}  // namespace url
@@ -1,6 +1,11 @@
 #define BOOST_TEST_MODULE urlencode tests
 #include <boost/test/unit_test.hpp>
 
+#include <memory>
+#include <optional>
+#include <random>
+#include <stdexcept>
+
 #include "../src/urldecode.h"
 
 BOOST_AUTO_TEST_CASE(UrlDecode_tests) {
@@ -16,4 +21,77 @@ BOOST_AUTO_TEST_CASE(UrlDecode_tests) {
     BOOST_TEST(UrlDecode("%2020"sv) == " 20"s);
     BOOST_TEST(UrlDecode("%20J"sv) == " J"s);
     BOOST_TEST(UrlDecode("Hello%20my%20name%20is%20 Dima"sv) == "Hello my name is  Dima"s);
-}
\ No newline at end of file
+}
+
+BOOST_AUTO_TEST_CASE(UrlDecode_errors) {
+    using namespace std::literals;
+
+    BOOST_CHECK_THROW(UrlDecode("%"sv), std::invalid_argument);
+    BOOST_CHECK_THROW(UrlDecode("%2"sv), std::invalid_argument);
+    BOOST_CHECK_THROW(UrlDecode("Hello%2"sv), std::invalid_argument);
+    BOOST_CHECK_THROW(UrlDecode("%G0"sv), std::invalid_argument);
+    BOOST_CHECK_THROW(UrlDecode("%0z"sv), std::invalid_argument);
+    BOOST_CHECK_THROW(UrlDecode("%%20"sv), std::invalid_argument);
+    BOOST_TEST(UrlDecode("%41%4a%4A"sv) == "AJJ"s);
+    BOOST_TEST(UrlDecode("%00"sv) == "\0"s);
+}
+
+using namespace std::literals;
+
+namespace {
+
+// Простой декодер, с которым сравнивается быстрый
+std::optional<std::string> ReferenceDecode(std::string_view str) {
+    const auto hex = [](char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    };
+
+    std::string result;
+    for (size_t i = 0; i < str.size(); ++i) {
+        if (str[i] == '+') {
+            result += ' ';
+        } else if (str[i] != '%') {
+            result += str[i];
+        } else if (i + 2 < str.size() && hex(str[i + 1]) >= 0 && hex(str[i + 2]) >= 0) {
+            result += static_cast<char>(hex(str[i + 1]) * 16 + hex(str[i + 2]));
+            i += 2;
+        } else {
+            return std::nullopt;
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(UrlDecode_fuzz) {
+    // Алфавит со спецсимволами и цифрами, чтобы часто получались и верные, и неверные escape-последовательности
+    static constexpr std::string_view ALPHABET = "%%%++09afAFgG \x80\xff/."sv;
+    std::mt19937 engine(20230714);
+    std::uniform_int_distribution<size_t> length(0, 70);
+    std::uniform_int_distribution<size_t> symbol(0, ALPHABET.size() - 1);
+    std::uniform_int_distribution<int> byte(0, 255);
+
+    for (int i = 0; i < 100'000; ++i) {
+        std::string str(length(engine), ' ');
+        const bool any_bytes = i % 4 == 0;
+        for (auto& c : str) {
+            c = any_bytes ? static_cast<char>(byte(engine)) : ALPHABET[symbol(engine)];
+        }
+
+        // Строка без запаса в конце, чтобы ASan поймал чтение за её пределами
+        const std::unique_ptr<char[]> exact(new char[str.size()]);
+        std::copy(str.begin(), str.end(), exact.get());
+        const std::string_view view(exact.get(), str.size());
+
+        const auto expected = ReferenceDecode(view);
+        if (expected) {
+            BOOST_TEST_REQUIRE(UrlDecode(view) == *expected, "input: " << str);
+        } else {
+            BOOST_CHECK_THROW(UrlDecode(view), std::invalid_argument);
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "../src/urlencode.h"
+
+using namespace std::literals;
+
+namespace {
+
+constexpr size_t INPUT_SIZE = 16 << 20;
+constexpr int RUNS = 5;
+
+// Прежний кодировщик: ostringstream и манипуляторы на каждый байт
+std::string StreamEncode(std::string_view str) {
+    std::ostringstream escaped;
+    escaped.fill('0');
+    escaped << std::hex;
+
+    for (auto i = str.begin(), n = str.end(); i != n; ++i) {
+        std::string::value_type c = (*i);
+        if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+            escaped << c;
+            continue;
+        }
+        if (c == ' ') {
+            escaped << '+';
+            continue;
+        }
+        escaped << std::uppercase;
+        escaped << '%' << std::setw(2) << int((unsigned char) c);
+        escaped << std::nouppercase;
+    }
+
+    return escaped.str();
+}
+
+// Query-строка вида key=value&..., значения — слова через пробел с долей не-ASCII байтов
+std::string MakeQuery(double non_ascii_share, int max_word_length = 12) {
+    static constexpr std::string_view LETTERS = "abcdefghijklmnopqrstuvwxyz0123456789"sv;
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<size_t> letter(0, LETTERS.size() - 1);
+    std::uniform_int_distribution<int> word_length(2, max_word_length);
+    std::bernoulli_distribution non_ascii(non_ascii_share);
+
+    std::string result;
+    result.reserve(INPUT_SIZE + 64);
+    while (result.size() < INPUT_SIZE) {
+        result += "param="sv;
+        for (int word = 0; word < 4; ++word) {
+            const int length = word_length(engine);
+            for (int i = 0; i < length; ++i) {
+                result += non_ascii(engine) ? '\xD0' : LETTERS[letter(engine)];
+            }
+            result += ' ';
+        }
+        result += '&';
+    }
+    return result;
+}
+
+template <typename Encoder>
+void Run(std::string_view title, std::string_view input, Encoder&& encode) {
+    double best = 0;
+    size_t checksum = 0;
+    for (int run = 0; run < RUNS; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        checksum += encode(input).size();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::max(best, input.size() / elapsed.count() / 1e6);
+    }
+    std::printf("%-16s %10.1f MB/s  (%zu)\n", std::string(title).c_str(), best, checksum / RUNS);
+}
+
+}  // namespace
+
+int main() {
+    for (const double share : {0.0, 0.1, 0.5}) {
+        const auto query = MakeQuery(share);
+        std::cout << "Query of "sv << (query.size() >> 20) << " MB, non-ASCII share "sv << share << std::endl;
+        Run("  UrlEncode"sv, query, UrlEncode);
+        Run("  ostringstream"sv, query, StreamEncode);
+    }
+
+    // Длинные значения вроде токенов и base64url, где работает копирование блоками
+    const auto tokens = MakeQuery(0.0, 400);
+    std::cout << "Query of "sv << (tokens.size() >> 20) << " MB, long tokens"sv << std::endl;
+    Run("  UrlEncode"sv, tokens, UrlEncode);
+    Run("  ostringstream"sv, tokens, StreamEncode);
+    return EXIT_SUCCESS;
+}
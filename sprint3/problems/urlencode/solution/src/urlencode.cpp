@@ -1,32 +1,117 @@
 #include "urlencode.h"
-#include <sstream>
-#include <iomanip>
-#include <cctype>
 
-std::string UrlEncode(std::string_view str) {
-    std::ostringstream escaped;
-    escaped.fill('0');
-    escaped << std::hex;
+#include <array>
+#include <cstdint>
+#include <cstring>
 
-    for (auto i = str.begin(), n = str.end(); i != n; ++i) {
-        std::string::value_type c = (*i);
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
-        // Keep alphanumeric and other accepted characters intact
-        if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
-            escaped << c;
-            continue;
-        }
+namespace {
+
+// Результат кодирования одного байта: до трёх символов и их количество.
+// Четыре байта записываются одним memcpy, лишние перезаписываются следующим символом
+struct Encoded {
+    char chars[3];
+    uint8_t length;
+};
 
-        if (c == ' ') {
-            escaped << '+';
-            continue;
+constexpr bool IsUnreserved(int c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')
+        || c == '-' || c == '_' || c == '.' || c == '~';
+}
+
+constexpr std::array<Encoded, 256> MakeTable() {
+    constexpr char HEX_DIGITS[] = "0123456789ABCDEF";
+    std::array<Encoded, 256> table{};
+    for (int c = 0; c < 256; ++c) {
+        if (IsUnreserved(c)) {
+            table[c] = Encoded{{static_cast<char>(c), 0, 0}, 1};
+        } else if (c == ' ') {
+            table[c] = Encoded{{'+', 0, 0}, 1};
+        } else {
+            table[c] = Encoded{{'%', HEX_DIGITS[c >> 4], HEX_DIGITS[c & 0xF]}, 3};
         }
+    }
+    return table;
+}
+
+constexpr std::array<Encoded, 256> TABLE = MakeTable();
+// Запас в конце строки под запись четырёх байт на последнем символе
+constexpr size_t SLACK = sizeof(Encoded) - 1;
+
+#if defined(__SSE2__)
+constexpr size_t CHUNK = 16;
 
-        // Any other characters are percent-encoded
-        escaped << std::uppercase;
-        escaped << '%' << std::setw(2) << int((unsigned char) c);
-        escaped << std::nouppercase;
+__m128i InRange(__m128i chunk, char low, char high) {
+    // Байты от 0x80 отрицательны и не попадают ни в один диапазон
+    return _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(static_cast<char>(low - 1))),
+                         _mm_cmplt_epi8(chunk, _mm_set1_epi8(static_cast<char>(high + 1))));
+}
+
+// true, если в 16 байтах с data нет кодируемых символов
+bool IsPlainChunk(const char* data) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    __m128i keep = _mm_or_si128(InRange(chunk, '0', '9'),
+                   _mm_or_si128(InRange(chunk, 'a', 'z'), InRange(chunk, 'A', 'Z')));
+    for (char c : {'-', '_', '.', '~'}) {
+        keep = _mm_or_si128(keep, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(c)));
+    }
+    return _mm_movemask_epi8(keep) == 0xFFFF;
+}
+#endif
+
+struct Measure {
+    size_t encoded_size = 0;
+    // Символы, которые заменяются, включая пробел
+    size_t replaced = 0;
+};
+
+// Первый проход: длина результата
+Measure MeasureEncoded(std::string_view str) {
+    Measure measure;
+    for (unsigned char c : str) {
+        measure.encoded_size += TABLE[c].length;
+        measure.replaced += TABLE[c].chars[0] != static_cast<char>(c);
+    }
+    return measure;
+}
+
+}  // namespace
+
+std::string UrlEncode(std::string_view str) {
+    const auto [encoded_size, replaced] = MeasureEncoded(str);
+    std::string result(encoded_size + SLACK, '\0');
+    char* dst = result.data();
+
+    const char* data = str.data();
+    const size_t size = str.size();
+    size_t pos = 0;
+#if defined(__SSE2__)
+    // Длинные отрезки некодируемых символов копируются блоками по 16 байт. В тексте из коротких слов
+    // таких блоков почти нет, и проверка блока только замедляет кодирование
+    if (replaced * 32 < size) {
+        for (; pos + CHUNK <= size; pos += CHUNK) {
+            if (IsPlainChunk(data + pos)) {
+                std::memcpy(dst, data + pos, CHUNK);
+                dst += CHUNK;
+                continue;
+            }
+            for (size_t i = pos; i < pos + CHUNK; ++i) {
+                const Encoded& encoded = TABLE[static_cast<unsigned char>(data[i])];
+                std::memcpy(dst, &encoded, sizeof(encoded));
+                dst += encoded.length;
+            }
+        }
+    }
+#endif
+    for (; pos < size; ++pos) {
+        const Encoded& encoded = TABLE[static_cast<unsigned char>(data[pos])];
+        std::memcpy(dst, &encoded, sizeof(encoded));
+        dst += encoded.length;
     }
 
-    return escaped.str();
+    result.resize(encoded_size);
+    return result;
 }
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <random>
+
 #include "../src/urlencode.h"
 
 using namespace std::literals;
@@ -19,4 +22,61 @@ TEST(UrlEncodeTestSuite, EncodedString) {
     EXPECT_EQ(UrlEncode("Hello  World!!"sv), "Hello++World%21%21"s);
 }
 
-/* Напишите остальные тесты самостоятельно */
+TEST(UrlEncodeTestSuite, ReservedCharsAreEncoded) {
+    EXPECT_EQ(UrlEncode("!#$&'()*+,/:;=?@[]"sv), "%21%23%24%26%27%28%29%2A%2B%2C%2F%3A%3B%3D%3F%40%5B%5D"s);
+    EXPECT_EQ(UrlEncode("-._~"sv), "-._~"s);
+}
+
+TEST(UrlEncodeTestSuite, NonAsciiCharsAreEncoded) {
+    EXPECT_EQ(UrlEncode("\xD0\xBA\xFF"sv), "%D0%BA%FF"s);
+    EXPECT_EQ(UrlEncode("\x01\x7F"sv), "%01%7F"s);
+    EXPECT_EQ(UrlEncode("a\0b"sv), "a%00b"s);
+}
+
+TEST(UrlEncodeTestSuite, LongStringsAreEncodedInChunks) {
+    // Безопасные отрезки разной длины, чтобы кодируемые символы попадали в разные места 16-байтных блоков
+    std::string str;
+    std::string expected;
+    for (int run = 0; run < 40; ++run) {
+        str += std::string(run, 'a') + "/ "s;
+        expected += std::string(run, 'a') + "%2F+"s;
+    }
+    EXPECT_EQ(UrlEncode(str), expected);
+}
+
+namespace {
+
+std::string ReferenceEncode(std::string_view str) {
+    std::string result;
+    for (unsigned char c : str) {
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')
+            || c == '-' || c == '_' || c == '.' || c == '~') {
+            result += static_cast<char>(c);
+        } else if (c == ' ') {
+            result += '+';
+        } else {
+            char escaped[4];
+            std::snprintf(escaped, sizeof(escaped), "%%%02X", c);
+            result += escaped;
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(UrlEncodeTestSuite, RandomStringsMatchReference) {
+    std::mt19937 engine(20230714);
+    std::uniform_int_distribution<size_t> length(0, 100);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::bernoulli_distribution plain(0.8);
+
+    for (int i = 0; i < 20'000; ++i) {
+        std::string str(length(engine), 'x');
+        for (auto& c : str) {
+            // В основном безопасные символы, чтобы получались длинные отрезки
+            c = plain(engine) ? "abcXYZ019-._~"[byte(engine) % 13] : static_cast<char>(byte(engine));
+        }
+        ASSERT_EQ(UrlEncode(str), ReferenceEncode(str)) << "input size " << str.size();
+    }
+}
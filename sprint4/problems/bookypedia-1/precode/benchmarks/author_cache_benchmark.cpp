@@ -0,0 +1,72 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cstdlib>
+
+#include "../src/app/author_cache.h"
+#include "../src/app/cached_unit_of_work.h"
+#include "../src/postgres/postgres.h"
+
+using namespace std::literals;
+
+namespace {
+
+constexpr const char DB_URL_ENV_NAME[]{"BOOKYPEDIA_DB_URL"};
+constexpr size_t POOL_SIZE = 1;
+constexpr size_t AUTHORS_COUNT = 100;
+
+std::string GetAuthorName(size_t index) {
+    return "Benchmark author " + std::to_string(index);
+}
+
+}  // namespace
+
+TEST_CASE("Repeated author lookups", "[!benchmark]") {
+    const auto* db_url = std::getenv(DB_URL_ENV_NAME);
+    if (!db_url) {
+        WARN(DB_URL_ENV_NAME << " is not set, benchmark is skipped");
+        return;
+    }
+
+    postgres::Database db{db_url, POOL_SIZE};
+    std::vector<domain::AuthorId> ids;
+    {
+        auto unit = db.CreateUnitOfWork();
+        for (size_t i = 0; i < AUTHORS_COUNT; ++i) {
+            const auto name = GetAuthorName(i);
+            if (auto author = unit->Authors().FindByName(name)) {
+                ids.push_back(author->GetId());
+            } else {
+                ids.push_back(domain::AuthorId::New());
+                unit->Authors().Save({ids.back(), name});
+            }
+        }
+        unit->Commit();
+    }
+
+    app::AuthorCache cache{AUTHORS_COUNT};
+    app::CachedUnitOfWorkFactory cached_db{db, cache};
+
+    // Every lookup is done in its own unit of work, as use cases do it
+    auto find_all = [&ids](app::UnitOfWorkFactory& factory) {
+        size_t found = 0;
+        for (size_t i = 0; i < ids.size(); ++i) {
+            auto unit = factory.CreateUnitOfWork();
+            found += unit->Authors().FindByName(GetAuthorName(i)).has_value();
+            found += unit->Authors().FindById(ids[i]).has_value();
+        }
+        return found;
+    };
+
+    BENCHMARK("200 lookups, no cache") {
+        return find_all(db);
+    };
+
+    BENCHMARK("200 lookups, cache") {
+        return find_all(cached_db);
+    };
+
+    const auto stats = cache.GetStats();
+    WARN("Cache hits: " << stats.hits << ", misses: " << stats.misses << ", hit rate: " << stats.GetHitRate());
+    CHECK(stats.GetHitRate() > 0.9);
+}
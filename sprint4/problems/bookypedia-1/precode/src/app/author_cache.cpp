@@ -0,0 +1,87 @@
+#include "author_cache.h"
+
+namespace app {
+
+std::optional<domain::Author> AuthorCache::FindById(const domain::AuthorId& id) {
+    std::lock_guard lock{mutex_};
+    if (auto it = by_id_.find(id); it != by_id_.end()) {
+        return Touch(it->second);
+    }
+    ++stats_.misses;
+    return std::nullopt;
+}
+
+std::optional<domain::Author> AuthorCache::FindByName(const std::string& name) {
+    std::lock_guard lock{mutex_};
+    if (auto it = by_name_.find(name); it != by_name_.end()) {
+        return Touch(it->second);
+    }
+    ++stats_.misses;
+    return std::nullopt;
+}
+
+AuthorCache::Version AuthorCache::GetVersion() const {
+    std::lock_guard lock{mutex_};
+    return version_;
+}
+
+void AuthorCache::Put(const domain::Author& author, Version version) {
+    std::lock_guard lock{mutex_};
+    if (version != version_ || capacity_ == 0) {
+        return;
+    }
+
+    if (auto it = by_id_.find(author.GetId()); it != by_id_.end()) {
+        Erase(it->second);
+    }
+    if (auto it = by_name_.find(author.GetName()); it != by_name_.end()) {
+        Erase(it->second);
+    }
+    if (entries_.size() == capacity_) {
+        Erase(std::prev(entries_.end()));
+    }
+
+    entries_.push_front(author);
+    by_id_.emplace(author.GetId(), entries_.begin());
+    by_name_.emplace(author.GetName(), entries_.begin());
+}
+
+void AuthorCache::Invalidate(const domain::AuthorId& id) {
+    std::lock_guard lock{mutex_};
+    ++version_;
+    if (auto it = by_id_.find(id); it != by_id_.end()) {
+        Erase(it->second);
+    }
+}
+
+void AuthorCache::Invalidate(const std::string& name) {
+    std::lock_guard lock{mutex_};
+    ++version_;
+    if (auto it = by_name_.find(name); it != by_name_.end()) {
+        Erase(it->second);
+    }
+}
+
+CacheStats AuthorCache::GetStats() const {
+    std::lock_guard lock{mutex_};
+    return stats_;
+}
+
+size_t AuthorCache::GetSize() const {
+    std::lock_guard lock{mutex_};
+    return entries_.size();
+}
+
+std::optional<domain::Author> AuthorCache::Touch(Entries::iterator it) {
+    ++stats_.hits;
+    entries_.splice(entries_.begin(), entries_, it);
+    return *it;
+}
+
+void AuthorCache::Erase(Entries::iterator it) {
+    by_id_.erase(it->GetId());
+    by_name_.erase(it->GetName());
+    entries_.erase(it);
+}
+
+}  // namespace app
@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
+
+#include "../domain/author.h"
+
+namespace app {
+
+struct CacheStats {
+    size_t hits = 0;
+    size_t misses = 0;
+
+    double GetHitRate() const noexcept {
+        const auto lookups = hits + misses;
+        return lookups ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0;
+    }
+};
+
+// Thread-safe LRU cache of authors, an author is found both by id and by name.
+// Every invalidation changes the version, so a value read from the database before
+// the invalidation isn't put into the cache
+class AuthorCache {
+public:
+    using Version = uint64_t;
+
+    explicit AuthorCache(size_t capacity)
+        : capacity_{capacity} {
+    }
+
+    std::optional<domain::Author> FindById(const domain::AuthorId& id);
+    std::optional<domain::Author> FindByName(const std::string& name);
+
+    // Version must be taken before the author is read from the database
+    Version GetVersion() const;
+    void Put(const domain::Author& author, Version version);
+
+    void Invalidate(const domain::AuthorId& id);
+    void Invalidate(const std::string& name);
+
+    CacheStats GetStats() const;
+    size_t GetSize() const;
+
+private:
+    struct AuthorIdHasher {
+        size_t operator()(const domain::AuthorId& id) const {
+            return boost::hash<util::detail::UUIDType>{}(*id);
+        }
+    };
+
+    using Entries = std::list<domain::Author>;
+
+    std::optional<domain::Author> Touch(Entries::iterator it);
+    void Erase(Entries::iterator it);
+
+    const size_t capacity_;
+
+    mutable std::mutex mutex_;
+    // Most recently used authors are at the front
+    Entries entries_;
+    std::unordered_map<domain::AuthorId, Entries::iterator, AuthorIdHasher> by_id_;
+    std::unordered_map<std::string, Entries::iterator> by_name_;
+    Version version_ = 0;
+    CacheStats stats_;
+};
+
+}  // namespace app
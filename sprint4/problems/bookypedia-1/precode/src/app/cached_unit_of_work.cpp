@@ -0,0 +1,66 @@
+#include "cached_unit_of_work.h"
+
+namespace app {
+
+void CachingAuthorRepository::Save(const domain::Author& author) {
+    // Entry is removed with all its keys, so the old name of a renamed author goes too
+    changed_ids_.push_back(author.GetId());
+    changed_names_.push_back(author.GetName());
+    cache_.Invalidate(author.GetId());
+    cache_.Invalidate(author.GetName());
+    authors_.Save(author);
+}
+
+void CachingAuthorRepository::Delete(const domain::AuthorId& id) {
+    changed_ids_.push_back(id);
+    cache_.Invalidate(id);
+    authors_.Delete(id);
+}
+
+std::optional<domain::Author> CachingAuthorRepository::FindById(const domain::AuthorId& id) {
+    if (!changed_ids_.empty()) {
+        return authors_.FindById(id);
+    }
+    if (auto author = cache_.FindById(id)) {
+        return author;
+    }
+
+    const auto version = cache_.GetVersion();
+    auto author = authors_.FindById(id);
+    if (author) {
+        cache_.Put(*author, version);
+    }
+    return author;
+}
+
+std::optional<domain::Author> CachingAuthorRepository::FindByName(const std::string& name) {
+    if (!changed_ids_.empty()) {
+        return authors_.FindByName(name);
+    }
+    if (auto author = cache_.FindByName(name)) {
+        return author;
+    }
+
+    const auto version = cache_.GetVersion();
+    auto author = authors_.FindByName(name);
+    if (author) {
+        cache_.Put(*author, version);
+    }
+    return author;
+}
+
+std::vector<domain::Author> CachingAuthorRepository::GetPage(const std::optional<domain::Author>& after,
+                                                             size_t limit) {
+    return authors_.GetPage(after, limit);
+}
+
+void CachingAuthorRepository::InvalidateChanged() {
+    for (const auto& id : changed_ids_) {
+        cache_.Invalidate(id);
+    }
+    for (const auto& name : changed_names_) {
+        cache_.Invalidate(name);
+    }
+}
+
+}  // namespace app
@@ -0,0 +1,79 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "../domain/author.h"
+#include "author_cache.h"
+#include "unit_of_work.h"
+
+namespace app {
+
+// Read-through cache in front of the author repository of one unit of work.
+// After the unit of work changes authors, its lookups bypass the cache, so
+// uncommitted authors never get into it
+class CachingAuthorRepository : public domain::AuthorRepository {
+public:
+    CachingAuthorRepository(domain::AuthorRepository& authors, AuthorCache& cache)
+        : authors_{authors}
+        , cache_{cache} {
+    }
+
+    void Save(const domain::Author& author) override;
+    void Delete(const domain::AuthorId& id) override;
+    std::optional<domain::Author> FindById(const domain::AuthorId& id) override;
+    std::optional<domain::Author> FindByName(const std::string& name) override;
+    std::vector<domain::Author> GetPage(const std::optional<domain::Author>& after, size_t limit) override;
+
+    // Invalidates changed authors once more, since other units of work could read
+    // the old values before the commit
+    void InvalidateChanged();
+
+private:
+    domain::AuthorRepository& authors_;
+    AuthorCache& cache_;
+    std::vector<domain::AuthorId> changed_ids_;
+    std::vector<std::string> changed_names_;
+};
+
+class CachedUnitOfWork : public UnitOfWork {
+public:
+    CachedUnitOfWork(UnitOfWorkHolder unit, AuthorCache& cache)
+        : unit_{std::move(unit)}
+        , authors_{unit_->Authors(), cache} {
+    }
+
+    void Commit() override {
+        unit_->Commit();
+        authors_.InvalidateChanged();
+    }
+
+    domain::AuthorRepository& Authors() override {
+        return authors_;
+    }
+
+    domain::BookRepository& Books() override {
+        return unit_->Books();
+    }
+
+private:
+    UnitOfWorkHolder unit_;
+    CachingAuthorRepository authors_;
+};
+
+class CachedUnitOfWorkFactory : public UnitOfWorkFactory {
+public:
+    CachedUnitOfWorkFactory(UnitOfWorkFactory& factory, AuthorCache& cache)
+        : factory_{factory}
+        , cache_{cache} {
+    }
+
+    UnitOfWorkHolder CreateUnitOfWork() override {
+        return std::make_unique<CachedUnitOfWork>(factory_.CreateUnitOfWork(), cache_);
+    }
+
+private:
+    UnitOfWorkFactory& factory_;
+    AuthorCache& cache_;
+};
+
+}  // namespace app
@@ -0,0 +1,79 @@
+#include "catalog_import.h"
+
+#include <boost/algorithm/string/trim.hpp>
+#include <stdexcept>
+#include <vector>
+
+namespace app {
+
+namespace {
+
+std::vector<std::string> SplitCsvLine(const std::string& line) {
+    std::vector<std::string> fields(1);
+    bool quoted = false;
+    for (size_t i = 0; i < line.size(); ++i) {
+        const char c = line[i];
+        if (quoted) {
+            if (c != '"') {
+                fields.back() += c;
+            } else if (i + 1 < line.size() && line[i + 1] == '"') {
+                fields.back() += '"';
+                ++i;
+            } else {
+                quoted = false;
+            }
+        } else if (c == '"') {
+            quoted = true;
+        } else if (c == ',') {
+            fields.emplace_back();
+        } else {
+            fields.back() += c;
+        }
+    }
+    if (quoted) {
+        throw std::invalid_argument("Unterminated quoted field");
+    }
+    for (auto& field : fields) {
+        boost::algorithm::trim(field);
+    }
+    return fields;
+}
+
+}  // namespace
+
+std::optional<CatalogRow> CatalogCsvReader::ReadRow() {
+    while (std::getline(input_, line_)) {
+        ++line_number_;
+        if (!line_.empty() && line_.back() == '\r') {
+            line_.pop_back();
+        }
+        if (line_.find_first_not_of(" \t") == std::string::npos) {
+            continue;
+        }
+
+        auto fields = SplitCsvLine(line_);
+        if (fields.size() > 3 || fields[0].empty()) {
+            throw std::invalid_argument("Line " + std::to_string(line_number_) + ": author,title,year expected");
+        }
+
+        CatalogRow row{std::move(fields[0])};
+        if (fields.size() > 1 && !fields[1].empty()) {
+            row.title = std::move(fields[1]);
+        }
+        if (fields.size() > 2 && !fields[2].empty()) {
+            size_t pos = 0;
+            try {
+                row.publication_year = std::stoi(fields[2], &pos);
+            } catch (const std::exception&) {
+                pos = 0;
+            }
+            if (pos != fields[2].size()) {
+                throw std::invalid_argument("Line " + std::to_string(line_number_) + ": invalid publication year");
+            }
+        }
+        return row;
+    }
+    return std::nullopt;
+}
+
+}  // namespace app
@@ -0,0 +1,71 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace app {
+
+// One line of the catalog: an author and optionally one of their books
+struct CatalogRow {
+    std::string author_name;
+    std::optional<std::string> title;
+    std::optional<int> publication_year;
+};
+
+struct ImportStats {
+    size_t rows = 0;
+    size_t authors = 0;
+    size_t books = 0;
+    std::chrono::duration<double> duration{0};
+
+    double GetRowsPerSecond() const noexcept {
+        return duration.count() > 0 ? static_cast<double>(rows) / duration.count() : 0.0;
+    }
+};
+
+// Streams rows into the storage. Rows are added only on commit, authors that
+// already exist aren't duplicated
+class CatalogWriter {
+public:
+    virtual void Write(const CatalogRow& row) = 0;
+    // Returns numbers of added authors and books
+    virtual ImportStats Commit() = 0;
+
+    virtual ~CatalogWriter() = default;
+};
+
+using CatalogWriterHolder = std::unique_ptr<CatalogWriter>;
+
+class CatalogWriterFactory {
+public:
+    virtual CatalogWriterHolder CreateCatalogWriter() = 0;
+
+protected:
+    ~CatalogWriterFactory() = default;
+};
+
+// Reads catalog rows from CSV: "author,title,publication year", title and year may be omitted.
+// Fields with commas or quotes are quoted, quotes inside are doubled
+class CatalogCsvReader {
+public:
+    explicit CatalogCsvReader(std::istream& input)
+        : input_{input} {
+    }
+
+    // Returns nullopt at the end of input, throws std::invalid_argument on a malformed line
+    std::optional<CatalogRow> ReadRow();
+
+    size_t GetLineNumber() const noexcept {
+        return line_number_;
+    }
+
+private:
+    std::istream& input_;
+    std::string line_;
+    size_t line_number_ = 0;
+};
+
+}  // namespace app
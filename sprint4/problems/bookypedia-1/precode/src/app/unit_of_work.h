@@ -0,0 +1,30 @@
+#pragma once
+#include <memory>
+
+#include "../domain/author_fwd.h"
+#include "../domain/book_fwd.h"
+
+namespace app {
+
+// Repository calls made through one unit of work are executed in one transaction.
+// Changes are discarded, if the unit of work is destroyed without commit
+class UnitOfWork {
+public:
+    virtual void Commit() = 0;
+    virtual domain::AuthorRepository& Authors() = 0;
+    virtual domain::BookRepository& Books() = 0;
+
+    virtual ~UnitOfWork() = default;
+};
+
+using UnitOfWorkHolder = std::unique_ptr<UnitOfWork>;
+
+class UnitOfWorkFactory {
+public:
+    virtual UnitOfWorkHolder CreateUnitOfWork() = 0;
+
+protected:
+    ~UnitOfWorkFactory() = default;
+};
+
+}  // namespace app
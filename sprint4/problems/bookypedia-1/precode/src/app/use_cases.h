@@ -1,12 +1,31 @@
 #pragma once
 
+#include <iosfwd>
 #include <string>
+#include <vector>
+
+#include "../domain/author.h"
+#include "../domain/book.h"
+#include "catalog_import.h"
 
 namespace app {
 
 class UseCases {
 public:
     virtual void AddAuthor(const std::string& name) = 0;
+    // All authors are added in one transaction
+    virtual void AddAuthors(const std::vector<std::string>& names) = 0;
+    virtual std::optional<domain::Author> FindAuthorById(const std::string& author_id) = 0;
+    virtual std::optional<domain::Author> FindAuthorByName(const std::string& name) = 0;
+    virtual void DeleteAuthor(const std::string& author_id) = 0;
+    virtual void AddBook(const std::string& author_id, const std::string& title, int publication_year) = 0;
+    // Listings are read page by page: the next page starts after the last item of the previous one
+    virtual std::vector<domain::Author> GetAuthors(const std::optional<domain::Author>& after, size_t limit) = 0;
+    virtual std::vector<domain::Book> GetBooks(const std::optional<domain::Book>& after, size_t limit) = 0;
+    virtual std::vector<domain::Book> GetAuthorBooks(const std::string& author_id,
+                                                     const std::optional<domain::Book>& after, size_t limit) = 0;
+    // Streams CSV catalog into the storage in one transaction, memory doesn't depend on the catalog size
+    virtual ImportStats ImportCatalog(std::istream& input) = 0;
 
 protected:
     ~UseCases() = default;
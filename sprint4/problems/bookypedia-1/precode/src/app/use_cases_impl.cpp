@@ -1,12 +1,80 @@
 #include "use_cases_impl.h"
 
 #include "../domain/author.h"
+#include "../domain/book.h"
+
+#include <chrono>
 
 namespace app {
 using namespace domain;
 
 void UseCasesImpl::AddAuthor(const std::string& name) {
-    authors_.Save({AuthorId::New(), name});
+    auto unit = unit_of_work_factory_.CreateUnitOfWork();
+    unit->Authors().Save({AuthorId::New(), name});
+    unit->Commit();
+}
+
+void UseCasesImpl::AddAuthors(const std::vector<std::string>& names) {
+    auto unit = unit_of_work_factory_.CreateUnitOfWork();
+    for (const auto& name : names) {
+        unit->Authors().Save({AuthorId::New(), name});
+    }
+    unit->Commit();
+}
+
+std::optional<Author> UseCasesImpl::FindAuthorById(const std::string& author_id) {
+    auto unit = unit_of_work_factory_.CreateUnitOfWork();
+    return unit->Authors().FindById(AuthorId::FromString(author_id));
+}
+
+std::optional<Author> UseCasesImpl::FindAuthorByName(const std::string& name) {
+    auto unit = unit_of_work_factory_.CreateUnitOfWork();
+    return unit->Authors().FindByName(name);
+}
+
+void UseCasesImpl::DeleteAuthor(const std::string& author_id) {
+    auto unit = unit_of_work_factory_.CreateUnitOfWork();
+    unit->Authors().Delete(AuthorId::FromString(author_id));
+    unit->Commit();
+}
+
+void UseCasesImpl::AddBook(const std::string& author_id, const std::string& title, int publication_year) {
+    auto unit = unit_of_work_factory_.CreateUnitOfWork();
+    unit->Books().Save({BookId::New(), AuthorId::FromString(author_id), title, publication_year});
+    unit->Commit();
+}
+
+std::vector<Author> UseCasesImpl::GetAuthors(const std::optional<Author>& after, size_t limit) {
+    auto unit = unit_of_work_factory_.CreateUnitOfWork();
+    return unit->Authors().GetPage(after, limit);
+}
+
+std::vector<Book> UseCasesImpl::GetBooks(const std::optional<Book>& after, size_t limit) {
+    auto unit = unit_of_work_factory_.CreateUnitOfWork();
+    return unit->Books().GetPage(after, limit);
+}
+
+std::vector<Book> UseCasesImpl::GetAuthorBooks(const std::string& author_id, const std::optional<Book>& after,
+                                               size_t limit) {
+    auto unit = unit_of_work_factory_.CreateUnitOfWork();
+    return unit->Books().GetAuthorBooksPage(AuthorId::FromString(author_id), after, limit);
+}
+
+ImportStats UseCasesImpl::ImportCatalog(std::istream& input) {
+    const auto start = std::chrono::steady_clock::now();
+
+    CatalogCsvReader reader{input};
+    auto writer = catalog_writer_factory_.CreateCatalogWriter();
+    size_t rows = 0;
+    while (auto row = reader.ReadRow()) {
+        writer->Write(*row);
+        ++rows;
+    }
+
+    auto stats = writer->Commit();
+    stats.rows = rows;
+    stats.duration = std::chrono::steady_clock::now() - start;
+    return stats;
 }
 
 }  // namespace app
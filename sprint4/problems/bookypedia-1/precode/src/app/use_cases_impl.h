@@ -1,19 +1,32 @@
 #pragma once
-#include "../domain/author_fwd.h"
+#include "catalog_import.h"
+#include "unit_of_work.h"
 #include "use_cases.h"
 
 namespace app {
 
 class UseCasesImpl : public UseCases {
 public:
-    explicit UseCasesImpl(domain::AuthorRepository& authors)
-        : authors_{authors} {
+    UseCasesImpl(UnitOfWorkFactory& unit_of_work_factory, CatalogWriterFactory& catalog_writer_factory)
+        : unit_of_work_factory_{unit_of_work_factory}
+        , catalog_writer_factory_{catalog_writer_factory} {
     }
 
     void AddAuthor(const std::string& name) override;
+    void AddAuthors(const std::vector<std::string>& names) override;
+    std::optional<domain::Author> FindAuthorById(const std::string& author_id) override;
+    std::optional<domain::Author> FindAuthorByName(const std::string& name) override;
+    void DeleteAuthor(const std::string& author_id) override;
+    void AddBook(const std::string& author_id, const std::string& title, int publication_year) override;
+    std::vector<domain::Author> GetAuthors(const std::optional<domain::Author>& after, size_t limit) override;
+    std::vector<domain::Book> GetBooks(const std::optional<domain::Book>& after, size_t limit) override;
+    std::vector<domain::Book> GetAuthorBooks(const std::string& author_id, const std::optional<domain::Book>& after,
+                                             size_t limit) override;
+    ImportStats ImportCatalog(std::istream& input) override;
 
 private:
-    domain::AuthorRepository& authors_;
+    UnitOfWorkFactory& unit_of_work_factory_;
+    CatalogWriterFactory& catalog_writer_factory_;
 };
 
 }  // namespace app
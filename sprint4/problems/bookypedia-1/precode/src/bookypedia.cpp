@@ -11,7 +11,8 @@ namespace bookypedia {
 using namespace std::literals;
 
 Application::Application(const AppConfig& config)
-    : db_{pqxx::connection{config.db_url}} {
+    : db_{config.db_url, config.db_pool_size}
+    , author_cache_{config.author_cache_capacity} {
 }
 
 void Application::Run() {
@@ -23,6 +24,12 @@ void Application::Run() {
     menu.AddAction("Exit"s, {}, "Exit program"s, [&menu](std::istream&) {
         return false;
     });
+    menu.AddAction("CacheStats"s, {}, "Show author cache statistics"s, [this](std::istream&) {
+        const auto stats = author_cache_.GetStats();
+        std::cout << "Author cache: "sv << author_cache_.GetSize() << " authors, "sv << stats.hits << " hits, "sv
+                  << stats.misses << " misses, hit rate "sv << stats.GetHitRate() << std::endl;
+        return true;
+    });
     ui::View view{menu, use_cases_, std::cin, std::cout};
     menu.Run();
 }
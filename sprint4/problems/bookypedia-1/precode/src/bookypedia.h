@@ -1,6 +1,8 @@
 #pragma once
 #include <pqxx/pqxx>
 
+#include "app/author_cache.h"
+#include "app/cached_unit_of_work.h"
 #include "app/use_cases_impl.h"
 #include "postgres/postgres.h"
 
@@ -8,6 +10,8 @@ namespace bookypedia {
 
 struct AppConfig {
     std::string db_url;
+    size_t db_pool_size = 4;
+    size_t author_cache_capacity = 10'000;
 };
 
 class Application {
@@ -18,7 +22,9 @@ public:
 
 private:
     postgres::Database db_;
-    app::UseCasesImpl use_cases_{db_.GetAuthors()};
+    app::AuthorCache author_cache_;
+    app::CachedUnitOfWorkFactory cached_units_{db_, author_cache_};
+    app::UseCasesImpl use_cases_{cached_units_, db_};
 };
 
 }  // namespace bookypedia
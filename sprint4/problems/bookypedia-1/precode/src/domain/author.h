@@ -1,5 +1,7 @@
 #pragma once
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "../util/tagged_uuid.h"
 
@@ -34,6 +36,12 @@ private:
 class AuthorRepository {
 public:
     virtual void Save(const Author& author) = 0;
+    // Author is deleted with all their books
+    virtual void Delete(const AuthorId& id) = 0;
+    virtual std::optional<Author> FindById(const AuthorId& id) = 0;
+    virtual std::optional<Author> FindByName(const std::string& name) = 0;
+    // Returns up to limit authors ordered by name, which follow the given one
+    virtual std::vector<Author> GetPage(const std::optional<Author>& after, size_t limit) = 0;
 
 protected:
     ~AuthorRepository() = default;
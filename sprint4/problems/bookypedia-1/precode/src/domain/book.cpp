@@ -0,0 +1,5 @@
+#include "book.h"
+
+namespace domain {
+
+}  // namespace domain
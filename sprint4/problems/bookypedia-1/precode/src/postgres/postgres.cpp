@@ -7,34 +7,217 @@ namespace postgres {
 using namespace std::literals;
 using pqxx::operator"" _zv;
 
-void AuthorRepositoryImpl::Save(const domain::Author& author) {
-    // Пока каждое обращение к репозиторию выполняется внутри отдельной транзакции
-    // В будущих уроках вы узнаете про паттерн Unit of Work, при помощи которого сможете несколько
-    // запросов выполнить в рамках одной транзакции.
-    // Вы также может самостоятельно почитать информацию про этот паттерн и применить его здесь.
-    pqxx::work work{connection_};
-    work.exec_params(
-        R"(
-INSERT INTO authors (id, name) VALUES ($1, $2)
-ON CONFLICT (id) DO UPDATE SET name=$2;
-)"_zv,
-        author.GetId().ToString(), author.GetName());
-    work.commit();
-}
+namespace {
 
-Database::Database(pqxx::connection connection)
-    : connection_{std::move(connection)} {
-    pqxx::work work{connection_};
+constexpr auto SAVE_AUTHOR = "save_author"_zv;
+constexpr auto DELETE_AUTHOR = "delete_author"_zv;
+constexpr auto DELETE_AUTHOR_BOOKS = "delete_author_books"_zv;
+constexpr auto FIND_AUTHOR_BY_ID = "find_author_by_id"_zv;
+constexpr auto FIND_AUTHOR_BY_NAME = "find_author_by_name"_zv;
+constexpr auto SAVE_BOOK = "save_book"_zv;
+constexpr auto AUTHORS_FIRST_PAGE = "authors_first_page"_zv;
+constexpr auto AUTHORS_NEXT_PAGE = "authors_next_page"_zv;
+constexpr auto BOOKS_FIRST_PAGE = "books_first_page"_zv;
+constexpr auto BOOKS_NEXT_PAGE = "books_next_page"_zv;
+constexpr auto AUTHOR_BOOKS_FIRST_PAGE = "author_books_first_page"_zv;
+constexpr auto AUTHOR_BOOKS_NEXT_PAGE = "author_books_next_page"_zv;
+constexpr auto IMPORT_TABLE = "catalog_import"sv;
+
+void CreateTables(pqxx::connection& connection) {
+    pqxx::work work{connection};
     work.exec(R"(
 CREATE TABLE IF NOT EXISTS authors (
     id UUID CONSTRAINT author_id_constraint PRIMARY KEY,
     name varchar(100) UNIQUE NOT NULL
 );
 )"_zv);
-    // ... создать другие таблицы
+    work.exec(R"(
+CREATE TABLE IF NOT EXISTS books (
+    id UUID CONSTRAINT book_id_constraint PRIMARY KEY,
+    author_id UUID NOT NULL REFERENCES authors (id),
+    title varchar(100) NOT NULL,
+    publication_year integer
+);
+)"_zv);
+    // Listings are read by keyset pagination, each page is a range scan of one of the indexes.
+    // Authors are ordered by the unique name, which is indexed by its constraint
+    work.exec(R"(
+CREATE INDEX IF NOT EXISTS books_title_id_idx ON books (title, id);
+)"_zv);
+    work.exec(R"(
+CREATE INDEX IF NOT EXISTS books_author_id_title_id_idx ON books (author_id, title, id);
+)"_zv);
 
     // коммитим изменения
     work.commit();
 }
 
-}  // namespace postgres
\ No newline at end of file
+// Statements are parsed and planned by the server once, repositories send only the parameters
+void PrepareStatements(pqxx::connection& connection) {
+    connection.prepare(SAVE_AUTHOR, R"(
+INSERT INTO authors (id, name) VALUES ($1, $2)
+ON CONFLICT (id) DO UPDATE SET name=$2;
+)"_zv);
+    connection.prepare(DELETE_AUTHOR, R"(
+DELETE FROM authors WHERE id = $1::uuid;
+)"_zv);
+    connection.prepare(DELETE_AUTHOR_BOOKS, R"(
+DELETE FROM books WHERE author_id = $1::uuid;
+)"_zv);
+    connection.prepare(FIND_AUTHOR_BY_ID, R"(
+SELECT id, name FROM authors WHERE id = $1::uuid;
+)"_zv);
+    connection.prepare(FIND_AUTHOR_BY_NAME, R"(
+SELECT id, name FROM authors WHERE name = $1;
+)"_zv);
+    connection.prepare(SAVE_BOOK, R"(
+INSERT INTO books (id, author_id, title, publication_year) VALUES ($1, $2, $3, $4)
+ON CONFLICT (id) DO UPDATE SET author_id=$2, title=$3, publication_year=$4;
+)"_zv);
+
+    // Next pages compare with the key of the last row instead of OFFSET, so the page
+    // costs the same wherever it is
+    connection.prepare(AUTHORS_FIRST_PAGE, R"(
+SELECT id, name FROM authors ORDER BY name LIMIT $1;
+)"_zv);
+    connection.prepare(AUTHORS_NEXT_PAGE, R"(
+SELECT id, name FROM authors WHERE name > $1 ORDER BY name LIMIT $2;
+)"_zv);
+    connection.prepare(BOOKS_FIRST_PAGE, R"(
+SELECT id, author_id, title, publication_year FROM books ORDER BY title, id LIMIT $1;
+)"_zv);
+    connection.prepare(BOOKS_NEXT_PAGE, R"(
+SELECT id, author_id, title, publication_year FROM books
+WHERE (title, id) > ($1, $2::uuid) ORDER BY title, id LIMIT $3;
+)"_zv);
+    connection.prepare(AUTHOR_BOOKS_FIRST_PAGE, R"(
+SELECT id, author_id, title, publication_year FROM books
+WHERE author_id = $1::uuid ORDER BY title, id LIMIT $2;
+)"_zv);
+    connection.prepare(AUTHOR_BOOKS_NEXT_PAGE, R"(
+SELECT id, author_id, title, publication_year FROM books
+WHERE author_id = $1::uuid AND (title, id) > ($2, $3::uuid) ORDER BY title, id LIMIT $4;
+)"_zv);
+}
+
+std::optional<domain::Author> ReadAuthor(const pqxx::result& rows) {
+    if (rows.empty()) {
+        return std::nullopt;
+    }
+    return domain::Author{domain::AuthorId::FromString(rows[0][0].as<std::string>()), rows[0][1].as<std::string>()};
+}
+
+std::vector<domain::Book> ReadBooks(const pqxx::result& rows) {
+    std::vector<domain::Book> books;
+    books.reserve(rows.size());
+    for (const auto& row : rows) {
+        books.emplace_back(domain::BookId::FromString(row[0].as<std::string>()),
+                           domain::AuthorId::FromString(row[1].as<std::string>()), row[2].as<std::string>(),
+                           row[3].as<int>(0));
+    }
+    return books;
+}
+
+}  // namespace
+
+void AuthorRepositoryImpl::Save(const domain::Author& author) {
+    // Transaction is owned by the unit of work, so several calls are committed at once
+    work_.exec_prepared(SAVE_AUTHOR, author.GetId().ToString(), author.GetName());
+}
+
+void AuthorRepositoryImpl::Delete(const domain::AuthorId& id) {
+    work_.exec_prepared(DELETE_AUTHOR_BOOKS, id.ToString());
+    work_.exec_prepared(DELETE_AUTHOR, id.ToString());
+}
+
+std::optional<domain::Author> AuthorRepositoryImpl::FindById(const domain::AuthorId& id) {
+    return ReadAuthor(work_.exec_prepared(FIND_AUTHOR_BY_ID, id.ToString()));
+}
+
+std::optional<domain::Author> AuthorRepositoryImpl::FindByName(const std::string& name) {
+    return ReadAuthor(work_.exec_prepared(FIND_AUTHOR_BY_NAME, name));
+}
+
+std::vector<domain::Author> AuthorRepositoryImpl::GetPage(const std::optional<domain::Author>& after, size_t limit) {
+    const auto rows = after ? work_.exec_prepared(AUTHORS_NEXT_PAGE, after->GetName(), static_cast<int64_t>(limit))
+                            : work_.exec_prepared(AUTHORS_FIRST_PAGE, static_cast<int64_t>(limit));
+
+    std::vector<domain::Author> authors;
+    authors.reserve(rows.size());
+    for (const auto& row : rows) {
+        authors.emplace_back(domain::AuthorId::FromString(row[0].as<std::string>()), row[1].as<std::string>());
+    }
+    return authors;
+}
+
+void BookRepositoryImpl::Save(const domain::Book& book) {
+    work_.exec_prepared(SAVE_BOOK, book.GetId().ToString(), book.GetAuthorId().ToString(), book.GetTitle(),
+                        book.GetPublicationYear());
+}
+
+CatalogWriterImpl::CatalogWriterImpl(ConnectionPool::ConnectionWrapper&& connection)
+    : connection_{std::move(connection)} {
+    work_.exec(R"(
+CREATE TEMP TABLE catalog_import (
+    author_name varchar(100) NOT NULL,
+    title varchar(100),
+    publication_year integer
+) ON COMMIT DROP;
+)"_zv);
+    stream_.emplace(pqxx::stream_to::table(work_, {IMPORT_TABLE}, {"author_name"sv, "title"sv, "publication_year"sv}));
+}
+
+void CatalogWriterImpl::Write(const app::CatalogRow& row) {
+    // Row is sent to the server right away, nothing is accumulated on the client
+    stream_->write_values(row.author_name, row.title, row.publication_year);
+}
+
+app::ImportStats CatalogWriterImpl::Commit() {
+    stream_->complete();
+
+    app::ImportStats stats;
+    // gen_random_uuid() is built into PostgreSQL since version 13
+    stats.authors = work_.exec(R"(
+INSERT INTO authors (id, name)
+SELECT gen_random_uuid(), author_name FROM (SELECT DISTINCT author_name FROM catalog_import) AS names
+ON CONFLICT (name) DO NOTHING;
+)"_zv).affected_rows();
+    stats.books = work_.exec(R"(
+INSERT INTO books (id, author_id, title, publication_year)
+SELECT gen_random_uuid(), authors.id, catalog_import.title, catalog_import.publication_year
+FROM catalog_import JOIN authors ON authors.name = catalog_import.author_name
+WHERE catalog_import.title IS NOT NULL;
+)"_zv).affected_rows();
+
+    work_.commit();
+    return stats;
+}
+
+std::vector<domain::Book> BookRepositoryImpl::GetPage(const std::optional<domain::Book>& after, size_t limit) {
+    return ReadBooks(after ? work_.exec_prepared(BOOKS_NEXT_PAGE, after->GetTitle(), after->GetId().ToString(),
+                                                 static_cast<int64_t>(limit))
+                           : work_.exec_prepared(BOOKS_FIRST_PAGE, static_cast<int64_t>(limit)));
+}
+
+std::vector<domain::Book> BookRepositoryImpl::GetAuthorBooksPage(const domain::AuthorId& author_id,
+                                                                 const std::optional<domain::Book>& after,
+                                                                 size_t limit) {
+    return ReadBooks(after ? work_.exec_prepared(AUTHOR_BOOKS_NEXT_PAGE, author_id.ToString(), after->GetTitle(),
+                                                 after->GetId().ToString(), static_cast<int64_t>(limit))
+                           : work_.exec_prepared(AUTHOR_BOOKS_FIRST_PAGE, author_id.ToString(),
+                                                 static_cast<int64_t>(limit)));
+}
+
+Database::Database(const std::string& db_url, size_t pool_size)
+    : pool_{pool_size, [&db_url, tables_created = false]() mutable {
+        auto connection = std::make_shared<pqxx::connection>(db_url);
+        if (!tables_created) {
+            CreateTables(*connection);
+            tables_created = true;
+        }
+        PrepareStatements(*connection);
+        return connection;
+    }} {
+}
+
+}  // namespace postgres
@@ -1,34 +1,106 @@
 #pragma once
 #include <pqxx/connection>
+#include <pqxx/stream_to>
 #include <pqxx/transaction>
 
+#include <optional>
+
+#include "../app/catalog_import.h"
+#include "../app/unit_of_work.h"
 #include "../domain/author.h"
+#include "../domain/book.h"
+#include "connection_pool.h"
 
 namespace postgres {
 
 class AuthorRepositoryImpl : public domain::AuthorRepository {
 public:
-    explicit AuthorRepositoryImpl(pqxx::connection& connection)
-        : connection_{connection} {
+    explicit AuthorRepositoryImpl(pqxx::work& work)
+        : work_{work} {
     }
 
     void Save(const domain::Author& author) override;
+    void Delete(const domain::AuthorId& id) override;
+    std::optional<domain::Author> FindById(const domain::AuthorId& id) override;
+    std::optional<domain::Author> FindByName(const std::string& name) override;
+    std::vector<domain::Author> GetPage(const std::optional<domain::Author>& after, size_t limit) override;
+
+private:
+    pqxx::work& work_;
+};
+
+class BookRepositoryImpl : public domain::BookRepository {
+public:
+    explicit BookRepositoryImpl(pqxx::work& work)
+        : work_{work} {
+    }
+
+    void Save(const domain::Book& book) override;
+    std::vector<domain::Book> GetPage(const std::optional<domain::Book>& after, size_t limit) override;
+    std::vector<domain::Book> GetAuthorBooksPage(const domain::AuthorId& author_id,
+                                                 const std::optional<domain::Book>& after, size_t limit) override;
 
 private:
-    pqxx::connection& connection_;
+    pqxx::work& work_;
 };
 
-class Database {
+// Holds a pooled connection and its transaction until the unit of work is destroyed
+class UnitOfWorkImpl : public app::UnitOfWork {
 public:
-    explicit Database(pqxx::connection connection);
+    explicit UnitOfWorkImpl(ConnectionPool::ConnectionWrapper&& connection)
+        : connection_{std::move(connection)} {
+    }
+
+    void Commit() override {
+        work_.commit();
+    }
 
-    AuthorRepositoryImpl& GetAuthors() & {
+    domain::AuthorRepository& Authors() override {
         return authors_;
     }
 
+    domain::BookRepository& Books() override {
+        return books_;
+    }
+
+private:
+    ConnectionPool::ConnectionWrapper connection_;
+    pqxx::work work_{*connection_};
+    AuthorRepositoryImpl authors_{work_};
+    BookRepositoryImpl books_{work_};
+};
+
+// Rows are copied into a temporary table with COPY, and then authors and books
+// are inserted from it by two statements
+class CatalogWriterImpl : public app::CatalogWriter {
+public:
+    explicit CatalogWriterImpl(ConnectionPool::ConnectionWrapper&& connection);
+
+    void Write(const app::CatalogRow& row) override;
+    app::ImportStats Commit() override;
+
+private:
+    ConnectionPool::ConnectionWrapper connection_;
+    pqxx::work work_{*connection_};
+    // Stream is opened after the temporary table is created
+    std::optional<pqxx::stream_to> stream_;
+};
+
+class Database : public app::UnitOfWorkFactory, public app::CatalogWriterFactory {
+public:
+    // Tables are created by the first connection, statements are prepared on each one
+    Database(const std::string& db_url, size_t pool_size);
+
+    app::UnitOfWorkHolder CreateUnitOfWork() override {
+        return std::make_unique<UnitOfWorkImpl>(pool_.GetConnection());
+    }
+
+    app::CatalogWriterHolder CreateCatalogWriter() override {
+        return std::make_unique<CatalogWriterImpl>(pool_.GetConnection());
+    }
+
 private:
-    pqxx::connection connection_;
-    AuthorRepositoryImpl authors_{connection_};
+    ConnectionPool pool_;
 };
 
-}  // namespace postgres
\ No newline at end of file
+}  // namespace postgres
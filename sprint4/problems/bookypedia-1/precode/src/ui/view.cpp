@@ -2,9 +2,13 @@
 
 #include <boost/algorithm/string/trim.hpp>
 #include <cassert>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
 
 #include "../app/use_cases.h"
+#include "../domain/author.h"
+#include "../domain/book.h"
 #include "../menu/menu.h"
 
 using namespace std::literals;
@@ -25,14 +29,51 @@ std::ostream& operator<<(std::ostream& out, const BookInfo& book) {
 
 }  // namespace detail
 
+namespace {
+
+// Lists are shown page by page, only the current page is kept in memory
+constexpr size_t PAGE_SIZE = 100;
+
+detail::AuthorInfo ToAuthorInfo(const domain::Author& author) {
+    return {author.GetId().ToString(), author.GetName()};
+}
+
+detail::BookInfo ToBookInfo(const domain::Book& book) {
+    return {book.GetTitle(), book.GetPublicationYear()};
+}
+
+}  // namespace
+
 template <typename T>
-void PrintVector(std::ostream& out, const std::vector<T>& vector) {
-    int i = 1;
+void PrintVector(std::ostream& out, const std::vector<T>& vector, size_t first_number = 1) {
+    size_t i = first_number;
     for (auto& value : vector) {
         out << i++ << " " << value << std::endl;
     }
 }
 
+// Fetches and prints pages until the list ends or the user stops it
+template <typename T, typename FetchPage, typename ToInfo>
+void View::PrintPages(FetchPage&& fetch_page, ToInfo&& to_info) const {
+    std::optional<T> last;
+    size_t first_number = 1;
+    while (true) {
+        const auto page = fetch_page(last);
+        std::vector<decltype(to_info(page.front()))> infos;
+        infos.reserve(page.size());
+        for (const auto& item : page) {
+            infos.push_back(to_info(item));
+        }
+        PrintVector(output_, infos, first_number);
+
+        if (page.size() < PAGE_SIZE || !AskForNextPage()) {
+            return;
+        }
+        last = page.back();
+        first_number += page.size();
+    }
+}
+
 View::View(menu::Menu& menu, app::UseCases& use_cases, std::istream& input, std::ostream& output)
     : menu_{menu}
     , use_cases_{use_cases}
@@ -45,6 +86,10 @@ View::View(menu::Menu& menu, app::UseCases& use_cases, std::istream& input, std:
     );
     menu_.AddAction("AddBook"s, "<pub year> <title>"s, "Adds book"s,
                     std::bind(&View::AddBook, this, ph::_1));
+    menu_.AddAction("DeleteAuthor"s, "<name>"s, "Deletes author and their books"s,
+                    std::bind(&View::DeleteAuthor, this, ph::_1));
+    menu_.AddAction("ImportCatalog"s, "<csv file>"s, "Imports authors and books from CSV: author,title,year"s,
+                    std::bind(&View::ImportCatalog, this, ph::_1));
     menu_.AddAction("ShowAuthors"s, {}, "Show authors"s, std::bind(&View::ShowAuthors, this));
     menu_.AddAction("ShowBooks"s, {}, "Show books"s, std::bind(&View::ShowBooks, this));
     menu_.AddAction("ShowAuthorBooks"s, {}, "Show author books"s,
@@ -66,7 +111,7 @@ bool View::AddAuthor(std::istream& cmd_input) const {
 bool View::AddBook(std::istream& cmd_input) const {
     try {
         if (auto params = GetBookParams(cmd_input)) {
-            assert(!"TODO: implement book adding");
+            use_cases_.AddBook(params->author_id, params->title, params->publication_year);
         }
     } catch (const std::exception&) {
         output_ << "Failed to add book"sv << std::endl;
@@ -74,13 +119,69 @@ bool View::AddBook(std::istream& cmd_input) const {
     return true;
 }
 
+bool View::DeleteAuthor(std::istream& cmd_input) const {
+    try {
+        std::string name;
+        std::getline(cmd_input, name);
+        boost::algorithm::trim(name);
+
+        // Author is selected from the list, if the name isn't given
+        std::optional<std::string> author_id;
+        if (name.empty()) {
+            author_id = SelectAuthor();
+        } else if (auto author = use_cases_.FindAuthorByName(name)) {
+            author_id = author->GetId().ToString();
+        } else {
+            throw std::invalid_argument("Author not found");
+        }
+
+        if (author_id) {
+            use_cases_.DeleteAuthor(*author_id);
+        }
+    } catch (const std::exception&) {
+        output_ << "Failed to delete author"sv << std::endl;
+    }
+    return true;
+}
+
+bool View::ImportCatalog(std::istream& cmd_input) const {
+    try {
+        std::string file_name;
+        std::getline(cmd_input, file_name);
+        boost::algorithm::trim(file_name);
+
+        std::ifstream file{file_name};
+        if (!file) {
+            output_ << "Failed to open "sv << file_name << std::endl;
+            return true;
+        }
+
+        const auto stats = use_cases_.ImportCatalog(file);
+        output_ << "Imported "sv << stats.rows << " rows ("sv << stats.authors << " authors, "sv << stats.books
+                << " books) in "sv << std::fixed << std::setprecision(2) << stats.duration.count() << " s, "sv
+                << std::setprecision(0) << stats.GetRowsPerSecond() << " rows/s"sv << std::defaultfloat
+                << std::endl;
+    } catch (const std::exception& e) {
+        output_ << "Failed to import catalog: "sv << e.what() << std::endl;
+    }
+    return true;
+}
+
 bool View::ShowAuthors() const {
-    PrintVector(output_, GetAuthors());
+    PrintPages<domain::Author>(
+        [this](const std::optional<domain::Author>& after) {
+            return use_cases_.GetAuthors(after, PAGE_SIZE);
+        },
+        ToAuthorInfo);
     return true;
 }
 
 bool View::ShowBooks() const {
-    PrintVector(output_, GetBooks());
+    PrintPages<domain::Book>(
+        [this](const std::optional<domain::Book>& after) {
+            return use_cases_.GetBooks(after, PAGE_SIZE);
+        },
+        ToBookInfo);
     return true;
 }
 
@@ -88,7 +189,11 @@ bool View::ShowAuthorBooks() const {
     // TODO: handle error
     try {
         if (auto author_id = SelectAuthor()) {
-            PrintVector(output_, GetAuthorBooks(*author_id));
+            PrintPages<domain::Book>(
+                [this, &author_id](const std::optional<domain::Book>& after) {
+                    return use_cases_.GetAuthorBooks(*author_id, after, PAGE_SIZE);
+                },
+                ToBookInfo);
         }
     } catch (const std::exception&) {
         throw std::runtime_error("Failed to Show Books");
@@ -96,6 +201,12 @@ bool View::ShowAuthorBooks() const {
     return true;
 }
 
+bool View::AskForNextPage() const {
+    output_ << "Enter empty line to show more or any text to stop"sv << std::endl;
+    std::string str;
+    return std::getline(input_, str) && str.empty();
+}
+
 std::optional<detail::AddBookParams> View::GetBookParams(std::istream& cmd_input) const {
     detail::AddBookParams params;
 
@@ -114,46 +225,53 @@ std::optional<detail::AddBookParams> View::GetBookParams(std::istream& cmd_input
 
 std::optional<std::string> View::SelectAuthor() const {
     output_ << "Select author:" << std::endl;
-    auto authors = GetAuthors();
-    PrintVector(output_, authors);
-    output_ << "Enter author # or empty line to cancel" << std::endl;
 
-    std::string str;
-    if (!std::getline(input_, str) || str.empty()) {
-        return std::nullopt;
-    }
-
-    int author_idx;
-    try {
-        author_idx = std::stoi(str);
-    } catch (std::exception const&) {
-        throw std::runtime_error("Invalid author num");
-    }
+    std::optional<domain::Author> last;
+    size_t first_number = 1;
+    while (true) {
+        const auto authors = use_cases_.GetAuthors(last, PAGE_SIZE);
+        std::vector<detail::AuthorInfo> infos;
+        infos.reserve(authors.size());
+        for (const auto& author : authors) {
+            infos.push_back(ToAuthorInfo(author));
+        }
+        PrintVector(output_, infos, first_number);
 
-    --author_idx;
-    if (author_idx < 0 or author_idx >= authors.size()) {
-        throw std::runtime_error("Invalid author num");
-    }
+        // Only the authors of the shown page can be selected
+        const bool has_more = authors.size() == PAGE_SIZE;
+        if (has_more) {
+            output_ << "Enter author #, empty line to show more or 'q' to cancel" << std::endl;
+        } else {
+            output_ << "Enter author # or empty line to cancel" << std::endl;
+        }
 
-    return authors[author_idx].id;
-}
+        std::string str;
+        if (!std::getline(input_, str)) {
+            return std::nullopt;
+        }
+        if (has_more && str.empty()) {
+            last = authors.back();
+            first_number += authors.size();
+            continue;
+        }
+        if (str.empty() || str == "q") {
+            return std::nullopt;
+        }
 
-std::vector<detail::AuthorInfo> View::GetAuthors() const {
-    std::vector<detail::AuthorInfo> dst_autors;
-    assert(!"TODO: implement GetAuthors()");
-    return dst_autors;
-}
+        int author_num;
+        try {
+            author_num = std::stoi(str);
+        } catch (std::exception const&) {
+            throw std::runtime_error("Invalid author num");
+        }
 
-std::vector<detail::BookInfo> View::GetBooks() const {
-    std::vector<detail::BookInfo> books;
-    assert(!"TODO: implement GetBooks()");
-    return books;
-}
+        if (author_num < static_cast<int>(first_number)
+            or author_num >= static_cast<int>(first_number + authors.size())) {
+            throw std::runtime_error("Invalid author num");
+        }
 
-std::vector<detail::BookInfo> View::GetAuthorBooks(const std::string& author_id) const {
-    std::vector<detail::BookInfo> books;
-    assert(!"TODO: implement GetAuthorBooks()");
-    return books;
+        return infos[author_num - first_number].id;
+    }
 }
 
 }  // namespace ui
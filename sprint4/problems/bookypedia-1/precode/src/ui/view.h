@@ -40,15 +40,18 @@ public:
 private:
     bool AddAuthor(std::istream& cmd_input) const;
     bool AddBook(std::istream& cmd_input) const;
+    bool DeleteAuthor(std::istream& cmd_input) const;
+    bool ImportCatalog(std::istream& cmd_input) const;
     bool ShowAuthors() const;
     bool ShowBooks() const;
     bool ShowAuthorBooks() const;
 
     std::optional<detail::AddBookParams> GetBookParams(std::istream& cmd_input) const;
     std::optional<std::string> SelectAuthor() const;
-    std::vector<detail::AuthorInfo> GetAuthors() const;
-    std::vector<detail::BookInfo> GetBooks() const;
-    std::vector<detail::BookInfo> GetAuthorBooks(const std::string& author_id) const;
+    bool AskForNextPage() const;
+
+    template <typename T, typename FetchPage, typename ToInfo>
+    void PrintPages(FetchPage&& fetch_page, ToInfo&& to_info) const;
 
     menu::Menu& menu_;
     app::UseCases& use_cases_;
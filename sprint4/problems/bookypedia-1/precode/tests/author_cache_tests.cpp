@@ -0,0 +1,193 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/app/author_cache.h"
+#include "../src/app/cached_unit_of_work.h"
+#include "../src/domain/book.h"
+
+namespace {
+
+// Counts lookups, which reach the storage
+struct CountingAuthorRepository : domain::AuthorRepository {
+    std::vector<domain::Author> authors;
+    int lookups = 0;
+
+    void Save(const domain::Author& author) override {
+        Delete(author.GetId());
+        authors.push_back(author);
+    }
+
+    void Delete(const domain::AuthorId& id) override {
+        std::erase_if(authors, [&id](const domain::Author& author) {
+            return author.GetId() == id;
+        });
+    }
+
+    std::optional<domain::Author> FindById(const domain::AuthorId& id) override {
+        ++lookups;
+        for (const auto& author : authors) {
+            if (author.GetId() == id) {
+                return author;
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::optional<domain::Author> FindByName(const std::string& name) override {
+        ++lookups;
+        for (const auto& author : authors) {
+            if (author.GetName() == name) {
+                return author;
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::vector<domain::Author> GetPage(const std::optional<domain::Author>&, size_t) override {
+        return authors;
+    }
+};
+
+struct NoBookRepository : domain::BookRepository {
+    void Save(const domain::Book&) override {
+    }
+    std::vector<domain::Book> GetPage(const std::optional<domain::Book>&, size_t) override {
+        return {};
+    }
+    std::vector<domain::Book> GetAuthorBooksPage(const domain::AuthorId&, const std::optional<domain::Book>&,
+                                                 size_t) override {
+        return {};
+    }
+};
+
+// Changes go straight to the shared repository, commit is only counted
+struct DirectUnitOfWork : app::UnitOfWork {
+    DirectUnitOfWork(CountingAuthorRepository& authors, NoBookRepository& books)
+        : authors{authors}
+        , books{books} {
+    }
+
+    void Commit() override {
+    }
+    domain::AuthorRepository& Authors() override {
+        return authors;
+    }
+    domain::BookRepository& Books() override {
+        return books;
+    }
+
+    CountingAuthorRepository& authors;
+    NoBookRepository& books;
+};
+
+struct DirectUnitOfWorkFactory : app::UnitOfWorkFactory {
+    CountingAuthorRepository authors;
+    NoBookRepository books;
+
+    app::UnitOfWorkHolder CreateUnitOfWork() override {
+        return std::make_unique<DirectUnitOfWork>(authors, books);
+    }
+};
+
+}  // namespace
+
+SCENARIO("Author cache") {
+    GIVEN("cache of two authors") {
+        app::AuthorCache cache{2};
+        const domain::Author rowling{domain::AuthorId::New(), "Joanne Rowling"};
+        const domain::Author king{domain::AuthorId::New(), "Stephen King"};
+        const domain::Author bradbury{domain::AuthorId::New(), "Ray Bradbury"};
+
+        WHEN("authors are put") {
+            cache.Put(rowling, cache.GetVersion());
+            cache.Put(king, cache.GetVersion());
+
+            THEN("they are found by id and by name") {
+                CHECK(cache.FindById(rowling.GetId())->GetName() == rowling.GetName());
+                CHECK(cache.FindByName(king.GetName())->GetId() == king.GetId());
+                CHECK(cache.GetStats().hits == 2);
+            }
+
+            THEN("least recently used author is evicted") {
+                cache.FindById(rowling.GetId());
+                cache.Put(bradbury, cache.GetVersion());
+                CHECK(cache.GetSize() == 2);
+                CHECK(cache.FindByName(rowling.GetName()));
+                CHECK_FALSE(cache.FindByName(king.GetName()));
+                CHECK_FALSE(cache.FindById(king.GetId()));
+                CHECK(cache.FindById(bradbury.GetId()));
+            }
+
+            THEN("invalidated author is removed with all its keys") {
+                cache.Invalidate(rowling.GetId());
+                CHECK_FALSE(cache.FindByName(rowling.GetName()));
+                CHECK(cache.GetStats().misses == 1);
+            }
+        }
+
+        WHEN("author is read before an invalidation") {
+            const auto version = cache.GetVersion();
+            cache.Invalidate(rowling.GetId());
+            cache.Put(rowling, version);
+
+            THEN("stale author isn't put") {
+                CHECK_FALSE(cache.FindById(rowling.GetId()));
+            }
+        }
+    }
+}
+
+SCENARIO("Cached unit of work") {
+    GIVEN("author repository behind the cache") {
+        DirectUnitOfWorkFactory factory;
+        app::AuthorCache cache{100};
+        app::CachedUnitOfWorkFactory cached_factory{factory, cache};
+        const domain::Author author{domain::AuthorId::New(), "Joanne Rowling"};
+        factory.authors.Save(author);
+
+        WHEN("author is looked up repeatedly") {
+            for (int i = 0; i < 10; ++i) {
+                auto unit = cached_factory.CreateUnitOfWork();
+                REQUIRE(unit->Authors().FindByName(author.GetName()));
+                REQUIRE(unit->Authors().FindById(author.GetId()));
+            }
+
+            THEN("only the first lookup reaches the repository") {
+                CHECK(factory.authors.lookups == 1);
+                CHECK(cache.GetStats().hits == 19);
+                CHECK(cache.GetStats().misses == 1);
+            }
+        }
+
+        WHEN("author is renamed") {
+            cached_factory.CreateUnitOfWork()->Authors().FindById(author.GetId());
+            {
+                auto unit = cached_factory.CreateUnitOfWork();
+                unit->Authors().Save({author.GetId(), "J. K. Rowling"});
+                // Lookups after the change in the same unit bypass the cache
+                CHECK(unit->Authors().FindById(author.GetId())->GetName() == "J. K. Rowling");
+                unit->Commit();
+            }
+
+            THEN("new name is read and the old one isn't found") {
+                auto unit = cached_factory.CreateUnitOfWork();
+                CHECK(unit->Authors().FindById(author.GetId())->GetName() == "J. K. Rowling");
+                CHECK_FALSE(unit->Authors().FindByName("Joanne Rowling"));
+            }
+        }
+
+        WHEN("author is deleted") {
+            cached_factory.CreateUnitOfWork()->Authors().FindByName(author.GetName());
+            {
+                auto unit = cached_factory.CreateUnitOfWork();
+                unit->Authors().Delete(author.GetId());
+                unit->Commit();
+            }
+
+            THEN("author isn't found") {
+                auto unit = cached_factory.CreateUnitOfWork();
+                CHECK_FALSE(unit->Authors().FindByName(author.GetName()));
+                CHECK_FALSE(unit->Authors().FindById(author.GetId()));
+            }
+        }
+    }
+}
@@ -1,7 +1,12 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
 #include "../src/app/use_cases_impl.h"
 #include "../src/domain/author.h"
+#include "../src/domain/book.h"
 
 namespace {
 
@@ -11,17 +16,137 @@ struct MockAuthorRepository : domain::AuthorRepository {
     void Save(const domain::Author& author) override {
         saved_authors.emplace_back(author);
     }
+
+    void Delete(const domain::AuthorId& id) override {
+        std::erase_if(saved_authors, [&id](const domain::Author& author) {
+            return author.GetId() == id;
+        });
+    }
+
+    std::optional<domain::Author> FindById(const domain::AuthorId& id) override {
+        auto it = std::find_if(saved_authors.begin(), saved_authors.end(), [&id](const domain::Author& author) {
+            return author.GetId() == id;
+        });
+        return it != saved_authors.end() ? std::optional{*it} : std::nullopt;
+    }
+
+    std::optional<domain::Author> FindByName(const std::string& name) override {
+        auto it = std::find_if(saved_authors.begin(), saved_authors.end(), [&name](const domain::Author& author) {
+            return author.GetName() == name;
+        });
+        return it != saved_authors.end() ? std::optional{*it} : std::nullopt;
+    }
+
+    std::vector<domain::Author> GetPage(const std::optional<domain::Author>& after, size_t limit) override {
+        auto authors = saved_authors;
+        std::sort(authors.begin(), authors.end(), [](const domain::Author& lhs, const domain::Author& rhs) {
+            return lhs.GetName() < rhs.GetName();
+        });
+        auto it = after ? std::upper_bound(authors.begin(), authors.end(), *after,
+                                           [](const domain::Author& lhs, const domain::Author& rhs) {
+                                               return lhs.GetName() < rhs.GetName();
+                                           })
+                        : authors.begin();
+        return {it, it + std::min<size_t>(limit, authors.end() - it)};
+    }
 };
 
-struct Fixture {
+struct MockBookRepository : domain::BookRepository {
+    std::vector<domain::Book> saved_books;
+
+    void Save(const domain::Book& book) override {
+        saved_books.emplace_back(book);
+    }
+
+    std::vector<domain::Book> GetPage(const std::optional<domain::Book>&, size_t) override {
+        return {};
+    }
+
+    std::vector<domain::Book> GetAuthorBooksPage(const domain::AuthorId&, const std::optional<domain::Book>&,
+                                                 size_t) override {
+        return {};
+    }
+};
+
+// Unit of work changes its own copy of the repositories, changes become visible only on commit
+struct MockUnitOfWork : app::UnitOfWork {
+    MockUnitOfWork(MockAuthorRepository& authors, MockBookRepository& books, int& commits)
+        : authors{authors}
+        , books{books}
+        , committed_authors{authors}
+        , committed_books{books}
+        , commits{commits} {
+    }
+
+    void Commit() override {
+        committed_authors.saved_authors = authors.saved_authors;
+        committed_books.saved_books = books.saved_books;
+        ++commits;
+    }
+
+    domain::AuthorRepository& Authors() override {
+        return authors;
+    }
+
+    domain::BookRepository& Books() override {
+        return books;
+    }
+
     MockAuthorRepository authors;
+    MockBookRepository books;
+    MockAuthorRepository& committed_authors;
+    MockBookRepository& committed_books;
+    int& commits;
+};
+
+struct MockCatalogWriter : app::CatalogWriter {
+    explicit MockCatalogWriter(std::vector<app::CatalogRow>& committed_rows)
+        : committed_rows{committed_rows} {
+    }
+
+    void Write(const app::CatalogRow& row) override {
+        rows.push_back(row);
+    }
+
+    app::ImportStats Commit() override {
+        committed_rows.insert(committed_rows.end(), rows.begin(), rows.end());
+        app::ImportStats stats;
+        stats.books = std::count_if(rows.begin(), rows.end(), [](const app::CatalogRow& row) {
+            return row.title.has_value();
+        });
+        return stats;
+    }
+
+    std::vector<app::CatalogRow> rows;
+    std::vector<app::CatalogRow>& committed_rows;
+};
+
+struct MockUnitOfWorkFactory : app::UnitOfWorkFactory, app::CatalogWriterFactory {
+    MockAuthorRepository authors;
+    MockBookRepository books;
+    std::vector<app::CatalogRow> catalog_rows;
+    int commits = 0;
+
+    app::UnitOfWorkHolder CreateUnitOfWork() override {
+        return std::make_unique<MockUnitOfWork>(authors, books, commits);
+    }
+
+    app::CatalogWriterHolder CreateCatalogWriter() override {
+        return std::make_unique<MockCatalogWriter>(catalog_rows);
+    }
+};
+
+struct Fixture {
+    MockUnitOfWorkFactory unit_of_work_factory;
+    MockAuthorRepository& authors = unit_of_work_factory.authors;
+    MockBookRepository& books = unit_of_work_factory.books;
 };
 
 }  // namespace
 
 SCENARIO_METHOD(Fixture, "Book Adding") {
     GIVEN("Use cases") {
-        app::UseCasesImpl use_cases{authors};
+        app::UseCasesImpl use_cases{unit_of_work_factory, unit_of_work_factory};
 
         WHEN("Adding an author") {
             const auto author_name = "Joanne Rowling";
@@ -33,5 +158,97 @@ SCENARIO_METHOD(Fixture, "Book Adding") {
                 CHECK(authors.saved_authors.at(0).GetId() != domain::AuthorId{});
             }
         }
+
+        WHEN("Adding several authors at once") {
+            const std::vector<std::string> names{"Joanne Rowling", "Ray Bradbury", "Stephen King"};
+            use_cases.AddAuthors(names);
+
+            THEN("all authors are saved in one transaction") {
+                REQUIRE(authors.saved_authors.size() == names.size());
+                CHECK(unit_of_work_factory.commits == 1);
+                for (size_t i = 0; i < names.size(); ++i) {
+                    CHECK(authors.saved_authors.at(i).GetName() == names.at(i));
+                }
+            }
+        }
+
+        WHEN("Authors are read page by page") {
+            use_cases.AddAuthors({"Stephen King", "Agatha Christie", "Ray Bradbury", "Joanne Rowling", "Isaac Asimov"});
+
+            std::vector<std::string> names;
+            std::optional<domain::Author> last;
+            size_t pages = 0;
+            while (true) {
+                const auto page = use_cases.GetAuthors(last, 2);
+                ++pages;
+                for (const auto& author : page) {
+                    names.push_back(author.GetName());
+                }
+                if (page.size() < 2) {
+                    break;
+                }
+                last = page.back();
+            }
+
+            THEN("each page continues after the last author of the previous one") {
+                CHECK(pages == 3);
+                CHECK(names == std::vector<std::string>{"Agatha Christie", "Isaac Asimov", "Joanne Rowling",
+                                                        "Ray Bradbury", "Stephen King"});
+            }
+        }
+
+        WHEN("Adding a book") {
+            const auto author_id = domain::AuthorId::New();
+            use_cases.AddBook(author_id.ToString(), "Harry Potter and the Philosopher's Stone", 1997);
+
+            THEN("book of the author is saved to repository") {
+                REQUIRE(books.saved_books.size() == 1);
+                CHECK(books.saved_books.at(0).GetAuthorId() == author_id);
+                CHECK(books.saved_books.at(0).GetTitle() == "Harry Potter and the Philosopher's Stone");
+                CHECK(books.saved_books.at(0).GetPublicationYear() == 1997);
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(Fixture, "Catalog import") {
+    GIVEN("Use cases") {
+        app::UseCasesImpl use_cases{unit_of_work_factory, unit_of_work_factory};
+
+        WHEN("CSV catalog is imported") {
+            std::istringstream input{
+                "Joanne Rowling,Harry Potter and the Chamber of Secrets,1998\r\n"
+                "\n"
+                "\"King, Stephen\",\"The \"\"Shining\"\"\", 1977\n"
+                "Ray Bradbury\n"};
+            const auto stats = use_cases.ImportCatalog(input);
+
+            THEN("all rows are written and committed") {
+                REQUIRE(stats.rows == 3);
+                CHECK(stats.books == 2);
+                const auto& rows = unit_of_work_factory.catalog_rows;
+                REQUIRE(rows.size() == 3);
+                CHECK(rows[0].author_name == "Joanne Rowling");
+                CHECK(rows[0].title == "Harry Potter and the Chamber of Secrets");
+                CHECK(rows[0].publication_year == 1998);
+                CHECK(rows[1].author_name == "King, Stephen");
+                CHECK(rows[1].title == "The \"Shining\"");
+                CHECK(rows[1].publication_year == 1977);
+                CHECK(rows[2].author_name == "Ray Bradbury");
+                CHECK_FALSE(rows[2].title.has_value());
+                CHECK_FALSE(rows[2].publication_year.has_value());
+            }
+        }
+
+        WHEN("CSV catalog has a malformed line") {
+            std::istringstream input{
+                "Joanne Rowling,Harry Potter,1998\n"
+                "Ray Bradbury,Fahrenheit 451,year\n"};
+
+            THEN("nothing is committed") {
+                REQUIRE_THROWS_AS(use_cases.ImportCatalog(input), std::invalid_argument);
+                CHECK(unit_of_work_factory.catalog_rows.empty());
+            }
+        }
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,68 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../src/json_loader.h"
+
+using namespace std::literals;
+
+namespace {
+
+constexpr int MAPS_COUNT = 20;
+constexpr int ROADS_PER_MAP = 20'000;
+constexpr int BUILDINGS_PER_MAP = 2'000;
+constexpr int OFFICES_PER_MAP = 10;
+
+// Writes config of the same shape as data/config.json, but with big maps
+void WriteMapPack(const std::filesystem::path& path) {
+    std::ofstream out(path);
+    out << R"({"defaultDogSpeed": 3.0, "lootGeneratorConfig": {"period": 5.0, "probability": 0.5}, "maps": [)";
+
+    for (int map = 0; map < MAPS_COUNT; ++map) {
+        out << (map ? "," : "") << R"({"id": "map)" << map << R"(", "name": "Map )" << map << R"(", "dogSpeed": 4.0,)";
+        out << R"("lootTypes": [{"name": "key", "file": "assets/key.obj", "type": "obj", "rotation": 90, "color": "#338844", "scale": 0.03, "value": 10},)"
+            << R"({"name": "wallet", "file": "assets/wallet.obj", "type": "obj", "rotation": 0, "color": "#883344", "scale": 0.01, "value": 30}],)";
+
+        out << R"("roads": [)";
+        for (int road = 0; road < ROADS_PER_MAP; ++road) {
+            out << (road ? "," : "");
+            if (road % 2) {
+                out << R"({"x0": )" << road << R"(, "y0": 0, "y1": 100})";
+            } else {
+                out << R"({"x0": 0, "y0": )" << road << R"(, "x1": 100})";
+            }
+        }
+
+        out << R"(], "buildings": [)";
+        for (int building = 0; building < BUILDINGS_PER_MAP; ++building) {
+            out << (building ? "," : "") << R"({"x": )" << building << R"(, "y": 5, "w": 30, "h": 20})";
+        }
+
+        out << R"(], "offices": [)";
+        for (int office = 0; office < OFFICES_PER_MAP; ++office) {
+            out << (office ? "," : "") << R"({"id": "o)" << office << R"(", "x": )" << office << R"(, "y": 0, "offsetX": 5, "offsetY": 0})";
+        }
+        out << "]}";
+    }
+
+    out << "]}";
+}
+
+}  // namespace
+
+TEST_CASE("Config loading of big map pack", "[!benchmark]") {
+    const auto path = std::filesystem::temp_directory_path() / "game_server_map_pack.json";
+    WriteMapPack(path);
+
+    INFO("config size: " << std::filesystem::file_size(path) << " bytes");
+    REQUIRE(json_loader::LoadGame(path).GetMaps()->size() == MAPS_COUNT);
+
+    BENCHMARK("LoadGame, "s + std::to_string(MAPS_COUNT) + " maps x "s + std::to_string(ROADS_PER_MAP) + " roads"s) {
+        return json_loader::LoadGame(path).GetMaps()->size();
+    };
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,65 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <random>
+
+#include "../src/game.h"
+
+using namespace std::literals;
+
+namespace {
+
+constexpr unsigned DOGS_COUNT = 10'000;
+constexpr int GRID_SIZE = 10;
+constexpr int GRID_STEP = 10;
+constexpr std::chrono::milliseconds TICK = 50ms;
+
+model::Map MakeGridMap() {
+    model::Map map(model::Map::Id("bench"), "bench");
+    for (int i = 0; i <= GRID_SIZE; ++i) {
+        map.AddRoad({model::Road::HORIZONTAL, {0, i * GRID_STEP}, GRID_SIZE * GRID_STEP});
+        map.AddRoad({model::Road::VERTICAL, {i * GRID_STEP, 0}, GRID_SIZE * GRID_STEP});
+    }
+    map.AddOffice(model::Office(model::Office::Id("o0"), {0, 0}, {0, 0}));
+    map.SetSpeed(3.0);
+    map.SetBagCapacity(3);
+    return map;
+}
+
+void AddMovingDogs(model::GameSession& session, unsigned count) {
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<int> line(0, GRID_SIZE);
+    std::uniform_real_distribution<double> offset(0.0, GRID_SIZE * GRID_STEP);
+    std::uniform_int_distribution<int> direction(0, 3);
+
+    for (unsigned id = 0; id < count; ++id) {
+        const bool on_horizontal = id % 2 == 0;
+        const model::Position pos = on_horizontal
+            ? model::Position{offset(engine), static_cast<double>(line(engine) * GRID_STEP)}
+            : model::Position{static_cast<double>(line(engine) * GRID_STEP), offset(engine)};
+
+        auto dog = session.AddDog(pos, "dog" + std::to_string(id), id);
+        const auto dir = static_cast<model::Direction>(direction(engine));
+        dog.SetDirection(dir);
+        dog.SetSpeedByDirection(dir);
+    }
+}
+
+}  // namespace
+
+TEST_CASE("Session tick with 10k dogs", "[!benchmark]") {
+    // No loot, so that the benchmark measures dogs movement and gathering sweep
+    model::ExtraData extra_data;
+    extra_data.SetLootGeneratorData(5000, 0.0);
+
+    auto map = MakeGridMap();
+    model::GameSession session(map, extra_data, 1, 42);
+    AddMovingDogs(session, DOGS_COUNT);
+
+    REQUIRE(session.GetDogs().Size() == DOGS_COUNT);
+
+    BENCHMARK("UpdateTime, 10k dogs") {
+        session.UpdateTime(TICK);
+        return session.GetDogs().GetPositions().front().x;
+    };
+}
@@ -0,0 +1,275 @@
+#include "bot_driver.h"
+
+#include <algorithm>
+#include <deque>
+#include <optional>
+#include <random>
+#include <stdexcept>
+
+#include "load_generator.h"
+
+namespace load {
+
+namespace {
+
+const std::string MOVES[] = {"L"s, "R"s, "U"s, "D"s};
+// Players stop their dogs now and then
+constexpr double STOP_PROBABILITY = 0.1;
+
+void PrintSection(std::ostream& out, std::string_view title, const LoadStats& stats, std::chrono::milliseconds duration) {
+    out << "== "sv << title << " ==\n"sv;
+    PrintReport(out, stats, duration);
+}
+
+}  // namespace
+
+void BotStats::Merge(const BotStats& other) {
+    join.Merge(other.join);
+    action.Merge(other.action);
+    state.Merge(other.state);
+}
+
+void PrintReport(std::ostream& out, const BotStats& stats, std::chrono::milliseconds duration) {
+    PrintSection(out, "join"sv, stats.join, duration);
+    PrintSection(out, "action"sv, stats.action, duration);
+    PrintSection(out, "state"sv, stats.state, duration);
+}
+
+class BotDriver::Bot : public std::enable_shared_from_this<Bot> {
+public:
+    Bot(BotDriver& driver, size_t id, const std::string& map_id)
+        : driver_(driver)
+        , connection_(std::make_shared<HttpConnection>(driver.ioc_, driver.endpoints_,
+                                                       driver.config_.host, driver.config_.timeout))
+        , join_request_(MakeJoinRequest(map_id, "bot"s + std::to_string(id)))
+        , state_request_(MakeStateRequest())
+        , random_(driver.config_.seed + id)
+        , action_rate_(1.0 / std::chrono::duration<double>(driver.config_.action_period).count())
+        , action_timer_(driver.ioc_)
+        , poll_timer_(driver.ioc_) {}
+
+    void Start() {
+        const auto now = Clock::now();
+        Enqueue(Kind::JOIN, now);
+
+        // Bots poll with random phases, so that they don't come all at once
+        std::uniform_int_distribution<Clock::rep> phase(0, std::chrono::duration_cast<Clock::duration>(driver_.config_.poll_period).count());
+        next_poll_ = now + Clock::duration{phase(random_)};
+        next_action_ = now + NextActionInterval();
+        SchedulePoll();
+        ScheduleAction();
+    }
+
+    void Stop() {
+        action_timer_.cancel();
+        poll_timer_.cancel();
+        connection_->Close();
+        if (in_flight_) {
+            ++GetStats(*in_flight_).unfinished;
+        }
+        for (const auto& pending : queue_) {
+            ++GetStats(pending.kind).unfinished;
+        }
+        queue_.clear();
+    }
+
+private:
+    enum class Kind { JOIN, ACTION, STATE };
+
+    struct Pending {
+        Kind kind;
+        Clock::time_point scheduled;
+    };
+
+    LoadStats& GetStats(Kind kind) {
+        switch (kind) {
+            case Kind::JOIN:
+                return driver_.stats_.join;
+            case Kind::ACTION:
+                return driver_.stats_.action;
+            default:
+                return driver_.stats_.state;
+        }
+    }
+
+    Clock::duration NextActionInterval() {
+        std::exponential_distribution<double> interval(action_rate_);
+        return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(interval(random_)));
+    }
+
+    const std::string& NextMove() {
+        static const std::string stop;
+        if (std::bernoulli_distribution(STOP_PROBABILITY)(random_)) {
+            return stop;
+        }
+        return MOVES[std::uniform_int_distribution<size_t>(0, std::size(MOVES) - 1)(random_)];
+    }
+
+    void SchedulePoll() {
+        poll_timer_.expires_at(next_poll_);
+        poll_timer_.async_wait([self = shared_from_this()](sys::error_code ec) {
+            if (ec || self->driver_.stopped_) {
+                return;
+            }
+            // Timer may fire late, then every missed poll is scheduled at its own time
+            for (const auto now = Clock::now(); self->next_poll_ <= now; self->next_poll_ += self->driver_.config_.poll_period) {
+                if (self->token_.empty()) {
+                    // Bot without a token tries to join again with the same rate
+                    if (!self->IsJoining()) {
+                        self->Enqueue(Kind::JOIN, self->next_poll_);
+                    }
+                } else {
+                    self->Enqueue(Kind::STATE, self->next_poll_);
+                }
+            }
+            self->SchedulePoll();
+        });
+    }
+
+    void ScheduleAction() {
+        action_timer_.expires_at(next_action_);
+        action_timer_.async_wait([self = shared_from_this()](sys::error_code ec) {
+            if (ec || self->driver_.stopped_) {
+                return;
+            }
+            for (const auto now = Clock::now(); self->next_action_ <= now; self->next_action_ += self->NextActionInterval()) {
+                if (!self->token_.empty()) {
+                    self->Enqueue(Kind::ACTION, self->next_action_);
+                }
+            }
+            self->ScheduleAction();
+        });
+    }
+
+    bool IsJoining() const {
+        if (in_flight_ == Kind::JOIN) {
+            return true;
+        }
+        return std::any_of(queue_.begin(), queue_.end(), [](const Pending& pending) {
+            return pending.kind == Kind::JOIN;
+        });
+    }
+
+    void Enqueue(Kind kind, Clock::time_point scheduled) {
+        ++GetStats(kind).scheduled;
+        queue_.push_back({kind, scheduled});
+        SendNext();
+    }
+
+    void SendNext() {
+        if (in_flight_ || queue_.empty()) {
+            return;
+        }
+        const auto pending = queue_.front();
+        queue_.pop_front();
+
+        Request action_request;
+        const Request* request = &state_request_;
+        if (pending.kind == Kind::JOIN) {
+            request = &join_request_;
+        } else if (pending.kind == Kind::ACTION) {
+            action_request = MakeActionRequest(NextMove());
+            request = &action_request;
+        }
+
+        in_flight_ = pending.kind;
+        ++GetStats(pending.kind).sent;
+        connection_->Send(*request, token_,
+            [self = shared_from_this(), pending](beast::error_code ec, const HttpConnection::Response& response) {
+                self->OnResponse(pending, ec, response);
+            });
+    }
+
+    void OnResponse(const Pending& pending, beast::error_code ec, const HttpConnection::Response& response) {
+        if (driver_.stopped_ || ec == net::error::operation_aborted) {
+            return;
+        }
+        in_flight_.reset();
+        auto& stats = GetStats(pending.kind);
+
+        if (ec) {
+            ++stats.errors;
+        } else {
+            const auto now = Clock::now();
+            ++stats.completed;
+            ++stats.statuses[response.result_int()];
+            stats.latency.Record(std::chrono::duration_cast<metrics::LatencyHistogram::Duration>(now - pending.scheduled));
+            stats.service_time.Record(std::chrono::duration_cast<metrics::LatencyHistogram::Duration>(now - connection_->GetSentTime()));
+        }
+
+        if (pending.kind == Kind::JOIN) {
+            token_ = ec ? std::string{} : ReadToken(response).value_or(std::string{});
+        } else if (!ec && response.result() == http::status::unauthorized) {
+            // Dog has been retired, the bot joins the game again on the next poll.
+            // Requests queued for the retired dog aren't sent
+            token_.clear();
+            std::erase_if(queue_, [this](const Pending& queued) {
+                if (queued.kind == Kind::JOIN) {
+                    return false;
+                }
+                --GetStats(queued.kind).scheduled;
+                return true;
+            });
+        }
+        SendNext();
+    }
+
+private:
+    BotDriver& driver_;
+    std::shared_ptr<HttpConnection> connection_;
+    const Request join_request_;
+    const Request state_request_;
+    std::mt19937_64 random_;
+    // Moves per second
+    double action_rate_;
+    net::steady_timer action_timer_;
+    net::steady_timer poll_timer_;
+    Clock::time_point next_action_;
+    Clock::time_point next_poll_;
+    std::deque<Pending> queue_;
+    std::optional<Kind> in_flight_;
+    std::string token_;
+};
+
+BotDriver::BotDriver(net::io_context& ioc, BotConfig config)
+    : ioc_(ioc)
+    , config_(std::move(config))
+    , timer_(ioc) {
+    if (config_.maps.empty()) {
+        throw std::invalid_argument("Bots need at least one map"s);
+    }
+    if (config_.action_period.count() <= 0 || config_.poll_period.count() <= 0) {
+        throw std::invalid_argument("Bot periods must be positive"s);
+    }
+}
+
+BotDriver::~BotDriver() = default;
+
+void BotDriver::Start() {
+    endpoints_ = tcp::resolver(ioc_).resolve(config_.host, config_.port);
+
+    bots_.reserve(config_.bots);
+    for (size_t i = 0; i < config_.bots; ++i) {
+        const auto id = config_.first_bot_id + i;
+        bots_.push_back(std::make_shared<Bot>(*this, id, config_.maps[id % config_.maps.size()]));
+    }
+    for (auto& bot : bots_) {
+        bot->Start();
+    }
+
+    timer_.expires_after(config_.duration);
+    timer_.async_wait([this](sys::error_code ec) {
+        if (!ec) {
+            Stop();
+        }
+    });
+}
+
+void BotDriver::Stop() {
+    stopped_ = true;
+    for (auto& bot : bots_) {
+        bot->Stop();
+    }
+}
+
+}  // namespace load
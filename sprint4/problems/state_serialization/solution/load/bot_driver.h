@@ -0,0 +1,76 @@
+#pragma once
+
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "http_connection.h"
+#include "load_stats.h"
+
+namespace load {
+
+using namespace std::literals;
+
+struct BotConfig {
+    std::string host = "127.0.0.1"s;
+    std::string port = "8080"s;
+    size_t bots = 100;
+    // Bots are spread over the maps evenly
+    std::vector<std::string> maps;
+    std::chrono::milliseconds duration = 10s;
+    std::chrono::milliseconds timeout = 5s;
+    // Mean time between moves. Moves come as a Poisson process, like key presses of a player
+    std::chrono::milliseconds action_period = 500ms;
+    // State is polled with the fixed period, like the game client does it
+    std::chrono::milliseconds poll_period = 100ms;
+    uint64_t seed = 0;
+    size_t first_bot_id = 0;
+};
+
+struct BotStats {
+    LoadStats join;
+    LoadStats action;
+    LoadStats state;
+
+    void Merge(const BotStats& other);
+};
+
+void PrintReport(std::ostream& out, const BotStats& stats, std::chrono::milliseconds duration);
+
+// Simulates players of the game. Every bot joins a map, moves its dog and polls
+// the game state over its own keep-alive connection. Requests are scheduled by
+// the bot timers whatever the response time is, and the latency is counted
+// from the scheduled time. Driver isn't thread-safe, it's run on one thread
+class BotDriver {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    BotDriver(net::io_context& ioc, BotConfig config);
+    ~BotDriver();
+
+    BotDriver(const BotDriver&) = delete;
+    BotDriver& operator=(const BotDriver&) = delete;
+
+    // Starts the bots, the load is over when the io_context runs out of work
+    void Start();
+    const BotStats& GetStats() const noexcept { return stats_; }
+
+private:
+    class Bot;
+
+    void Stop();
+
+private:
+    net::io_context& ioc_;
+    BotConfig config_;
+    tcp::resolver::results_type endpoints_;
+    net::steady_timer timer_;
+    std::vector<std::shared_ptr<Bot>> bots_;
+    bool stopped_ = false;
+    BotStats stats_;
+};
+
+}  // namespace load
@@ -0,0 +1,98 @@
+#include "http_connection.h"
+
+using namespace std::literals;
+
+namespace load {
+
+HttpConnection::HttpConnection(net::io_context& ioc, const tcp::resolver::results_type& endpoints,
+                               std::string host, std::chrono::milliseconds timeout)
+    : endpoints_(endpoints)
+    , host_(std::move(host))
+    , timeout_(timeout)
+    , stream_(ioc) {}
+
+void HttpConnection::Send(const Request& request, const std::string& token, Handler handler) {
+    handler_ = std::move(handler);
+
+    request_ = {};
+    request_.method(request.method);
+    request_.target(request.target);
+    request_.version(11);
+    request_.set(http::field::host, host_);
+    request_.keep_alive(true);
+    for (const auto& [name, value] : request.headers) {
+        request_.set(name, value);
+    }
+    if (request.authorized) {
+        request_.set(http::field::authorization, "Bearer "s + token);
+    }
+    request_.body() = request.body;
+    request_.prepare_payload();
+
+    if (connected_) {
+        return Write();
+    }
+    stream_.expires_after(timeout_);
+    stream_.async_connect(endpoints_, [self = shared_from_this()](beast::error_code ec, const tcp::endpoint&) {
+        if (ec) {
+            return self->Complete(ec);
+        }
+        self->connected_ = true;
+        self->stream_.socket().set_option(tcp::no_delay(true), ec);
+        self->Write();
+    });
+}
+
+void HttpConnection::Close() {
+    beast::error_code ec;
+    stream_.socket().shutdown(tcp::socket::shutdown_both, ec);
+    stream_.close();
+    connected_ = false;
+}
+
+void HttpConnection::Write() {
+    sent_ = Clock::now();
+    stream_.expires_after(timeout_);
+    http::async_write(stream_, request_, [self = shared_from_this()](beast::error_code ec, size_t) {
+        if (ec) {
+            return self->Complete(ec);
+        }
+        self->Read();
+    });
+}
+
+void HttpConnection::Read() {
+    response_ = {};
+    http::async_read(stream_, buffer_, response_, [self = shared_from_this()](beast::error_code ec, size_t) {
+        self->Complete(ec);
+    });
+}
+
+void HttpConnection::Complete(beast::error_code ec) {
+    if (ec || response_.need_eof()) {
+        Close();
+    }
+    // Handler may send the next request, which replaces the current handler
+    auto handler = std::move(handler_);
+    handler(ec, response_);
+}
+
+HttpConnection::Response HttpGet(const std::string& host, const std::string& port, const std::string& target) {
+    net::io_context ioc;
+    beast::tcp_stream stream(ioc);
+    stream.connect(tcp::resolver(ioc).resolve(host, port));
+
+    http::request<http::string_body> request{http::verb::get, target, 11};
+    request.set(http::field::host, host);
+    http::write(stream, request);
+
+    beast::flat_buffer buffer;
+    HttpConnection::Response response;
+    http::read(stream, buffer, response);
+
+    beast::error_code ec;
+    stream.socket().shutdown(tcp::socket::shutdown_both, ec);
+    return response;
+}
+
+}  // namespace load
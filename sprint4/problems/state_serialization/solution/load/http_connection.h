@@ -0,0 +1,66 @@
+#pragma once
+
+#define BOOST_BEAST_USE_STD_STRING_VIEW
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "scenario.h"
+
+namespace load {
+
+namespace net = boost::asio;
+namespace beast = boost::beast;
+namespace sys = boost::system;
+using tcp = net::ip::tcp;
+
+// Keep-alive client connection, one request is sent at a time. It's connected on
+// the first request and again after the server or an error has closed it
+class HttpConnection : public std::enable_shared_from_this<HttpConnection> {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Response = http::response<http::string_body>;
+    // Called with operation_aborted, when the connection is closed during the request
+    using Handler = std::function<void(beast::error_code ec, const Response& response)>;
+
+    HttpConnection(net::io_context& ioc, const tcp::resolver::results_type& endpoints,
+                   std::string host, std::chrono::milliseconds timeout);
+
+    HttpConnection(const HttpConnection&) = delete;
+    HttpConnection& operator=(const HttpConnection&) = delete;
+
+    // Token is sent, if the request is authorized
+    void Send(const Request& request, const std::string& token, Handler handler);
+    void Close();
+
+    // Time the last request was started to be written, connecting isn't included
+    Clock::time_point GetSentTime() const noexcept { return sent_; }
+
+private:
+    void Write();
+    void Read();
+    void Complete(beast::error_code ec);
+
+private:
+    const tcp::resolver::results_type& endpoints_;
+    std::string host_;
+    std::chrono::milliseconds timeout_;
+    beast::tcp_stream stream_;
+    beast::flat_buffer buffer_;
+    http::request<http::string_body> request_;
+    Response response_;
+    Handler handler_;
+    bool connected_ = false;
+    Clock::time_point sent_;
+};
+
+// Blocking GET, it's used to prepare the load and to read the server stats
+HttpConnection::Response HttpGet(const std::string& host, const std::string& port, const std::string& target);
+
+}  // namespace load
@@ -0,0 +1,195 @@
+#include "load_generator.h"
+
+#include <boost/json.hpp>
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+
+namespace load {
+
+namespace http = beast::http;
+namespace json = boost::json;
+
+std::optional<std::string> ReadToken(const HttpConnection::Response& response) {
+    if (response.result() != http::status::ok) {
+        return std::nullopt;
+    }
+    try {
+        return std::string(json::parse(response.body()).as_object().at("authToken").as_string().c_str());
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+// Plays one virtual user over its own keep-alive connection
+class LoadGenerator::Connection : public std::enable_shared_from_this<Connection> {
+public:
+    Connection(LoadGenerator& generator, size_t user_id)
+        : generator_(generator)
+        , connection_(std::make_shared<HttpConnection>(generator.ioc_, generator.endpoints_,
+                                                       generator.config_.host, generator.config_.timeout))
+        , user_(generator.scenario_, user_id) {}
+
+    void Send(Clock::time_point scheduled) {
+        const auto& request = user_.NextRequest();
+        joins_ = request.joins;
+        ++generator_.stats_.sent;
+        connection_->Send(request, user_.GetToken(),
+            [self = shared_from_this(), scheduled](beast::error_code ec, const HttpConnection::Response& response) {
+                if (ec) {
+                    return self->OnError(ec);
+                }
+                self->OnResponse(scheduled, response);
+            });
+    }
+
+    void Close() {
+        connection_->Close();
+    }
+
+private:
+    void OnResponse(Clock::time_point scheduled, const HttpConnection::Response& response) {
+        const auto now = Clock::now();
+        auto& stats = generator_.stats_;
+        ++stats.completed;
+        ++stats.statuses[response.result_int()];
+        stats.latency.Record(std::chrono::duration_cast<metrics::LatencyHistogram::Duration>(now - scheduled));
+        stats.service_time.Record(std::chrono::duration_cast<metrics::LatencyHistogram::Duration>(now - connection_->GetSentTime()));
+
+        if (joins_) {
+            SetTokenFromResponse(response);
+        } else if (response.result() == http::status::unauthorized) {
+            // Player has been retired, the user joins the game again
+            user_.Restart();
+        }
+        generator_.OnIdle(shared_from_this());
+    }
+
+    void SetTokenFromResponse(const HttpConnection::Response& response) {
+        if (auto token = ReadToken(response)) {
+            user_.SetToken(std::move(*token));
+        } else {
+            user_.Restart();
+        }
+    }
+
+    void OnError(beast::error_code ec) {
+        if (generator_.stopped_ || ec == net::error::operation_aborted) {
+            return;
+        }
+        ++generator_.stats_.errors;
+        if (joins_) {
+            user_.Restart();
+        }
+        generator_.OnIdle(shared_from_this());
+    }
+
+private:
+    LoadGenerator& generator_;
+    std::shared_ptr<HttpConnection> connection_;
+    VirtualUser user_;
+    bool joins_ = false;
+};
+
+LoadGenerator::LoadGenerator(net::io_context& ioc, LoadConfig config, const Scenario& scenario, size_t first_user_id)
+    : ioc_(ioc)
+    , config_(std::move(config))
+    , scenario_(scenario)
+    , first_user_id_(first_user_id)
+    , timer_(ioc) {
+    if (config_.rps <= 0.0) {
+        throw std::invalid_argument("Requests per second must be positive"s);
+    }
+    if (config_.connections == 0) {
+        throw std::invalid_argument("At least one connection is needed"s);
+    }
+    interval_ = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / config_.rps));
+    slots_count_ = static_cast<uint64_t>(std::floor(config_.rps * std::chrono::duration<double>(config_.duration).count()));
+}
+
+LoadGenerator::~LoadGenerator() = default;
+
+void LoadGenerator::Start() {
+    endpoints_ = tcp::resolver(ioc_).resolve(config_.host, config_.port);
+
+    connections_.reserve(config_.connections);
+    for (size_t i = 0; i < config_.connections; ++i) {
+        connections_.push_back(std::make_shared<Connection>(*this, first_user_id_ + i));
+    }
+    idle_connections_ = connections_;
+
+    start_ = Clock::now() + std::chrono::duration_cast<Clock::duration>(config_.start_offset);
+    ScheduleNextSlot();
+}
+
+void LoadGenerator::ScheduleNextSlot() {
+    if (next_slot_ < slots_count_) {
+        timer_.expires_at(start_ + interval_ * next_slot_);
+    } else {
+        // Requests which haven't finished till the deadline are unfinished
+        timer_.expires_at(start_ + config_.duration + config_.timeout);
+    }
+    timer_.async_wait([this](sys::error_code ec) {
+        OnSlot(ec);
+    });
+}
+
+void LoadGenerator::OnSlot(sys::error_code ec) {
+    if (ec || stopped_) {
+        return;
+    }
+    if (next_slot_ == slots_count_) {
+        return Stop();
+    }
+
+    // Timer may fire late, then all the overdue requests are scheduled at their own time
+    const auto now = Clock::now();
+    for (auto slot = start_ + interval_ * next_slot_; next_slot_ < slots_count_ && slot <= now;
+         slot = start_ + interval_ * ++next_slot_) {
+        pending_.push_back(slot);
+        ++stats_.scheduled;
+    }
+    Dispatch();
+
+    if (IsDone()) {
+        return Stop();
+    }
+    ScheduleNextSlot();
+}
+
+void LoadGenerator::Dispatch() {
+    while (!pending_.empty() && !idle_connections_.empty()) {
+        auto connection = std::move(idle_connections_.back());
+        idle_connections_.pop_back();
+        const auto scheduled = pending_.front();
+        pending_.pop_front();
+        connection->Send(scheduled);
+    }
+}
+
+void LoadGenerator::OnIdle(const std::shared_ptr<Connection>& connection) {
+    if (stopped_) {
+        return;
+    }
+    idle_connections_.push_back(connection);
+    Dispatch();
+    if (IsDone()) {
+        Stop();
+    }
+}
+
+bool LoadGenerator::IsDone() const noexcept {
+    return next_slot_ == slots_count_ && pending_.empty() && idle_connections_.size() == connections_.size();
+}
+
+void LoadGenerator::Stop() {
+    stopped_ = true;
+    timer_.cancel();
+    stats_.unfinished = pending_.size() + (connections_.size() - idle_connections_.size());
+    pending_.clear();
+    for (auto& connection : connections_) {
+        connection->Close();
+    }
+}
+
+}  // namespace load
@@ -0,0 +1,88 @@
+#pragma once
+
+#define BOOST_BEAST_USE_STD_STRING_VIEW
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "http_connection.h"
+#include "load_stats.h"
+#include "scenario.h"
+
+namespace load {
+
+using namespace std::literals;
+
+struct LoadConfig {
+    std::string host = "127.0.0.1"s;
+    std::string port = "8080"s;
+    double rps = 100.0;
+    std::chrono::milliseconds duration = 10s;
+    size_t connections = 16;
+    std::chrono::milliseconds timeout = 5s;
+    // Shifts the schedule, so that generators of different threads don't fire at the same time
+    std::chrono::nanoseconds start_offset{0};
+};
+
+// Reads the token from the join response
+std::optional<std::string> ReadToken(const HttpConnection::Response& response);
+
+// Open-loop load: requests are scheduled at the fixed rate whatever the server
+// response time is. A scheduled request waits for a free keep-alive connection,
+// and this waiting is a part of its latency. Every connection plays one virtual
+// user of the scenario. Generator isn't thread-safe, it's run on one thread
+class LoadGenerator {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    LoadGenerator(net::io_context& ioc, LoadConfig config, const Scenario& scenario, size_t first_user_id = 0);
+    ~LoadGenerator();
+
+    LoadGenerator(const LoadGenerator&) = delete;
+    LoadGenerator& operator=(const LoadGenerator&) = delete;
+
+    // Starts the schedule, the load is over when the io_context runs out of work
+    void Start();
+    const LoadStats& GetStats() const noexcept { return stats_; }
+
+private:
+    class Connection;
+
+    void ScheduleNextSlot();
+    void OnSlot(sys::error_code ec);
+    void Dispatch();
+    void OnIdle(const std::shared_ptr<Connection>& connection);
+    bool IsDone() const noexcept;
+    void Stop();
+
+private:
+    net::io_context& ioc_;
+    LoadConfig config_;
+    const Scenario& scenario_;
+    size_t first_user_id_;
+
+    tcp::resolver::results_type endpoints_;
+    net::steady_timer timer_;
+    std::vector<std::shared_ptr<Connection>> connections_;
+    std::vector<std::shared_ptr<Connection>> idle_connections_;
+    // Scheduled times of requests waiting for a free connection
+    std::deque<Clock::time_point> pending_;
+
+    Clock::time_point start_;
+    Clock::duration interval_;
+    uint64_t slots_count_ = 0;
+    uint64_t next_slot_ = 0;
+    bool stopped_ = false;
+    LoadStats stats_;
+};
+
+}  // namespace load
@@ -0,0 +1,69 @@
+#include "load_stats.h"
+
+#include <iomanip>
+#include <sstream>
+
+using namespace std::literals;
+
+namespace load {
+
+namespace {
+
+constexpr double PERCENTILES[] = {50.0, 90.0, 99.0, 99.9, 99.99};
+
+double ToMilliseconds(metrics::LatencyHistogram::Duration value) {
+    return std::chrono::duration<double, std::milli>(value).count();
+}
+
+void PrintHistogram(std::ostream& out, std::string_view title, const metrics::LatencyHistogram& histogram) {
+    out << title << " (ms):\n"sv;
+    out << "  min "sv << ToMilliseconds(histogram.GetMin())
+        << ", mean "sv << ToMilliseconds(histogram.GetMean())
+        << ", max "sv << ToMilliseconds(histogram.GetMax()) << '\n';
+    for (double percentile : PERCENTILES) {
+        std::ostringstream name;
+        name << 'p' << percentile;
+        out << "  "sv << std::left << std::setw(8) << name.str() << std::right
+            << ToMilliseconds(histogram.GetPercentile(percentile)) << '\n';
+    }
+}
+
+}  // namespace
+
+void LoadStats::Merge(const LoadStats& other) {
+    latency.Merge(other.latency);
+    service_time.Merge(other.service_time);
+    scheduled += other.scheduled;
+    sent += other.sent;
+    completed += other.completed;
+    errors += other.errors;
+    unfinished += other.unfinished;
+    for (const auto& [status, count] : other.statuses) {
+        statuses[status] += count;
+    }
+}
+
+void PrintReport(std::ostream& out, const LoadStats& stats, std::chrono::milliseconds duration) {
+    const auto seconds = std::chrono::duration<double>(duration).count();
+    const auto flags = out.flags();
+    out << std::fixed << std::setprecision(3);
+
+    out << "Requests: scheduled "sv << stats.scheduled
+        << ", sent "sv << stats.sent
+        << ", completed "sv << stats.completed
+        << ", errors "sv << stats.errors
+        << ", unfinished "sv << stats.unfinished << '\n';
+    out << "Throughput: "sv << (seconds > 0 ? stats.completed / seconds : 0.0) << " rps\n"sv;
+    out << "Statuses:"sv;
+    for (const auto& [status, count] : stats.statuses) {
+        out << ' ' << status << '=' << count;
+    }
+    out << '\n';
+
+    PrintHistogram(out, "Latency from schedule"sv, stats.latency);
+    PrintHistogram(out, "Service time"sv, stats.service_time);
+
+    out.flags(flags);
+}
+
+}  // namespace load
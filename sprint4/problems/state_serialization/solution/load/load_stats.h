@@ -0,0 +1,32 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <ostream>
+
+#include "../src/latency_histogram.h"
+
+namespace load {
+
+struct LoadStats {
+    // Latency from the time the request was scheduled, so the time the request waited
+    // for a free connection is counted (coordinated omission is corrected)
+    metrics::LatencyHistogram latency;
+    // Latency from the time the request was written to the connection
+    metrics::LatencyHistogram service_time;
+
+    uint64_t scheduled = 0;
+    uint64_t sent = 0;
+    uint64_t completed = 0;
+    // Requests failed on the connection level: timeouts, resets, refused connects
+    uint64_t errors = 0;
+    // Requests that were scheduled, but haven't got a response before the load was stopped
+    uint64_t unfinished = 0;
+    std::map<unsigned, uint64_t> statuses;
+
+    void Merge(const LoadStats& other);
+};
+
+void PrintReport(std::ostream& out, const LoadStats& stats, std::chrono::milliseconds duration);
+
+}  // namespace load
@@ -0,0 +1,253 @@
+#include <boost/json.hpp>
+#include <boost/program_options.hpp>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <optional>
+#include <thread>
+
+#include "bot_driver.h"
+#include "load_generator.h"
+
+using namespace std::literals;
+
+namespace {
+
+namespace fs = std::filesystem;
+namespace json = boost::json;
+
+const std::string MAPS_TARGET = "/api/v1/maps"s;
+const std::string TICK_STATS_TARGET = "/api/v1/game/tick-stats?reset=true"s;
+
+struct Args {
+    load::LoadConfig config;
+    int duration = 10;
+    int timeout = 5000;
+    unsigned threads = 1;
+    fs::path ammo_file;
+    fs::path scenario_file;
+
+    size_t bots = 0;
+    size_t maps = 1;
+    int action_period = 500;
+    int poll_period = 100;
+    uint64_t seed = 0;
+};
+
+std::optional<Args> ParseCommandLine(int argc, const char* const argv[]) {
+    Args args;
+
+    namespace po = boost::program_options;
+    po::options_description desc("Allowed options"s);
+    desc.add_options()
+        ("help,h", "produce help message")
+        ("host", po::value(&args.config.host)->value_name("address"s), "set server address, 127.0.0.1 by default")
+        ("port,p", po::value(&args.config.port)->value_name("port"s), "set server port, 8080 by default")
+        ("rps,r", po::value(&args.config.rps)->value_name("number"s), "set requests per second, 100 by default")
+        ("duration,d", po::value(&args.duration)->value_name("seconds"s), "set load duration, 10 by default")
+        ("connections,c", po::value(&args.config.connections)->value_name("number"s), "set keep-alive connections count, 16 by default")
+        ("threads,t", po::value(&args.threads)->value_name("number"s), "set generator threads count, 1 by default")
+        ("timeout", po::value(&args.timeout)->value_name("milliseconds"s), "set request timeout, 5000 by default")
+        ("ammo,a", po::value(&args.ammo_file)->value_name("file"s), "replay Yandex.Tank ammo in the uri format")
+        ("scenario,s", po::value(&args.scenario_file)->value_name("file"s), "play scenario script by every connection")
+        ("bots,b", po::value(&args.bots)->value_name("number"s), "simulate players, every bot has its own connection")
+        ("maps,m", po::value(&args.maps)->value_name("number"s), "spread bots over the first maps, 1 by default")
+        ("action-period", po::value(&args.action_period)->value_name("milliseconds"s), "set mean time between bot moves, 500 by default")
+        ("poll-period", po::value(&args.poll_period)->value_name("milliseconds"s), "set period of bot state polls, 100 by default")
+        ("seed", po::value(&args.seed)->value_name("number"s), "set seed of bot moves");
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.contains("help"s)) {
+        std::cout << desc;
+        return std::nullopt;
+    }
+
+    if (vm.contains("ammo"s) + vm.contains("scenario"s) + vm.contains("bots"s) != 1) {
+        throw std::runtime_error("One of ammo, scenario or bots must be set!");
+    }
+    if (vm.contains("bots"s)) {
+        if (args.threads == 0 || args.bots < args.threads) {
+            throw std::runtime_error("Every thread needs at least one bot!");
+        }
+        if (args.maps == 0) {
+            throw std::runtime_error("Bots need at least one map!");
+        }
+    } else if (args.threads == 0 || args.config.connections < args.threads) {
+        throw std::runtime_error("Every thread needs at least one connection!");
+    }
+
+    args.config.duration = std::chrono::seconds(args.duration);
+    args.config.timeout = std::chrono::milliseconds(args.timeout);
+    return args;
+}
+
+// Share of the count for the thread, the remainder is given to the first threads
+size_t GetThreadShare(size_t count, unsigned threads, unsigned thread) {
+    return count / threads + (thread < count % threads ? 1 : 0);
+}
+
+load::Scenario LoadScenario(const Args& args) {
+    const auto& path = args.ammo_file.empty() ? args.scenario_file : args.ammo_file;
+    std::ifstream input(path);
+    if (!input) {
+        throw std::runtime_error("Can't open file "s + path.string());
+    }
+    return args.ammo_file.empty() ? load::ParseScenario(input) : load::ParseAmmo(input);
+}
+
+// Every thread runs its own generator with its share of the rate and connections
+load::LoadStats RunLoad(const Args& args, const load::Scenario& scenario) {
+    const auto threads = args.threads;
+    const auto thread_interval = std::chrono::duration<double>(1.0 / args.config.rps);
+
+    std::vector<std::future<load::LoadStats>> results;
+    size_t first_user_id = 0;
+    for (unsigned i = 0; i < threads; ++i) {
+        auto config = args.config;
+        config.rps = args.config.rps / threads;
+        config.connections = GetThreadShare(args.config.connections, threads, i);
+        config.start_offset = std::chrono::duration_cast<std::chrono::nanoseconds>(thread_interval * i);
+
+        results.push_back(std::async(std::launch::async, [config, &scenario, first_user_id] {
+            load::net::io_context ioc;
+            load::LoadGenerator generator(ioc, config, scenario, first_user_id);
+            generator.Start();
+            ioc.run();
+            return generator.GetStats();
+        }));
+        first_user_id += config.connections;
+    }
+
+    load::LoadStats stats;
+    for (auto& result : results) {
+        stats.Merge(result.get());
+    }
+    return stats;
+}
+
+std::vector<std::string> FetchMapIds(const Args& args) {
+    const auto response = load::HttpGet(args.config.host, args.config.port, MAPS_TARGET);
+    if (response.result() != load::http::status::ok) {
+        throw std::runtime_error("Maps aren't available: "s + std::string(response.reason()));
+    }
+
+    std::vector<std::string> map_ids;
+    for (const auto& map : json::parse(response.body()).as_array()) {
+        if (map_ids.size() == args.maps) {
+            break;
+        }
+        map_ids.emplace_back(map.as_object().at("id").as_string().c_str());
+    }
+    if (map_ids.size() < args.maps) {
+        throw std::runtime_error("Server has only "s + std::to_string(map_ids.size()) + " maps"s);
+    }
+    return map_ids;
+}
+
+// Reads and resets the server tick times, they are collected if the server is run with --tick-stats
+std::optional<json::object> FetchTickStats(const Args& args) {
+    const auto response = load::HttpGet(args.config.host, args.config.port, TICK_STATS_TARGET);
+    if (response.result() != load::http::status::ok) {
+        return std::nullopt;
+    }
+    return json::parse(response.body()).as_object();
+}
+
+void PrintTickStats(std::ostream& out, const json::object& tick_stats) {
+    out << "== server tick ==\n"sv;
+    out << "Ticks: "sv << tick_stats.at("ticks").as_int64() << '\n';
+    out << "Tick time (ms):\n"sv;
+    out << "  mean "sv << tick_stats.at("mean").as_double() << ", max "sv << tick_stats.at("max").as_double() << '\n';
+    for (const auto* percentile : {"p50", "p90", "p99"}) {
+        out << "  "sv << percentile << "     "sv << tick_stats.at(percentile).as_double() << '\n';
+    }
+}
+
+// Every thread runs its own bots, the maps are shared by all the threads
+load::BotStats RunBots(const Args& args, const std::vector<std::string>& map_ids) {
+    std::vector<std::future<load::BotStats>> results;
+    size_t first_bot_id = 0;
+    for (unsigned i = 0; i < args.threads; ++i) {
+        load::BotConfig config;
+        config.host = args.config.host;
+        config.port = args.config.port;
+        config.bots = GetThreadShare(args.bots, args.threads, i);
+        config.maps = map_ids;
+        config.duration = args.config.duration;
+        config.timeout = args.config.timeout;
+        config.action_period = std::chrono::milliseconds(args.action_period);
+        config.poll_period = std::chrono::milliseconds(args.poll_period);
+        config.seed = args.seed;
+        config.first_bot_id = first_bot_id;
+
+        results.push_back(std::async(std::launch::async, [config] {
+            load::net::io_context ioc;
+            load::BotDriver driver(ioc, config);
+            driver.Start();
+            ioc.run();
+            return driver.GetStats();
+        }));
+        first_bot_id += config.bots;
+    }
+
+    load::BotStats stats;
+    for (auto& result : results) {
+        stats.Merge(result.get());
+    }
+    return stats;
+}
+
+bool IsSucceeded(const load::LoadStats& stats) {
+    return stats.errors == 0 && stats.unfinished == 0;
+}
+
+int PlayBots(const Args& args) {
+    const auto map_ids = FetchMapIds(args);
+    std::cout << "Bots "sv << args.config.host << ':' << args.config.port << ": "sv << args.bots
+              << " bots on "sv << map_ids.size() << " maps for "sv << args.duration << " s"sv << std::endl;
+
+    // Ticks before the load aren't counted
+    const bool has_tick_stats = FetchTickStats(args).has_value();
+    if (!has_tick_stats) {
+        std::cout << "Server tick times aren't collected, run the server with --tick-stats to see them"sv << std::endl;
+    }
+
+    const auto stats = RunBots(args, map_ids);
+    load::PrintReport(std::cout, stats, args.config.duration);
+    if (has_tick_stats) {
+        if (auto tick_stats = FetchTickStats(args)) {
+            PrintTickStats(std::cout, *tick_stats);
+        }
+    }
+    return IsSucceeded(stats.join) && IsSucceeded(stats.action) && IsSucceeded(stats.state) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int PlayScenario(const Args& args) {
+    const auto scenario = LoadScenario(args);
+    std::cout << "Load "sv << args.config.host << ':' << args.config.port
+              << ": "sv << args.config.rps << " rps for "sv << args.duration << " s over "sv
+              << args.config.connections << " connections"sv << std::endl;
+
+    const auto stats = RunLoad(args, scenario);
+    load::PrintReport(std::cout, stats, args.config.duration);
+    return IsSucceeded(stats) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+}  // namespace
+
+int main(int argc, const char* argv[]) {
+    try {
+        auto args = ParseCommandLine(argc, argv);
+        if (!args) {
+            return EXIT_SUCCESS;
+        }
+        return args->bots ? PlayBots(*args) : PlayScenario(*args);
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,209 @@
+#include "scenario.h"
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/json.hpp>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std::literals;
+
+namespace load {
+
+namespace json = boost::json;
+
+namespace {
+
+const std::string JOIN_TARGET = "/api/v1/game/join"s;
+const std::string ACTION_TARGET = "/api/v1/game/player/action"s;
+const std::string STATE_TARGET = "/api/v1/game/state"s;
+const std::string PLAYERS_TARGET = "/api/v1/game/players"s;
+const std::string TICK_TARGET = "/api/v1/game/tick"s;
+const std::string DEFAULT_USER_NAME = "bot"s;
+
+const Request::Header JSON_CONTENT_TYPE{"Content-Type"s, "application/json"s};
+
+std::string Trim(const std::string& line) {
+    const auto begin = line.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) {
+        return {};
+    }
+    const auto end = line.find_last_not_of(" \t\r");
+    return line.substr(begin, end - begin + 1);
+}
+
+Request MakeJsonPost(const std::string& target, const json::object& body, bool authorized) {
+    Request request;
+    request.method = http::verb::post;
+    request.target = target;
+    request.body = json::serialize(body);
+    request.headers.push_back(JSON_CONTENT_TYPE);
+    request.authorized = authorized;
+    return request;
+}
+
+Request MakeGet(const std::string& target, bool authorized) {
+    Request request;
+    request.target = target;
+    request.authorized = authorized;
+    return request;
+}
+
+Request ParseStep(const std::string& line, size_t line_number) {
+    std::istringstream words(line);
+    std::string command;
+    std::string argument;
+    words >> command >> argument;
+
+    auto throw_error = [&](std::string_view message) {
+        throw std::runtime_error("Scenario line "s + std::to_string(line_number) + ": "s + std::string(message));
+    };
+
+    if (command == "join"sv) {
+        if (argument.empty()) {
+            throw_error("map id isn't set"sv);
+        }
+        std::string name;
+        words >> name;
+        return MakeJoinRequest(argument, name.empty() ? DEFAULT_USER_NAME : name);
+    }
+    if (command == "action"sv) {
+        if (argument.empty()) {
+            throw_error("move isn't set"sv);
+        }
+        if (argument != "L"sv && argument != "R"sv && argument != "U"sv && argument != "D"sv && argument != "stop"sv) {
+            throw_error("unknown move"sv);
+        }
+        return MakeActionRequest(argument == "stop"sv ? ""s : argument);
+    }
+    if (command == "state"sv) {
+        return MakeStateRequest();
+    }
+    if (command == "players"sv) {
+        return MakeGet(PLAYERS_TARGET, true);
+    }
+    if (command == "tick"sv) {
+        int delta = 0;
+        try {
+            delta = std::stoi(argument);
+        } catch (const std::exception&) {
+            throw_error("tick period isn't a number"sv);
+        }
+        return MakeJsonPost(TICK_TARGET, {{"timeDelta", delta}}, false);
+    }
+    if (command == "get"sv) {
+        if (argument.empty() || argument.front() != '/') {
+            throw_error("target must start with '/'"sv);
+        }
+        return MakeGet(argument, false);
+    }
+
+    throw_error("unknown step '"s + command + "'"s);
+    return {};
+}
+
+}  // namespace
+
+Request MakeJoinRequest(const std::string& map_id, const std::string& user_name) {
+    auto request = MakeJsonPost(JOIN_TARGET, {{"userName", user_name}, {"mapId", map_id}}, false);
+    request.joins = true;
+    return request;
+}
+
+Request MakeActionRequest(const std::string& move) {
+    return MakeJsonPost(ACTION_TARGET, {{"move", move}}, true);
+}
+
+Request MakeStateRequest() {
+    return MakeGet(STATE_TARGET, true);
+}
+
+Scenario ParseAmmo(std::istream& input) {
+    Scenario scenario;
+    std::vector<Request::Header> headers;
+
+    std::string line;
+    while (std::getline(input, line)) {
+        line = Trim(line);
+        if (line.empty()) {
+            continue;
+        }
+
+        if (line.front() == '[') {
+            const auto colon = line.find(':');
+            if (line.back() != ']' || colon == std::string::npos) {
+                throw std::runtime_error("Wrong ammo header: "s + line);
+            }
+            auto name = Trim(line.substr(1, colon - 1));
+            auto value = Trim(line.substr(colon + 1, line.size() - colon - 2));
+            if (!boost::iequals(name, "Connection"sv)) {
+                headers.emplace_back(std::move(name), std::move(value));
+            }
+            continue;
+        }
+
+        if (line.front() != '/') {
+            throw std::runtime_error("Wrong ammo uri: "s + line);
+        }
+        // Tag after the uri is only used by the Tank reports
+        auto request = MakeGet(line.substr(0, line.find_first_of(" \t")), false);
+        request.headers = headers;
+        scenario.loop.push_back(std::move(request));
+    }
+
+    if (scenario.loop.empty()) {
+        throw std::runtime_error("Ammo has no requests"s);
+    }
+    return scenario;
+}
+
+Scenario ParseScenario(std::istream& input) {
+    Scenario scenario;
+    bool loop_found = false;
+
+    std::string line;
+    size_t line_number = 0;
+    while (std::getline(input, line)) {
+        ++line_number;
+        line = Trim(line);
+        if (line.empty() || line.front() == '#') {
+            continue;
+        }
+        if (line == "loop"sv) {
+            if (loop_found) {
+                throw std::runtime_error("Scenario line "s + std::to_string(line_number) + ": loop is set twice"s);
+            }
+            loop_found = true;
+            continue;
+        }
+        (loop_found ? scenario.loop : scenario.setup).push_back(ParseStep(line, line_number));
+    }
+
+    if (!loop_found) {
+        std::swap(scenario.setup, scenario.loop);
+    }
+    if (scenario.loop.empty()) {
+        throw std::runtime_error("Scenario has no repeated steps"s);
+    }
+    return scenario;
+}
+
+VirtualUser::VirtualUser(const Scenario& scenario, size_t id)
+    : scenario_(scenario)
+    , id_(id)
+    , loop_position_(id % scenario.loop.size()) {}
+
+const Request& VirtualUser::NextRequest() {
+    if (setup_position_ < scenario_.setup.size()) {
+        return scenario_.setup[setup_position_++];
+    }
+    const auto& request = scenario_.loop[loop_position_];
+    loop_position_ = (loop_position_ + 1) % scenario_.loop.size();
+    return request;
+}
+
+void VirtualUser::Restart() {
+    setup_position_ = 0;
+    token_.clear();
+}
+
+}  // namespace load
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <boost/beast/http/verb.hpp>
+#include <istream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace load {
+
+namespace http = boost::beast::http;
+
+struct Request {
+    using Header = std::pair<std::string, std::string>;
+
+    http::verb method = http::verb::get;
+    std::string target;
+    std::string body;
+    std::vector<Header> headers;
+    // Request is sent with the token of the virtual user
+    bool authorized = false;
+    // Response of the request carries a new token of the virtual user
+    bool joins = false;
+};
+
+// Setup requests are sent once by every virtual user, loop requests are repeated
+// until the load is over
+struct Scenario {
+    std::vector<Request> setup;
+    std::vector<Request> loop;
+};
+
+// Requests of the game API
+Request MakeJoinRequest(const std::string& map_id, const std::string& user_name);
+// Empty move stops the dog
+Request MakeActionRequest(const std::string& move);
+Request MakeStateRequest();
+
+// Reads Yandex.Tank ammo in the uri format:
+//   [Header: value]
+//   /uri [tag]
+// Connection header is skipped, connections are always kept alive by the generator
+Scenario ParseAmmo(std::istream& input);
+
+// Reads scenario script, one step per line:
+//   join <mapId> [userName]   POST /api/v1/game/join, the virtual user keeps the token
+//   action <L|R|U|D|stop>     POST /api/v1/game/player/action
+//   state                     GET /api/v1/game/state
+//   players                   GET /api/v1/game/players
+//   tick <milliseconds>       POST /api/v1/game/tick
+//   get <target>              GET of any target
+//   loop                      steps after it are repeated, steps before it are sent once
+// Without the loop line the whole script is repeated. Empty lines and lines
+// starting with '#' are skipped
+Scenario ParseScenario(std::istream& input);
+
+// Walks the scenario for one simulated player
+class VirtualUser {
+public:
+    VirtualUser(const Scenario& scenario, size_t id);
+
+    size_t GetId() const noexcept { return id_; }
+    const std::string& GetToken() const noexcept { return token_; }
+    void SetToken(std::string token) { token_ = std::move(token); }
+
+    // Returns the current request and moves to the next one
+    const Request& NextRequest();
+    // Starts the scenario from the setup again, e.g. when the token was rejected
+    void Restart();
+
+private:
+    const Scenario& scenario_;
+    size_t id_;
+    size_t setup_position_ = 0;
+    // Users start the loop at different steps, so that the ammo is spread over the connections
+    size_t loop_position_;
+    std::string token_;
+};
+
+}  // namespace load
@@ -20,7 +20,11 @@ std::optional<Args> ParseCommandLine(int argc, const char *const argv[])
         ("www-root,w", po::value(&args.source_dir)->value_name("dir"s), "set static files root")
         ("randomize-spawn-points", po::bool_switch(&args.randomize_spawn_point), "spawn dogs at random positions")
         ("state-file,s", po::value(&args.state_file)->value_name("file"s), "set file path to save state")
-        ("save-state-period,st", po::value(&args.save_state_period)->value_name("milliseconds"s), "set period to save state");
+        ("save-state-period,st", po::value(&args.save_state_period)->value_name("milliseconds"s), "set period to save state")
+        ("seed", po::value<uint64_t>()->value_name("number"s), "set random seed to make sessions reproducible")
+        ("map-cache", po::value(&args.map_cache_file)->value_name("file"s), "set binary cache of built maps")
+        ("tick-stats", po::bool_switch(&args.tick_stats), "collect session tick times, serve them at /api/v1/game/tick-stats")
+        ("enable-profiler", po::bool_switch(&args.enable_profiler), "serve sampling CPU profiles at /debug/pprof/profile");
     
     po::variables_map vm;
     po::store(po::parse_command_line(argc, argv, desc), vm);
@@ -31,6 +35,10 @@ std::optional<Args> ParseCommandLine(int argc, const char *const argv[])
         return std::nullopt;
     }
 
+    if (vm.contains("seed"s)) {
+        args.seed = vm["seed"s].as<uint64_t>();
+    }
+
     if (!vm.contains("config-file"s)) {
         throw std::runtime_error("Config file isn't set!");
     }
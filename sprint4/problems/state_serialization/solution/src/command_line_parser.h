@@ -4,6 +4,7 @@
 #include <string>
 #include <filesystem>
 #include <optional>
+#include <cstdint>
 
 namespace fs = std::filesystem;
 
@@ -16,6 +17,10 @@ struct Args {
     fs::path source_dir;
     fs::path state_file;
     int save_state_period = 0;
+    std::optional<uint64_t> seed;
+    fs::path map_cache_file;
+    bool tick_stats = false;
+    bool enable_profiler = false;
 };
 
 std::optional<Args> ParseCommandLine(int argc, const char* const argv[]);
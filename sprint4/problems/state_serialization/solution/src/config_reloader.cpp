@@ -0,0 +1,45 @@
+#include "config_reloader.h"
+#include "json_loader.h"
+#include "logger.h"
+
+namespace config_reloader {
+
+ConfigReloader::~ConfigReloader() {
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+bool ConfigReloader::ReloadAsync() {
+    if (in_progress_.exchange(true)) {
+        return false;
+    }
+
+    // Previous worker has finished, since the flag was reset
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+
+    worker_ = std::thread([this] {
+        Reload();
+        in_progress_ = false;
+    });
+    return true;
+}
+
+void ConfigReloader::Reload() {
+    auto loaded = json_loader::TryLoadGame(config_file_, map_cache_file_);
+    if (!loaded) {
+        logger::LogErrorMessage("Config reload failed, current maps are kept");
+        return;
+    }
+
+    const auto maps_count = loaded->GetMaps()->size();
+    game_.ReloadMaps(std::move(loaded.value()));
+
+    boost::json::object val;
+    val["maps"] = maps_count;
+    logger::LogJsonAndMessage(std::move(val), "config reloaded");
+}
+
+}  // namespace config_reloader
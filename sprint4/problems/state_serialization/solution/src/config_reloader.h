@@ -0,0 +1,40 @@
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <thread>
+
+#include "game.h"
+
+namespace config_reloader {
+
+// Reloads maps of the running game from the config file.
+// Config is parsed and validated in a separate thread, so requests aren't stalled,
+// and then the new maps are published to the game at once.
+class ConfigReloader {
+public:
+    ConfigReloader(model::Game& game, std::filesystem::path config_file, std::filesystem::path map_cache_file = {})
+        : game_(game)
+        , config_file_(std::move(config_file))
+        , map_cache_file_(std::move(map_cache_file)) {}
+
+    ConfigReloader(const ConfigReloader&) = delete;
+    ConfigReloader& operator=(const ConfigReloader&) = delete;
+    ~ConfigReloader();
+
+    // Returns false if the previous reload is still in progress
+    bool ReloadAsync();
+
+private:
+    void Reload();
+
+private:
+    model::Game& game_;
+    std::filesystem::path config_file_;
+    std::filesystem::path map_cache_file_;
+
+    std::atomic_bool in_progress_{false};
+    std::thread worker_;
+};
+
+}  // namespace config_reloader
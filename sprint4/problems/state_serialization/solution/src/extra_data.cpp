@@ -4,16 +4,12 @@
 namespace model {
 
 bool ExtraData::AddLootToMap(const model::Map::Id& id, const boost::json::array& loot) {
-    if (map_to_loot_.contains(id)) {
-        logger::LogErrorMessage("Loot has been already added to map.");
-        return false;
-    }
-    map_to_loot_[id] = loot;
+    std::vector<int> loot_values;
     
     try {
-        auto& loot_values = map_to_loot_values_[id];
+        loot_values.reserve(loot.size());
         for (int i = 0; i < loot.size(); ++i) {
-            auto loot_obj = loot[i].as_object();
+            const auto& loot_obj = loot[i].as_object();
             loot_values.push_back(loot_obj.at("value").as_int64());
         }
     } catch (const std::exception& e) {
@@ -21,6 +17,10 @@ bool ExtraData::AddLootToMap(const model::Map::Id& id, const boost::json::array&
         return false;
     }
 
+    // Copy goes to the default storage, so the source may live in a temporary resource
+    map_to_loot_[id] = loot;
+    map_to_loot_values_[id] = std::move(loot_values);
+
     return true;
 }
 
@@ -8,51 +8,43 @@
 
 namespace model {
 
+// Data from the config that isn't a part of the model.
+// It's loaded with the maps into a new snapshot and isn't changed after the snapshot is published
 class ExtraData {
 public:
-    static ExtraData& GetInstance() {
-        static ExtraData instance;
-        return instance;
-    }
-
-    ExtraData(const ExtraData& other) = delete;
-    ExtraData(ExtraData&& other) = delete;
+    struct LootGeneratorData {
+        long long period = 0.0;
+        double probability = 0.0;
+    };
 
-public:
     // Setters
+    // Loot of the map is replaced, if it has been already added
     bool AddLootToMap(const model::Map::Id& id, const boost::json::array& loot);
     void SetLootGeneratorData(double period, double probability);
 
     // Getters
-    decltype(auto) GetLootByMapId(const model::Map::Id& id) const {
-        if (map_to_loot_.contains(id)) {
-            return map_to_loot_.at(id);
+    const boost::json::array& GetLootByMapId(const model::Map::Id& id) const {
+        if (auto it = map_to_loot_.find(id); it != map_to_loot_.end()) {
+            return it->second;
         }
         throw server_exceptions::InvalidMapException();
     }
 
-    decltype(auto) GetLootValuesByMapId(const model::Map::Id& id) const {
-        if (map_to_loot_values_.contains(id)) {
-            return map_to_loot_values_.at(id);
+    const std::vector<int>& GetLootValuesByMapId(const model::Map::Id& id) const {
+        if (auto it = map_to_loot_values_.find(id); it != map_to_loot_values_.end()) {
+            return it->second;
         }
         throw server_exceptions::InvalidMapException();
     }
 
-    const auto& GetLootGeneratorData() const {
+    const LootGeneratorData& GetLootGeneratorData() const noexcept {
         return loot_generator_data_;
     }
 
 private:
-    ExtraData() = default;
-
-private:
-    struct LootGeneratorData {
-        long long period = 0.0;
-        double probability = 0.0;
-    };
-
     using MapIdToLoot = std::unordered_map<model::Map::Id, boost::json::array, util::TaggedHasher<model::Map::Id>>;
     using MapIdToLootValues = std::unordered_map<model::Map::Id, std::vector<int>, util::TaggedHasher<model::Map::Id>>;
+
     MapIdToLoot map_to_loot_;
     MapIdToLootValues map_to_loot_values_;
     LootGeneratorData loot_generator_data_;
@@ -2,6 +2,8 @@
 #include "logger.h"
 #include "game_server_exceptions.h"
 
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
 #include <sstream>
 #include <iomanip>
@@ -10,65 +12,339 @@ namespace model {
 
 using namespace std::literals;
 
+Game::Game(Game&& other) noexcept
+    : next_player_id_(other.next_player_id_.load())
+    , max_players_per_session_(other.max_players_per_session_)
+    , seed_(other.seed_)
+    , next_shard_index_(other.next_shard_index_)
+    , dog_retirement_time_(other.dog_retirement_time_)
+    , maps_(std::move(other.maps_))
+    , shards_(std::move(other.shards_))
+    , map_id_to_shards_(std::move(other.map_id_to_shards_))
+    , token_to_shard_(std::move(other.token_to_shard_)) {
+}
+
 void Game::AddMap(Map map) {
-    const size_t index = maps_.size();
-    if (auto [it, inserted] = map_id_to_index_.emplace(map.GetId(), index); !inserted) {
+    std::unique_lock registry_lock(shards_mutex_);
+
+    auto& maps = *maps_;
+    const size_t index = maps.maps.size();
+    if (auto [it, inserted] = maps.map_id_to_index.emplace(map.GetId(), index); !inserted) {
         throw std::invalid_argument("Map with id "s + *map.GetId() + " already exists"s);
     } else {
         try {
-            maps_.emplace_back(std::move(map));
+            // Deque keeps references to maps valid, so shards and sessions may refer to them
+            auto& added_map = maps.maps.emplace_back(std::move(map));
+            AddShard(added_map);
         } catch (...) {
-            map_id_to_index_.erase(it);
+            if (maps.maps.size() > index) {
+                maps.maps.pop_back();
+            }
+            maps.map_id_to_index.erase(it);
             throw;
         }
     }
 }
 
-const Game::Maps& Game::GetMaps() const noexcept {
-    return maps_;
+bool Game::AddLootToMap(const Map::Id& id, const boost::json::array& loot) {
+    std::unique_lock registry_lock(shards_mutex_);
+    return maps_->extra_data.AddLootToMap(id, loot);
+}
+
+void Game::SetLootGeneratorData(double period, double probability) {
+    std::unique_lock registry_lock(shards_mutex_);
+    maps_->extra_data.SetLootGeneratorData(period, probability);
 }
 
-const Map* Game::FindMap(const Map::Id& id) const noexcept {
-    if (auto it = map_id_to_index_.find(id); it != map_id_to_index_.end()) {
-        return &maps_.at(it->second);
+void Game::ReloadMaps(Game&& loaded) {
+    std::unique_lock registry_lock(shards_mutex_);
+
+    // Sessions of the old maps aren't joinable anymore, but they are ticked and
+    // their players are found by token, until the sessions are gone.
+    // Loot data is published with the maps in the same snapshot
+    maps_ = std::move(loaded.maps_);
+    map_id_to_shards_ = std::move(loaded.map_id_to_shards_);
+    max_players_per_session_ = loaded.max_players_per_session_;
+    dog_retirement_time_ = loaded.dog_retirement_time_;
+
+    // Old sessions retire dogs by the new config as well
+    for (auto& shard : shards_) {
+        std::lock_guard lock(shard->GetMutex());
+        shard->GetSession()->SetDogRetirementTime(dog_retirement_time_);
+    }
+
+    for (auto& shard : loaded.shards_) {
+        if (seed_.has_value()) {
+            shard->GetSession()->SetRandomSeed(RandomGenerator::DeriveSeed(seed_.value(), next_shard_index_));
+        }
+        ++next_shard_index_;
+        shards_.push_back(std::move(shard));
+    }
+    loaded.shards_.clear();
+    loaded.maps_ = std::make_shared<MapsSnapshot>();
+}
+
+std::shared_ptr<const Game::Maps> Game::GetMaps() const {
+    auto snapshot = GetMapsSnapshot();
+    return {snapshot, &snapshot->maps};
+}
+
+std::shared_ptr<const Map> Game::FindMap(const Map::Id& id) const {
+    auto snapshot = GetMapsSnapshot();
+    if (const auto* map = snapshot->FindMap(id)) {
+        return {snapshot, map};
     }
     return nullptr;
 }
 
+std::shared_ptr<const MapsSnapshot> Game::GetMapsSnapshot() const {
+    std::shared_lock registry_lock(shards_mutex_);
+    return maps_;
+}
+
 Token Game::JoinGame(const std::string &name, const Map::Id &map_id, bool randomize_spawn_point) {
-    auto map = FindMap(map_id);
-    if (!map) {
-        throw server_exceptions::InvalidMapException("Map is not found");
+    // Registry is only read under the shared lock, so joins to different sessions run in parallel.
+    // Shards are locked after the registry lock is released, and the join is retried
+    // if the copied shards have been changed meanwhile
+    while (true) {
+        std::vector<GameShardPtr> map_shards;
+        size_t max_players = UNLIMITED_PLAYERS_PER_SESSION;
+        {
+            std::shared_lock registry_lock(shards_mutex_);
+            map_shards = GetMapShards(map_id);
+            max_players = max_players_per_session_;
+        }
+
+        // Player with the same name on any session of the map gets the same token back
+        for (const auto& shard : map_shards) {
+            std::lock_guard lock(shard->GetMutex());
+            if (auto id = shard->GetSession()->GetPlayerIdByName(name)) {
+                return shard->GetPlayerTokens().FindTokenByPlayerId(id.value());
+            }
+        }
+
+        auto shard = SelectShardToJoin(map_shards, max_players);
+        if (!shard) {
+            // All sessions of the map are full, so open one more instance of it
+            shard = TryAddShard(map_id, map_shards);
+        }
+        if (!shard) {
+            continue;
+        }
+
+        if (auto token = TryJoinShard(shard, name, map_id, max_players, randomize_spawn_point)) {
+            return std::move(token.value());
+        }
     }
+}
 
-    auto session = FindSession(map_id);
-    if (auto id = session->GetPlayerIdByName(name)) {
-        return player_tokens_.FindTokenByPlayerId(id.value());
-    } else {
-        const auto player_id = current_id_++;
-        Position start_pos = randomize_spawn_point ? map->GetRandomPosition() : Position{ 0.0, 0.0 };
-        auto dog = session->AddDog(start_pos, name, player_id);
-        return player_tokens_.AddPlayer({ name, player_id, map_id, dog });
+void Game::SetRandomSeed(uint64_t seed) {
+    std::unique_lock registry_lock(shards_mutex_);
+
+    seed_ = seed;
+    for (size_t index = 0; index < shards_.size(); ++index) {
+        std::lock_guard lock(shards_[index]->GetMutex());
+        shards_[index]->GetSession()->SetRandomSeed(RandomGenerator::DeriveSeed(seed, index));
     }
 }
 
-const Player &Game::FindPlayerByToken(Token token) {
-    return player_tokens_.FindPlayerByToken(token);
+void Game::SetDogRetirementTime(std::chrono::milliseconds retirement_time) {
+    std::unique_lock registry_lock(shards_mutex_);
+
+    dog_retirement_time_ = retirement_time;
+    for (auto& shard : shards_) {
+        std::lock_guard lock(shard->GetMutex());
+        shard->GetSession()->SetDogRetirementTime(retirement_time);
+    }
 }
 
-const Player &Game::FindPlayerById(uint32_t id) {
-    return player_tokens_.FindPlayerById(id);
+std::vector<RetiredDog> Game::Tick(GameShard& shard, std::chrono::milliseconds delta) {
+    std::vector<RetiredDog> retired_dogs;
+    std::vector<Token> retired_tokens;
+    bool is_empty = false;
+    {
+        std::lock_guard lock(shard.GetMutex());
+        shard.GetSession()->UpdateTime(delta);
+        retired_dogs = shard.GetSession()->TakeRetiredDogs();
+        for (const auto& dog : retired_dogs) {
+            retired_tokens.push_back(shard.GetPlayerTokens().RemovePlayer(dog.player_id));
+        }
+        is_empty = shard.GetPlayersCount() == 0;
+    }
+
+    if (retired_tokens.empty() && !(is_empty && !shard.IsEvicted() && IsEvictableShard(shard))) {
+        return retired_dogs;
+    }
+
+    std::unique_lock registry_lock(shards_mutex_);
+    for (const auto& token : retired_tokens) {
+        token_to_shard_.erase(token);
+    }
+    if (is_empty) {
+        TryEvictShard(shard);
+    }
+    return retired_dogs;
+}
+
+Player Game::FindPlayerByToken(const Token& token) const {
+    return WithPlayer(token, [](const Player& player, GameShard&) {
+        return player;
+    });
 }
 
-SessionPtr Game::FindSession(Map::Id id) {
-    if (!map_id_to_session_.contains(id)) {
-        if (auto map = FindMap(id)) {
-            map_id_to_session_[id] = std::make_shared<GameSession>(const_cast<Map&>(*map));
-        } else {
-            throw server_exceptions::InvalidMapException("Map is not found");
+Player Game::FindPlayerById(uint32_t id) const {
+    for (const auto& shard : GetShards()) {
+        std::lock_guard lock(shard->GetMutex());
+        if (auto player = shard->GetPlayerTokens().TryFindPlayerById(id)) {
+            return *player;
         }
     }
-    return map_id_to_session_.at(id);
+    throw server_exceptions::InvalidArgumentException("Invalid player id");
+}
+
+SessionPtr Game::FindSession(const Map::Id& id) const {
+    std::shared_lock registry_lock(shards_mutex_);
+    return GetMapShards(id).front()->GetSession();
+}
+
+std::vector<SessionPtr> Game::FindSessions(const Map::Id& id) const {
+    std::shared_lock registry_lock(shards_mutex_);
+
+    std::vector<SessionPtr> result;
+    for (const auto& shard : GetMapShards(id)) {
+        result.push_back(shard->GetSession());
+    }
+    return result;
+}
+
+std::vector<GameShardPtr> Game::GetShards() const {
+    std::shared_lock registry_lock(shards_mutex_);
+    return shards_;
+}
+
+const std::vector<GameShardPtr>& Game::GetMapShards(const Map::Id& id) const {
+    if (auto it = map_id_to_shards_.find(id); it != map_id_to_shards_.end()) {
+        return it->second;
+    }
+    throw server_exceptions::InvalidMapException("Map is not found");
+}
+
+GameShardPtr Game::AddShard(Map& map) {
+    auto& map_shards = map_id_to_shards_[map.GetId()];
+    map_shards.reserve(map_shards.size() + 1);
+
+    // Index isn't reused after eviction, so sessions get the same seeds on replay
+    std::optional<uint64_t> seed;
+    if (seed_.has_value()) {
+        seed = RandomGenerator::DeriveSeed(seed_.value(), next_shard_index_);
+    }
+    ++next_shard_index_;
+
+    auto shard = std::make_shared<GameShard>(maps_, map, seed);
+    shard->GetSession()->SetDogRetirementTime(dog_retirement_time_);
+    shards_.push_back(shard);
+    map_shards.push_back(shard);
+    return shard;
+}
+
+GameShardPtr Game::SelectShardToJoin(const std::vector<GameShardPtr>& map_shards, size_t max_players) const {
+    GameShardPtr least_loaded;
+    size_t least_players = std::numeric_limits<size_t>::max();
+
+    for (const auto& shard : map_shards) {
+        std::lock_guard lock(shard->GetMutex());
+        if (shard->IsEvicted()) {
+            continue;
+        }
+        if (const auto players = shard->GetPlayersCount(); players < least_players) {
+            least_loaded = shard;
+            least_players = players;
+        }
+    }
+
+    if (least_loaded && (max_players == UNLIMITED_PLAYERS_PER_SESSION || least_players < max_players)) {
+        return least_loaded;
+    }
+    return nullptr;
+}
+
+GameShardPtr Game::TryAddShard(const Map::Id& map_id, const std::vector<GameShardPtr>& map_shards) {
+    std::unique_lock registry_lock(shards_mutex_);
+
+    // Another join may have opened a session, or a tick may have evicted one
+    if (GetMapShards(map_id) != map_shards) {
+        return nullptr;
+    }
+    return AddShard(maps_->maps.at(maps_->map_id_to_index.at(map_id)));
+}
+
+std::optional<Token> Game::TryJoinShard(const GameShardPtr& shard, const std::string& name, const Map::Id& map_id,
+                                        size_t max_players, bool randomize_spawn_point) {
+    std::optional<Token> token;
+    {
+        std::lock_guard lock(shard->GetMutex());
+        // Session may have been evicted or filled up after it was selected
+        if (shard->IsEvicted()) {
+            return std::nullopt;
+        }
+        // Concurrent join with the same name has added the player
+        if (auto id = shard->GetSession()->GetPlayerIdByName(name)) {
+            return shard->GetPlayerTokens().FindTokenByPlayerId(id.value());
+        }
+        if (max_players != UNLIMITED_PLAYERS_PER_SESSION && shard->GetPlayersCount() >= max_players) {
+            return std::nullopt;
+        }
+
+        const auto player_id = next_player_id_.fetch_add(1, std::memory_order_relaxed);
+        Position start_pos = randomize_spawn_point ? shard->GetSession()->GetRandomPosition() : Position{ 0.0, 0.0 };
+        auto dog = shard->GetSession()->AddDog(start_pos, name, player_id);
+        token = shard->GetPlayerTokens().AddPlayer({ name, player_id, map_id, dog });
+    }
+
+    std::unique_lock registry_lock(shards_mutex_);
+    token_to_shard_.emplace(token.value(), shard);
+    return token;
+}
+
+bool Game::IsEvictableShard(const GameShard& shard) const {
+    std::shared_lock registry_lock(shards_mutex_);
+    return IsEvictable(shard);
+}
+
+bool Game::IsEvictable(const GameShard& shard) const {
+    // Session of the current maps stays, if it's the last one of its map
+    auto it = map_id_to_shards_.find(shard.GetMap().GetId());
+    if (it == map_id_to_shards_.end()) {
+        return true;
+    }
+    const auto& map_shards = it->second;
+    const bool is_current = std::any_of(map_shards.begin(), map_shards.end(), [&shard](const GameShardPtr& map_shard) {
+        return map_shard.get() == &shard;
+    });
+    return !is_current || map_shards.size() > 1;
+}
+
+void Game::TryEvictShard(GameShard& shard) {
+    if (shard.IsEvicted() || !IsEvictable(shard)) {
+        return;
+    }
+
+    {
+        // Player may have joined the session after the tick
+        std::lock_guard lock(shard.GetMutex());
+        if (shard.GetPlayersCount() != 0) {
+            return;
+        }
+        shard.SetEvicted();
+    }
+
+    auto is_shard = [&shard](const GameShardPtr& other) {
+        return other.get() == &shard;
+    };
+    if (auto it = map_id_to_shards_.find(shard.GetMap().GetId()); it != map_id_to_shards_.end()) {
+        std::erase_if(it->second, is_shard);
+    }
+    std::erase_if(shards_, is_shard);
 }
 
 }  // namespace model
@@ -1,4 +1,10 @@
 #pragma once
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -8,41 +14,184 @@
 #include "model_dog.h"
 #include "model_map.h"
 #include "game_session.h"
+#include "extra_data.h"
 #include "model_player.h"
 #include "player_tokens.h"
+#include "game_server_exceptions.h"
 
 #include "tagged.h"
 
 namespace model {
 
+// Zero means that the number of players in one session isn't limited
+const static size_t UNLIMITED_PLAYERS_PER_SESSION = 0;
+
+// Maps of one config with their loot data. Snapshot isn't changed after it's published: config reload
+// publishes a new one, and sessions created from the old one keep it alive until they are gone
+struct MapsSnapshot {
+    using Maps = std::deque<Map>;
+    using MapIdToIndex = std::unordered_map<Map::Id, size_t, util::TaggedHasher<Map::Id>>;
+
+    const Map* FindMap(const Map::Id& id) const {
+        if (auto it = map_id_to_index.find(id); it != map_id_to_index.end()) {
+            return &maps.at(it->second);
+        }
+        return nullptr;
+    }
+
+    Maps maps;
+    MapIdToIndex map_id_to_index;
+    ExtraData extra_data;
+};
+
+using MapsSnapshotPtr = std::shared_ptr<MapsSnapshot>;
+
+// One session instance of a map and the players that joined it.
+// Every access to the shard state is done under the shard mutex, so requests
+// and ticks of different sessions don't contend with each other.
+class GameShard {
+public:
+    GameShard(MapsSnapshotPtr maps, Map& map, std::optional<uint64_t> seed = std::nullopt)
+        : maps_(std::move(maps))
+        , map_(map)
+        , session_(std::make_shared<GameSession>(map, maps_->extra_data, std::nullopt, seed)) {}
+
+    GameShard(const GameShard&) = delete;
+    GameShard& operator=(const GameShard&) = delete;
+
+    const Map& GetMap() const noexcept { return map_; }
+    const SessionPtr& GetSession() const noexcept { return session_; }
+    PlayerTokens& GetPlayerTokens() noexcept { return player_tokens_; }
+    const PlayerTokens& GetPlayerTokens() const noexcept { return player_tokens_; }
+    const std::vector<Player>& GetPlayers() const noexcept { return player_tokens_.GetPlayers(); }
+    size_t GetPlayersCount() const noexcept { return player_tokens_.GetPlayers().size(); }
+    std::mutex& GetMutex() const noexcept { return mutex_; }
+
+    // Evicted shard is removed from the game, it's only kept alive by its last users
+    bool IsEvicted() const noexcept { return evicted_; }
+    void SetEvicted() noexcept { evicted_ = true; }
+
+private:
+    MapsSnapshotPtr maps_;
+    Map& map_;
+    SessionPtr session_;
+    PlayerTokens player_tokens_;
+    mutable std::mutex mutex_;
+    std::atomic_bool evicted_{false};
+};
+
+using GameShardPtr = std::shared_ptr<GameShard>;
+
 class Game {
 public:
-    using Maps = std::vector<Map>;
+    using Maps = MapsSnapshot::Maps;
     using MapIdHasher = util::TaggedHasher<Map::Id>;
-    using MapIdToIndex = std::unordered_map<Map::Id, size_t, MapIdHasher>;
-    using MapIdToSession = std::unordered_map<Map::Id, SessionPtr , MapIdHasher>;
+    using MapIdToShards = std::unordered_map<Map::Id, std::vector<GameShardPtr>, MapIdHasher>;
+    using TokenToShard = std::unordered_map<Token, GameShardPtr, util::TaggedHasher<Token>>;
 
+    Game() = default;
+    Game(Game&& other) noexcept;
+    Game& operator=(Game&& other) = delete;
+
+    // Add data to the current snapshot, they are used only while the game is loaded.
+    // Loot of the map is added before the map, since the session of the map takes loot values
     void AddMap(Map map);
-    const Map* FindMap(const Map::Id& id) const noexcept;
+    bool AddLootToMap(const Map::Id& id, const boost::json::array& loot);
+    void SetLootGeneratorData(double period, double probability);
+    std::shared_ptr<const Map> FindMap(const Map::Id& id) const;
+    // Publishes maps of the loaded game. New players join sessions of the new maps,
+    // existing sessions keep playing on the old ones. Loaded game must have no players
+    void ReloadMaps(Game&& loaded);
 
     // Change game state
     Token JoinGame(const std::string &name, const Map::Id& id, bool randomize_spawn_point = false);
-    const Player& FindPlayerByToken(Token token);
-    const Player& FindPlayerById(uint32_t id);
-    SessionPtr FindSession(Map::Id id);
-    
+    Player FindPlayerByToken(const Token& token) const;
+    Player FindPlayerById(uint32_t id) const;
+    SessionPtr FindSession(const Map::Id& id) const;
+    std::vector<SessionPtr> FindSessions(const Map::Id& id) const;
+    // Updates the session, removes players of retired dogs and evicts the shard,
+    // if it's empty and isn't the last session of a current map
+    std::vector<RetiredDog> Tick(GameShard& shard, std::chrono::milliseconds delta);
+
+    // Calls fn(const Player&, GameShard&) under the lock of the player's shard
+    template <typename Fn>
+    decltype(auto) WithPlayer(const Token& token, Fn&& fn) const {
+        PlayerTokens::ValidateToken(token);
+
+        GameShardPtr shard;
+        {
+            std::shared_lock lock(shards_mutex_);
+            if (auto it = token_to_shard_.find(token); it != token_to_shard_.end()) {
+                shard = it->second;
+            }
+        }
+        if (!shard) {
+            throw server_exceptions::UnknownTokenException("Player token has not been found");
+        }
+
+        // Player may have been retired after the registry lookup, then the token is not found here
+        std::lock_guard lock(shard->GetMutex());
+        return fn(shard->GetPlayerTokens().FindPlayerByToken(token), *shard);
+    }
+
+    // Calls fn(const GameShardPtr&) for each shard without locking it
+    template <typename Fn>
+    void ForEachShard(Fn&& fn) const {
+        for (const auto& shard : GetShards()) {
+            fn(shard);
+        }
+    }
+
+    // Calls fn(SessionPtr) for each session under the lock of its shard
+    template <typename Fn>
+    void ForEachSession(Fn&& fn) const {
+        for (const auto& shard : GetShards()) {
+            std::lock_guard lock(shard->GetMutex());
+            fn(shard->GetSession());
+        }
+    }
+
+    // Setters
+    void SetMaxPlayersPerSession(size_t max_players) noexcept { max_players_per_session_ = max_players; }
+    // Makes every session replayable: session N is seeded with a seed derived from (seed, N)
+    void SetRandomSeed(uint64_t seed);
+    void SetDogRetirementTime(std::chrono::milliseconds retirement_time);
+
     // Getters
-    const Maps& GetMaps() const noexcept;
-    const auto& GetPlayers() const { return player_tokens_.GetPlayers(); }
-    auto& GetMapToSession() { return map_id_to_session_; }
-    
+    std::shared_ptr<const Maps> GetMaps() const;
+    // Maps and loot data of one config, they aren't split by a concurrent config reload
+    std::shared_ptr<const MapsSnapshot> GetMapsSnapshot() const;
+    size_t GetMaxPlayersPerSession() const noexcept { return max_players_per_session_; }
+    std::chrono::milliseconds GetDogRetirementTime() const noexcept { return dog_retirement_time_; }
+    std::vector<GameShardPtr> GetShards() const;
+
 private:
-    uint32_t current_id_ = 0;
+    const std::vector<GameShardPtr>& GetMapShards(const Map::Id& id) const;
+    GameShardPtr AddShard(Map& map);
+    // Least loaded session with room, nullptr if all sessions are full
+    GameShardPtr SelectShardToJoin(const std::vector<GameShardPtr>& map_shards, size_t max_players) const;
+    // Opens one more session of the map, nullptr if the map shards differ from the given ones
+    GameShardPtr TryAddShard(const Map::Id& map_id, const std::vector<GameShardPtr>& map_shards);
+    // Adds the player to the session, nullopt if the session has been evicted or is full
+    std::optional<Token> TryJoinShard(const GameShardPtr& shard, const std::string& name, const Map::Id& map_id,
+                                      size_t max_players, bool randomize_spawn_point);
+    bool IsEvictableShard(const GameShard& shard) const;
+    bool IsEvictable(const GameShard& shard) const;
+    void TryEvictShard(GameShard& shard);
 
-    std::vector<Map> maps_;
-    MapIdToIndex map_id_to_index_;
-    MapIdToSession map_id_to_session_;
-    PlayerTokens player_tokens_;
+private:
+    std::atomic<uint32_t> next_player_id_{0};
+    size_t max_players_per_session_ = UNLIMITED_PLAYERS_PER_SESSION;
+    std::optional<uint64_t> seed_;
+    size_t next_shard_index_ = 0;
+    std::chrono::milliseconds dog_retirement_time_ = DEFAULT_DOG_RETIREMENT_TIME;
+
+    // Session registry, lock order is registry mutex -> shard mutex
+    mutable std::shared_mutex shards_mutex_;
+    MapsSnapshotPtr maps_ = std::make_shared<MapsSnapshot>();
+    std::vector<GameShardPtr> shards_;
+    MapIdToShards map_id_to_shards_;
+    TokenToShard token_to_shard_;
 };
 
 }  // namespace model
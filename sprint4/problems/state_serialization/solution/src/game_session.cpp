@@ -26,33 +26,77 @@ void GameSession::SetTimeSinceSave(std::chrono::milliseconds time_since_save) {
     time_since_save_ = time_since_save;
 }
 
-DogPtr GameSession::AddDog(Position spawn_point, const std::string& name, uint32_t id) {
-    auto dog = std::make_shared<Dog>(name, spawn_point, GetMapSpeed(), Direction::NORTH);
+Dog GameSession::AddDog(Position spawn_point, const std::string& name, uint32_t id) {
+    const auto slot = dogs_.Add(name, spawn_point, Direction::NORTH);
     name_to_id_[name] = id;
-    id_to_dog_[id] = dog;
-    return id_to_dog_.at(id);
+    id_to_slot_[id] = slot;
+    if (slot_to_id_.size() <= slot) {
+        slot_to_id_.resize(slot + 1);
+    }
+    slot_to_id_[slot] = id;
+    return Dog(dogs_, slot);
 }
 
 void GameSession::UpdateTime(std::chrono::milliseconds delta) {
-    for (auto&[id, dog] : id_to_dog_) {
-        UpdateDogPosition(dog, delta);
+    for (DogStorage::SlotId slot = 0; slot < dogs_.Size(); ++slot) {
+        if (dogs_.IsAlive(slot)) {
+            UpdateDogPosition(slot, delta);
+        }
     }
     UpdateLostObjects(delta);
     UpdateLootProvider();
     UpdateCollisions();
+    RetireIdleDogs(delta);
     time_since_save_ += delta;
 }
 
+std::vector<RetiredDog> GameSession::TakeRetiredDogs() {
+    return std::exchange(retired_dogs_, {});
+}
+
+void GameSession::RetireIdleDogs(std::chrono::milliseconds delta) {
+    for (DogStorage::SlotId slot = 0; slot < dogs_.Size(); ++slot) {
+        if (!dogs_.IsAlive(slot)) {
+            continue;
+        }
+
+        const auto& speed = dogs_.GetSpeed(slot);
+        auto& idle_time = dogs_.GetIdleTime(slot);
+        auto& play_time = dogs_.GetPlayTime(slot);
+
+        play_time += delta;
+        idle_time = (speed.v_x == 0.0 && speed.v_y == 0.0) ? idle_time + delta : std::chrono::milliseconds{0};
+
+        if (idle_time >= dog_retirement_time_) {
+            // Dog has retired in the middle of the tick, the rest of the tick isn't played
+            retired_dogs_.push_back({slot_to_id_[slot], dogs_.GetName(slot), dogs_.GetScore(slot), play_time - (idle_time - dog_retirement_time_)});
+            RemoveDog(slot);
+        }
+    }
+}
+
+void GameSession::RemoveDog(DogStorage::SlotId slot) {
+    const auto id = slot_to_id_[slot];
+    name_to_id_.erase(dogs_.GetName(slot));
+    id_to_slot_.erase(id);
+    dogs_.Remove(slot);
+}
+
 void GameSession::UpdateLostObjects(std::chrono::milliseconds delta) {
     TryGenerateLoot(delta);
 }
 
 void GameSession::TryGenerateLoot(std::chrono::milliseconds delta) {
     auto current_loot_count = available_loot_items_.size();
-    auto calculated_loot_count = loot_generator_->Generate(delta, current_loot_count, id_to_dog_.size());
+    auto calculated_loot_count = loot_generator_->Generate(delta, current_loot_count, dogs_.AliveCount());
+
+    if (loot_size_ == 0) {
+        return;
+    }
 
     for (int i = 0; i < calculated_loot_count; ++i) {
-        available_loot_items_[loot_id_++] = LootItem(rand() % loot_size_, map_.GetRandomPosition());
+        const auto type = static_cast<unsigned>(random_.NextIndex(loot_size_));
+        available_loot_items_[loot_id_++] = LootItem(type, map_.GetRandomPosition(random_));
     }
 }
 
@@ -61,8 +105,13 @@ void GameSession::UpdateLootProvider() {
     loot_provider_.Clear();
     
     // Add new data
-    for (const auto&[id, dog] : id_to_dog_) {
-        loot_provider_.PushGatherer(collision_detector::Gatherer(dog->GetPrevPosition(), dog->GetPosition(), PLAYER_WIDTH, id));
+    const auto& prev_positions = dogs_.GetPrevPositions();
+    const auto& positions = dogs_.GetPositions();
+    for (DogStorage::SlotId slot = 0; slot < dogs_.Size(); ++slot) {
+        if (!dogs_.IsAlive(slot)) {
+            continue;
+        }
+        loot_provider_.PushGatherer(collision_detector::Gatherer(prev_positions[slot], positions[slot], PLAYER_WIDTH, slot));
     }
 
     // Add loot items
@@ -82,10 +131,6 @@ void GameSession::UpdateCollisions() {
     auto gather_events = collision_detector::FindGatherEvents(loot_provider_);
 
     for (const auto& e : gather_events) {
-        auto gatherer_id = e.gatherer_id;
-        auto item_id = e.item_id;
-        auto& dog = id_to_dog_.at(gatherer_id);
-
         TryUpdateCollisionsWithOffice(e);
         TryUpdateCollisionsWithLoot(e);
     }
@@ -93,15 +138,14 @@ void GameSession::UpdateCollisions() {
 
 bool GameSession::TryUpdateCollisionsWithOffice(const collision_detector::GatheringEvent& gather_event) {
     if (gather_event.is_collision_with_base) {
-        auto gatherer_id = gather_event.gatherer_id;
-        auto item_id = gather_event.item_id;
-        auto& dog = id_to_dog_.at(gatherer_id);
-        for (const auto&[id, loot] : dog->GetBagContent()) {
-            auto loot_value = ExtraData::GetInstance().GetLootValuesByMapId(map_.GetId()).at(loot.type);
-            dog->UpdateScore(loot_value);
+        const auto slot = static_cast<DogStorage::SlotId>(gather_event.gatherer_id);
+        auto& bag = dogs_.GetBag(slot);
+        for (const auto&[id, loot] : bag) {
+            auto loot_value = loot_values_.at(loot.type);
+            dogs_.GetScore(slot) += loot_value;
         }
 
-        dog->RemoveLootFromBag();
+        bag.clear();
         return true;
     }
     return false;
@@ -109,12 +153,12 @@ bool GameSession::TryUpdateCollisionsWithOffice(const collision_detector::Gather
 
 bool GameSession::TryUpdateCollisionsWithLoot(const collision_detector::GatheringEvent& gather_event) {
     if (!gather_event.is_collision_with_base) {
-        auto gatherer_id = gather_event.gatherer_id;
+        const auto slot = static_cast<DogStorage::SlotId>(gather_event.gatherer_id);
         auto item_id = gather_event.item_id;
-        auto& dog = id_to_dog_.at(gatherer_id);
-        if (dog->GetBagContent().size() < map_.GetBagCapacity()) {
+        auto& bag = dogs_.GetBag(slot);
+        if (bag.size() < map_.GetBagCapacity()) {
             if (available_loot_items_.contains(item_id)) {
-                dog->AddLootIntoBag(item_id, available_loot_items_.at(item_id));
+                bag[item_id] = available_loot_items_.at(item_id);
                 available_loot_items_.erase(item_id);
             }
         }
@@ -123,49 +167,37 @@ bool GameSession::TryUpdateCollisionsWithLoot(const collision_detector::Gatherin
     return false;
 }
 
-void GameSession::UpdateDogPosition(DogPtr dog, std::chrono::milliseconds delta) {
+void GameSession::UpdateDogPosition(DogStorage::SlotId slot, std::chrono::milliseconds delta) {
     static const int TIME_RATE = 1000;
 
-    dog->SetPrevPosition(dog->GetPosition());
+    Position& position = dogs_.GetPosition(slot);
+    Speed& speed = dogs_.GetSpeed(slot);
+
+    dogs_.GetPrevPosition(slot) = position;
 
     Position calculated_pos;
 
-    Position calculated_pos_on_current_road = dog->GetPosition();
+    Position calculated_pos_on_current_road = position;
     Speed calculated_speed_on_current_road;
 
-    Position calculated_pos_on_other_road = dog->GetPosition();
+    Position calculated_pos_on_other_road = position;
     Speed calculated_speed_on_other_road;
 
-    calculated_pos.x = dog->GetPosition().x + dog->GetSpeed().v_x * delta.count() / TIME_RATE;
-    calculated_pos.y = dog->GetPosition().y + dog->GetSpeed().v_y * delta.count() / TIME_RATE;
+    calculated_pos.x = position.x + speed.v_x * delta.count() / TIME_RATE;
+    calculated_pos.y = position.y + speed.v_y * delta.count() / TIME_RATE;
 
     std::multimap<double, std::pair<model::Position, model::Speed>> distance_to_calculated_data; 
 
-    auto current_road = map_.FindRoadByPosition(dog->GetPosition());
+    auto current_road = map_.FindRoadByPosition(position);
     if (current_road.has_value()) {
-        auto result_on_current_road = map_.CalculatePositionAndSpeedOnRoad(current_road.value(), map_.GetRoadBoarders().at(current_road.value().GetId()), calculated_pos, dog->GetSpeed());
+        auto result_on_current_road = map_.CalculatePositionAndSpeedOnRoad(current_road.value(), map_.GetRoadBoarders().at(current_road.value().GetId()), calculated_pos, speed);
         calculated_pos_on_current_road = result_on_current_road.first;
         calculated_speed_on_current_road = result_on_current_road.second;
 
-        // auto other_road = map_.FindRoadByPositionExceptRoadId(dog->GetPosition(), current_road.value().GetId());
-        // if (other_road.has_value()) {
-        //     auto result_on_other_road = map_.CalculatePositionAndSpeedOnRoad(other_road.value(), map_.GetRoadBoarders().at(other_road.value().GetId()), calculated_pos, dog->GetSpeed());
-        //     calculated_pos_on_other_road = result_on_other_road.first;
-        //     calculated_speed_on_other_road = result_on_other_road.second;
-
-        //     std::cout << "Road id: " << other_road.value().GetId() << std::endl;
-        //     std::cout << "Old Position on this road: " << "x: " << result_on_other_road.first.x << ", y: " << result_on_other_road.first.y << std::endl;
-
-        //     std::cout << "Old Calculated distance: " << CalculateDistance(result_on_other_road.first, dog->GetPosition()) 
-        //                                 << ", x: " << result_on_other_road.first.x << ", y: " << result_on_other_road.first.y 
-        //                                 << ", v_x: " << result_on_other_road.second.v_x << ", v_y: " << result_on_other_road.second.v_y << std::endl;
-
-        //}
-
-        auto other_roads = map_.FindRoadsByPositionExceptRoadId(dog->GetPosition(), current_road.value().GetId());
+        auto other_roads = map_.FindRoadsByPositionExceptRoadId(position, current_road.value().GetId());
         for (const auto& road : other_roads) {
-            auto result_on_other_road = map_.CalculatePositionAndSpeedOnRoad(road, map_.GetRoadBoarders().at(road.GetId()), calculated_pos, dog->GetSpeed());
-            distance_to_calculated_data.insert( { CalculateDistance(result_on_other_road.first, dog->GetPosition()), std::move(result_on_other_road) } );
+            auto result_on_other_road = map_.CalculatePositionAndSpeedOnRoad(road, map_.GetRoadBoarders().at(road.GetId()), calculated_pos, speed);
+            distance_to_calculated_data.insert( { CalculateDistance(result_on_other_road.first, position), std::move(result_on_other_road) } );
         }
     }
 
@@ -187,32 +219,27 @@ void GameSession::UpdateDogPosition(DogPtr dog, std::chrono::milliseconds delta)
         }
     }
 
-    // For debug only
-    // std::cout << "Current road: " << "vertical: " << current_road->IsVertical() << ", horizontal: " << current_road->IsHorizontal() << std::endl;
-    // std::cout << "Calculated pos on current road: " << calculated_pos_on_current_road.x << ", " << calculated_pos_on_current_road.y << std::endl;
-    // std::cout << "Calculated pos on other road: " << calculated_pos_on_other_road.x << ", " << calculated_pos_on_other_road.y << std::endl;
-
-    auto distance_on_current_road = CalculateDistance(calculated_pos_on_current_road, dog->GetPosition());
+    auto distance_on_current_road = CalculateDistance(calculated_pos_on_current_road, position);
     auto distance_on_other_road = !distance_to_calculated_data.empty() ? 
                                 std::prev(distance_to_calculated_data.end())->first : 
-                                CalculateDistance(calculated_pos_on_other_road, dog->GetPosition());
+                                CalculateDistance(calculated_pos_on_other_road, position);
     
     if (distance_on_current_road > distance_on_other_road) {
-        dog->SetPosition(calculated_pos_on_current_road);
-        dog->SetSpeed(calculated_speed_on_current_road);
+        position = calculated_pos_on_current_road;
+        speed = calculated_speed_on_current_road;
     } else if (distance_on_current_road < distance_on_other_road) {
-        dog->SetPosition(calculated_pos_on_other_road);
-        dog->SetSpeed(calculated_speed_on_other_road);
+        position = calculated_pos_on_other_road;
+        speed = calculated_speed_on_other_road;
     } else {
         if (CalculateAbsSpeed(calculated_speed_on_current_road) > CalculateAbsSpeed(calculated_speed_on_other_road)) {
-            dog->SetPosition(calculated_pos_on_current_road);
-            dog->SetSpeed(calculated_speed_on_current_road);
+            position = calculated_pos_on_current_road;
+            speed = calculated_speed_on_current_road;
         } else if (CalculateAbsSpeed(calculated_speed_on_current_road) < CalculateAbsSpeed(calculated_speed_on_other_road)) {
-            dog->SetPosition(calculated_pos_on_other_road);
-            dog->SetSpeed(calculated_speed_on_other_road);
+            position = calculated_pos_on_other_road;
+            speed = calculated_speed_on_other_road;
         } else {
-            dog->SetPosition(calculated_pos_on_other_road);
-            dog->SetSpeed(calculated_speed_on_other_road);
+            position = calculated_pos_on_other_road;
+            speed = calculated_speed_on_other_road;
         }
     }
 }
@@ -4,83 +4,114 @@
 #include <memory>
 #include <chrono>
 #include <optional>
+#include <string>
+#include <vector>
 
 #include "model_dog.h"
+#include "model_dog_storage.h"
 #include "model_map.h"
 #include "model_loot_item.h"
 #include "extra_data.h"
 #include "loot_generator.h"
 #include "collision_detector.h"
+#include "random_generator.h"
 
 namespace model {
 
-using DogPtr = std::shared_ptr<Dog>;
+const static std::chrono::milliseconds DEFAULT_DOG_RETIREMENT_TIME{60'000};
+
+// Dog that has stood still for the retirement time and has been removed from the session
+struct RetiredDog {
+    uint32_t player_id = 0;
+    std::string name;
+    int score = 0;
+    std::chrono::milliseconds play_time{0};
+};
 
 class GameSession {
 public:
-    GameSession(model::Map& map, std::optional<unsigned> loot_size = std::nullopt)
-        : map_(map) {
+    // Session without seed takes it from std::random_device.
+    // Loot data is taken from the extra data of the snapshot the map belongs to
+    GameSession(model::Map& map, const ExtraData& extra_data, std::optional<unsigned> loot_size = std::nullopt, std::optional<uint64_t> seed = std::nullopt)
+        : map_(map)
+        , dogs_(map.GetSpeed())
+        , random_(seed.has_value() ? RandomGenerator(seed.value()) : RandomGenerator()) {
         
         // Option for testing
         if (loot_size.has_value()) {
             loot_size_ = loot_size.value();
         } else {
-            loot_size_ = model::ExtraData::GetInstance().GetLootValuesByMapId(map.GetId()).size();
+            // Values are copied, so the session keeps scoring by its config after config reload
+            loot_values_ = extra_data.GetLootValuesByMapId(map.GetId());
+            loot_size_ = loot_values_.size();
         }
 
-        SetLootGeneratorData(model::ExtraData::GetInstance().GetLootGeneratorData().period, model::ExtraData::GetInstance().GetLootGeneratorData().probability);
+        const auto& loot_generator_data = extra_data.GetLootGeneratorData();
+        SetLootGeneratorData(loot_generator_data.period, loot_generator_data.probability);
     }
 
-    GameSession(const GameSession& session) = default;
-    GameSession& operator=(const GameSession& session) {
-        name_to_id_ = session.name_to_id_;
-        id_to_dog_ = session.id_to_dog_;
-        available_loot_items_ = session.available_loot_items_;
-        map_ = session.map_;
-        loot_generator_ = session.loot_generator_;
-        return *this;
-    }
+    // Dog handles refer to the session storage, so sessions are not copyable
+    GameSession(const GameSession& session) = delete;
+    GameSession& operator=(const GameSession& session) = delete;
 
     // Getters
     const auto& GetPlayers() const { return name_to_id_; }
     const auto& GetMapId() const { return map_.GetId(); }
     double GetMapSpeed() const { return map_.GetSpeed(); }
     const auto& GetAvailableLoot() const { return available_loot_items_; }
-    int GetPlayerScore(uint32_t id) const { return id_to_dog_.at(id)->GetScore(); }
+    int GetPlayerScore(uint32_t id) const { return dogs_.GetScore(id_to_slot_.at(id)); }
+    const DogStorage& GetDogs() const { return dogs_; }
     std::optional<uint32_t> GetPlayerIdByName(const std::string& name);
     std::chrono::milliseconds GetTimeSinceSave() const { return time_since_save_; }
 
     // Setters
     void SetLootGeneratorData(double base_interval, double probability);
     void SetTimeSinceSave(std::chrono::milliseconds time_since_save);
+    void SetRandomSeed(uint64_t seed) noexcept { random_.Seed(seed); }
+    void SetDogRetirementTime(std::chrono::milliseconds retirement_time) noexcept { dog_retirement_time_ = retirement_time; }
 
     // Update state
-    DogPtr AddDog(Position spawn_point, const std::string& name, uint32_t id);
+    Position GetRandomPosition() { return map_.GetRandomPosition(random_); }
+    Dog AddDog(Position spawn_point, const std::string& name, uint32_t id);
     void UpdateTime(std::chrono::milliseconds delta);
-    void UpdateDogPosition(DogPtr dog, std::chrono::milliseconds delta);
+    void UpdateDogPosition(DogStorage::SlotId slot, std::chrono::milliseconds delta);
     void UpdateLostObjects(std::chrono::milliseconds delta);
+    // Dogs retired since the previous call
+    std::vector<RetiredDog> TakeRetiredDogs();
 
 private:
     bool HasPlayerWithName(const std::string &name) { return name_to_id_.contains(name); }
     void TryGenerateLoot(std::chrono::milliseconds delta);
     void UpdateLootProvider();
     void UpdateCollisions();
+    void RetireIdleDogs(std::chrono::milliseconds delta);
+    void RemoveDog(DogStorage::SlotId slot);
     bool TryUpdateCollisionsWithOffice(const collision_detector::GatheringEvent& gather_event);
     bool TryUpdateCollisionsWithLoot(const collision_detector::GatheringEvent& gather_event);
 
 private:
     std::unordered_map<std::string, uint32_t> name_to_id_;
-    std::unordered_map<uint32_t, DogPtr> id_to_dog_;
+    std::unordered_map<uint32_t, DogStorage::SlotId> id_to_slot_;
+    std::vector<uint32_t> slot_to_id_;
     std::unordered_map<uint32_t, LootItem> available_loot_items_;
     model::Map& map_;
+    DogStorage dogs_;
+
+    // Session-local generator for spawn points and loot, so sessions don't share state
+    RandomGenerator random_;
 
     // Fields for loot
     std::shared_ptr<loot_gen::LootGenerator> loot_generator_;
+    std::vector<int> loot_values_;
     unsigned loot_size_ = 0;
     unsigned loot_id_ = 0;
 
     collision_detector::ItemGathererProviderBase loot_provider_;
 
+    // Fields for retirement
+    std::chrono::milliseconds dog_retirement_time_ = DEFAULT_DOG_RETIREMENT_TIME;
+    std::vector<RetiredDog> retired_dogs_;
+
     // Field to save state
     std::chrono::milliseconds time_since_save_{0};
 };
@@ -1,10 +1,10 @@
 #include "json_helper.h"
 #include "logger.h"
-#include "extra_data.h"
 #include "model_utils.h"
 
 #include <boost/json/serialize.hpp>
 #include <iostream>
+#include <stdexcept>
 
 namespace json_helper {
 
@@ -18,6 +18,8 @@ static const std::string DEFAULT_DOG_SPEED_STRING = "defaultDogSpeed";
 static const std::string LOOT_GENERATOR_STRING = "lootGeneratorConfig";
 static const std::string BAG_CAPACITY_STRING = "bagCapacity";
 static const std::string DEFAULT_BAG_CAPACITY_STRING = "defaultBagCapacity";
+static const std::string MAX_PLAYERS_PER_SESSION_STRING = "maxPlayersPerSession";
+static const std::string DOG_RETIREMENT_TIME_STRING = "dogRetirementTime";
 
 static const std::string POSITION_X = "x";
 static const std::string POSITION_Y = "y";
@@ -36,7 +38,9 @@ static const std::string PROBABILITY = "probability";
 bool AddRoadsToMap(model::Map& currentMap, const boost::json::value& mapObj) {
     bool result = false;
     try {
-        for (const auto& road : mapObj.at(ROADS_STRING).as_array()) {
+        const auto& roads = mapObj.at(ROADS_STRING).as_array();
+        currentMap.ReserveRoads(roads.size());
+        for (const auto& road : roads) {
             const auto& roadObj = road.as_object();
             
             model::Point start;
@@ -64,7 +68,9 @@ bool AddRoadsToMap(model::Map& currentMap, const boost::json::value& mapObj) {
 bool AddBuildingsToMap(model::Map& currentMap, const boost::json::value& mapObj) {
     bool result = false;
     try {
-        for (const auto& building : mapObj.at(BUILDINGS_STRING).as_array()) {
+        const auto& buildings = mapObj.at(BUILDINGS_STRING).as_array();
+        currentMap.ReserveBuildings(buildings.size());
+        for (const auto& building : buildings) {
             const auto& buildingObj = building.as_object();
             
             model::Rectangle rectangle;
@@ -115,10 +121,10 @@ bool AddOfficesToMap(model::Map& currentMap, const boost::json::value& mapObj) {
     return result;
 }
 
-bool AddExtraData(const model::Map& currentMap, const boost::json::value& mapObj) {
+bool AddExtraData(model::Game& game, const model::Map& currentMap, const boost::json::value& mapObj) {
     try {
-        const auto loot_array = mapObj.at(LOOT_TYPES_STRING).as_array();
-        return model::ExtraData::GetInstance().AddLootToMap(currentMap.GetId(), loot_array);
+        const auto& loot_array = mapObj.at(LOOT_TYPES_STRING).as_array();
+        return game.AddLootToMap(currentMap.GetId(), loot_array);
     } catch(std::exception& e) {
         logger::LogErrorMessage(e.what());
         throw std::runtime_error("Extra data hasn't been added!");
@@ -152,14 +158,14 @@ bool SetDefaultDogSpeed(model::Map& currentMap, const boost::json::value& config
     return true;
 }
 
-bool SetLootGeneratorData(const boost::json::value& configObj) {
+bool SetLootGeneratorData(model::Game& game, const boost::json::value& configObj) {
     bool result = false;
     
     try {
         auto val = configObj.at(LOOT_GENERATOR_STRING).as_object();
         auto period = val.at(PERIOD).as_double();
         auto probability = val.at(PROBABILITY).as_double();
-        model::ExtraData::GetInstance().SetLootGeneratorData(period, probability);
+        game.SetLootGeneratorData(period, probability);
         result = true;
     } catch (std::exception& e) {
         logger::LogErrorMessage(e.what());
@@ -193,6 +199,45 @@ bool SetDefaultBagCapacity(model::Map &currentMap, const boost::json::value &con
     return true;
 }
 
+bool SetMaxPlayersPerSession(model::Game& game, const boost::json::value& configObj) {
+    bool result = false;
+
+    try {
+        if (configObj.as_object().contains(MAX_PLAYERS_PER_SESSION_STRING)) {
+            auto max_players = configObj.at(MAX_PLAYERS_PER_SESSION_STRING).as_int64();
+            if (max_players < 0) {
+                throw std::invalid_argument("Max players per session can't be negative");
+            }
+            game.SetMaxPlayersPerSession(static_cast<size_t>(max_players));
+            result = true;
+        }
+    } catch (std::exception& e) {
+        logger::LogErrorMessage(e.what());
+    }
+
+    return result;
+}
+
+bool SetDogRetirementTime(model::Game& game, const boost::json::value& configObj) {
+    bool result = false;
+
+    try {
+        if (configObj.as_object().contains(DOG_RETIREMENT_TIME_STRING)) {
+            // Retirement time is set in seconds
+            auto retirement_time = configObj.at(DOG_RETIREMENT_TIME_STRING).as_double();
+            if (retirement_time < 0.0) {
+                throw std::invalid_argument("Dog retirement time can't be negative");
+            }
+            game.SetDogRetirementTime(std::chrono::milliseconds(static_cast<long long>(retirement_time * 1000)));
+            result = true;
+        }
+    } catch (std::exception& e) {
+        logger::LogErrorMessage(e.what());
+    }
+
+    return result;
+}
+
 boost::json::array CreateRoadsArray(const model::Map& map) {
     boost::json::array roads;
 
@@ -307,6 +352,23 @@ boost::json::object CreateLostObjectValue(unsigned type, const model::Position&
     return val;
 }
 
+boost::json::object CreateTickStatsValue(const metrics::LatencyHistogram& ticks) {
+    const auto to_ms = [](metrics::LatencyHistogram::Duration value) {
+        return std::chrono::duration<double, std::milli>(value).count();
+    };
+
+    boost::json::object val;
+
+    val["ticks"] = ticks.GetCount();
+    val["mean"] = to_ms(ticks.GetMean());
+    val["p50"] = to_ms(ticks.GetPercentile(50.0));
+    val["p90"] = to_ms(ticks.GetPercentile(90.0));
+    val["p99"] = to_ms(ticks.GetPercentile(99.0));
+    val["max"] = to_ms(ticks.GetMax());
+
+    return val;
+}
+
 boost::json::array CreateCoordArray(double x, double y) {
     boost::json::array res;
     res.push_back(x);
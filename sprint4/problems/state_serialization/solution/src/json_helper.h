@@ -8,7 +8,9 @@
 #include <unordered_map>
 
 #include "model_map.h"
+#include "game.h"
 #include "model_loot_item.h"
+#include "latency_histogram.h"
 
 namespace json_helper {
 
@@ -18,12 +20,14 @@ using tcp = net::ip::tcp;
 bool AddRoadsToMap(model::Map& currentMap, const boost::json::value& mapObj);
 bool AddBuildingsToMap(model::Map& currentMap, const boost::json::value& mapObj);
 bool AddOfficesToMap(model::Map& currentMap, const boost::json::value& mapObj);
-bool AddExtraData(const model::Map& currentMap, const boost::json::value& mapObj);
+bool AddExtraData(model::Game& game, const model::Map& currentMap, const boost::json::value& mapObj);
 bool SetMapDogSpeed(model::Map& currentMap, const boost::json::value& mapObj);
 bool SetDefaultDogSpeed(model::Map& currentMap, const boost::json::value& configObj);
-bool SetLootGeneratorData(const boost::json::value& configObj);
+bool SetLootGeneratorData(model::Game& game, const boost::json::value& configObj);
 bool SetMapBagCapacity(model::Map& currentMap, const boost::json::value& mapObj);
 bool SetDefaultBagCapacity(model::Map& currentMap, const boost::json::value& configObj);
+bool SetMaxPlayersPerSession(model::Game& game, const boost::json::value& configObj);
+bool SetDogRetirementTime(model::Game& game, const boost::json::value& configObj);
 
 boost::json::array CreateRoadsArray(const model::Map& map);
 boost::json::array CreateBuildingsArray(const model::Map& map);
@@ -43,6 +47,8 @@ boost::json::object CreateNetworkErrorValue(int code, const std::string& text, c
 boost::json::object CreateRequestValue(const tcp::endpoint& endpoint, const std::string& uri, const std::string& method);
 boost::json::object CreateResponseValue(int response_time, int code, const std::string& content_type);
 boost::json::object CreateLostObjectValue(unsigned type, const model::Position& position);
+// Tick count and tick time percentiles in milliseconds
+boost::json::object CreateTickStatsValue(const metrics::LatencyHistogram& ticks);
 
 boost::json::array CreateCoordArray(double x, double y);
 boost::json::array CreateBagArray(const std::unordered_map<unsigned, model::LootItem>& bag);
@@ -1,64 +1,101 @@
 #include "json_loader.h"
 #include "json_helper.h"
+#include "map_cache.h"
+#include "logger.h"
 
-#include <boost/json/parse.hpp>
-#include <fstream>
-#include <sstream>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/json/monotonic_resource.hpp>
+#include <boost/json/stream_parser.hpp>
 #include <iostream>
 
 namespace json_loader {
 
-model::Game LoadGame(const std::filesystem::path& json_path) {
-    // Загрузить содержимое файла json_path, например, в виде строки
-    // Распарсить строку как JSON, используя boost::json::parse
-    // Загрузить модель игры из файла
-    model::Game game;
+namespace {
 
-    try {
-        std::ifstream fStream(json_path);
-        if (!fStream) {
-            throw std::runtime_error("Couldn't open json file!");
-        }
+namespace ipc = boost::interprocess;
 
-        std::stringstream buf;
-        buf << fStream.rdbuf();
+// Parses the config without copying it: the file is mapped into memory and fed to the
+// stream parser. The whole DOM lives in the monotonic resource and is released at once
+boost::json::value ParseConfig(const std::filesystem::path& json_path, boost::json::monotonic_resource& resource) {
+    std::error_code fs_ec;
+    const auto file_size = std::filesystem::file_size(json_path, fs_ec);
+    if (fs_ec) {
+        throw std::runtime_error("Couldn't open json file!");
+    }
+    if (file_size == 0) {
+        throw std::runtime_error("Couldn't parse json file!");
+    }
 
-        boost::system::error_code ec;
-        auto configObj = boost::json::parse(buf.str(), ec);
+    ipc::file_mapping file(json_path.string().c_str(), ipc::read_only);
+    ipc::mapped_region region(file, ipc::read_only);
 
-        if (ec) {
-            throw std::runtime_error("Couldn't parse json file!");
-        }
+    boost::system::error_code ec;
+    boost::json::stream_parser parser;
+    parser.reset(&resource);
+    parser.write(static_cast<const char*>(region.get_address()), region.get_size(), ec);
+    if (!ec) {
+        parser.finish(ec);
+    }
 
-        if (!json_helper::SetLootGeneratorData(configObj)) {
-            throw std::runtime_error("Loot generator data isn't set!");
-        }
+    if (ec) {
+        throw std::runtime_error("Couldn't parse json file!");
+    }
 
-        auto mapsObj = configObj.as_object()["maps"];
-        for (const auto& map : mapsObj.as_array()) {
-            const auto& mapObj = map.as_object();
-            
-            auto id = mapObj.at("id").as_string();
-            auto name = mapObj.at("name").as_string();
+    return parser.release();
+}
+
+// Fills the game by the config, throws on invalid config.
+// Everything is loaded into the game's own snapshot, so a failed load leaves the served game intact
+void FillGame(model::Game& game, const std::filesystem::path& json_path) {
+    boost::json::monotonic_resource resource;
+    const auto configObj = ParseConfig(json_path, resource);
+
+    if (!json_helper::SetLootGeneratorData(game, configObj)) {
+        throw std::runtime_error("Loot generator data isn't set!");
+    }
 
-            model::Map::Id currentId({id.data(), id.size()});
-            model::Map currentMap(currentId, { name.data(), name.size() });
+    json_helper::SetMaxPlayersPerSession(game, configObj);
+    json_helper::SetDogRetirementTime(game, configObj);
 
-            json_helper::AddRoadsToMap(currentMap, mapObj);
-            json_helper::AddBuildingsToMap(currentMap, mapObj);
-            json_helper::AddOfficesToMap(currentMap, mapObj);
-            json_helper::AddExtraData(currentMap, mapObj);
+    const auto& mapsObj = configObj.at("maps");
+    // Helpers take the map value itself: passing the object would copy it into a temporary value
+    for (const auto& mapObj : mapsObj.as_array()) {
+        const auto& id = mapObj.at("id").as_string();
+        const auto& name = mapObj.at("name").as_string();
 
-            if (!json_helper::SetMapDogSpeed(currentMap, mapObj)) {
-                json_helper::SetDefaultDogSpeed(currentMap, configObj);
-            }
+        model::Map::Id currentId({id.data(), id.size()});
+        model::Map currentMap(currentId, { name.data(), name.size() });
 
-            if (!json_helper::SetMapBagCapacity(currentMap, mapObj)) {
-                json_helper::SetDefaultBagCapacity(currentMap, configObj);
-            }
+        if (!json_helper::AddRoadsToMap(currentMap, mapObj)
+            || !json_helper::AddBuildingsToMap(currentMap, mapObj)
+            || !json_helper::AddOfficesToMap(currentMap, mapObj)
+            || !json_helper::AddExtraData(game, currentMap, mapObj)) {
+            throw std::runtime_error("Map " + std::string(id.data(), id.size()) + " is invalid!");
+        }
 
-            game.AddMap(std::move(currentMap));
+        if (!json_helper::SetMapDogSpeed(currentMap, mapObj)) {
+            json_helper::SetDefaultDogSpeed(currentMap, configObj);
         }
+
+        if (!json_helper::SetMapBagCapacity(currentMap, mapObj)) {
+            json_helper::SetDefaultBagCapacity(currentMap, configObj);
+        }
+
+        game.AddMap(std::move(currentMap));
+    }
+}
+
+}  // namespace
+
+model::Game LoadGame(const std::filesystem::path& json_path) {
+    // Загрузить содержимое файла json_path через отображение в память
+    // Распарсить его потоковым парсером boost::json::stream_parser
+    // Загрузить модель игры из файла
+    model::Game game;
+
+    try {
+        FillGame(game, json_path);
     } catch (std::exception& e) {
         std::cout << e.what() << std::endl;
     }
@@ -66,4 +103,36 @@ model::Game LoadGame(const std::filesystem::path& json_path) {
     return game;
 }
 
+model::Game LoadGame(const std::filesystem::path& json_path, const std::filesystem::path& map_cache_path) {
+    if (auto game = TryLoadGame(json_path, map_cache_path)) {
+        return std::move(game.value());
+    }
+    return model::Game{};
+}
+
+std::optional<model::Game> TryLoadGame(const std::filesystem::path& json_path, const std::filesystem::path& map_cache_path) {
+    if (!map_cache_path.empty()) {
+        if (auto game = map_cache::LoadGame(map_cache_path, json_path)) {
+            return game;
+        }
+    }
+
+    try {
+        model::Game game;
+        FillGame(game, json_path);
+        if (game.GetMaps()->empty()) {
+            throw std::runtime_error("Config has no maps!");
+        }
+
+        if (!map_cache_path.empty()) {
+            map_cache::SaveGame(game, map_cache_path, json_path);
+        }
+        return std::optional<model::Game>(std::move(game));
+    } catch (std::exception& e) {
+        logger::LogErrorMessage(e.what());
+    }
+
+    return std::nullopt;
+}
+
 }  // namespace json_loader
@@ -1,10 +1,15 @@
 #pragma once
 
 #include <filesystem>
+#include <optional>
 #include "game.h"
 
 namespace json_loader {
     
 model::Game LoadGame(const std::filesystem::path& json_path);
+// Loads game from the map cache if it's valid for the config, otherwise parses the config and rebuilds the cache
+model::Game LoadGame(const std::filesystem::path& json_path, const std::filesystem::path& map_cache_path);
+// Same as LoadGame, but returns nullopt if the config is invalid or has no maps. Empty cache path disables the cache
+std::optional<model::Game> TryLoadGame(const std::filesystem::path& json_path, const std::filesystem::path& map_cache_path = {});
 
 }  // namespace json_loader
@@ -0,0 +1,83 @@
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace metrics {
+
+namespace {
+
+constexpr size_t BUCKETS_COUNT = (64 - LatencyHistogram::SUB_BUCKET_BITS) * LatencyHistogram::SUB_BUCKETS_COUNT;
+
+}  // namespace
+
+LatencyHistogram::LatencyHistogram()
+    : buckets_(BUCKETS_COUNT, 0) {}
+
+void LatencyHistogram::Record(Duration value) {
+    const auto us = static_cast<uint64_t>(std::max<Duration::rep>(value.count(), 0));
+    ++buckets_[GetBucketIndex(us)];
+    ++count_;
+    min_ = std::min(min_, us);
+    max_ = std::max(max_, us);
+    sum_ += us;
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    sum_ += other.sum_;
+}
+
+LatencyHistogram::Duration LatencyHistogram::GetMin() const noexcept {
+    return Duration{count_ ? min_ : 0};
+}
+
+LatencyHistogram::Duration LatencyHistogram::GetMean() const noexcept {
+    return Duration{count_ ? sum_ / count_ : 0};
+}
+
+LatencyHistogram::Duration LatencyHistogram::GetPercentile(double percentile) const {
+    if (count_ == 0) {
+        return Duration{0};
+    }
+
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * count_)));
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        seen += buckets_[i];
+        if (seen >= rank) {
+            return Duration{std::min(GetBucketHighestValue(i), max_)};
+        }
+    }
+    return Duration{max_};
+}
+
+// Values below 2 * SUB_BUCKETS_COUNT are kept exactly. A bigger value keeps
+// SUB_BUCKET_BITS bits after its highest bit, the rest of bits is the bucket width
+size_t LatencyHistogram::GetBucketIndex(uint64_t value) noexcept {
+    if (value < 2 * SUB_BUCKETS_COUNT) {
+        return value;
+    }
+    const int shift = std::bit_width(value) - 1 - SUB_BUCKET_BITS;
+    const uint64_t mantissa = value >> shift;
+    return (shift + 1) * SUB_BUCKETS_COUNT + (mantissa - SUB_BUCKETS_COUNT);
+}
+
+uint64_t LatencyHistogram::GetBucketHighestValue(size_t index) noexcept {
+    if (index < 2 * SUB_BUCKETS_COUNT) {
+        return index;
+    }
+    const int shift = static_cast<int>(index / SUB_BUCKETS_COUNT) - 1;
+    const uint64_t mantissa = SUB_BUCKETS_COUNT + index % SUB_BUCKETS_COUNT;
+    return ((mantissa + 1) << shift) - 1;
+}
+
+}  // namespace metrics
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace metrics {
+
+// Log-linear histogram of latencies with microsecond resolution.
+// Every power of two range is split into SUB_BUCKETS_COUNT buckets,
+// so a percentile is reported with less than 1% relative error
+class LatencyHistogram {
+public:
+    using Duration = std::chrono::microseconds;
+
+    constexpr static int SUB_BUCKET_BITS = 7;
+    constexpr static uint64_t SUB_BUCKETS_COUNT = uint64_t{1} << SUB_BUCKET_BITS;
+
+    LatencyHistogram();
+
+    void Record(Duration value);
+    void Merge(const LatencyHistogram& other);
+
+    uint64_t GetCount() const noexcept { return count_; }
+    Duration GetMin() const noexcept;
+    Duration GetMax() const noexcept { return Duration{max_}; }
+    Duration GetMean() const noexcept;
+    // Percentile is in [0, 100], the highest value of the percentile bucket is returned
+    Duration GetPercentile(double percentile) const;
+
+private:
+    static size_t GetBucketIndex(uint64_t value) noexcept;
+    static uint64_t GetBucketHighestValue(size_t index) noexcept;
+
+private:
+    std::vector<uint64_t> buckets_;
+    uint64_t count_ = 0;
+    uint64_t min_ = UINT64_MAX;
+    uint64_t max_ = 0;
+    // Sum of values in microseconds doesn't overflow for ~5e5 years of latencies
+    uint64_t sum_ = 0;
+};
+
+}  // namespace metrics
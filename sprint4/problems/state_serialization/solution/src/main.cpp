@@ -2,6 +2,9 @@
 //
 #include <boost/asio/io_context.hpp>
 #include <iostream>
+#include <cstdlib>
+#include <functional>
+#include <memory>
 #include <thread>
 #include <boost/asio/signal_set.hpp>
 
@@ -10,6 +13,9 @@
 #include "request_handler.h"
 #include "logger.h"
 #include "command_line_parser.h"
+#include "config_reloader.h"
+#include "postgres.h"
+#include "records_writer.h"
 
 using namespace std::literals;
 namespace net = boost::asio;
@@ -17,6 +23,8 @@ namespace sys = http_server::sys;
 
 namespace {
 
+constexpr const char DB_URL_ENV_NAME[]{"GAME_DB_URL"};
+
 // Запускает функцию fn на n потоках, включая текущий
 template <typename Fn>
 int RunWorkers(unsigned workersCount, const Fn& fn) {
@@ -54,12 +62,27 @@ int main(int argc, const char* argv[]) {
 
         if (auto args = command_line::ParseCommandLine(argc, argv)) {
             // 1. Загружаем карту из файла и построить модель игры
-            model::Game game = json_loader::LoadGame(args.value().config_file);
+            model::Game game = args.value().map_cache_file.empty()
+                ? json_loader::LoadGame(args.value().config_file)
+                : json_loader::LoadGame(args.value().config_file, args.value().map_cache_file);
+            if (args.value().seed) {
+                game.SetRandomSeed(args.value().seed.value());
+            }
 
             // 2. Инициализируем io_context
             const unsigned numThreads = std::thread::hardware_concurrency();
             net::io_context ioc(numThreads);
 
+            // Records of retired players are kept in the database, if it's configured
+            std::unique_ptr<postgres::Database> database;
+            std::unique_ptr<records::RecordsWriter> records_writer;
+            if (const auto* db_url = std::getenv(DB_URL_ENV_NAME)) {
+                database = std::make_unique<postgres::Database>(db_url, std::max(1u, numThreads));
+                records_writer = std::make_unique<records::RecordsWriter>(database->GetRecords());
+            } else {
+                logger::LogErrorMessage(std::string(DB_URL_ENV_NAME) + " environment variable isn't set, records aren't saved");
+            }
+
             // 3. Добавляем асинхронный обработчик сигналов SIGINT и SIGTERM
             // Подписываемся на сигналы и при их получении завершаем работу сервера
             net::signal_set signals(ioc, SIGINT, SIGTERM);
@@ -70,8 +93,24 @@ int main(int argc, const char* argv[]) {
                 }
             });
 
+            // Перечитываем конфиг по сигналу SIGHUP, не останавливая сервер
+            config_reloader::ConfigReloader reloader(game, args.value().config_file, args.value().map_cache_file);
+            net::signal_set reload_signals(ioc, SIGHUP);
+            std::function<void(const sys::error_code&, int)> on_reload_signal;
+            on_reload_signal = [&](const sys::error_code& ec, [[maybe_unused]] int signalNumber) {
+                if (!ec) {
+                    if (!reloader.ReloadAsync()) {
+                        logger::LogErrorMessage("Config reload is already in progress");
+                    }
+                    reload_signals.async_wait(on_reload_signal);
+                }
+            };
+            reload_signals.async_wait(on_reload_signal);
+
             // 4. Создаём обработчик HTTP-запросов и связываем его с моделью игры
-            auto handler = std::make_shared<http_handler::RequestHandler>(game, ioc, args.value());
+            auto handler = std::make_shared<http_handler::RequestHandler>(game, ioc, args.value(),
+                                                                          database ? &database->GetRecords() : nullptr,
+                                                                          records_writer.get());
 
             // 5. Запустить обработчик HTTP-запросов, делегируя их обработчику запросов
             const auto address = net::ip::make_address("0.0.0.0");
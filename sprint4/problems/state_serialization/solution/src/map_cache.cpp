@@ -0,0 +1,318 @@
+#include "map_cache.h"
+#include "extra_data.h"
+#include "logger.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/json/serialize.hpp>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace map_cache {
+
+namespace {
+
+namespace fs = std::filesystem;
+namespace ipc = boost::interprocess;
+
+using namespace std::literals;
+
+constexpr char MAGIC[4] = {'G', 'S', 'M', 'C'};
+// Increment on every change of the payload layout
+constexpr uint32_t FORMAT_VERSION = 2;
+// Blob is written in host byte order, so it's rejected on a host with another one
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t reserved;
+    uint64_t config_size;
+    int64_t config_mtime;
+    uint64_t payload_size;
+    uint64_t payload_checksum;
+};
+
+// FNV-1a over 8-byte words, the tail is hashed bytewise
+uint64_t CalculateChecksum(const char* data, size_t size) {
+    constexpr uint64_t OFFSET_BASIS = 0xcbf29ce484222325ULL;
+    constexpr uint64_t PRIME = 0x100000001b3ULL;
+
+    uint64_t hash = OFFSET_BASIS;
+    size_t pos = 0;
+    for (; pos + sizeof(uint64_t) <= size; pos += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + pos, sizeof(word));
+        hash = (hash ^ word) * PRIME;
+    }
+    for (; pos < size; ++pos) {
+        hash = (hash ^ static_cast<unsigned char>(data[pos])) * PRIME;
+    }
+    return hash;
+}
+
+std::optional<std::pair<uint64_t, int64_t>> GetConfigStamp(const fs::path& config_path) {
+    std::error_code ec;
+    const auto size = fs::file_size(config_path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    const auto mtime = fs::last_write_time(config_path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    return std::make_pair(static_cast<uint64_t>(size), static_cast<int64_t>(mtime.time_since_epoch().count()));
+}
+
+class BlobWriter {
+public:
+    template <typename T>
+    void Put(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        buffer_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void PutString(std::string_view str) {
+        Put(static_cast<uint64_t>(str.size()));
+        buffer_.append(str.data(), str.size());
+    }
+
+    const std::string& GetBuffer() const noexcept {
+        return buffer_;
+    }
+
+private:
+    std::string buffer_;
+};
+
+// Reads values written by BlobWriter. Data may be unaligned, so values are copied out
+class BlobReader {
+public:
+    BlobReader(const char* data, size_t size)
+        : pos_(data)
+        , end_(data + size) {}
+
+    template <typename T>
+    T Get() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value;
+        std::memcpy(&value, Take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    std::string_view GetString() {
+        const auto size = Get<uint64_t>();
+        return {Take(size), size};
+    }
+
+    bool IsEnd() const noexcept {
+        return pos_ == end_;
+    }
+
+private:
+    const char* Take(size_t size) {
+        if (static_cast<size_t>(end_ - pos_) < size) {
+            throw std::runtime_error("Map cache is truncated");
+        }
+        const char* result = pos_;
+        pos_ += size;
+        return result;
+    }
+
+private:
+    const char* pos_;
+    const char* end_;
+};
+
+void WriteMap(BlobWriter& writer, const model::Map& map, const model::ExtraData& extra_data) {
+    writer.PutString(*map.GetId());
+    writer.PutString(map.GetName());
+    writer.Put(map.GetSpeed());
+    writer.Put(static_cast<uint64_t>(map.GetBagCapacity()));
+
+    const auto& roads = map.GetRoads();
+    const auto& boarders = map.GetRoadBoarders();
+    writer.Put(static_cast<uint64_t>(roads.size()));
+    for (size_t i = 0; i < roads.size(); ++i) {
+        writer.Put(roads[i].GetStart());
+        writer.Put(roads[i].GetEnd());
+        writer.Put(boarders[i].GetStartPoint());
+        writer.Put(boarders[i].GetEndPoint());
+    }
+
+    writer.Put(static_cast<uint64_t>(map.GetBuildings().size()));
+    for (const auto& building : map.GetBuildings()) {
+        writer.Put(building.GetBounds());
+    }
+
+    writer.Put(static_cast<uint64_t>(map.GetOffices().size()));
+    for (const auto& office : map.GetOffices()) {
+        writer.PutString(*office.GetId());
+        writer.Put(office.GetPosition());
+        writer.Put(office.GetOffset());
+    }
+
+    // Loot types are sent to clients as is, so they are kept as JSON text
+    writer.PutString(boost::json::serialize(extra_data.GetLootByMapId(map.GetId())));
+}
+
+model::Map ReadMap(BlobReader& reader, model::Game& game) {
+    const auto id = reader.GetString();
+    const auto name = reader.GetString();
+    model::Map map{model::Map::Id{std::string(id)}, std::string(name)};
+    map.SetSpeed(reader.Get<double>());
+    map.SetBagCapacity(reader.Get<uint64_t>());
+
+    const auto roads_count = reader.Get<uint64_t>();
+    map.ReserveRoads(roads_count);
+    for (uint64_t i = 0; i < roads_count; ++i) {
+        const auto start = reader.Get<model::Point>();
+        const auto end = reader.Get<model::Point>();
+        const auto boarder_start = reader.Get<model::Position>();
+        const auto boarder_end = reader.Get<model::Position>();
+
+        const model::Road road = start.y == end.y
+            ? model::Road(model::Road::HORIZONTAL, start, end.x)
+            : model::Road(model::Road::VERTICAL, start, end.y);
+        map.AddRoad(road, model::RoadBoarders(boarder_start, boarder_end));
+    }
+
+    const auto buildings_count = reader.Get<uint64_t>();
+    map.ReserveBuildings(buildings_count);
+    for (uint64_t i = 0; i < buildings_count; ++i) {
+        map.AddBuilding(model::Building(reader.Get<model::Rectangle>()));
+    }
+
+    const auto offices_count = reader.Get<uint64_t>();
+    for (uint64_t i = 0; i < offices_count; ++i) {
+        const auto office_id = reader.GetString();
+        const auto position = reader.Get<model::Point>();
+        const auto offset = reader.Get<model::Offset>();
+        map.AddOffice(model::Office(model::Office::Id(std::string(office_id)), position, offset));
+    }
+
+    const auto loot = boost::json::parse(reader.GetString());
+    if (!game.AddLootToMap(map.GetId(), loot.as_array())) {
+        throw std::runtime_error("Map cache has invalid loot types");
+    }
+
+    return map;
+}
+
+}  // namespace
+
+bool SaveGame(const model::Game& game, const fs::path& cache_path, const fs::path& config_path) {
+    try {
+        const auto stamp = GetConfigStamp(config_path);
+        if (!stamp) {
+            throw std::runtime_error("Config file for the map cache isn't found");
+        }
+
+        // Maps and loot data are written from one snapshot
+        const auto snapshot = game.GetMapsSnapshot();
+
+        BlobWriter writer;
+        const auto& loot_generator_data = snapshot->extra_data.GetLootGeneratorData();
+        writer.Put(loot_generator_data.period);
+        writer.Put(loot_generator_data.probability);
+        writer.Put(static_cast<uint64_t>(game.GetMaxPlayersPerSession()));
+        writer.Put(static_cast<int64_t>(game.GetDogRetirementTime().count()));
+
+        writer.Put(static_cast<uint64_t>(snapshot->maps.size()));
+        for (const auto& map : snapshot->maps) {
+            WriteMap(writer, map, snapshot->extra_data);
+        }
+
+        const auto& payload = writer.GetBuffer();
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = FORMAT_VERSION;
+        header.byte_order = BYTE_ORDER_MARK;
+        header.config_size = stamp->first;
+        header.config_mtime = stamp->second;
+        header.payload_size = payload.size();
+        header.payload_checksum = CalculateChecksum(payload.data(), payload.size());
+
+        // Cache is replaced atomically, so a crash while writing doesn't leave a broken file
+        auto temp_path = cache_path;
+        temp_path += ".tmp";
+        {
+            std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            out.write(payload.data(), payload.size());
+            if (!out) {
+                throw std::runtime_error("Couldn't write map cache file");
+            }
+        }
+        fs::rename(temp_path, cache_path);
+        return true;
+    } catch (const std::exception& e) {
+        logger::LogErrorMessage(e.what());
+    }
+
+    return false;
+}
+
+std::optional<model::Game> LoadGame(const fs::path& cache_path, const fs::path& config_path) {
+    try {
+        std::error_code ec;
+        const auto stamp = GetConfigStamp(config_path);
+        const auto cache_size = fs::file_size(cache_path, ec);
+        if (!stamp || ec || cache_size < sizeof(Header)) {
+            return std::nullopt;
+        }
+
+        ipc::file_mapping file(cache_path.string().c_str(), ipc::read_only);
+        ipc::mapped_region region(file, ipc::read_only);
+        const char* data = static_cast<const char*>(region.get_address());
+
+        Header header;
+        std::memcpy(&header, data, sizeof(header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0
+            || header.version != FORMAT_VERSION
+            || header.byte_order != BYTE_ORDER_MARK
+            || header.config_size != stamp->first
+            || header.config_mtime != stamp->second
+            || header.payload_size != region.get_size() - sizeof(Header)) {
+            return std::nullopt;
+        }
+
+        const char* payload = data + sizeof(Header);
+        if (CalculateChecksum(payload, header.payload_size) != header.payload_checksum) {
+            logger::LogErrorMessage("Map cache checksum mismatch");
+            return std::nullopt;
+        }
+
+        // Maps and loot data go to the snapshot of the loaded game only,
+        // so a broken cache leaves nothing behind
+        BlobReader reader(payload, header.payload_size);
+        model::Game game;
+
+        const auto period = reader.Get<long long>();
+        const auto probability = reader.Get<double>();
+        game.SetLootGeneratorData(period, probability);
+        game.SetMaxPlayersPerSession(reader.Get<uint64_t>());
+        game.SetDogRetirementTime(std::chrono::milliseconds(reader.Get<int64_t>()));
+
+        const auto maps_count = reader.Get<uint64_t>();
+        for (uint64_t i = 0; i < maps_count; ++i) {
+            game.AddMap(ReadMap(reader, game));
+        }
+
+        if (!reader.IsEnd()) {
+            throw std::runtime_error("Map cache has unexpected trailing data");
+        }
+
+        return game;
+    } catch (const std::exception& e) {
+        logger::LogErrorMessage(e.what());
+    }
+
+    return std::nullopt;
+}
+
+}  // namespace map_cache
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+
+#include "game.h"
+
+namespace map_cache {
+
+// Binary cache of fully built maps: roads with boarders, buildings, offices and loot data.
+// The cache is bound to the config it was built from (size and modification time),
+// so a changed config invalidates it.
+
+// Writes maps of the game into the cache file. Returns false if the cache can't be written
+bool SaveGame(const model::Game& game, const std::filesystem::path& cache_path, const std::filesystem::path& config_path);
+
+// Builds the game from the cache file. Returns nullopt if there is no cache,
+// or it is built by another version, for another config, or corrupted
+std::optional<model::Game> LoadGame(const std::filesystem::path& cache_path, const std::filesystem::path& config_path);
+
+}  // namespace map_cache
@@ -5,12 +5,12 @@
 namespace model {
 void Dog::SetDirection(Direction dir) {
     if (dir != Direction::NO_DIRECTION) {
-        direction_ = dir; 
+        storage_->GetDirection(slot_) = dir;
     }
 }
 
 std::string Dog::GetDirectionString() const {
-    switch (direction_) {
+    switch (GetDirection()) {
         case Direction::EAST: return "R";
         case Direction::WEST: return "L";
         case Direction::NORTH: return "U";
@@ -21,24 +21,26 @@ std::string Dog::GetDirectionString() const {
 }
 
 void Dog::SetSpeedByDirection(Direction dir) {
+    const double map_speed = storage_->GetMapSpeed();
+
     switch (dir) {
         case Direction::EAST: {
-            SetSpeed({map_speed_, 0});
+            SetSpeed({map_speed, 0});
             break;
         }
 
         case Direction::WEST: {
-            SetSpeed({(-1) * map_speed_, 0});
+            SetSpeed({(-1) * map_speed, 0});
             break;
         }
 
         case Direction::NORTH: {
-            SetSpeed({0, (-1) * map_speed_});
+            SetSpeed({0, (-1) * map_speed});
             break;
         }
 
         case Direction::SOUTH: {
-            SetSpeed({0, map_speed_});
+            SetSpeed({0, map_speed});
             break;
         }
 
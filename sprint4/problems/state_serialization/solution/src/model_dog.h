@@ -2,51 +2,45 @@
 
 #include "model_utils.h"
 #include "model_loot_item.h"
+#include "model_dog_storage.h"
 
 #include <string>
 #include <unordered_map>
 
 namespace model {
 
+// Lightweight handle to the dog state kept in the session DogStorage.
+// Copies of the handle refer to the same dog.
 class Dog {
 public:
-    Dog(const std::string& name, Position position, double map_speed, Direction direction)
-        : name_(name)
-        , position_(position)
-        , prev_position_(position)
-        , map_speed_(map_speed)
-        , direction_(direction) {}
+    Dog(DogStorage& storage, DogStorage::SlotId slot)
+        : storage_(&storage)
+        , slot_(slot) {}
 
     // Setters
     void SetDirection(Direction dir);
     void SetSpeedByDirection(Direction dir);
-    void SetPosition(Position pos) { position_.x = pos.x; position_.y = pos.y; };
-    void SetPrevPosition(Position pos) { prev_position_.x = pos.x; prev_position_.y = pos.y; };
-    void SetSpeed(Speed speed) { speed_.v_x = speed.v_x; speed_.v_y = speed.v_y; }
-    void AddLootIntoBag(unsigned id, const LootItem& loot) { bag_[id] = loot; }
-    void RemoveLootFromBag() { bag_.clear(); }
-    void UpdateScore(int points) { score_ += points; }
+    void SetPosition(Position pos) { storage_->GetPosition(slot_) = pos; };
+    void SetPrevPosition(Position pos) { storage_->GetPrevPosition(slot_) = pos; };
+    void SetSpeed(Speed speed) { storage_->GetSpeed(slot_) = speed; }
+    void AddLootIntoBag(unsigned id, const LootItem& loot) { storage_->GetBag(slot_)[id] = loot; }
+    void RemoveLootFromBag() { storage_->GetBag(slot_).clear(); }
+    void UpdateScore(int points) { storage_->GetScore(slot_) += points; }
 
     // Getters
-    const Position& GetPosition() const { return position_; }
-    const Position& GetPrevPosition() const { return prev_position_; }
-    const Speed& GetSpeed() const { return speed_; }
-    Direction GetDirection() const { return direction_; }
-    const std::string& GetFullName() const { return name_; }
+    DogStorage::SlotId GetSlot() const { return slot_; }
+    const Position& GetPosition() const { return storage_->GetPosition(slot_); }
+    const Position& GetPrevPosition() const { return storage_->GetPrevPosition(slot_); }
+    const Speed& GetSpeed() const { return storage_->GetSpeed(slot_); }
+    Direction GetDirection() const { return storage_->GetDirection(slot_); }
+    const std::string& GetFullName() const { return storage_->GetName(slot_); }
     std::string GetDirectionString() const;
-    const auto& GetBagContent() const { return bag_; }
-    const int GetScore() const { return score_; }
+    const auto& GetBagContent() const { return storage_->GetBag(slot_); }
+    const int GetScore() const { return storage_->GetScore(slot_); }
 
 private:
-    const double map_speed_;
-    std::string name_;
-
-    Position position_;
-    Position prev_position_;
-    Speed speed_{0.0, 0.0};
-    Direction direction_ = Direction::NO_DIRECTION;
-    std::unordered_map<unsigned, LootItem> bag_;
-    int score_ = 0;
+    DogStorage* storage_;
+    DogStorage::SlotId slot_;
 };
 
 }
@@ -0,0 +1,73 @@
+#include "model_dog_storage.h"
+
+namespace model {
+
+DogStorage::SlotId DogStorage::Add(const std::string& name, Position position, Direction direction) {
+    if (!free_slots_.empty()) {
+        const auto slot = free_slots_.back();
+        free_slots_.pop_back();
+
+        positions_[slot] = position;
+        prev_positions_[slot] = position;
+        speeds_[slot] = {0.0, 0.0};
+        directions_[slot] = direction;
+        idle_times_[slot] = {};
+        play_times_[slot] = {};
+        alive_[slot] = true;
+
+        names_[slot] = name;
+        bags_[slot].clear();
+        scores_[slot] = 0;
+
+        return slot;
+    }
+
+    const auto slot = static_cast<SlotId>(positions_.size());
+
+    positions_.push_back(position);
+    prev_positions_.push_back(position);
+    speeds_.push_back({0.0, 0.0});
+    directions_.push_back(direction);
+    idle_times_.emplace_back();
+    play_times_.emplace_back();
+    alive_.push_back(true);
+
+    names_.push_back(name);
+    bags_.emplace_back();
+    scores_.push_back(0);
+
+    return slot;
+}
+
+void DogStorage::Remove(SlotId slot) {
+    if (!alive_[slot]) {
+        return;
+    }
+
+    alive_[slot] = false;
+    speeds_[slot] = {0.0, 0.0};
+    prev_positions_[slot] = positions_[slot];
+
+    // Cold data is released right away, the slot itself waits for the next dog
+    std::string().swap(names_[slot]);
+    Bag().swap(bags_[slot]);
+    scores_[slot] = 0;
+
+    free_slots_.push_back(slot);
+}
+
+void DogStorage::Reserve(size_t count) {
+    positions_.reserve(count);
+    prev_positions_.reserve(count);
+    speeds_.reserve(count);
+    directions_.reserve(count);
+    idle_times_.reserve(count);
+    play_times_.reserve(count);
+    alive_.reserve(count);
+
+    names_.reserve(count);
+    bags_.reserve(count);
+    scores_.reserve(count);
+}
+
+}
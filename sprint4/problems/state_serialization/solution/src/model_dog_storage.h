@@ -0,0 +1,81 @@
+#pragma once
+
+#include "model_utils.h"
+#include "model_loot_item.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace model {
+
+// Structure-of-arrays storage of session dogs.
+// Kinematic state is kept in contiguous arrays indexed by a dense slot id,
+// so that tick loops are linear sweeps. Cold data (name, bag, score) is kept
+// separately and is touched only by collisions and API requests.
+// Slots of removed dogs are recycled through a free list, so the storage
+// doesn't grow when players come and go.
+class DogStorage {
+public:
+    using SlotId = uint32_t;
+    using Bag = std::unordered_map<unsigned, LootItem>;
+
+    explicit DogStorage(double map_speed = DEFAULT_DOG_SPEED)
+        : map_speed_(map_speed) {}
+
+    SlotId Add(const std::string& name, Position position, Direction direction);
+    void Remove(SlotId slot);
+    void Reserve(size_t count);
+
+    // Number of slots including free ones, tick loops have to skip the free slots
+    size_t Size() const noexcept { return positions_.size(); }
+    size_t AliveCount() const noexcept { return positions_.size() - free_slots_.size(); }
+    bool IsAlive(SlotId slot) const { return alive_[slot]; }
+    double GetMapSpeed() const noexcept { return map_speed_; }
+
+    // Hot data
+    Position& GetPosition(SlotId slot) { return positions_[slot]; }
+    const Position& GetPosition(SlotId slot) const { return positions_[slot]; }
+    Position& GetPrevPosition(SlotId slot) { return prev_positions_[slot]; }
+    const Position& GetPrevPosition(SlotId slot) const { return prev_positions_[slot]; }
+    Speed& GetSpeed(SlotId slot) { return speeds_[slot]; }
+    const Speed& GetSpeed(SlotId slot) const { return speeds_[slot]; }
+    Direction& GetDirection(SlotId slot) { return directions_[slot]; }
+    Direction GetDirection(SlotId slot) const { return directions_[slot]; }
+    std::chrono::milliseconds& GetIdleTime(SlotId slot) { return idle_times_[slot]; }
+    std::chrono::milliseconds& GetPlayTime(SlotId slot) { return play_times_[slot]; }
+
+    const std::vector<Position>& GetPositions() const noexcept { return positions_; }
+    const std::vector<Position>& GetPrevPositions() const noexcept { return prev_positions_; }
+    const std::vector<Speed>& GetSpeeds() const noexcept { return speeds_; }
+
+    // Cold data
+    const std::string& GetName(SlotId slot) const { return names_[slot]; }
+    Bag& GetBag(SlotId slot) { return bags_[slot]; }
+    const Bag& GetBag(SlotId slot) const { return bags_[slot]; }
+    int& GetScore(SlotId slot) { return scores_[slot]; }
+    int GetScore(SlotId slot) const { return scores_[slot]; }
+
+private:
+    double map_speed_;
+
+    // Hot data
+    std::vector<Position> positions_;
+    std::vector<Position> prev_positions_;
+    std::vector<Speed> speeds_;
+    std::vector<Direction> directions_;
+    std::vector<std::chrono::milliseconds> idle_times_;
+    std::vector<std::chrono::milliseconds> play_times_;
+    std::vector<uint8_t> alive_;
+
+    // Cold data
+    std::vector<std::string> names_;
+    std::vector<Bag> bags_;
+    std::vector<int> scores_;
+
+    std::vector<SlotId> free_slots_;
+};
+
+}
@@ -126,17 +126,19 @@ std::vector<Road> Map::FindRoadsByPositionExceptRoadId(const Position& position,
     return result;
 }
 
-Position Map::GetRandomPosition() const {
+Position Map::GetRandomPosition(RandomGenerator& random) const {
+    if (road_boarders_.empty()) {
+        return {0.0, 0.0};
+    }
+
     try {
-        int road_id = rand()%(roads_.size());
-        auto boarders = road_boarders_.at(road_id);
+        const auto& boarders = road_boarders_.at(random.NextIndex(road_boarders_.size()));
         
-        double random = ((double) rand()) / (double) RAND_MAX;
         double diff_x = boarders.GetEndPoint().x - boarders.GetStartPoint().x;
         double diff_y = boarders.GetEndPoint().y - boarders.GetStartPoint().y;
 
-        double r_x = random * diff_x;
-        double r_y = random * diff_y;
+        double r_x = random.NextDouble() * diff_x;
+        double r_y = random.NextDouble() * diff_y;
 
         double pos_x = boarders.GetStartPoint().x + r_x;
         double pos_y = boarders.GetStartPoint().y + r_y;
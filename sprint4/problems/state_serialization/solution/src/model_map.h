@@ -2,6 +2,7 @@
 
 #include "tagged.h"
 #include "model_utils.h"
+#include "random_generator.h"
 
 #include <unordered_map>
 #include <map>
@@ -206,12 +207,28 @@ public:
         return road_boarders_;
     }
 
+    void ReserveRoads(size_t count) {
+        roads_.reserve(count);
+        road_boarders_.reserve(count);
+    }
+
+    void ReserveBuildings(size_t count) {
+        buildings_.reserve(count);
+    }
+
     void AddRoad(const Road& road) {
         roads_.emplace_back(road);
         roads_.back().SetId(roads_.size() - 1);
         road_boarders_.emplace_back(CalculateBoarders(road));
     }
 
+    // Adds road with boarders calculated beforehand, e.g. loaded from the map cache
+    void AddRoad(const Road& road, const RoadBoarders& boarders) {
+        roads_.emplace_back(road);
+        roads_.back().SetId(roads_.size() - 1);
+        road_boarders_.emplace_back(boarders);
+    }
+
     void AddBuilding(const Building& building) {
         buildings_.emplace_back(building);
     }
@@ -238,7 +255,7 @@ public:
     std::optional<Road> FindRoadByPosition(const Position& position);
     std::optional<Road> FindRoadByPositionExceptRoadId(const Position& position, int excepted_id);
     std::vector<Road> FindRoadsByPositionExceptRoadId(const Position &position, int excepted_id);
-    Position GetRandomPosition() const;
+    Position GetRandomPosition(RandomGenerator& random) const;
 
 private:
     using OfficeIdToIndex = std::unordered_map<Office::Id, size_t, util::TaggedHasher<Office::Id>>;
@@ -10,11 +10,10 @@
 namespace model {
 
 using SessionPtr = std::shared_ptr<GameSession>;
-using DogPtr = std::shared_ptr<Dog>;
 
 class Player {
 public:
-    Player(const std::string& name, uint32_t id, model::Map::Id map_id, DogPtr dog)
+    Player(const std::string& name, uint32_t id, model::Map::Id map_id, Dog dog)
         : name_(name)
         , map_id_(map_id) 
         , dog_(dog) 
@@ -24,14 +23,13 @@ public:
     uint32_t GetId() const { return id_; }
     const std::string& GetName() const { return name_; }
     const auto& GetMapId() const { return map_id_; }
-    DogPtr GetDog() { return dog_; }
-    const DogPtr GetDog() const { return dog_; }
+    Dog GetDog() const { return dog_; }
 
 private:
     uint32_t id_;
     std::string name_;
     model::Map::Id map_id_;
-    DogPtr dog_;
+    Dog dog_;
 };
 
 }
\ No newline at end of file
@@ -1,4 +1,7 @@
 #include "path_helper.h"
+#include "url_decoder.h"
+
+#include <stdexcept>
 
 //#include <iomanip>
 //#include <cctype>
@@ -53,6 +56,10 @@ fs::path GetRelPathFromRequest(const std::vector<std::string>& splittedRequest)
 
 fs::path GetDecodedPath(std::string_view path) {   
     auto decoded_path = UrlDecode(path);
+    // %00 would cut the path when the file is opened
+    if (decoded_path.find('\0') != std::string::npos) {
+        throw std::invalid_argument("Null character in path");
+    }
     if (!decoded_path.empty()) {
         return fs::path(decoded_path.begin() + 1, decoded_path.end());
     }
@@ -60,20 +67,8 @@ fs::path GetDecodedPath(std::string_view path) {
 }
 
 std::string UrlDecode(const std::string_view& value) {
-    std::string ret;
-    char ch;
-    int temp;
-    for (int i = 0; i < value.length(); ++i) {
-        if (value[i] == '%') {
-            sscanf(value.substr(i + 1, 2).data(), "%x", &temp);
-            ch = static_cast<char>(temp);
-            ret += ch;
-            i += 2;
-        } else {
-            ret += value[i];
-        }
-    }
-    return ret;
+    // '+' в пути — обычный символ, пробелом он бывает только в query-строке
+    return url::Decode(value, url::Plus::KEEP);
 }
 
 }
\ No newline at end of file
@@ -16,6 +16,7 @@ bool IsSubPath(fs::path path, fs::path base);
 fs::path CreatePathForTemporaryFile(const fs::path& basePath);
 fs::path GetAbsPath(const fs::path& basePath, const fs::path& relPath);
 fs::path GetRelPathFromRequest(const std::vector<std::string>& splittedRequest);
+// Выбрасывают std::invalid_argument, если escape-последовательность некорректна
 fs::path GetDecodedPath(std::string_view path);
 std::string UrlDecode(const std::string_view& value);
 
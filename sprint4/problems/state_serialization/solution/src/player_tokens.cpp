@@ -9,6 +9,12 @@ namespace model {
 
 const static uint8_t TOKEN_SIZE = 32;
 
+void PlayerTokens::ValidateToken(const Token& token) {
+    if ((*token).size() != TOKEN_SIZE) {
+        throw server_exceptions::InvalidTokenException("Invalid token size");
+    }
+}
+
 Token PlayerTokens::AddPlayer(Player&& player) {
     std::stringstream buf;
 
@@ -24,42 +30,75 @@ Token PlayerTokens::AddPlayer(Player&& player) {
 
     auto result = Token(std::move(token_string));
     
-    tokenToPlayer_.emplace(result, player.GetId());
+    const size_t index = players_.size();
+    tokenToPlayer_.emplace(result, index);
+    idToPlayer_.emplace(player.GetId(), index);
     players_.emplace_back(std::move(player));
     tokens_.push_back(result);
     return result;
 }
 
-const Player& PlayerTokens::FindPlayerByToken(const Token& token) const {
-    if ((*token).size() != 32) {
-        throw server_exceptions::InvalidTokenException("Invalid token size");
+Token PlayerTokens::RemovePlayer(uint32_t id) {
+    const size_t index = GetIndexByPlayerId(id);
+    auto token = std::move(tokens_[index]);
+    tokenToPlayer_.erase(token);
+    idToPlayer_.erase(id);
+
+    // Last player takes the place of the removed one, so the tables stay dense
+    const size_t last = players_.size() - 1;
+    if (index != last) {
+        players_[index] = std::move(players_[last]);
+        tokens_[index] = std::move(tokens_[last]);
+        tokenToPlayer_[tokens_[index]] = index;
+        idToPlayer_[players_[index].GetId()] = index;
     }
+    players_.pop_back();
+    tokens_.pop_back();
+
+    return token;
+}
 
-    if (tokenToPlayer_.contains(token)) {
-        auto id = tokenToPlayer_.at(token);
-        return players_[id];
+const Player& PlayerTokens::FindPlayerByToken(const Token& token) const {
+    ValidateToken(token);
+
+    if (auto player = TryFindPlayerByToken(token)) {
+        return *player;
     } else {
         throw server_exceptions::UnknownTokenException("Player token has not been found");
     }
 }
 
-const Player &PlayerTokens::FindPlayerById(uint32_t id) {
-    if (id >= tokens_.size()) {
-        throw server_exceptions::InvalidArgumentException("Invalid player id");
+const Player* PlayerTokens::TryFindPlayerByToken(const Token& token) const {
+    if (auto it = tokenToPlayer_.find(token); it != tokenToPlayer_.end()) {
+        return &players_[it->second];
     }
-    auto token = tokens_[id];
-    return FindPlayerByToken(token);
+    return nullptr;
 }
 
-const Token &PlayerTokens::FindTokenByPlayerId(uint32_t id) {
-    if (id >= tokens_.size()) {
-        throw server_exceptions::InvalidArgumentException("Invalid player id");
+const Player &PlayerTokens::FindPlayerById(uint32_t id) const {
+    return players_[GetIndexByPlayerId(id)];
+}
+
+const Player* PlayerTokens::TryFindPlayerById(uint32_t id) const {
+    if (auto it = idToPlayer_.find(id); it != idToPlayer_.end()) {
+        return &players_[it->second];
     }
-    return tokens_[id];
+    return nullptr;
+}
+
+const Token &PlayerTokens::FindTokenByPlayerId(uint32_t id) const {
+    return tokens_[GetIndexByPlayerId(id)];
 }
 
 const std::vector<Player> &PlayerTokens::GetPlayers() const {
     return players_;
 }
 
+size_t PlayerTokens::GetIndexByPlayerId(uint32_t id) const {
+    if (auto it = idToPlayer_.find(id); it != idToPlayer_.end()) {
+        return it->second;
+    }
+    throw server_exceptions::InvalidArgumentException("Invalid player id");
+}
+
 }
\ No newline at end of file
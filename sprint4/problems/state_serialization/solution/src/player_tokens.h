@@ -19,14 +19,25 @@ static std::random_device RandomDevice;
 
 class PlayerTokens {
 public:
+    static void ValidateToken(const Token& token);
+
     Token AddPlayer(Player&& player);
+    // Returns token of the removed player
+    Token RemovePlayer(uint32_t id);
     const Player& FindPlayerByToken(const Token& token) const;
-    const Player& FindPlayerById(uint32_t id);
-    const Token& FindTokenByPlayerId(uint32_t id);
+    const Player* TryFindPlayerByToken(const Token& token) const;
+    const Player& FindPlayerById(uint32_t id) const;
+    const Player* TryFindPlayerById(uint32_t id) const;
+    const Token& FindTokenByPlayerId(uint32_t id) const;
     const std::vector<Player>& GetPlayers() const;
 
 private:
-    std::unordered_map<Token, uint32_t, util::TaggedHasher<Token>> tokenToPlayer_;
+    size_t GetIndexByPlayerId(uint32_t id) const;
+
+private:
+    // Player ids are allocated globally, so they aren't dense inside one table
+    std::unordered_map<Token, size_t, util::TaggedHasher<Token>> tokenToPlayer_;
+    std::unordered_map<uint32_t, size_t> idToPlayer_;
     std::vector<Player> players_;
     std::vector<Token> tokens_;
 
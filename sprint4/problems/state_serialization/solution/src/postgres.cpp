@@ -0,0 +1,99 @@
+#include "postgres.h"
+
+#include <pqxx/transaction>
+#include <pqxx/zview.hxx>
+
+namespace postgres {
+
+using namespace std::literals;
+using pqxx::operator"" _zv;
+
+namespace {
+
+constexpr auto INSERT_RECORDS = "insert_records"_zv;
+constexpr auto SELECT_RECORDS = "select_records"_zv;
+
+void CreateTables(pqxx::connection& conn) {
+    pqxx::work work{conn};
+    work.exec(R"(
+CREATE TABLE IF NOT EXISTS retired_players (
+    id SERIAL CONSTRAINT retired_player_id_constraint PRIMARY KEY,
+    name varchar(100) NOT NULL,
+    score integer NOT NULL,
+    play_time_ms integer NOT NULL
+);
+)"_zv);
+    work.exec(R"(
+CREATE INDEX IF NOT EXISTS retired_players_score_time_name_idx
+ON retired_players (score DESC, play_time_ms, name);
+)"_zv);
+    work.commit();
+}
+
+// Statements are prepared once per connection
+void PrepareStatements(pqxx::connection& conn) {
+    // Whole batch is inserted by one statement: columns are passed as arrays and unnested into rows
+    conn.prepare(INSERT_RECORDS, R"(
+INSERT INTO retired_players (name, score, play_time_ms)
+SELECT * FROM unnest($1::varchar(100)[], $2::integer[], $3::integer[]);
+)"_zv);
+    // Order matches the index, so the page is read from the index without sorting
+    conn.prepare(SELECT_RECORDS, R"(
+SELECT name, score, play_time_ms FROM retired_players
+ORDER BY score DESC, play_time_ms, name
+LIMIT $1 OFFSET $2;
+)"_zv);
+}
+
+}  // namespace
+
+void RecordsRepositoryImpl::SaveRecords(const std::vector<records::PlayerRecord>& records) {
+    if (records.empty()) {
+        return;
+    }
+
+    std::vector<std::string> names;
+    std::vector<int> scores;
+    std::vector<int> play_times;
+    names.reserve(records.size());
+    scores.reserve(records.size());
+    play_times.reserve(records.size());
+    for (const auto& record : records) {
+        names.push_back(record.name);
+        scores.push_back(record.score);
+        play_times.push_back(static_cast<int>(record.play_time.count()));
+    }
+
+    auto conn = pool_.GetConnection();
+    pqxx::work work{*conn};
+    work.exec_prepared(INSERT_RECORDS, names, scores, play_times);
+    work.commit();
+}
+
+std::vector<records::PlayerRecord> RecordsRepositoryImpl::GetRecords(size_t start, size_t max_items) {
+    auto conn = pool_.GetConnection();
+    pqxx::read_transaction read{*conn};
+    const auto rows = read.exec_prepared(SELECT_RECORDS, static_cast<int64_t>(max_items), static_cast<int64_t>(start));
+
+    std::vector<records::PlayerRecord> result;
+    result.reserve(rows.size());
+    for (const auto& row : rows) {
+        result.push_back({row[0].as<std::string>(), row[1].as<int>(), std::chrono::milliseconds(row[2].as<int>())});
+    }
+    return result;
+}
+
+Database::Database(const std::string& db_url, size_t connections_count)
+    : pool_{connections_count, [&db_url, tables_created = false]() mutable {
+        auto conn = std::make_shared<pqxx::connection>(db_url);
+        // Statements are prepared on the server, so the tables must exist before
+        if (!tables_created) {
+            CreateTables(*conn);
+            tables_created = true;
+        }
+        PrepareStatements(*conn);
+        return conn;
+    }} {
+}
+
+}  // namespace postgres
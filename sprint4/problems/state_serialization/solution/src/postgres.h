@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string>
+
+#include "connection_pool.h"
+#include "records_repository.h"
+
+namespace postgres {
+
+class RecordsRepositoryImpl : public records::RecordsRepository {
+public:
+    explicit RecordsRepositoryImpl(ConnectionPool& pool)
+        : pool_{pool} {
+    }
+
+    void SaveRecords(const std::vector<records::PlayerRecord>& records) override;
+    std::vector<records::PlayerRecord> GetRecords(size_t start, size_t max_items) override;
+
+private:
+    ConnectionPool& pool_;
+};
+
+class Database {
+public:
+    // Creates the tables if they don't exist
+    Database(const std::string& db_url, size_t connections_count);
+
+    RecordsRepositoryImpl& GetRecords() & {
+        return records_;
+    }
+
+private:
+    ConnectionPool pool_;
+    RecordsRepositoryImpl records_{pool_};
+};
+
+}  // namespace postgres
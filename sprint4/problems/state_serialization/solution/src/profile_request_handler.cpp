@@ -0,0 +1,114 @@
+#include "profile_request_handler.h"
+#include "sampling_profiler.h"
+#include "json_helper.h"
+
+#include <boost/json/serialize.hpp>
+#include <charconv>
+
+namespace http_handler {
+
+namespace {
+
+constexpr std::string_view PROFILE_PATH = "/debug/pprof/profile"sv;
+
+StringResponse MakeProfileResponse(http::status status, std::string body, std::string_view content_type,
+                                   unsigned http_version, bool keep_alive) {
+    StringResponse response(status, http_version);
+    response.set(http::field::content_type, content_type);
+    response.set(http::field::cache_control, "no-cache");
+    response.body() = std::move(body);
+    response.prepare_payload();
+    response.keep_alive(keep_alive);
+    return response;
+}
+
+StringResponse MakeErrorResponse(http::status status, const std::string& code, const std::string& message,
+                                 const StringRequest& req) {
+    return MakeProfileResponse(status, boost::json::serialize(json_helper::CreateErrorValue(code, message)),
+                               ContentType::APP_JSON, req.version(), req.keep_alive());
+}
+
+// Returns 0, if the duration is invalid
+int ParseSeconds(std::string_view target) {
+    const auto params = GetQueryParams(target);
+    const auto it = params.find("seconds");
+    if (it == params.end()) {
+        return ProfileRequestHandler::DEFAULT_SECONDS;
+    }
+
+    int seconds = 0;
+    const auto& value = it->second;
+    const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), seconds);
+    if (ec != std::errc{} || end != value.data() + value.size() ||
+        seconds <= 0 || seconds > ProfileRequestHandler::MAX_SECONDS) {
+        return 0;
+    }
+    return seconds;
+}
+
+}  // namespace
+
+bool IsProfileRequest(const StringRequest& req) {
+    return GetTargetPath(req.target()) == PROFILE_PATH;
+}
+
+// Drains the profiler every DRAIN_PERIOD until the deadline, then sends the profile
+class ProfileRequestHandler::Session : public std::enable_shared_from_this<Session> {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    Session(net::io_context& ioc, StringRequest&& req, Send&& send, std::chrono::seconds duration)
+        : timer_(ioc)
+        , req_(std::move(req))
+        , send_(std::move(send))
+        , deadline_(Clock::now() + duration) {}
+
+    void Run() {
+        const auto next = std::min(Clock::now() + profiler::SamplingProfiler::DRAIN_PERIOD, deadline_);
+        timer_.expires_at(next);
+        timer_.async_wait([self = shared_from_this()](const boost::system::error_code& ec) {
+            self->OnTimer(ec);
+        });
+    }
+
+private:
+    void OnTimer(const boost::system::error_code& ec) {
+        auto& profiler = profiler::SamplingProfiler::GetInstance();
+        if (!ec && Clock::now() < deadline_) {
+            profiler.Drain();
+            return Run();
+        }
+        // Profile is stopped on errors too, otherwise the next request gets profilerBusy forever
+        auto stacks = profiler.Stop();
+        send_(MakeProfileResponse(http::status::ok, std::move(stacks), ContentType::TEXT_PLAIN,
+                                  req_.version(), req_.keep_alive()));
+    }
+
+private:
+    net::steady_timer timer_;
+    StringRequest req_;
+    Send send_;
+    Clock::time_point deadline_;
+};
+
+void ProfileRequestHandler::HandleRequest(StringRequest&& req, Send send) {
+    if (req.method() != http::verb::get) {
+        auto response = MakeErrorResponse(http::status::method_not_allowed, "invalidMethod", "Only GET method is expected", req);
+        response.set(http::field::allow, "GET");
+        return send(std::move(response));
+    }
+
+    const int seconds = ParseSeconds(req.target());
+    if (seconds == 0) {
+        return send(MakeErrorResponse(http::status::bad_request, "invalidArgument",
+                                      "seconds must be from 1 to " + std::to_string(MAX_SECONDS), req));
+    }
+
+    if (!profiler::SamplingProfiler::GetInstance().Start()) {
+        return send(MakeErrorResponse(http::status::bad_request, "profilerBusy", "Profile is already being taken", req));
+    }
+
+    std::make_shared<Session>(ioc_, std::move(req), std::move(send), std::chrono::seconds{seconds})->Run();
+}
+
+}  // namespace http_handler
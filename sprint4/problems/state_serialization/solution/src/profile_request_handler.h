@@ -0,0 +1,41 @@
+#pragma once
+
+#define BOOST_BEAST_USE_STD_STRING_VIEW
+
+#include "request_handler_helper.h"
+#include "request_handler_strategy.h"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace http_handler {
+
+namespace net = boost::asio;
+
+bool IsProfileRequest(const StringRequest& req);
+
+// Serves GET /debug/pprof/profile?seconds=N: samples the server for N seconds and returns
+// the collapsed stacks, which are drawn by flamegraph.pl. The request waits on a timer,
+// so the worker threads keep serving the game while the profile is taken
+class ProfileRequestHandler {
+public:
+    using Send = std::function<void(StringResponse&&)>;
+
+    constexpr static int DEFAULT_SECONDS = 30;
+    constexpr static int MAX_SECONDS = 300;
+
+    explicit ProfileRequestHandler(net::io_context& ioc)
+        : ioc_(ioc) {}
+
+    void HandleRequest(StringRequest&& req, Send send);
+
+private:
+    class Session;
+
+    net::io_context& ioc_;
+};
+
+}  // namespace http_handler
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace model {
+
+// xoshiro256** pseudo-random generator.
+// It is much cheaper than global rand() (no shared state under lock) and than std::mt19937,
+// so every session owns its instance. Same seed gives the same sequence on every platform.
+class RandomGenerator {
+public:
+    using result_type = uint64_t;
+
+    RandomGenerator()
+        : RandomGenerator(MakeRandomSeed()) {}
+
+    explicit RandomGenerator(uint64_t seed) noexcept {
+        Seed(seed);
+    }
+
+    void Seed(uint64_t seed) noexcept {
+        // State is filled by splitmix64, so that any seed (including zero) gives a valid state
+        for (auto& word : state_) {
+            word = SplitMix64(seed);
+        }
+    }
+
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() noexcept {
+        const uint64_t result = RotateLeft(state_[1] * 5, 7) * 9;
+        const uint64_t t = state_[1] << 17;
+
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = RotateLeft(state_[3], 45);
+
+        return result;
+    }
+
+    // Uniform number in [0, 1)
+    double NextDouble() noexcept {
+        return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+    }
+
+    // Uniform number in [0, bound), bound must be positive
+    uint64_t NextIndex(uint64_t bound) noexcept {
+        return static_cast<uint64_t>((static_cast<unsigned __int128>((*this)()) * bound) >> 64);
+    }
+
+    // Seed for the stream-th generator derived from the common seed
+    static uint64_t DeriveSeed(uint64_t seed, uint64_t stream) noexcept {
+        uint64_t mixed = seed ^ (stream * 0x9e3779b97f4a7c15ULL);
+        return SplitMix64(mixed);
+    }
+
+    static uint64_t MakeRandomSeed() {
+        std::random_device device;
+        return (static_cast<uint64_t>(device()) << 32) | device();
+    }
+
+private:
+    static uint64_t RotateLeft(uint64_t x, int k) noexcept {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    static uint64_t SplitMix64(uint64_t& x) noexcept {
+        uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+private:
+    uint64_t state_[4];
+};
+
+}
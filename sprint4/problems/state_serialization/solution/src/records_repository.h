@@ -0,0 +1,28 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace records {
+
+// Result of a retired player
+struct PlayerRecord {
+    std::string name;
+    int score = 0;
+    std::chrono::milliseconds play_time{0};
+};
+
+// Storage of the records, it's shared by the API handler and the records writer
+class RecordsRepository {
+public:
+    // Saves all records at once
+    virtual void SaveRecords(const std::vector<PlayerRecord>& records) = 0;
+    // Returns records ordered by score (desc), play time and name
+    virtual std::vector<PlayerRecord> GetRecords(size_t start, size_t max_items) = 0;
+
+protected:
+    ~RecordsRepository() = default;
+};
+
+}  // namespace records
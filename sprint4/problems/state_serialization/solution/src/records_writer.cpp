@@ -0,0 +1,75 @@
+#include "records_writer.h"
+#include "logger.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace records {
+
+RecordsWriter::RecordsWriter(RecordsRepository& repository, size_t max_batch_size)
+    : repository_(repository)
+    , max_batch_size_(std::max<size_t>(1, max_batch_size))
+    , worker_([this] { Run(); }) {
+}
+
+RecordsWriter::~RecordsWriter() {
+    {
+        std::lock_guard lock(mutex_);
+        stopped_ = true;
+    }
+    queue_cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+void RecordsWriter::Push(std::vector<PlayerRecord> records) {
+    if (records.empty()) {
+        return;
+    }
+    {
+        std::lock_guard lock(mutex_);
+        std::move(records.begin(), records.end(), std::back_inserter(queue_));
+    }
+    queue_cv_.notify_one();
+}
+
+void RecordsWriter::Flush() {
+    std::unique_lock lock(mutex_);
+    flush_cv_.wait(lock, [this] {
+        return queue_.empty() && in_flight_ == 0;
+    });
+}
+
+void RecordsWriter::Run() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+        queue_cv_.wait(lock, [this] {
+            return stopped_ || !queue_.empty();
+        });
+        if (queue_.empty()) {
+            // Stopped and everything is written
+            return;
+        }
+
+        // Records queued while the previous batch was written go in one batch
+        const auto batch_size = std::min(queue_.size(), max_batch_size_);
+        std::vector<PlayerRecord> batch(std::make_move_iterator(queue_.begin()),
+                                        std::make_move_iterator(queue_.begin() + batch_size));
+        queue_.erase(queue_.begin(), queue_.begin() + batch_size);
+        in_flight_ = batch.size();
+
+        lock.unlock();
+        try {
+            repository_.SaveRecords(batch);
+        } catch (std::exception& e) {
+            logger::LogErrorMessage(std::string("Records aren't saved: ") + e.what());
+        }
+        lock.lock();
+
+        in_flight_ = 0;
+        flush_cv_.notify_all();
+    }
+}
+
+}  // namespace records
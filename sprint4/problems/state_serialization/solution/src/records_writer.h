@@ -0,0 +1,47 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "records_repository.h"
+
+namespace records {
+
+// Writes records to the repository in batches from a background thread,
+// so the game tick never waits for the database
+class RecordsWriter {
+public:
+    constexpr static size_t DEFAULT_MAX_BATCH_SIZE = 256;
+
+    explicit RecordsWriter(RecordsRepository& repository, size_t max_batch_size = DEFAULT_MAX_BATCH_SIZE);
+
+    RecordsWriter(const RecordsWriter&) = delete;
+    RecordsWriter& operator=(const RecordsWriter&) = delete;
+    // Writes the queued records before the thread is stopped
+    ~RecordsWriter();
+
+    // Queues records without waiting for the repository
+    void Push(std::vector<PlayerRecord> records);
+    // Waits until all queued records are written
+    void Flush();
+
+private:
+    void Run();
+
+private:
+    RecordsRepository& repository_;
+    const size_t max_batch_size_;
+
+    std::mutex mutex_;
+    std::condition_variable queue_cv_;
+    std::condition_variable flush_cv_;
+    std::deque<PlayerRecord> queue_;
+    // Records taken from the queue, but not written yet
+    size_t in_flight_ = 0;
+    bool stopped_ = false;
+    std::thread worker_;
+};
+
+}  // namespace records
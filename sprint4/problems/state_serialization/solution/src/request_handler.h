@@ -8,9 +8,11 @@
 #include "game.h"
 #include "request_handler_strategy.h"
 #include "request_handler_helper.h"
+#include "profile_request_handler.h"
 #include "command_line_parser.h"
 
 #include <boost/asio/strand.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/json/parse.hpp>
 #include <unordered_map>
 #include <memory>
@@ -29,25 +31,48 @@ using namespace std::literals;
 
 class RequestHandler : public std::enable_shared_from_this<RequestHandler> {
 public:
-    explicit RequestHandler(model::Game& game, net::io_context& ioc, const command_line::Args& args)
+    constexpr static size_t RECORDS_THREADS = 2;
+
+    explicit RequestHandler(model::Game& game, net::io_context& ioc, const command_line::Args& args,
+                            records::RecordsRepository* records_repository = nullptr,
+                            records::RecordsWriter* records_writer = nullptr)
         : game_{game} 
         , strand_(net::make_strand(ioc)) 
         , args_(args) {
 
         strategy_api_ = std::make_shared<RequestHandlerStrategyApi>(game_, strand_, args_.randomize_spawn_point, args_.tick_period, 
-                                                                    fs::weakly_canonical(args_.state_file), args_.save_state_period);
+                                                                    fs::weakly_canonical(args_.state_file), args_.save_state_period,
+                                                                    records_repository, records_writer, args_.tick_stats);
         strategy_static_ = std::make_shared<RequestHandlerStrategyStaticFile>(fs::weakly_canonical(args_.source_dir));
+        if (args_.enable_profiler) {
+            profile_handler_ = std::make_unique<ProfileRequestHandler>(ioc);
+        }
     }
 
     RequestHandler(const RequestHandler&) = delete;
     RequestHandler& operator=(const RequestHandler&) = delete;
     ~RequestHandler() { 
-        if (auto strategy_api = std::dynamic_pointer_cast<RequestHandlerStrategyApi>(strategy_api_))
-            strategy_api->TrySaveSessions();
+        strategy_api_->TrySaveSessions();
     }
 
     template <typename Body, typename Allocator, typename Send>
     void operator()(http::request<Body, http::basic_fields<Allocator>>&& req, Send&& send) {
+        if (profile_handler_ && IsProfileRequest(req)) {
+            return profile_handler_->HandleRequest(std::move(req), [send](StringResponse&& response) {
+                send(std::move(response));
+            });
+        }
+        if (IsApiRequest(req) && strategy_api_->IsRecordsRequest(req)) {
+            // Records query waits for a database connection, so it runs on its own pool
+            // and the response is posted back to the API strand
+            return net::post(records_pool_, [strategy_api = strategy_api_, strand = strand_,
+                                             req = std::move(req), send = std::move(send)]() mutable {
+                auto response = strategy_api->HandleRecordsRequest(std::move(req));
+                net::post(strand, [response = std::move(response), send = std::move(send)]() mutable {
+                    send(std::move(response));
+                });
+            });
+        }
         if (IsApiRequest(req)) {
             return net::dispatch(strand_, [self = this->shared_from_this(), req = std::move(req), send = std::move(send)] {
                 send(self->strategy_api_->HandleRequest(std::decay_t<decltype(req)>(req)));
@@ -62,8 +87,12 @@ private:
     const command_line::Args& args_;
     net::strand<net::io_context::executor_type> strand_;
 
-    std::shared_ptr<RequestHandlerStrategyIntf> strategy_api_;
+    std::shared_ptr<RequestHandlerStrategyApi> strategy_api_;
     std::shared_ptr<RequestHandlerStrategyIntf> strategy_static_;
+    // Exists only with --enable-profiler, otherwise the profile path is a missing static file
+    std::unique_ptr<ProfileRequestHandler> profile_handler_;
+    // Declared last, so it's joined before the strategies are destroyed
+    net::thread_pool records_pool_{RECORDS_THREADS};
 };
 
 
@@ -28,4 +28,33 @@ std::vector<std::string> GetVectorFromTarget(std::string_view target)
     return result;
 }
 
+std::string_view GetTargetPath(std::string_view target)
+{
+    return target.substr(0, target.find('?'));
+}
+
+std::unordered_map<std::string, std::string> GetQueryParams(std::string_view target)
+{
+    std::unordered_map<std::string, std::string> result;
+    const auto query_pos = target.find('?');
+    if (query_pos == std::string_view::npos) {
+        return result;
+    }
+
+    std::vector<std::string> params;
+    boost::split(params, target.substr(query_pos + 1), boost::is_any_of("&"), boost::token_compress_on);
+    for (const auto& param : params) {
+        if (param.empty()) {
+            continue;
+        }
+        const auto eq_pos = param.find('=');
+        if (eq_pos == std::string::npos) {
+            result[param] = "";
+        } else {
+            result[param.substr(0, eq_pos)] = param.substr(eq_pos + 1);
+        }
+    }
+    return result;
+}
+
 }
\ No newline at end of file
@@ -16,6 +16,10 @@ using StringRequest = http::request<http::string_body>;
 
 bool IsApiRequest(const StringRequest& req);
 std::vector<std::string> GetVectorFromTarget(std::string_view target);
+// Target without the query string
+std::string_view GetTargetPath(std::string_view target);
+// Parameters of the query string, values aren't decoded
+std::unordered_map<std::string, std::string> GetQueryParams(std::string_view target);
 
 using namespace std::literals;
 
@@ -1,11 +1,13 @@
 #include "request_handler_strategy.h"
 #include "json_helper.h"
 #include "logger.h"
-#include "extra_data.h"
 #include "game_server_exceptions.h"
 
 #include <boost/json/serialize.hpp>
+#include <charconv>
 #include <fstream>
+#include <limits>
+#include <stdexcept>
 #include <string>
 #include <chrono>
 #include <random>
@@ -52,7 +54,10 @@ RequestHandlerStrategyApi::RequestHandlerStrategyApi(model::Game &game,
                                                     bool randomize_spawn_point, 
                                                     int tick_period, 
                                                     const std::filesystem::path& state_file, 
-                                                    int save_state_period)
+                                                    int save_state_period,
+                                                    records::RecordsRepository* records_repository,
+                                                    records::RecordsWriter* records_writer,
+                                                    bool collect_tick_stats)
     : game_(game) 
     , randomize_spawn_point_(randomize_spawn_point)
     , ticker_started_(false)
@@ -60,19 +65,36 @@ RequestHandlerStrategyApi::RequestHandlerStrategyApi(model::Game &game,
     , tick_period_(tick_period) 
     , state_file_(state_file)
     , save_state_period_(save_state_period)
-    , save_before_close_(false) {
+    , save_before_close_(false)
+    , records_repository_(records_repository)
+    , records_writer_(records_writer)
+    , tick_stats_(collect_tick_stats ? std::make_unique<metrics::TickStats>() : nullptr) {
     
-    using namespace std::chrono_literals;
-    loot_generator_ = std::make_shared<loot_gen::LootGenerator>(
-        model::ExtraData::GetInstance().GetLootGeneratorData().period * 1ms, 
-        model::ExtraData::GetInstance().GetLootGeneratorData().probability);
     is_debug_mode_ = tick_period_.count() ? false : true;
 }
 
 void RequestHandlerStrategyApi::TrySaveSessions() {
     save_before_close_ = true;
-    for (auto& [map, session] : game_.GetMapToSession())
+    game_.ForEachSession([this](const model::SessionPtr& session) {
         TrySaveSessionInFile(session);
+    });
+}
+
+bool RequestHandlerStrategyApi::IsRecordsRequest(const StringRequest& req) {
+    return GetRequestType(GetVectorFromTarget(GetTargetPath(std::string_view(req.target().data(), req.target().size()))))
+        == RequestType::GET_RECORDS;
+}
+
+StringResponse RequestHandlerStrategyApi::HandleRecordsRequest(StringRequest&& req) {
+    http::status status;
+    std::string body;
+
+    if (req.method() == http::verb::get || req.method() == http::verb::head) {
+        MakeGetRecordsBody(req, body, status);
+    } else {
+        MakeMethodNotAllowedBody(body, status, "invalidMethod", "Invalid method");
+    }
+    return MakeStringResponse(status, body, req.version(), req.keep_alive(), RequestType::GET_RECORDS);
 }
 
 StringResponse RequestHandlerStrategyApi::HandleRequestImpl(StringRequest &&req, http::status &status, std::string &body, std::string_view &content_type)
@@ -81,17 +103,13 @@ StringResponse RequestHandlerStrategyApi::HandleRequestImpl(StringRequest &&req,
         return this->MakeStringResponse(status, text, req.version(), req.keep_alive(), type, content_type);
     };
 
-    if (!is_debug_mode_ && !ticker_started_) {
-        ticker_ = std::make_shared<Ticker>(strand_, tick_period_, 
-                    [self = this->shared_from_this()] (std::chrono::milliseconds delta) {
-                        self->UpdateTimeInSessions(delta);
-                    });
-        ticker_->Start();
+    if (!ticker_started_) {
+        StartSessionTickers();
         ticker_started_ = true;
     }
 
     content_type = ContentType::APP_JSON;
-    auto request_type = GetRequestType(GetVectorFromTarget(std::string_view(req.target().data(), req.target().size())));
+    auto request_type = GetRequestType(GetVectorFromTarget(GetTargetPath(std::string_view(req.target().data(), req.target().size()))));
     switch (request_type) {
         case RequestType::GET_MAP_BY_ID:
         case RequestType::GET_MAP_LIST: {
@@ -112,7 +130,9 @@ StringResponse RequestHandlerStrategyApi::HandleRequestImpl(StringRequest &&req,
             break;
         }
 
-        case RequestType::GET_GAME_STATE: {
+        case RequestType::GET_GAME_STATE:
+        case RequestType::GET_RECORDS:
+        case RequestType::GET_TICK_STATS: {
             if (req.method() == http::verb::get || req.method() == http::verb::head) {
                 SetResponseDataGet(req, request_type, body, status);
             } else {
@@ -148,6 +168,8 @@ StringResponse RequestHandlerStrategyApi::MakeStringResponse(http::status status
     } else if (status == http::status::method_not_allowed && 
         (request_type == RequestType::GET_PLAYERS_ON_MAP || 
         request_type == RequestType::GET_GAME_STATE ||
+        request_type == RequestType::GET_RECORDS ||
+        request_type == RequestType::GET_TICK_STATS ||
         request_type == RequestType::GET_MAP_LIST ||
         request_type == RequestType::GET_MAP_BY_ID)) {
         response.set(http::field::allow, "GET, HEAD");
@@ -182,6 +204,16 @@ void RequestHandlerStrategyApi::SetResponseDataGet(const StringRequest& req, Req
             break;
         }
 
+        case RequestType::GET_RECORDS: {
+            MakeGetRecordsBody(req, body, status);
+            break;
+        }
+
+        case RequestType::GET_TICK_STATS: {
+            MakeGetTickStatsBody(req, body, status);
+            break;
+        }
+
         case RequestType::UNKNOWN: {
             MakeBadRequestBody(body, status);
             break;
@@ -232,6 +264,10 @@ RequestHandlerStrategyApi::RequestType RequestHandlerStrategyApi::GetRequestType
             result = RequestType::GET_PLAYERS_ON_MAP;
         } else if (splittedRequest.size() == RequestTypeSize::GET_GAME_STATE && splittedRequest.back() == "state") {
             result = RequestType::GET_GAME_STATE;
+        } else if (splittedRequest.size() == RequestTypeSize::GET_RECORDS && splittedRequest[2] == "game" && splittedRequest.back() == "records") {
+            result = RequestType::GET_RECORDS;
+        } else if (splittedRequest.size() == RequestTypeSize::GET_TICK_STATS && splittedRequest[2] == "game" && splittedRequest.back() == "tick-stats") {
+            result = RequestType::GET_TICK_STATS;
         } else if (splittedRequest.size() == RequestTypeSize::JOIN_GAME && splittedRequest.back() == "join") {
             result = RequestType::JOIN_GAME;
         } else if (splittedRequest.size() == RequestTypeSize::UPDATE_TIME && splittedRequest.back() == "tick") {
@@ -249,6 +285,8 @@ bool RequestHandlerStrategyApi::CheckRequestCorrectness(const std::vector<std::s
         || splittedRequest.size() == RequestTypeSize::GET_MAP_LIST
         || splittedRequest.size() == RequestTypeSize::GET_PLAYERS_ON_MAP
         || splittedRequest.size() == RequestTypeSize::GET_GAME_STATE
+        || splittedRequest.size() == RequestTypeSize::GET_RECORDS
+        || splittedRequest.size() == RequestTypeSize::GET_TICK_STATS
         || splittedRequest.size() == RequestTypeSize::JOIN_GAME
         || splittedRequest.size() == RequestTypeSize::UPDATE_TIME
         || splittedRequest.size() == RequestTypeSize::MOVE_PLAYER)
@@ -328,18 +366,73 @@ std::chrono::milliseconds RequestHandlerStrategyApi::ReceiveTimeFromRequest(cons
     }
 }
 
-void RequestHandlerStrategyApi::UpdateTimeInSessions(std::chrono::milliseconds delta) {
-    for (auto& [map, session] : game_.GetMapToSession()) {
-        session->UpdateTime(delta);
-        TrySaveSessionInFile(session);
+void RequestHandlerStrategyApi::StartSessionTickers() {
+    if (is_debug_mode_) {
+        return;
+    }
+
+    game_.ForEachShard([this](const model::GameShardPtr& shard) {
+        if (session_tickers_.contains(shard)) {
+            return;
+        }
+
+        auto ticker = std::make_shared<Ticker>(net::make_strand(strand_.get_inner_executor()), tick_period_,
+                    [self = this->shared_from_this(), shard] (std::chrono::milliseconds delta) {
+                        self->UpdateTimeInSession(shard, delta);
+                    });
+        ticker->Start();
+        session_tickers_.emplace(shard, std::move(ticker));
+    });
+}
+
+void RequestHandlerStrategyApi::UpdateTimeInSession(const model::GameShardPtr& shard, std::chrono::milliseconds delta) {
+    SaveRetiredDogs(TickShard(*shard, delta));
+
+    if (shard->IsEvicted()) {
+        // Ticker map is owned by the API strand, the evicted session is released there
+        net::post(strand_, [self = this->shared_from_this(), shard] {
+            if (auto it = self->session_tickers_.find(shard); it != self->session_tickers_.end()) {
+                it->second->Stop();
+                self->session_tickers_.erase(it);
+            }
+        });
+        return;
+    }
+
+    std::lock_guard lock(shard->GetMutex());
+    TrySaveSessionInFile(shard->GetSession());
+}
+
+std::vector<model::RetiredDog> RequestHandlerStrategyApi::TickShard(model::GameShard& shard, std::chrono::milliseconds delta) {
+    if (!tick_stats_) {
+        return game_.Tick(shard, delta);
     }
+
+    const auto start = std::chrono::steady_clock::now();
+    auto retired_dogs = game_.Tick(shard, delta);
+    tick_stats_->Record(std::chrono::steady_clock::now() - start);
+    return retired_dogs;
+}
+
+void RequestHandlerStrategyApi::SaveRetiredDogs(const std::vector<model::RetiredDog>& retired_dogs) {
+    if (!records_writer_ || retired_dogs.empty()) {
+        return;
+    }
+
+    std::vector<records::PlayerRecord> player_records;
+    player_records.reserve(retired_dogs.size());
+    for (const auto& dog : retired_dogs) {
+        player_records.push_back({dog.name, dog.score, dog.play_time});
+    }
+    // Records are written by the writer thread, the tick doesn't wait for the database
+    records_writer_->Push(std::move(player_records));
 }
 
 // Get responses
 
 bool RequestHandlerStrategyApi::MakeGetMapListBody(std::string &bodyText, http::status &status) {
     boost::json::array jsonList; 
-    for (const auto& map : game_.GetMaps()) {
+    for (const auto& map : *game_.GetMaps()) {
         boost::json::object val;
         val["id"] = *map.GetId();
         val["name"] = map.GetName();
@@ -355,14 +448,15 @@ bool RequestHandlerStrategyApi::MakeGetMapListBody(std::string &bodyText, http::
 bool RequestHandlerStrategyApi::MakeGetMapByIdBody(model::Map::Id id, std::string &bodyText, http::status &status) {
     boost::json::object val;
     
-    auto map = game_.FindMap(id);
-    if (map) {
+    // Map and its loot types are taken from one snapshot, so a config reload doesn't split them
+    const auto snapshot = game_.GetMapsSnapshot();
+    if (const auto* map = snapshot->FindMap(id)) {
         val["id"] = *map->GetId();
         val["name"] = map->GetName();
         val["roads"] = json_helper::CreateRoadsArray(*map);
         val["buildings"] = json_helper::CreateBuildingsArray(*map);
         val["offices"] = json_helper::CreateOfficesArray(*map);
-        val["lootTypes"] = model::ExtraData::GetInstance().GetLootByMapId(id);
+        val["lootTypes"] = snapshot->extra_data.GetLootByMapId(id);
 
         status = http::status::ok;
     } else {
@@ -380,15 +474,13 @@ bool RequestHandlerStrategyApi::MakeGetPlayersOnMapBody(const StringRequest& req
 
     try {
         const auto token = ReceiveTokenFromRequest(req);
-        const auto player = game_.FindPlayerByToken(model::Token(std::string(token)));
-        const auto map_id = player.GetMapId();
-        const auto session = game_.FindSession(map_id);
-
-        for (const auto&[name, id] : session->GetPlayers()) {
-            boost::json::object name_obj;
-            name_obj["name"] = name;
-            res[std::to_string(id)] = name_obj;
-        }
+        game_.WithPlayer(model::Token(std::string(token)), [&res](const model::Player&, model::GameShard& shard) {
+            for (const auto&[name, id] : shard.GetSession()->GetPlayers()) {
+                boost::json::object name_obj;
+                name_obj["name"] = name;
+                res[std::to_string(id)] = name_obj;
+            }
+        });
 
         status = http::status::ok;
     } catch (const server_exceptions::BaseException& e) {
@@ -406,30 +498,29 @@ bool RequestHandlerStrategyApi::MakeGetGameStateBody(const StringRequest &req, s
 
     try {
         auto token = ReceiveTokenFromRequest(req);
-        
-        // Just to ensure that token is valid
-        const auto& player = game_.FindPlayerByToken(model::Token(std::string(token)));
 
         boost::json::object players_obj;
-        for (const auto& player : game_.GetPlayers()) {
-            const auto& session = game_.FindSession(player.GetMapId());
+        boost::json::object lost_objects_obj;
+        game_.WithPlayer(model::Token(std::string(token)), [&](const model::Player&, model::GameShard& shard) {
+            const auto& session = shard.GetSession();
 
-            boost::json::object temp;
+            for (const auto& player : shard.GetPlayers()) {
+                boost::json::object temp;
 
-            const auto& dog = player.GetDog();
-            temp["pos"] = boost::json::array({ dog->GetPosition().x, dog->GetPosition().y });
-            temp["speed"] = boost::json::array({ dog->GetSpeed().v_x, dog->GetSpeed().v_y });
-            temp["dir"] = dog->GetDirectionString();
-            temp["bag"] = json_helper::CreateBagArray(dog->GetBagContent());
-            temp["score"] = session->GetPlayerScore(player.GetId());
+                const auto dog = player.GetDog();
+                temp["pos"] = boost::json::array({ dog.GetPosition().x, dog.GetPosition().y });
+                temp["speed"] = boost::json::array({ dog.GetSpeed().v_x, dog.GetSpeed().v_y });
+                temp["dir"] = dog.GetDirectionString();
+                temp["bag"] = json_helper::CreateBagArray(dog.GetBagContent());
+                temp["score"] = session->GetPlayerScore(player.GetId());
 
-            players_obj[std::to_string(player.GetId())] = temp;
-        }
-        
-        boost::json::object lost_objects_obj;
-        for (const auto& [id, loot_data] : game_.FindSession(player.GetMapId())->GetAvailableLoot()) {
-            lost_objects_obj[std::to_string(id)] = json_helper::CreateLostObjectValue(loot_data.type, loot_data.position);
-        }
+                players_obj[std::to_string(player.GetId())] = temp;
+            }
+
+            for (const auto& [id, loot_data] : session->GetAvailableLoot()) {
+                lost_objects_obj[std::to_string(id)] = json_helper::CreateLostObjectValue(loot_data.type, loot_data.position);
+            }
+        });
 
         res["players"] = players_obj;
         res["lostObjects"] = lost_objects_obj;
@@ -447,6 +538,83 @@ bool RequestHandlerStrategyApi::MakeGetGameStateBody(const StringRequest &req, s
 
 // Post responses
 
+bool RequestHandlerStrategyApi::MakeGetRecordsBody(const StringRequest& req, std::string& body, http::status& status) {
+    static const size_t MAX_RECORDS_ITEMS = 100;
+
+    boost::json::value res;
+
+    try {
+        const auto params = GetQueryParams(std::string_view(req.target().data(), req.target().size()));
+        const auto read_param = [&params](const std::string& name, size_t default_value) -> size_t {
+            auto it = params.find(name);
+            if (it == params.end()) {
+                return default_value;
+            }
+            // Only digits are accepted, values are passed to the database as signed 64-bit integers
+            const auto& text = it->second;
+            uint64_t value = 0;
+            const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (ec != std::errc{} || end != text.data() + text.size()
+                || value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+                throw server_exceptions::InvalidArgumentException("Invalid " + name + " value");
+            }
+            return static_cast<size_t>(value);
+        };
+
+        const auto start = read_param("start", 0);
+        const auto max_items = read_param("maxItems", MAX_RECORDS_ITEMS);
+        if (max_items > MAX_RECORDS_ITEMS) {
+            throw server_exceptions::InvalidArgumentException("maxItems can't be greater than " + std::to_string(MAX_RECORDS_ITEMS));
+        }
+
+        boost::json::array records_array;
+        if (records_repository_) {
+            for (const auto& record : records_repository_->GetRecords(start, max_items)) {
+                boost::json::object record_obj;
+                record_obj["name"] = record.name;
+                record_obj["score"] = record.score;
+                record_obj["playTime"] = std::chrono::duration<double>(record.play_time).count();
+                records_array.push_back(std::move(record_obj));
+            }
+        }
+        res = std::move(records_array);
+        status = http::status::ok;
+    } catch (const server_exceptions::BaseException& e) {
+        status = http::status::bad_request;
+        res = json_helper::CreateErrorValue(e.code(), e.message());
+    } catch (const std::exception& e) {
+        logger::LogErrorMessage(e.what());
+        status = http::status::internal_server_error;
+        res = json_helper::CreateErrorValue("internalError", "Records aren't available");
+    }
+    body += boost::json::serialize(res);
+
+    return true;
+}
+
+bool RequestHandlerStrategyApi::MakeGetTickStatsBody(const StringRequest& req, std::string& body, http::status& status) {
+    boost::json::value res;
+
+    try {
+        if (!tick_stats_) {
+            throw server_exceptions::InvalidEndpointException("Tick stats aren't collected");
+        }
+        // Reset on request, so that the next reading covers only the next load run
+        const auto params = GetQueryParams(std::string_view(req.target().data(), req.target().size()));
+        const auto reset_it = params.find("reset");
+        const bool reset = reset_it != params.end() && reset_it->second == "true";
+
+        res = json_helper::CreateTickStatsValue(tick_stats_->GetSnapshot(reset));
+        status = http::status::ok;
+    } catch (const server_exceptions::BaseException& e) {
+        status = http::status::bad_request;
+        res = json_helper::CreateErrorValue(e.code(), e.message());
+    }
+    body += boost::json::serialize(res);
+
+    return true;
+}
+
 bool RequestHandlerStrategyApi::MakeJoinGameBody(std::string_view request, std::string &body, http::status &status) {
     boost::json::object res;
 
@@ -464,6 +632,8 @@ bool RequestHandlerStrategyApi::MakeJoinGameBody(std::string_view request, std::
 
         auto token = game_.JoinGame(name, model::Map::Id{mapId}, randomize_spawn_point_);
         auto player = game_.FindPlayerByToken(token);
+        // Join may have opened a new session of the map
+        StartSessionTickers();
         res["authToken"] = *token;
         res["playerId"] = player.GetId();
         status = http::status::ok;
@@ -487,11 +657,13 @@ bool RequestHandlerStrategyApi::MakeMovePlayerBody(const StringRequest& req, std
 
     try {
         auto token = ReceiveTokenFromRequest(req);
-        auto player = game_.FindPlayerByToken(model::Token(std::string(token)));
-        auto direction = ReceiveDirectionFromRequest(req);
 
-        player.GetDog()->SetDirection(direction);
-        player.GetDog()->SetSpeedByDirection(direction);
+        game_.WithPlayer(model::Token(std::string(token)), [this, &req](const model::Player& player, model::GameShard&) {
+            auto direction = ReceiveDirectionFromRequest(req);
+            auto dog = player.GetDog();
+            dog.SetDirection(direction);
+            dog.SetSpeedByDirection(direction);
+        });
         
         status = http::status::ok;
     } catch (const server_exceptions::InvalidDirectionException& e) {
@@ -515,9 +687,9 @@ bool RequestHandlerStrategyApi::MakeUpdateTimeBody(const StringRequest &req, std
             throw server_exceptions::InvalidEndpointException("Invalid endpoint");
         }
         auto time = ReceiveTimeFromRequest(req);
-        for (auto& [map, session] : game_.GetMapToSession()) {
-            session->UpdateTime(time);
-        }
+        game_.ForEachShard([this, time](const model::GameShardPtr& shard) {
+            SaveRetiredDogs(TickShard(*shard, time));
+        });
         status = http::status::ok;
     } catch (const server_exceptions::BaseException& e) {
         status = http::status::bad_request;
@@ -554,7 +726,14 @@ StringResponse RequestHandlerStrategyStaticFile::MakeStringResponse(http::status
 }
 
 void RequestHandlerStrategyStaticFile::SetResponseData(const std::string_view &request, std::string &body, http::status &status, std::string_view &content_type) {
-    auto decoded_path = path_helper::GetDecodedPath(request);
+    fs::path decoded_path;
+    try {
+        decoded_path = path_helper::GetDecodedPath(request);
+    } catch (const std::invalid_argument&) {
+        MakeBadRequestBody(body, status);
+        content_type = ContentType::TEXT_PLAIN;
+        return;
+    }
     auto abs_path = path_helper::GetAbsPath(base_path_, decoded_path);
 
     std::ifstream fstream(abs_path);
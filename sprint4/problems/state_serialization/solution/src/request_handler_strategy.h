@@ -9,7 +9,9 @@
 #include "request_handler_helper.h"
 #include "model_utils.h"
 #include "ticker.h"
-#include "loot_generator.h"
+#include "records_repository.h"
+#include "records_writer.h"
+#include "tick_stats.h"
 
 namespace http_handler {
 
@@ -56,7 +58,10 @@ public:
                                 bool randomize_spawn_point = false, 
                                 int tick_period = 0, 
                                 const std::filesystem::path& state_file = "",
-                                int save_state_period = 0);
+                                int save_state_period = 0,
+                                records::RecordsRepository* records_repository = nullptr,
+                                records::RecordsWriter* records_writer = nullptr,
+                                bool collect_tick_stats = false);
 
     struct RequestTypeSize {
         RequestTypeSize() = delete;
@@ -67,6 +72,8 @@ public:
         constexpr static size_t JOIN_GAME = 4;
         constexpr static size_t UPDATE_TIME = 4;
         constexpr static size_t MOVE_PLAYER = 5;
+        constexpr static size_t GET_RECORDS = 4;
+        constexpr static size_t GET_TICK_STATS = 4;
     };
 
     enum class RequestType {
@@ -74,6 +81,8 @@ public:
         GET_MAP_BY_ID,
         GET_PLAYERS_ON_MAP,
         GET_GAME_STATE,
+        GET_RECORDS,
+        GET_TICK_STATS,
         JOIN_GAME,
         MOVE_PLAYER,
         UPDATE_TIME,
@@ -82,6 +91,11 @@ public:
 
     void TrySaveSessions();
 
+    // Records are read from the database, so they are handled off the API strand.
+    // Records handling doesn't touch the game and may be called from any thread
+    bool IsRecordsRequest(const StringRequest& req);
+    StringResponse HandleRecordsRequest(StringRequest&& req);
+
 protected:
     StringResponse HandleRequestImpl(
         StringRequest&& req, 
@@ -112,6 +126,8 @@ private:
     bool MakeGetMapByIdBody(model::Map::Id id, std::string& body, http::status& status);
     bool MakeGetPlayersOnMapBody(const StringRequest& req, std::string& body, http::status& status);
     bool MakeGetGameStateBody(const StringRequest& req, std::string& body, http::status& status);
+    bool MakeGetRecordsBody(const StringRequest& req, std::string& body, http::status& status);
+    bool MakeGetTickStatsBody(const StringRequest& req, std::string& body, http::status& status);
     
     // Post responses
     bool MakeJoinGameBody(std::string_view request, std::string& body, http::status& status);
@@ -123,21 +139,30 @@ private:
     std::chrono::milliseconds ReceiveTimeFromRequest(const StringRequest& req);
 
 private:
-    void UpdateTimeInSessions(std::chrono::milliseconds delta = 1000ms);
+    void StartSessionTickers();
+    void UpdateTimeInSession(const model::GameShardPtr& shard, std::chrono::milliseconds delta);
+    void SaveRetiredDogs(const std::vector<model::RetiredDog>& retired_dogs);
+    std::vector<model::RetiredDog> TickShard(model::GameShard& shard, std::chrono::milliseconds delta);
 
 private:
     model::Game& game_;
     Strand& strand_;
     std::chrono::milliseconds tick_period_;
     net::steady_timer timer_{strand_};
-    std::shared_ptr<Ticker> ticker_;
-    std::shared_ptr<loot_gen::LootGenerator> loot_generator_;
+    // Every session is ticked on its own strand, so sessions are updated in parallel.
+    // Accessed only from the API strand
+    std::unordered_map<model::GameShardPtr, std::shared_ptr<Ticker>> session_tickers_;
     bool ticker_started_;
     bool is_debug_mode_;
     bool randomize_spawn_point_;
     std::filesystem::path state_file_;
     std::chrono::milliseconds save_state_period_;
     bool save_before_close_;
+    // Records aren't kept, if the database isn't configured
+    records::RecordsRepository* records_repository_;
+    records::RecordsWriter* records_writer_;
+    // Tick times are collected only on demand, so ticks aren't slowed down by default
+    std::unique_ptr<metrics::TickStats> tick_stats_;
 };
 
 class RequestHandlerStrategyStaticFile : public RequestHandlerStrategyIntf {
@@ -0,0 +1,230 @@
+#include "sampling_profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <sstream>
+#include <stdexcept>
+#include <sys/time.h>
+#include <thread>
+#include <unordered_map>
+
+namespace profiler {
+
+namespace {
+
+constexpr size_t MAX_FRAMES = 48;
+constexpr size_t MAX_THREADS = 128;
+constexpr size_t SAMPLES_PER_THREAD = 256;
+// Frames of the signal handler and of the signal trampoline
+constexpr int SKIPPED_FRAMES = 2;
+
+struct Sample {
+    int depth = 0;
+    void* frames[MAX_FRAMES];
+};
+
+// Single producer (the sampled thread in the signal handler), single consumer (Drain) ring
+struct ThreadBuffer {
+    std::atomic<uint64_t> head{0};
+    std::atomic<uint64_t> tail{0};
+    Sample samples[SAMPLES_PER_THREAD];
+};
+
+// Signal handler state. Only lock-free atomics and initial-exec TLS are touched in the handler
+std::atomic<ThreadBuffer*> buffers{nullptr};
+std::atomic<uint32_t> generation{0};
+std::atomic<size_t> next_slot{0};
+std::atomic<uint64_t> dropped_samples{0};
+std::atomic<int> running_handlers{0};
+
+// Thread gets a new buffer slot in every profile
+thread_local uint32_t thread_generation __attribute__((tls_model("initial-exec"))) = 0;
+thread_local size_t thread_slot __attribute__((tls_model("initial-exec"))) = 0;
+
+void OnSigprof(int, siginfo_t*, void*) {
+    const int saved_errno = errno;
+    running_handlers.fetch_add(1);
+
+    if (auto* thread_buffers = buffers.load()) {
+        const auto current_generation = generation.load(std::memory_order_relaxed);
+        if (thread_generation != current_generation) {
+            thread_slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+            thread_generation = current_generation;
+        }
+
+        bool recorded = false;
+        if (thread_slot < MAX_THREADS) {
+            auto& buffer = thread_buffers[thread_slot];
+            const auto tail = buffer.tail.load(std::memory_order_relaxed);
+            if (tail - buffer.head.load(std::memory_order_acquire) < SAMPLES_PER_THREAD) {
+                auto& sample = buffer.samples[tail % SAMPLES_PER_THREAD];
+                sample.depth = backtrace(sample.frames, MAX_FRAMES);
+                buffer.tail.store(tail + 1, std::memory_order_release);
+                recorded = true;
+            }
+        }
+        if (!recorded) {
+            dropped_samples.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    running_handlers.fetch_sub(1);
+    errno = saved_errno;
+}
+
+void SetTimer(int frequency) {
+    itimerval timer{};
+    if (frequency > 0) {
+        timer.it_interval.tv_usec = 1'000'000 / frequency;
+        timer.it_value = timer.it_interval;
+    }
+    if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+        throw std::runtime_error(std::string("Profiler timer isn't set: ") + std::strerror(errno));
+    }
+}
+
+}  // namespace
+
+bool SamplingProfiler::Start(int frequency) {
+    if (frequency <= 0 || frequency > 1'000'000) {
+        throw std::invalid_argument("Profiler frequency is out of range");
+    }
+
+    std::lock_guard lock(mutex_);
+    if (running_) {
+        return false;
+    }
+
+    if (!handler_installed_) {
+        // The first backtrace call loads the unwinder, it mustn't happen in the signal handler
+        void* frames[1];
+        backtrace(frames, 1);
+
+        // Handler is never removed: SIGPROF that comes after the timer is stopped
+        // would terminate the process with the default action
+        struct sigaction action{};
+        action.sa_sigaction = OnSigprof;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        if (sigaction(SIGPROF, &action, nullptr) != 0) {
+            throw std::runtime_error(std::string("Profiler signal handler isn't set: ") + std::strerror(errno));
+        }
+        handler_installed_ = true;
+    }
+
+    stacks_.clear();
+    dropped_samples.store(0);
+    next_slot.store(0);
+    generation.fetch_add(1);
+    buffers.store(new ThreadBuffer[MAX_THREADS]);
+    SetTimer(frequency);
+    running_ = true;
+    return true;
+}
+
+void SamplingProfiler::Drain() {
+    std::lock_guard lock(mutex_);
+    if (running_) {
+        DrainImpl();
+    }
+}
+
+std::string SamplingProfiler::Stop() {
+    std::lock_guard lock(mutex_);
+    if (!running_) {
+        return {};
+    }
+
+    SetTimer(0);
+    DrainImpl();
+    // Handlers that have already taken the buffers finish before the buffers are freed
+    auto* thread_buffers = buffers.exchange(nullptr);
+    while (running_handlers.load() != 0) {
+        std::this_thread::yield();
+    }
+    delete[] thread_buffers;
+    running_ = false;
+
+    // Different addresses of one function make the same frame, so stacks are merged by names
+    std::unordered_map<void*, std::string> names;
+    std::map<std::string, uint64_t> collapsed;
+    for (const auto& [frames, count] : stacks_) {
+        std::string stack;
+        for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+            auto name_it = names.find(*it);
+            if (name_it == names.end()) {
+                name_it = names.emplace(*it, Symbolize(*it)).first;
+            }
+            if (!stack.empty()) {
+                stack += ';';
+            }
+            stack += name_it->second;
+        }
+        collapsed[stack] += count;
+    }
+    if (const auto dropped = dropped_samples.load()) {
+        collapsed["[dropped]"] += dropped;
+    }
+    stacks_.clear();
+
+    std::ostringstream out;
+    for (const auto& [stack, count] : collapsed) {
+        out << stack << ' ' << count << '\n';
+    }
+    return out.str();
+}
+
+void SamplingProfiler::DrainImpl() {
+    auto* thread_buffers = buffers.load();
+    const auto threads = std::min(next_slot.load(), MAX_THREADS);
+    for (size_t i = 0; i < threads; ++i) {
+        auto& buffer = thread_buffers[i];
+        const auto tail = buffer.tail.load(std::memory_order_acquire);
+        for (auto head = buffer.head.load(std::memory_order_relaxed); head != tail; ++head) {
+            const auto& sample = buffer.samples[head % SAMPLES_PER_THREAD];
+            if (sample.depth > SKIPPED_FRAMES) {
+                ++stacks_[std::vector<void*>(sample.frames + SKIPPED_FRAMES, sample.frames + sample.depth)];
+            }
+        }
+        buffer.head.store(tail, std::memory_order_release);
+    }
+}
+
+// Names need exported symbols, the executable is linked with -rdynamic for it
+std::string SamplingProfiler::Symbolize(void* address) {
+    Dl_info info{};
+    // Return address points after the call, the call itself is looked up
+    if (dladdr(static_cast<char*>(address) - 1, &info) == 0) {
+        std::ostringstream out;
+        out << address;
+        return out.str();
+    }
+    if (info.dli_sname) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        std::string name = status == 0 && demangled ? demangled : info.dli_sname;
+        std::free(demangled);
+        // Semicolons separate the frames of the collapsed stack
+        for (auto& c : name) {
+            if (c == ';') {
+                c = ',';
+            }
+        }
+        return name;
+    }
+
+    std::string module = info.dli_fname ? info.dli_fname : "??";
+    module = module.substr(module.find_last_of('/') + 1);
+    std::ostringstream out;
+    out << module << "+0x" << std::hex << (static_cast<char*>(address) - static_cast<char*>(info.dli_fbase));
+    return out.str();
+}
+
+}  // namespace profiler
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace profiler {
+
+// Samples stacks of all threads of the process by SIGPROF timer, which counts the CPU time
+// of the process. Nothing is installed until the first profile is started, so the profiler
+// costs nothing when it isn't used. Only one profile is taken at a time
+class SamplingProfiler {
+public:
+    constexpr static int DEFAULT_FREQUENCY = 99;
+    // Samples are moved from the thread buffers more often than the buffers are filled
+    constexpr static std::chrono::milliseconds DRAIN_PERIOD{100};
+
+    static SamplingProfiler& GetInstance() {
+        static SamplingProfiler instance;
+        return instance;
+    }
+
+    SamplingProfiler(const SamplingProfiler&) = delete;
+    SamplingProfiler& operator=(const SamplingProfiler&) = delete;
+
+    // Returns false, if the profile is already being taken
+    bool Start(int frequency = DEFAULT_FREQUENCY);
+    // Moves samples from the thread buffers to the profile, it's called every DRAIN_PERIOD while profiling
+    void Drain();
+    // Stops sampling and returns the collapsed stacks, one "root;...;leaf count" line per stack
+    std::string Stop();
+
+private:
+    SamplingProfiler() = default;
+
+    void DrainImpl();
+    std::string Symbolize(void* address);
+
+private:
+    std::mutex mutex_;
+    bool running_ = false;
+    bool handler_installed_ = false;
+    std::map<std::vector<void*>, uint64_t> stacks_;
+};
+
+}  // namespace profiler
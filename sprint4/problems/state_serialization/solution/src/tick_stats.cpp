@@ -0,0 +1,21 @@
+#include "tick_stats.h"
+
+#include <utility>
+
+namespace metrics {
+
+void TickStats::Record(std::chrono::steady_clock::duration tick_time) {
+    const auto value = std::chrono::duration_cast<LatencyHistogram::Duration>(tick_time);
+    std::lock_guard lock(mutex_);
+    histogram_.Record(value);
+}
+
+LatencyHistogram TickStats::GetSnapshot(bool reset) {
+    std::lock_guard lock(mutex_);
+    if (!reset) {
+        return histogram_;
+    }
+    return std::exchange(histogram_, LatencyHistogram{});
+}
+
+}  // namespace metrics
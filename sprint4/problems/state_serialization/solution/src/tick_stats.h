@@ -0,0 +1,22 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+
+#include "latency_histogram.h"
+
+namespace metrics {
+
+// Durations of session ticks. Sessions are ticked on different strands, so recording is thread-safe
+class TickStats {
+public:
+    void Record(std::chrono::steady_clock::duration tick_time);
+    // Returns ticks recorded since the previous reset
+    LatencyHistogram GetSnapshot(bool reset = false);
+
+private:
+    std::mutex mutex_;
+    LatencyHistogram histogram_;
+};
+
+}  // namespace metrics
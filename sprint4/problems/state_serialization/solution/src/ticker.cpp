@@ -9,6 +9,13 @@ void Ticker::Start() {
     ScheduleTick();
 }
 
+void Ticker::Stop() {
+    net::dispatch(strand_, [self = shared_from_this()] {
+        self->stopped_ = true;
+        self->timer_.cancel();
+    });
+}
+
 void Ticker::ScheduleTick() {
     timer_.expires_after(std::chrono::duration_cast<std::chrono::milliseconds>(period_));
     timer_.async_wait(
@@ -18,6 +25,10 @@ void Ticker::ScheduleTick() {
 }
 
 void Ticker::OnTick(sys::error_code ec) {
+    if (ec || stopped_) {
+        return;
+    }
+
     auto current_tick = std::chrono::steady_clock::now();
     handler_(std::chrono::duration_cast<std::chrono::milliseconds>(current_tick - last_tick_));
     last_tick_ = current_tick;
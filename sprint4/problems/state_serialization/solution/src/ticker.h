@@ -18,23 +18,26 @@ public:
     using Handler = std::function<void(std::chrono::milliseconds)>;
     using Strand = net::strand<net::io_context::executor_type>;
 
-    Ticker(Strand& strand, std::chrono::milliseconds period, Handler handler)
+    Ticker(Strand strand, std::chrono::milliseconds period, Handler handler)
         : strand_(strand)
         , period_(period)
         , handler_(handler) {}
 
     void Start();
+    // Ticker stops after the current tick, handler isn't called anymore
+    void Stop();
 
 private:
     void ScheduleTick();
     void OnTick(sys::error_code ec);
 
 private:
-    Strand& strand_;
+    Strand strand_;
     net::steady_timer timer_{strand_};
     std::chrono::milliseconds period_;
     Handler handler_;
     std::chrono::time_point<std::chrono::steady_clock> last_tick_;
+    bool stopped_ = false;
 }; 
 
 }
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+
+#include "../src/latency_histogram.h"
+#include "../src/tick_stats.h"
+#include "../load/scenario.h"
+
+using namespace std::literals;
+
+namespace {
+
+using Duration = metrics::LatencyHistogram::Duration;
+
+}  // namespace
+
+SCENARIO("Latency histogram") {
+    GIVEN("empty histogram") {
+        metrics::LatencyHistogram histogram;
+
+        THEN("percentiles are zero") {
+            CHECK(histogram.GetCount() == 0);
+            CHECK(histogram.GetPercentile(99.0) == Duration{0});
+            CHECK(histogram.GetMin() == Duration{0});
+        }
+
+        WHEN("small values are recorded") {
+            for (int i = 1; i <= 100; ++i) {
+                histogram.Record(Duration{i});
+            }
+
+            THEN("percentiles are exact") {
+                CHECK(histogram.GetCount() == 100);
+                CHECK(histogram.GetPercentile(50.0) == Duration{50});
+                CHECK(histogram.GetPercentile(99.0) == Duration{99});
+                CHECK(histogram.GetPercentile(100.0) == Duration{100});
+                CHECK(histogram.GetMin() == Duration{1});
+                CHECK(histogram.GetMean() == Duration{50});
+            }
+        }
+
+        WHEN("big values are recorded") {
+            for (int i = 1; i <= 1000; ++i) {
+                histogram.Record(Duration{i * 1000});
+            }
+
+            THEN("percentiles are within 1% and never exceed the maximum") {
+                for (double percentile : {50.0, 90.0, 99.0, 99.9}) {
+                    const double expected = percentile * 10'000.0;
+                    const double actual = static_cast<double>(histogram.GetPercentile(percentile).count());
+                    CHECK(actual >= expected);
+                    CHECK(actual <= expected * 1.01);
+                }
+                CHECK(histogram.GetPercentile(100.0) == Duration{1'000'000});
+            }
+        }
+
+        WHEN("histograms are merged") {
+            metrics::LatencyHistogram other;
+            histogram.Record(10ms);
+            other.Record(1ms);
+            other.Record(100ms);
+            histogram.Merge(other);
+
+            THEN("merged histogram has all values") {
+                CHECK(histogram.GetCount() == 3);
+                CHECK(histogram.GetMin() == 1ms);
+                CHECK(histogram.GetMax() == 100ms);
+            }
+        }
+    }
+}
+
+SCENARIO("Tick stats") {
+    GIVEN("recorded ticks") {
+        metrics::TickStats stats;
+        stats.Record(2ms);
+        stats.Record(4ms);
+
+        WHEN("stats are read without reset") {
+            const auto snapshot = stats.GetSnapshot();
+
+            THEN("ticks are kept") {
+                CHECK(snapshot.GetCount() == 2);
+                CHECK(snapshot.GetMax() == 4ms);
+                CHECK(stats.GetSnapshot().GetCount() == 2);
+            }
+        }
+
+        WHEN("stats are read with reset") {
+            const auto snapshot = stats.GetSnapshot(true);
+
+            THEN("next reading has only new ticks") {
+                CHECK(snapshot.GetCount() == 2);
+                stats.Record(1ms);
+                const auto next = stats.GetSnapshot(true);
+                CHECK(next.GetCount() == 1);
+                CHECK(next.GetMax() == 1ms);
+            }
+        }
+    }
+}
+
+SCENARIO("Load ammo and scenarios") {
+    GIVEN("ammo in the uri format") {
+        std::istringstream ammo(
+            "[Connection: close]\n"
+            "[Host: localhost]\n"
+            "/api/v1/maps\n"
+            "\n"
+            "/api/v1/maps/map1 map\n");
+
+        WHEN("ammo is parsed") {
+            const auto scenario = load::ParseAmmo(ammo);
+
+            THEN("every uri is repeated with the headers except connection") {
+                CHECK(scenario.setup.empty());
+                REQUIRE(scenario.loop.size() == 2);
+                CHECK(scenario.loop[1].target == "/api/v1/maps/map1"s);
+                CHECK(scenario.loop[1].method == boost::beast::http::verb::get);
+                REQUIRE(scenario.loop[0].headers.size() == 1);
+                CHECK(scenario.loop[0].headers[0].first == "Host"s);
+                CHECK(scenario.loop[0].headers[0].second == "localhost"s);
+            }
+        }
+    }
+
+    GIVEN("game scenario") {
+        std::istringstream script(
+            "# join once, then play\n"
+            "join map1 Rex\n"
+            "loop\n"
+            "action L\n"
+            "state\n");
+
+        WHEN("scenario is parsed") {
+            const auto scenario = load::ParseScenario(script);
+
+            THEN("join is the setup step") {
+                REQUIRE(scenario.setup.size() == 1);
+                CHECK(scenario.setup[0].joins);
+                CHECK(scenario.setup[0].target == "/api/v1/game/join"s);
+                REQUIRE(scenario.loop.size() == 2);
+                CHECK(scenario.loop[0].method == boost::beast::http::verb::post);
+                CHECK(scenario.loop[0].authorized);
+                CHECK(scenario.loop[1].target == "/api/v1/game/state"s);
+            }
+
+            THEN("virtual user joins once and repeats the loop from its own step") {
+                load::VirtualUser user(scenario, 1);
+                CHECK(user.NextRequest().joins);
+                CHECK(user.NextRequest().target == "/api/v1/game/state"s);
+                CHECK(user.NextRequest().target == "/api/v1/game/player/action"s);
+                CHECK(user.NextRequest().target == "/api/v1/game/state"s);
+
+                user.Restart();
+                CHECK(user.NextRequest().joins);
+            }
+        }
+    }
+
+    GIVEN("requests of bots") {
+        THEN("only join carries a token and only moves and polls need it") {
+            const auto join = load::MakeJoinRequest("map1"s, "bot1"s);
+            CHECK(join.joins);
+            CHECK_FALSE(join.authorized);
+            const auto action = load::MakeActionRequest(""s);
+            CHECK(action.authorized);
+            CHECK(action.method == boost::beast::http::verb::post);
+            const auto state = load::MakeStateRequest();
+            CHECK(state.authorized);
+            CHECK(state.target == "/api/v1/game/state"s);
+        }
+    }
+
+    GIVEN("wrong scripts") {
+        THEN("they are rejected") {
+            std::istringstream unknown("jump\n");
+            CHECK_THROWS_AS(load::ParseScenario(unknown), std::runtime_error);
+            std::istringstream bad_move("action X\n");
+            CHECK_THROWS_AS(load::ParseScenario(bad_move), std::runtime_error);
+            std::istringstream setup_only("join map1\nloop\n");
+            CHECK_THROWS_AS(load::ParseScenario(setup_only), std::runtime_error);
+            std::istringstream no_ammo("[Host: localhost]\n");
+            CHECK_THROWS_AS(load::ParseAmmo(no_ammo), std::runtime_error);
+        }
+    }
+}
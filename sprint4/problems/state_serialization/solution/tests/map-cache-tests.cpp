@@ -0,0 +1,122 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include "../src/map_cache.h"
+
+using namespace std::literals;
+
+namespace {
+
+void WriteFile(const std::filesystem::path& path, std::string_view content) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << content;
+}
+
+}  // namespace
+
+SCENARIO("Map cache") {
+
+    GIVEN("game with a built map and its config file") {
+        const model::Map::Id MAP_ID("cached_map");
+        const auto dir = std::filesystem::temp_directory_path();
+        const auto config_path = dir / "map_cache_test_config.json";
+        const auto cache_path = dir / "map_cache_test.bin";
+        WriteFile(config_path, R"({"maps": []})");
+        std::filesystem::remove(cache_path);
+
+        model::Game game;
+        game.SetLootGeneratorData(5, 0.5);
+        game.AddLootToMap(MAP_ID, boost::json::array{ boost::json::object{ {"name", "key"}, {"value", 10} } });
+        game.SetMaxPlayersPerSession(7);
+        {
+            model::Map map(MAP_ID, "cached");
+            map.AddRoad({model::Road::HORIZONTAL, {0, 0}, 40});
+            map.AddRoad({model::Road::VERTICAL, {40, 0}, 30});
+            map.AddBuilding(model::Building({{5, 5}, {10, 20}}));
+            map.AddOffice(model::Office(model::Office::Id("o0"), {40, 30}, {5, 0}));
+            map.SetSpeed(4.5);
+            map.SetBagCapacity(5);
+            game.AddMap(std::move(map));
+        }
+
+        WHEN("cache is saved and loaded back") {
+            REQUIRE(map_cache::SaveGame(game, cache_path, config_path));
+            auto loaded = map_cache::LoadGame(cache_path, config_path);
+
+            THEN("maps are restored with calculated boarders") {
+                REQUIRE(loaded.has_value());
+                CHECK(loaded->GetMaxPlayersPerSession() == 7);
+                REQUIRE(loaded->GetMaps()->size() == 1);
+
+                const auto& expected = game.GetMaps()->front();
+                const auto& map = loaded->GetMaps()->front();
+                CHECK(map.GetId() == MAP_ID);
+                CHECK(map.GetName() == expected.GetName());
+                CHECK(map.GetSpeed() == expected.GetSpeed());
+                CHECK(map.GetBagCapacity() == expected.GetBagCapacity());
+
+                REQUIRE(map.GetRoads().size() == expected.GetRoads().size());
+                for (size_t i = 0; i < map.GetRoads().size(); ++i) {
+                    CHECK(map.GetRoads()[i].GetEnd().x == expected.GetRoads()[i].GetEnd().x);
+                    CHECK(map.GetRoads()[i].GetEnd().y == expected.GetRoads()[i].GetEnd().y);
+                    CHECK(map.GetRoads()[i].IsVertical() == expected.GetRoads()[i].IsVertical());
+                    CHECK(map.GetRoadBoarders()[i].GetStartPoint().x == expected.GetRoadBoarders()[i].GetStartPoint().x);
+                    CHECK(map.GetRoadBoarders()[i].GetEndPoint().y == expected.GetRoadBoarders()[i].GetEndPoint().y);
+                }
+
+                REQUIRE(map.GetBuildings().size() == 1);
+                CHECK(map.GetBuildings().front().GetBounds().size.height == 20);
+                REQUIRE(map.GetOffices().size() == 1);
+                CHECK(*map.GetOffices().front().GetId() == "o0");
+                CHECK(map.GetOffices().front().GetOffset().dx == 5);
+            }
+
+            THEN("loot data is restored into the loaded game") {
+                REQUIRE(loaded.has_value());
+                const auto snapshot = loaded->GetMapsSnapshot();
+                CHECK(snapshot->extra_data.GetLootGeneratorData().period == 5);
+                CHECK(snapshot->extra_data.GetLootGeneratorData().probability == 0.5);
+                REQUIRE_NOTHROW(snapshot->extra_data.GetLootByMapId(MAP_ID));
+            }
+        }
+
+        WHEN("config is changed after the cache is saved") {
+            REQUIRE(map_cache::SaveGame(game, cache_path, config_path));
+            WriteFile(config_path, R"({"maps": [], "changed": true})");
+
+            THEN("cache isn't used") {
+                REQUIRE_FALSE(map_cache::LoadGame(cache_path, config_path).has_value());
+            }
+        }
+
+        WHEN("cache file is corrupted") {
+            REQUIRE(map_cache::SaveGame(game, cache_path, config_path));
+            {
+                std::fstream file(cache_path, std::ios::binary | std::ios::in | std::ios::out);
+                file.seekp(-1, std::ios::end);
+                file.put('\x7f');
+            }
+
+            THEN("cache isn't used") {
+                REQUIRE_FALSE(map_cache::LoadGame(cache_path, config_path).has_value());
+            }
+
+            THEN("loot data of the saved game is kept") {
+                REQUIRE_FALSE(map_cache::LoadGame(cache_path, config_path).has_value());
+                REQUIRE_NOTHROW(game.GetMapsSnapshot()->extra_data.GetLootByMapId(MAP_ID));
+            }
+        }
+
+        WHEN("there is no cache file") {
+            THEN("cache isn't used") {
+                REQUIRE_FALSE(map_cache::LoadGame(cache_path, config_path).has_value());
+            }
+        }
+
+        std::filesystem::remove(cache_path);
+        std::filesystem::remove(config_path);
+    }
+
+}
@@ -2,6 +2,9 @@
 
 #include "../src/game.h"
 
+#include <thread>
+#include <unordered_set>
+
 using namespace std::literals;
 
 SCENARIO("Lost object generation") { 
@@ -22,11 +25,12 @@ SCENARIO("Lost object generation") {
         // Game objects
         model::Map map_1(MAP_ID_1, MAP_NAME_1);
 
-        // Init extra data instance
-        model::ExtraData::GetInstance().SetLootGeneratorData(100, 0.5);
+        // Init extra data
+        model::ExtraData extra_data;
+        extra_data.SetLootGeneratorData(100, 0.5);
 
         // Create session with LOOT_SIZE
-        model::SessionPtr session = std::make_shared<model::GameSession>(map_1, LOOT_SIZE);
+        model::SessionPtr session = std::make_shared<model::GameSession>(map_1, extra_data, LOOT_SIZE);
 
         WHEN("there is no players on map") {
             THEN("before time updating number of lost objects is equal to zero") {
@@ -76,4 +80,396 @@ SCENARIO("Lost object generation") {
         }
     }
 
-}
\ No newline at end of file
+}
+
+SCENARIO("Sharded game registry") {
+
+    GIVEN("game with two maps") {
+        const model::Map::Id MAP_ID_1("shard_map_1");
+        const model::Map::Id MAP_ID_2("shard_map_2");
+        constexpr unsigned PLAYERS_PER_MAP = 100;
+
+        model::Game game;
+        game.SetLootGeneratorData(100, 0.5);
+        const boost::json::array loot{ boost::json::object{ {"name", "key"}, {"value", 10} } };
+        game.AddLootToMap(MAP_ID_1, loot);
+        game.AddLootToMap(MAP_ID_2, loot);
+        for (const auto& id : { MAP_ID_1, MAP_ID_2 }) {
+            model::Map map(id, *id);
+            map.AddRoad({model::Road::HORIZONTAL, {0, 0}, 10});
+            game.AddMap(std::move(map));
+        }
+
+        THEN("sessions are created at load") {
+            CHECK(game.FindSessions(MAP_ID_1).size() == 1);
+            CHECK(game.FindSessions(MAP_ID_2).size() == 1);
+            REQUIRE(game.FindSession(MAP_ID_1) != game.FindSession(MAP_ID_2));
+        }
+
+        WHEN("players join different maps concurrently") {
+            std::vector<model::Token> tokens_1, tokens_2;
+            {
+                std::jthread join_1([&] {
+                    for (unsigned i = 0; i < PLAYERS_PER_MAP; ++i) {
+                        tokens_1.push_back(game.JoinGame("player " + std::to_string(i), MAP_ID_1));
+                    }
+                });
+                std::jthread join_2([&] {
+                    for (unsigned i = 0; i < PLAYERS_PER_MAP; ++i) {
+                        tokens_2.push_back(game.JoinGame("player " + std::to_string(i), MAP_ID_2));
+                    }
+                });
+            }
+
+            THEN("every player gets unique id and is found on its map") {
+                std::unordered_set<uint32_t> ids;
+                for (const auto& token : tokens_1) {
+                    const auto player = game.FindPlayerByToken(token);
+                    CHECK(player.GetMapId() == MAP_ID_1);
+                    ids.insert(player.GetId());
+                }
+                for (const auto& token : tokens_2) {
+                    const auto player = game.FindPlayerByToken(token);
+                    CHECK(player.GetMapId() == MAP_ID_2);
+                    ids.insert(player.GetId());
+                }
+                CHECK(ids.size() == 2 * PLAYERS_PER_MAP);
+                CHECK(game.FindSession(MAP_ID_1)->GetPlayers().size() == PLAYERS_PER_MAP);
+                REQUIRE(game.FindSession(MAP_ID_2)->GetPlayers().size() == PLAYERS_PER_MAP);
+            }
+
+            THEN("joining again with the same name returns the same token") {
+                REQUIRE(game.JoinGame("player 0", MAP_ID_1) == tokens_1.front());
+            }
+        }
+    }
+
+}
+
+
+SCENARIO("Multiple sessions per map") {
+
+    GIVEN("game with limited number of players per session") {
+        const model::Map::Id MAP_ID("balanced_map");
+        constexpr size_t MAX_PLAYERS = 3;
+
+        model::Game game;
+        game.SetLootGeneratorData(100, 0.5);
+        game.AddLootToMap(MAP_ID, boost::json::array{ boost::json::object{ {"name", "key"}, {"value", 10} } });
+        game.SetMaxPlayersPerSession(MAX_PLAYERS);
+        model::Map map(MAP_ID, "balanced");
+        map.AddRoad({model::Road::HORIZONTAL, {0, 0}, 10});
+        game.AddMap(std::move(map));
+
+        WHEN("players don't fill one session") {
+            for (size_t i = 0; i < MAX_PLAYERS; ++i) {
+                game.JoinGame("player " + std::to_string(i), MAP_ID);
+            }
+
+            THEN("map has single session") {
+                REQUIRE(game.FindSessions(MAP_ID).size() == 1);
+            }
+        }
+
+        WHEN("more players join than fit into one session") {
+            std::vector<model::Token> tokens;
+            for (size_t i = 0; i < MAX_PLAYERS * 2 + 1; ++i) {
+                tokens.push_back(game.JoinGame("player " + std::to_string(i), MAP_ID));
+            }
+
+            THEN("new sessions are opened and none of them exceeds the limit") {
+                const auto sessions = game.FindSessions(MAP_ID);
+                REQUIRE(sessions.size() == 3);
+                for (const auto& session : sessions) {
+                    CHECK(session->GetPlayers().size() <= MAX_PLAYERS);
+                }
+            }
+
+            THEN("players of different sessions don't see each other") {
+                game.WithPlayer(tokens.front(), [&](const model::Player&, model::GameShard& shard) {
+                    CHECK(shard.GetPlayersCount() == MAX_PLAYERS);
+                });
+                game.WithPlayer(tokens.back(), [&](const model::Player&, model::GameShard& shard) {
+                    CHECK(shard.GetPlayersCount() == 1);
+                });
+            }
+
+            THEN("rejoin returns the token from the player's session") {
+                REQUIRE(game.JoinGame("player 4", MAP_ID) == tokens[4]);
+            }
+        }
+
+        WHEN("players join the map concurrently") {
+            constexpr size_t THREADS = 4;
+            constexpr size_t PLAYERS_PER_THREAD = 30;
+            std::vector<std::vector<model::Token>> tokens(THREADS);
+            {
+                std::vector<std::jthread> joins;
+                for (size_t t = 0; t < THREADS; ++t) {
+                    joins.emplace_back([&, t] {
+                        for (size_t i = 0; i < PLAYERS_PER_THREAD; ++i) {
+                            tokens[t].push_back(game.JoinGame("player " + std::to_string(t) + "-" + std::to_string(i), MAP_ID));
+                        }
+                    });
+                }
+            }
+
+            THEN("every player is found and no session exceeds the limit") {
+                std::unordered_set<uint32_t> ids;
+                for (const auto& thread_tokens : tokens) {
+                    for (const auto& token : thread_tokens) {
+                        ids.insert(game.FindPlayerByToken(token).GetId());
+                    }
+                }
+                CHECK(ids.size() == THREADS * PLAYERS_PER_THREAD);
+
+                size_t players = 0;
+                for (const auto& session : game.FindSessions(MAP_ID)) {
+                    CHECK(session->GetPlayers().size() <= MAX_PLAYERS);
+                    players += session->GetPlayers().size();
+                }
+                REQUIRE(players == THREADS * PLAYERS_PER_THREAD);
+            }
+        }
+    }
+
+}
+
+
+SCENARIO("Seeded sessions are replayable") {
+
+    GIVEN("two sessions of the same map with equal seeds") {
+        const model::Map::Id MAP_ID("seeded_map");
+        constexpr unsigned LOOT_SIZE = 5;
+        constexpr uint64_t SEED = 2024;
+        constexpr std::chrono::milliseconds DELTA = 1000ms;
+
+        model::ExtraData extra_data;
+        extra_data.SetLootGeneratorData(100, 0.5);
+
+        model::Map map(MAP_ID, "seeded");
+        map.AddRoad({model::Road::HORIZONTAL, {0, 0}, 40});
+        map.AddRoad({model::Road::VERTICAL, {40, 0}, 40});
+
+        model::GameSession session_1(map, extra_data, LOOT_SIZE, SEED);
+        model::GameSession session_2(map, extra_data, LOOT_SIZE, SEED);
+
+        WHEN("same players join and time passes") {
+            for (uint32_t id = 0; id < 10; ++id) {
+                const auto name = "player " + std::to_string(id);
+                CHECK(session_1.AddDog(session_1.GetRandomPosition(), name, id).GetPosition().x
+                    == session_2.AddDog(session_2.GetRandomPosition(), name, id).GetPosition().x);
+            }
+            for (int tick = 0; tick < 5; ++tick) {
+                session_1.UpdateTime(DELTA);
+                session_2.UpdateTime(DELTA);
+            }
+
+            THEN("sessions generate the same loot") {
+                const auto& loot_1 = session_1.GetAvailableLoot();
+                const auto& loot_2 = session_2.GetAvailableLoot();
+                REQUIRE(loot_1.size() == loot_2.size());
+                for (const auto& [id, item] : loot_1) {
+                    REQUIRE(loot_2.contains(id));
+                    CHECK(item.type == loot_2.at(id).type);
+                    CHECK(item.type < LOOT_SIZE);
+                    CHECK(item.position.x == loot_2.at(id).position.x);
+                    CHECK(item.position.y == loot_2.at(id).position.y);
+                }
+            }
+        }
+    }
+
+    GIVEN("map without roads") {
+        model::Map map(model::Map::Id("empty_map"), "empty");
+        model::RandomGenerator random(1);
+
+        THEN("random position is the origin") {
+            const auto position = map.GetRandomPosition(random);
+            CHECK(position.x == 0.0);
+            REQUIRE(position.y == 0.0);
+        }
+    }
+
+}
+
+
+SCENARIO("Maps reload") {
+
+    GIVEN("game with a player on the map") {
+        const model::Map::Id MAP_ID("reloaded_map");
+        const model::Map::Id OTHER_MAP_ID("other_reloaded_map");
+
+        // Configs differ by the number of loot types
+        const auto add_loot = [&](model::Game& game, size_t loot_types) {
+            boost::json::array loot;
+            for (size_t i = 0; i < loot_types; ++i) {
+                loot.push_back(boost::json::object{ {"name", "key"}, {"value", 10} });
+            }
+            game.SetLootGeneratorData(100, 0.5);
+            game.AddLootToMap(MAP_ID, loot);
+            game.AddLootToMap(OTHER_MAP_ID, loot);
+        };
+
+        const auto make_map = [](const model::Map::Id& id, int length) {
+            model::Map map(id, *id);
+            map.AddRoad({model::Road::HORIZONTAL, {0, 0}, length});
+            return map;
+        };
+
+        model::Game game;
+        add_loot(game, 1);
+        game.AddMap(make_map(MAP_ID, 10));
+        const auto old_token = game.JoinGame("old player", MAP_ID);
+        const auto old_session = game.FindSession(MAP_ID);
+        const auto old_map = game.FindMap(MAP_ID);
+
+        WHEN("maps are reloaded from a new config") {
+            const auto old_snapshot = game.GetMapsSnapshot();
+            model::Game loaded;
+            add_loot(loaded, 2);
+            loaded.AddMap(make_map(MAP_ID, 50));
+            loaded.AddMap(make_map(OTHER_MAP_ID, 20));
+            game.ReloadMaps(std::move(loaded));
+
+            THEN("new maps are published") {
+                CHECK(game.GetMaps()->size() == 2);
+                REQUIRE(game.FindMap(MAP_ID)->GetRoads().front().GetEnd().x == 50);
+            }
+
+            THEN("loot data is published with the maps") {
+                CHECK(game.GetMapsSnapshot()->extra_data.GetLootByMapId(MAP_ID).size() == 2);
+                REQUIRE(old_snapshot->extra_data.GetLootByMapId(MAP_ID).size() == 1);
+            }
+
+            THEN("old map is kept alive for its session") {
+                REQUIRE(old_map->GetRoads().front().GetEnd().x == 10);
+            }
+
+            THEN("existing player stays in the old session") {
+                game.WithPlayer(old_token, [&](const model::Player& player, model::GameShard& shard) {
+                    CHECK(player.GetName() == "old player");
+                    CHECK(shard.GetSession() == old_session);
+                });
+                REQUIRE_NOTHROW(old_session->UpdateTime(100ms));
+            }
+
+            THEN("new player joins the session of the new map") {
+                const auto token = game.JoinGame("new player", MAP_ID);
+                game.WithPlayer(token, [&](const model::Player&, model::GameShard& shard) {
+                    CHECK(shard.GetSession() != old_session);
+                    CHECK(shard.GetMap().GetRoads().front().GetEnd().x == 50);
+                });
+                REQUIRE(game.FindSessions(MAP_ID).size() == 1);
+            }
+        }
+
+        WHEN("map is removed from the config") {
+            model::Game loaded;
+            add_loot(loaded, 1);
+            loaded.AddMap(make_map(OTHER_MAP_ID, 20));
+            game.ReloadMaps(std::move(loaded));
+
+            THEN("nobody can join it") {
+                CHECK(game.FindMap(MAP_ID) == nullptr);
+                REQUIRE_THROWS_AS(game.JoinGame("new player", MAP_ID), server_exceptions::InvalidMapException);
+            }
+
+            THEN("its players are still found") {
+                REQUIRE(game.FindPlayerByToken(old_token).GetName() == "old player");
+            }
+        }
+    }
+
+}
+
+SCENARIO("Idle dogs retirement") {
+
+    GIVEN("game with short dog retirement time") {
+        using namespace std::chrono_literals;
+        const model::Map::Id MAP_ID("retirement_map");
+        constexpr auto RETIREMENT_TIME = 1000ms;
+
+        model::Game game;
+        game.SetLootGeneratorData(100, 0.0);
+        game.AddLootToMap(MAP_ID, boost::json::array{ boost::json::object{ {"name", "key"}, {"value", 10} } });
+        game.SetMaxPlayersPerSession(1);
+        game.SetDogRetirementTime(RETIREMENT_TIME);
+        model::Map map(MAP_ID, "retirement");
+        map.SetSpeed(1.0);
+        map.AddRoad({model::Road::HORIZONTAL, {0, 0}, 10});
+        game.AddMap(std::move(map));
+
+        const auto token = game.JoinGame("idle", MAP_ID);
+        const auto shard = game.GetShards().front();
+
+        WHEN("dog stands still less than the retirement time") {
+            const auto retired = game.Tick(*shard, RETIREMENT_TIME - 1ms);
+
+            THEN("dog keeps playing") {
+                REQUIRE(retired.empty());
+                REQUIRE(game.FindPlayerByToken(token).GetName() == "idle");
+            }
+        }
+
+        WHEN("dog moves and stops") {
+            game.WithPlayer(token, [](const model::Player& player, model::GameShard&) {
+                player.GetDog().SetSpeedByDirection(model::Direction::EAST);
+            });
+            game.Tick(*shard, RETIREMENT_TIME - 1ms);
+            game.WithPlayer(token, [](const model::Player& player, model::GameShard&) {
+                player.GetDog().SetSpeedByDirection(model::Direction::NO_DIRECTION);
+            });
+
+            THEN("idle time starts from the stop") {
+                REQUIRE(game.Tick(*shard, RETIREMENT_TIME - 1ms).empty());
+                const auto retired = game.Tick(*shard, 1ms);
+                REQUIRE(retired.size() == 1);
+                CHECK(retired.front().play_time == RETIREMENT_TIME * 2 - 1ms);
+            }
+        }
+
+        WHEN("dog stands still for the retirement time") {
+            const auto retired = game.Tick(*shard, RETIREMENT_TIME + 500ms);
+
+            THEN("dog is retired with the play time up to the retirement moment") {
+                REQUIRE(retired.size() == 1);
+                CHECK(retired.front().name == "idle");
+                CHECK(retired.front().score == 0);
+                CHECK(retired.front().play_time == RETIREMENT_TIME);
+            }
+
+            THEN("player token isn't valid anymore") {
+                REQUIRE_THROWS_AS(game.FindPlayerByToken(token), server_exceptions::UnknownTokenException);
+                REQUIRE(shard->GetSession()->GetPlayers().empty());
+            }
+
+            THEN("last session of the map stays and reuses the dog slot") {
+                REQUIRE_FALSE(shard->IsEvicted());
+                const auto new_token = game.JoinGame("newcomer", MAP_ID);
+                REQUIRE(game.FindSessions(MAP_ID).size() == 1);
+                REQUIRE(game.FindPlayerByToken(new_token).GetDog().GetFullName() == "newcomer");
+                REQUIRE(shard->GetSession()->GetDogs().Size() == 1);
+            }
+        }
+
+        WHEN("extra session of the map becomes empty") {
+            const auto extra_token = game.JoinGame("extra", MAP_ID);
+            REQUIRE(game.GetShards().size() == 2);
+            const auto extra_shard = game.GetShards().back();
+
+            game.WithPlayer(token, [](const model::Player& player, model::GameShard&) {
+                player.GetDog().SetSpeedByDirection(model::Direction::EAST);
+            });
+            game.Tick(*extra_shard, RETIREMENT_TIME);
+
+            THEN("extra session is evicted") {
+                REQUIRE_THROWS_AS(game.FindPlayerByToken(extra_token), server_exceptions::UnknownTokenException);
+                REQUIRE(extra_shard->IsEvicted());
+                REQUIRE(game.GetShards().size() == 1);
+                REQUIRE(game.FindSessions(MAP_ID).size() == 1);
+            }
+        }
+    }
+
+}
@@ -0,0 +1,69 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "../src/sampling_profiler.h"
+
+using namespace std::literals;
+
+// Exported, so that the profiler finds its name
+double BurnProfilerTestCpu(std::chrono::milliseconds duration) {
+    const auto deadline = std::chrono::steady_clock::now() + duration;
+    volatile double sum = 0.0;
+    while (std::chrono::steady_clock::now() < deadline) {
+        for (int i = 0; i < 1000; ++i) {
+            sum = sum + i * 0.5;
+        }
+    }
+    return sum;
+}
+
+SCENARIO("Sampling profiler") {
+    auto& profiler = profiler::SamplingProfiler::GetInstance();
+
+    GIVEN("started profiler") {
+        REQUIRE(profiler.Start(1000));
+
+        THEN("the second profile isn't started") {
+            CHECK_FALSE(profiler.Start());
+            profiler.Stop();
+        }
+
+        WHEN("threads burn the CPU") {
+            std::thread worker([] {
+                BurnProfilerTestCpu(200ms);
+            });
+            BurnProfilerTestCpu(200ms);
+            profiler.Drain();
+            worker.join();
+            const auto profile = profiler.Stop();
+
+            THEN("stacks are collapsed with counts") {
+                REQUIRE_FALSE(profile.empty());
+                CHECK(profile.find("BurnProfilerTestCpu") != std::string::npos);
+
+                std::istringstream lines(profile);
+                std::string line;
+                while (std::getline(lines, line)) {
+                    const auto space = line.rfind(' ');
+                    REQUIRE(space != std::string::npos);
+                    CHECK(std::stoull(line.substr(space + 1)) > 0);
+                }
+            }
+
+            THEN("the next profile starts empty") {
+                REQUIRE(profiler.Start());
+                CHECK(profiler.Stop().find("BurnProfilerTestCpu") == std::string::npos);
+            }
+        }
+    }
+
+    GIVEN("stopped profiler") {
+        THEN("stop returns nothing") {
+            CHECK(profiler.Stop().empty());
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "../src/url_decoder.h"
+#include "../src/path_helper.h"
+#include "../src/request_handler_strategy.h"
+
+using namespace std::literals;
+
+SCENARIO("URL decoder for paths") {
+    GIVEN("encoded paths") {
+        THEN("escapes are decoded and plus is kept") {
+            CHECK(url::Decode("/images/a%20b+c.png"sv, url::Plus::KEEP) == "/images/a b+c.png"s);
+            CHECK(url::Decode("/%D0%BA%D0%BE%D1%82.html"sv, url::Plus::KEEP) == "/\xD0\xBA\xD0\xBE\xD1\x82.html"s);
+            CHECK(url::Decode("/index.html"sv, url::Plus::KEEP) == "/index.html"s);
+            CHECK(url::Decode("%2e%2E/%2F"sv, url::Plus::KEEP) == "..//"s);
+        }
+
+        THEN("plus is a space in query strings") {
+            CHECK(url::Decode("a+b%2Bc"sv, url::Plus::AS_SPACE) == "a b+c"s);
+        }
+    }
+
+    GIVEN("broken escapes") {
+        THEN("decoding fails without reading past the end") {
+            for (const auto str : {"%"sv, "/a%"sv, "/a%2"sv, "/a%g0"sv, "/a%0g"sv, "/aaaaaaaaaaaaaaaaaaaa%2"sv}) {
+                CHECK_THROWS_AS(url::Decode(str, url::Plus::KEEP), std::invalid_argument);
+                std::string out = "kept"s;
+                CHECK_FALSE(url::DecodeTo(str, out, url::Plus::KEEP));
+                CHECK(out.starts_with("kept"sv));
+            }
+            // Escape split from the rest of a long string by the 16 byte scan
+            CHECK_THROWS_AS(url::Decode(std::string(15, 'a') + "%4"s, url::Plus::KEEP), std::invalid_argument);
+        }
+    }
+
+    GIVEN("long string") {
+        std::string str;
+        std::string expected;
+        for (int i = 0; i < 100; ++i) {
+            str += "abcdefghijklmnopqrs%41"s;
+            expected += "abcdefghijklmnopqrsA"s;
+        }
+
+        THEN("escapes are found in every 16 byte chunk") {
+            CHECK(url::Decode(str, url::Plus::KEEP) == expected);
+        }
+    }
+}
+
+SCENARIO("Decoding of static file paths in the server") {
+    GIVEN("static file handler with index.html") {
+        const auto root = std::filesystem::temp_directory_path() / "url_decoder_static_root";
+        std::filesystem::create_directories(root);
+        std::ofstream(root / "index.html") << "<html></html>";
+
+        http_handler::RequestHandlerStrategyStaticFile handler(std::filesystem::weakly_canonical(root));
+        const auto get = [&handler](std::string_view target) {
+            return handler.HandleRequest(http_handler::StringRequest{http_handler::http::verb::get, target, 11});
+        };
+
+        THEN("broken escapes and null characters are rejected by the path decoder") {
+            CHECK_THROWS_AS(path_helper::GetDecodedPath("/index.html%4"sv), std::invalid_argument);
+            CHECK_THROWS_AS(path_helper::GetDecodedPath("/%zz.html"sv), std::invalid_argument);
+            CHECK_THROWS_AS(path_helper::GetDecodedPath("/index.html%00.png"sv), std::invalid_argument);
+            CHECK(path_helper::GetDecodedPath("/%69ndex.html"sv) == std::filesystem::path("index.html"));
+        }
+
+        THEN("they give bad request, not not found or internal error") {
+            for (const auto target : {"/index.html%4"sv, "/%4"sv, "/%zz.html"sv, "/index.html%00.png"sv, "/%00"sv}) {
+                INFO(target);
+                CHECK(get(target).result() == http_handler::http::status::bad_request);
+            }
+        }
+
+        THEN("valid escapes are decoded to the file") {
+            CHECK(get("/%69ndex.html"sv).result() == http_handler::http::status::ok);
+            REQUIRE(get("/index.html"sv).body() == "<html></html>");
+        }
+
+        std::filesystem::remove_all(root);
+    }
+}